@@ -0,0 +1,133 @@
+#include "SimBluetooth.h"
+#include "SimClock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+SimBluetooth simBluetooth;
+
+SimBluetooth::SimBluetooth() {
+    scriptIndex = 0;
+    connected = false;
+    echo = true;
+    atLineStart = true;
+    linesTyped = 0;
+    bytesSent = 0;
+}
+
+bool SimBluetooth::loadScript(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        char* end = line + strlen(line);
+        while (end > line && (end[-1] == '\n' || end[-1] == '\r')) {
+            *--end = 0;
+        }
+        char* text = line;
+        while (*text == ' ' || *text == '\t') {
+            text++;
+        }
+        if (*text == 0 || *text == '#') {
+            continue;
+        }
+        char* rest = nullptr;
+        double seconds = strtod(text, &rest);
+        if (*rest == ' ' || *rest == '\t') {
+            rest++;
+        }
+        Entry entry;
+        entry.at = (uint64_t)llround(seconds * 1000000.0);
+        entry.text = rest;
+        script.push_back(entry);
+    }
+    fclose(file);
+    return true;
+}
+
+void SimBluetooth::setEcho(bool echo) {
+    this->echo = echo;
+}
+
+bool SimBluetooth::hasClient() {
+    pump();
+    return connected;
+}
+
+int SimBluetooth::available() {
+    pump();
+    return connected ? (int)typed.size() : 0;
+}
+
+int SimBluetooth::read() {
+    pump();
+    if (!connected || typed.empty()) {
+        return -1;
+    }
+    char c = typed.front();
+    typed.pop_front();
+    return (unsigned char)c;
+}
+
+int SimBluetooth::peek() {
+    pump();
+    return connected && !typed.empty() ? (unsigned char)typed.front() : -1;
+}
+
+void SimBluetooth::send(const uint8_t* buffer, size_t size) {
+    if (!connected) {
+        return;
+    }
+    bytesSent += size;
+    if (!echo) {
+        return;
+    }
+    for (size_t i = 0; i < size; i++) {
+        char c = (char)buffer[i];
+        if (c == '\r') {
+            continue;
+        }
+        if (atLineStart) {
+            fputs("bt> ", stdout);
+            atLineStart = false;
+        }
+        fputc(c, stdout);
+        if (c == '\n') {
+            atLineStart = true;
+        }
+    }
+}
+
+uint64_t SimBluetooth::getLinesTyped() {
+    return linesTyped;
+}
+
+uint64_t SimBluetooth::getBytesSent() {
+    return bytesSent;
+}
+
+void SimBluetooth::pump() {
+    uint64_t now = simClock.now();
+    while (scriptIndex < script.size() && script[scriptIndex].at <= now) {
+        const std::string& text = script[scriptIndex++].text;
+        if (text == "!connect") {
+            connected = true;
+        } else if (text == "!disconnect") {
+            connected = false;
+            typed.clear();
+        } else {
+            connected = true;
+            if (echo) {
+                // Keep the typed line apart from a prompt still open
+                printf("%sbt< %s\n", atLineStart ? "" : "\n", text.c_str());
+                atLineStart = true;
+            }
+            typed.insert(typed.end(), text.begin(), text.end());
+            typed.push_back('\r');
+            linesTyped++;
+        }
+    }
+}
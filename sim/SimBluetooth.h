@@ -0,0 +1,49 @@
+#ifndef SIM_BLUETOOTH_H
+#define SIM_BLUETOOTH_H
+
+#include <stdint.h>
+#include <string>
+#include <deque>
+#include <vector>
+
+// A scripted Bluetooth terminal. Script lines are "<seconds> <text>": the
+// text is typed followed by Enter at that virtual time, connecting first
+// if needed; "!connect" and "!disconnect" change the link alone. Whatever
+// the firmware sends back is echoed to stdout prefixed with "bt> ".
+class SimBluetooth {
+public:
+    SimBluetooth();
+
+    bool loadScript(const char* path);
+    void setEcho(bool echo);
+
+    bool hasClient();
+    int available();
+    int read();
+    int peek();
+    void send(const uint8_t* buffer, size_t size);
+
+    uint64_t getLinesTyped();
+    uint64_t getBytesSent();
+
+private:
+    struct Entry {
+        uint64_t at;
+        std::string text;
+    };
+
+    std::vector<Entry> script;
+    size_t scriptIndex;
+    bool connected;
+    bool echo;
+    bool atLineStart;
+    std::deque<char> typed;
+    uint64_t linesTyped;
+    uint64_t bytesSent;
+
+    void pump();
+};
+
+extern SimBluetooth simBluetooth;
+
+#endif
@@ -0,0 +1,103 @@
+#include "SimClock.h"
+#include <algorithm>
+
+SimClock simClock;
+
+SimClock::SimClock() {
+    nowMicros = 0;
+    loopQuantum = 1;
+    timerEvents = 0;
+    dispatching = false;
+}
+
+SimClock::~SimClock() {
+    for (SimTimer* timer : timers) {
+        delete timer;
+    }
+}
+
+uint64_t SimClock::now() {
+    return nowMicros;
+}
+
+void SimClock::advanceBy(uint64_t micros) {
+    advanceTo(nowMicros + micros);
+}
+
+void SimClock::advanceTo(uint64_t micros) {
+    if (dispatching) {
+        // A wait inside a timer callback only moves the clock
+        if (micros > nowMicros) {
+            nowMicros = micros;
+        }
+        return;
+    }
+    SimTimer* timer = nextDue(micros);
+    while (timer) {
+        if (timer->dueAt > nowMicros) {
+            nowMicros = timer->dueAt;
+        }
+        if (timer->period > 0) {
+            timer->dueAt += timer->period;
+        } else {
+            timer->armed = false;
+        }
+        dispatching = true;
+        timer->callback(timer->arg);
+        dispatching = false;
+        timerEvents++;
+        timer = nextDue(micros);
+    }
+    if (micros > nowMicros) {
+        nowMicros = micros;
+    }
+}
+
+void SimClock::setLoopQuantum(uint32_t millis) {
+    loopQuantum = millis > 0 ? millis : 1;
+}
+
+uint32_t SimClock::getLoopQuantum() {
+    return loopQuantum;
+}
+
+SimTimer* SimClock::createTimer(esp_timer_cb_t callback, void* arg) {
+    SimTimer* timer = new SimTimer();
+    timer->callback = callback;
+    timer->arg = arg;
+    timer->armed = false;
+    timer->dueAt = 0;
+    timer->period = 0;
+    timers.push_back(timer);
+    return timer;
+}
+
+void SimClock::startTimer(SimTimer* timer, uint64_t timeoutMicros, uint64_t period) {
+    timer->armed = true;
+    timer->dueAt = nowMicros + timeoutMicros;
+    timer->period = period;
+}
+
+void SimClock::stopTimer(SimTimer* timer) {
+    timer->armed = false;
+}
+
+void SimClock::deleteTimer(SimTimer* timer) {
+    timers.erase(std::remove(timers.begin(), timers.end(), timer), timers.end());
+    delete timer;
+}
+
+uint64_t SimClock::getTimerEvents() {
+    return timerEvents;
+}
+
+SimTimer* SimClock::nextDue(uint64_t limit) {
+    // Earliest first; ties go to the timer created first
+    SimTimer* result = nullptr;
+    for (SimTimer* timer : timers) {
+        if (timer->armed && timer->dueAt <= limit && (!result || timer->dueAt < result->dueAt)) {
+            result = timer;
+        }
+    }
+    return result;
+}
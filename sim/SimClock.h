@@ -0,0 +1,51 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+#include <vector>
+#include "esp_timer.h"
+
+struct SimTimer {
+    esp_timer_cb_t callback;
+    void* arg;
+    bool armed;
+    uint64_t dueAt;
+    uint64_t period; // 0 for one-shot
+};
+
+// Virtual microsecond clock shared by everything in the simulator. Time
+// only moves when the firmware waits (delay(), vTaskDelay()); timers due on
+// the way fire in order, each at exactly its own expiry time.
+class SimClock {
+public:
+    SimClock();
+    ~SimClock();
+
+    uint64_t now();
+    void advanceBy(uint64_t micros);
+    void advanceTo(uint64_t micros);
+
+    // vTaskDelay() waits at least this long, so loop() need not run every
+    // millisecond of a multi-day run
+    void setLoopQuantum(uint32_t millis);
+    uint32_t getLoopQuantum();
+
+    SimTimer* createTimer(esp_timer_cb_t callback, void* arg);
+    void startTimer(SimTimer* timer, uint64_t timeoutMicros, uint64_t period);
+    void stopTimer(SimTimer* timer);
+    void deleteTimer(SimTimer* timer);
+    uint64_t getTimerEvents();
+
+private:
+    uint64_t nowMicros;
+    uint32_t loopQuantum;
+    std::vector<SimTimer*> timers;
+    uint64_t timerEvents;
+    bool dispatching;
+
+    SimTimer* nextDue(uint64_t limit);
+};
+
+extern SimClock simClock;
+
+#endif
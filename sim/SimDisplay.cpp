@@ -0,0 +1,20 @@
+#include "SimDisplay.h"
+
+SimDisplay simDisplay;
+
+SimDisplay::SimDisplay() {
+    frames = 0;
+}
+
+void SimDisplay::present(const std::vector<std::string>& rows) {
+    frames++;
+    lastFrame = rows;
+}
+
+uint64_t SimDisplay::getFrames() {
+    return frames;
+}
+
+std::vector<std::string> SimDisplay::getLastFrame() {
+    return lastFrame;
+}
@@ -0,0 +1,25 @@
+#ifndef SIM_DISPLAY_H
+#define SIM_DISPLAY_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// What the OLED shows, as text. Each display() call presents one frame of
+// character rows; the last frame and a count are kept for the report.
+class SimDisplay {
+public:
+    SimDisplay();
+
+    void present(const std::vector<std::string>& rows);
+    uint64_t getFrames();
+    std::vector<std::string> getLastFrame();
+
+private:
+    uint64_t frames;
+    std::vector<std::string> lastFrame;
+};
+
+extern SimDisplay simDisplay;
+
+#endif
@@ -0,0 +1,150 @@
+#include "SimFlash.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+SimFlash simFlash;
+
+SimFlash::SimFlash() {
+    // Usable space of the default 1.5 MB SPIFFS partition
+    capacity = 1374476;
+    writeFailures = 0;
+}
+
+void SimFlash::setCapacity(size_t bytes) {
+    capacity = bytes;
+}
+
+size_t SimFlash::getCapacity() {
+    return capacity;
+}
+
+size_t SimFlash::getUsedBytes() {
+    size_t used = 0;
+    for (auto& entry : files) {
+        used += pagesFor(entry.second->size()) * PAGE_SIZE;
+    }
+    return used;
+}
+
+size_t SimFlash::getFileCount() {
+    return files.size();
+}
+
+uint32_t SimFlash::getWriteFailures() {
+    return writeFailures;
+}
+
+bool SimFlash::exists(const std::string& path) {
+    return files.count(path) > 0 || isDirectory(path);
+}
+
+bool SimFlash::isDirectory(const std::string& path) {
+    std::string prefix = path.empty() || path.back() != '/' ? path + "/" : path;
+    auto next = files.lower_bound(prefix);
+    return next != files.end() && next->first.compare(0, prefix.size(), prefix) == 0;
+}
+
+std::shared_ptr<std::string> SimFlash::open(const std::string& path, bool create) {
+    auto found = files.find(path);
+    if (found != files.end()) {
+        return found->second;
+    }
+    if (!create || !reserve(path, 0)) {
+        return nullptr;
+    }
+    std::shared_ptr<std::string> data = std::make_shared<std::string>();
+    files[path] = data;
+    return data;
+}
+
+bool SimFlash::remove(const std::string& path) {
+    return files.erase(path) > 0;
+}
+
+bool SimFlash::rename(const std::string& from, const std::string& to) {
+    auto found = files.find(from);
+    if (found == files.end() || files.count(to) > 0) {
+        return false;
+    }
+    files[to] = found->second;
+    files.erase(found);
+    return true;
+}
+
+std::vector<std::string> SimFlash::list(const std::string& directory) {
+    std::string prefix = directory.empty() || directory.back() != '/' ? directory + "/" : directory;
+    std::vector<std::string> paths;
+    for (auto next = files.lower_bound(prefix); next != files.end(); ++next) {
+        if (next->first.compare(0, prefix.size(), prefix) != 0) {
+            break;
+        }
+        paths.push_back(next->first);
+    }
+    return paths;
+}
+
+bool SimFlash::reserve(const std::string& path, size_t growth) {
+    auto found = files.find(path);
+    size_t current = found != files.end() ? found->second->size() : 0;
+    size_t extraPages = pagesFor(current + growth) - (found != files.end() ? pagesFor(current) : 0);
+    if (getUsedBytes() + extraPages * PAGE_SIZE > capacity) {
+        writeFailures++;
+        return false;
+    }
+    return true;
+}
+
+void SimFlash::format() {
+    files.clear();
+}
+
+bool SimFlash::dump(const char* directory) {
+    ::mkdir(directory, 0755);
+    bool ok = true;
+    for (auto& entry : files) {
+        // Flatten "/logs/3.log" to "logs_3.log"
+        std::string name = entry.first.substr(entry.first[0] == '/' ? 1 : 0);
+        for (char& c : name) {
+            if (c == '/') {
+                c = '_';
+            }
+        }
+        std::string hostPath = std::string(directory) + "/" + name;
+        FILE* file = fopen(hostPath.c_str(), "wb");
+        if (!file) {
+            ok = false;
+            continue;
+        }
+        fwrite(entry.second->data(), 1, entry.second->size(), file);
+        fclose(file);
+    }
+    return ok;
+}
+
+bool SimFlash::load(const char* hostPath) {
+    FILE* file = fopen(hostPath, "rb");
+    if (!file) {
+        return false;
+    }
+    std::string contents;
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        contents.append(buffer, count);
+    }
+    fclose(file);
+    const char* name = strrchr(hostPath, '/');
+    std::string path = "/" + std::string(name ? name + 1 : hostPath);
+    remove(path);
+    if (!reserve(path, contents.size())) {
+        return false;
+    }
+    *open(path, true) = contents;
+    return true;
+}
+
+size_t SimFlash::pagesFor(size_t bytes) {
+    // Even an empty file takes a page for its header
+    return bytes == 0 ? 1 : (bytes + PAGE_SIZE - 1) / PAGE_SIZE;
+}
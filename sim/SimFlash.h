@@ -0,0 +1,52 @@
+#ifndef SIM_FLASH_H
+#define SIM_FLASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The SPIFFS partition, held in memory. Like SPIFFS it is flat: a
+// "directory" is only a path prefix. Space is counted in 256-byte pages,
+// and a write that does not fit fails and is counted.
+class SimFlash {
+public:
+    static const size_t PAGE_SIZE = 256;
+
+    SimFlash();
+
+    void setCapacity(size_t bytes);
+    size_t getCapacity();
+    size_t getUsedBytes();
+    size_t getFileCount();
+    uint32_t getWriteFailures();
+
+    bool exists(const std::string& path);
+    bool isDirectory(const std::string& path);
+    // Contents of a file, created (empty) if asked to
+    std::shared_ptr<std::string> open(const std::string& path, bool create);
+    bool remove(const std::string& path);
+    bool rename(const std::string& from, const std::string& to);
+    // Full paths of the files under a directory, in name order
+    std::vector<std::string> list(const std::string& directory);
+    // Room for a file to grow from its current size by the given bytes
+    bool reserve(const std::string& path, size_t growth);
+    void format();
+    // Copies every file into a host directory
+    bool dump(const char* directory);
+    // Copies a host file in, at the root under its own name
+    bool load(const char* hostPath);
+
+private:
+    std::map<std::string, std::shared_ptr<std::string>> files;
+    size_t capacity;
+    uint32_t writeFailures;
+
+    static size_t pagesFor(size_t bytes);
+};
+
+extern SimFlash simFlash;
+
+#endif
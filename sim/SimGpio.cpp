@@ -0,0 +1,141 @@
+#include "SimGpio.h"
+#include "Arduino.h"
+#include "soc/gpio_reg.h"
+
+SimGpio simGpio;
+
+SimGpio::SimGpio() {
+    outputs = 0;
+    driven = 0;
+    levels = 0;
+    for (int i = 0; i < PIN_COUNT; i++) {
+        modes[i] = 0;
+        handlers[i] = nullptr;
+        handlerArgs[i] = nullptr;
+        handlerModes[i] = 0;
+    }
+}
+
+void SimGpio::setMode(uint8_t pin, uint8_t mode) {
+    if (pin < PIN_COUNT) {
+        modes[pin] = mode;
+    }
+}
+
+void SimGpio::write(uint8_t pin, uint8_t value) {
+    if (pin >= PIN_COUNT) {
+        return;
+    }
+    uint64_t bit = 1ULL << pin;
+    setOutputs(value ? (outputs | bit) : (outputs & ~bit));
+}
+
+int SimGpio::read(uint8_t pin) {
+    if (pin >= PIN_COUNT) {
+        return 0;
+    }
+    if (inputs[pin]) {
+        return inputs[pin]() ? 1 : 0;
+    }
+    if (modes[pin] == OUTPUT) {
+        // An output reads back the level it drives
+        return (outputs >> pin) & 1;
+    }
+    if (driven & (1ULL << pin)) {
+        return (levels >> pin) & 1;
+    }
+    return 1;
+}
+
+void SimGpio::setInterrupt(uint8_t pin, InterruptHandler handler, void* arg, int mode) {
+    if (pin < PIN_COUNT) {
+        handlers[pin] = handler;
+        handlerArgs[pin] = arg;
+        handlerModes[pin] = mode;
+    }
+}
+
+void SimGpio::drive(uint8_t pin, int level) {
+    if (pin >= PIN_COUNT) {
+        return;
+    }
+    int before = read(pin);
+    uint64_t bit = 1ULL << pin;
+    driven |= bit;
+    levels = level ? (levels | bit) : (levels & ~bit);
+    int after = read(pin);
+    int edge = after > before ? RISING : (after < before ? FALLING : 0);
+    if (edge && handlers[pin] && (handlerModes[pin] & edge)) {
+        handlers[pin](handlerArgs[pin]);
+    }
+}
+
+void SimGpio::writeRegister(uint32_t address, uint32_t value) {
+    switch (address) {
+        case GPIO_OUT_REG:
+            setOutputs((outputs & 0xFFFFFFFF00000000ULL) | value);
+            break;
+        case GPIO_OUT_W1TS_REG:
+            setOutputs(outputs | value);
+            break;
+        case GPIO_OUT_W1TC_REG:
+            setOutputs(outputs & ~(uint64_t)value);
+            break;
+        case GPIO_OUT1_REG:
+            setOutputs((outputs & 0xFFFFFFFFULL) | ((uint64_t)(value & 0xFF) << 32));
+            break;
+        case GPIO_OUT1_W1TS_REG:
+            setOutputs(outputs | ((uint64_t)(value & 0xFF) << 32));
+            break;
+        case GPIO_OUT1_W1TC_REG:
+            setOutputs(outputs & ~((uint64_t)(value & 0xFF) << 32));
+            break;
+        default:
+            break;
+    }
+}
+
+uint32_t SimGpio::readRegister(uint32_t address) {
+    uint64_t levels = 0;
+    for (uint8_t pin = 0; pin < PIN_COUNT; pin++) {
+        if (read(pin)) {
+            levels |= 1ULL << pin;
+        }
+    }
+    switch (address) {
+        case GPIO_OUT_REG:
+            return (uint32_t)outputs;
+        case GPIO_OUT1_REG:
+            return (uint32_t)(outputs >> 32);
+        case GPIO_IN_REG:
+            return (uint32_t)levels;
+        case GPIO_IN1_REG:
+            return (uint32_t)(levels >> 32);
+        default:
+            return 0;
+    }
+}
+
+uint64_t SimGpio::getOutputs() {
+    return outputs;
+}
+
+void SimGpio::setOutputListener(OutputListener listener) {
+    this->listener = listener;
+}
+
+void SimGpio::setInputSource(uint8_t pin, InputSource source) {
+    if (pin < PIN_COUNT) {
+        inputs[pin] = source;
+    }
+}
+
+void SimGpio::setOutputs(uint64_t value) {
+    if (value == outputs) {
+        return;
+    }
+    outputs = value;
+    if (listener) {
+        listener(outputs);
+    }
+}
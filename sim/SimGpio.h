@@ -0,0 +1,50 @@
+#ifndef SIM_GPIO_H
+#define SIM_GPIO_H
+
+#include <stdint.h>
+#include <functional>
+
+// The ESP32's 40 GPIOs. Outputs are written through digitalWrite() or the
+// set/clear registers; a listener sees every change of the output word.
+// Inputs read a source function when one is attached, or the level a
+// simulated part drives, else stay HIGH (pull-up). Driving a level runs the
+// pin's interrupt handler on a matching edge.
+class SimGpio {
+public:
+    typedef std::function<void(uint64_t outputs)> OutputListener;
+    typedef std::function<int()> InputSource;
+    typedef void (*InterruptHandler)(void* arg);
+
+    static const uint8_t PIN_COUNT = 40;
+
+    SimGpio();
+
+    void setMode(uint8_t pin, uint8_t mode);
+    void write(uint8_t pin, uint8_t value);
+    int read(uint8_t pin);
+    void writeRegister(uint32_t address, uint32_t value);
+    uint32_t readRegister(uint32_t address);
+    uint64_t getOutputs();
+
+    void setOutputListener(OutputListener listener);
+    void setInputSource(uint8_t pin, InputSource source);
+    void setInterrupt(uint8_t pin, InterruptHandler handler, void* arg, int mode);
+    void drive(uint8_t pin, int level);
+
+private:
+    uint64_t outputs;
+    uint8_t modes[PIN_COUNT];
+    InputSource inputs[PIN_COUNT];
+    uint64_t driven;  // pins a part drives
+    uint64_t levels;  // and their levels
+    InterruptHandler handlers[PIN_COUNT];
+    void* handlerArgs[PIN_COUNT];
+    int handlerModes[PIN_COUNT];
+    OutputListener listener;
+
+    void setOutputs(uint64_t value);
+};
+
+extern SimGpio simGpio;
+
+#endif
@@ -0,0 +1,179 @@
+#include "SimMotor.h"
+#include "SimClock.h"
+#include <math.h>
+
+SimMotor simMotor;
+
+// Half-step phase for each coil pattern (bit n is IN(n+1)), -1 if the
+// pattern is not in the sequence
+static const int8_t PHASE_OF_PATTERN[16] = {
+    -1, 0, 2, 1, 4, -1, 3, -1, 6, 7, -1, -1, 5, -1, -1, -1
+};
+
+SimMotor::SimMotor() {
+    for (int i = 0; i < 4; i++) {
+        pins[i] = 0;
+    }
+    gearFullSteps = 2048;
+    backlashHalfSteps = 0;
+    indexAngle = 90;
+    indexWidth = 3;
+    lastPhase = -1;
+    rotor = 0;
+    output = 0;
+    slack = 0;
+    lastDirection = 0;
+    halfSteps = 0;
+    reversals = 0;
+    faults = 0;
+    lastStepAt = 0;
+    minStepInterval = 0;
+    energized = false;
+    energizedSince = 0;
+    energizedMicros = 0;
+}
+
+void SimMotor::begin(SimGpio* gpio, const uint8_t pins[4], uint8_t indexPin) {
+    for (int i = 0; i < 4; i++) {
+        this->pins[i] = pins[i];
+    }
+    gpio->setOutputListener([this](uint64_t outputs) { observe(outputs); });
+    gpio->setInputSource(indexPin, [this]() { return indexActive() ? 0 : 1; });
+}
+
+void SimMotor::setGear(double fullStepsPerRevolution) {
+    if (fullStepsPerRevolution > 0) {
+        gearFullSteps = fullStepsPerRevolution;
+    }
+}
+
+void SimMotor::setBacklash(double fullSteps) {
+    backlashHalfSteps = fullSteps > 0 ? (int64_t)llround(fullSteps * 2) : 0;
+    // Starts engaged for forward rotation
+    slack = backlashHalfSteps;
+}
+
+void SimMotor::setIndex(double angleDegrees, double widthDegrees) {
+    indexAngle = angleDegrees;
+    indexWidth = widthDegrees;
+}
+
+int64_t SimMotor::getRotorHalfSteps() {
+    return rotor;
+}
+
+double SimMotor::getOutputRevolutions() {
+    return (double)output / (2.0 * gearFullSteps);
+}
+
+double SimMotor::getOutputDegrees() {
+    double revolutions = getOutputRevolutions();
+    double degrees = (revolutions - floor(revolutions)) * 360.0;
+    return degrees >= 360.0 ? 0.0 : degrees;
+}
+
+uint64_t SimMotor::getHalfSteps() {
+    return halfSteps;
+}
+
+uint32_t SimMotor::getReversals() {
+    return reversals;
+}
+
+uint32_t SimMotor::getFaults() {
+    return faults;
+}
+
+uint64_t SimMotor::getMinStepInterval() {
+    return minStepInterval;
+}
+
+uint64_t SimMotor::getEnergizedMicros() {
+    uint64_t total = energizedMicros;
+    if (energized) {
+        total += simClock.now() - energizedSince;
+    }
+    return total;
+}
+
+void SimMotor::observe(uint64_t outputs) {
+    uint8_t pattern = 0;
+    for (int i = 0; i < 4; i++) {
+        if ((outputs >> pins[i]) & 1) {
+            pattern |= 1 << i;
+        }
+    }
+
+    uint64_t now = simClock.now();
+    if (pattern == 0) {
+        // Released, the rotor stays in its detent
+        if (energized) {
+            energizedMicros += now - energizedSince;
+            energized = false;
+        }
+        return;
+    }
+    if (!energized) {
+        energized = true;
+        energizedSince = now;
+    }
+
+    int8_t phase = PHASE_OF_PATTERN[pattern];
+    if (phase < 0) {
+        faults++;
+        return;
+    }
+    if (lastPhase < 0) {
+        lastPhase = phase;
+        return;
+    }
+    int8_t delta = (int8_t)((phase - lastPhase + 8) % 8);
+    if (delta > 4) {
+        delta -= 8;
+    }
+    lastPhase = phase;
+    if (delta == 0) {
+        return;
+    }
+    if (delta > 2 || delta < -2) {
+        // Pulled more than a full step at once: direction is ambiguous
+        faults++;
+        return;
+    }
+
+    if (halfSteps > 0) {
+        uint64_t interval = now - lastStepAt;
+        // Register writes for one step land at the same instant
+        if (interval > 0 && (minStepInterval == 0 || interval < minStepInterval)) {
+            minStepInterval = interval;
+        }
+    }
+    lastStepAt = now;
+    turn(delta);
+}
+
+void SimMotor::turn(int8_t halfStepsMoved) {
+    int8_t direction = halfStepsMoved > 0 ? 1 : -1;
+    if (lastDirection != 0 && direction != lastDirection) {
+        reversals++;
+    }
+    lastDirection = direction;
+    rotor += halfStepsMoved;
+    halfSteps += halfStepsMoved > 0 ? halfStepsMoved : -halfStepsMoved;
+
+    // The output moves only once the slack is taken up
+    slack += halfStepsMoved;
+    if (slack > backlashHalfSteps) {
+        output += slack - backlashHalfSteps;
+        slack = backlashHalfSteps;
+    } else if (slack < 0) {
+        output += slack;
+        slack = 0;
+    }
+}
+
+bool SimMotor::indexActive() {
+    double offset = getOutputDegrees() - indexAngle;
+    offset -= 360.0 * floor(offset / 360.0);
+    return offset < indexWidth;
+}
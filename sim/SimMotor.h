@@ -0,0 +1,59 @@
+#ifndef SIM_MOTOR_H
+#define SIM_MOTOR_H
+
+#include <stdint.h>
+#include "SimGpio.h"
+
+// Virtual 28BYJ-48 on a ULN2003. It watches the four coil pins, decodes
+// the half-step phase the rotor is pulled to and records every step; a
+// jump of more than one full step, or a pattern that is not in the
+// sequence, is a fault (the real motor would lose or mis-step). The output
+// shaft follows through a gearbox of any ratio with backlash, and drives
+// an index sensor that pulls its pin LOW over a small arc.
+class SimMotor {
+public:
+    SimMotor();
+
+    void begin(SimGpio* gpio, const uint8_t pins[4], uint8_t indexPin);
+    void setGear(double fullStepsPerRevolution);
+    void setBacklash(double fullSteps);
+    void setIndex(double angleDegrees, double widthDegrees);
+
+    int64_t getRotorHalfSteps();
+    double getOutputRevolutions();
+    double getOutputDegrees(); // 0..360
+    uint64_t getHalfSteps();   // total moved, either direction
+    uint32_t getReversals();
+    uint32_t getFaults();
+    uint64_t getMinStepInterval(); // microseconds, 0 before two steps
+    uint64_t getEnergizedMicros();
+
+private:
+    uint8_t pins[4];
+    double gearFullSteps;
+    int64_t backlashHalfSteps;
+    double indexAngle;
+    double indexWidth;
+
+    int8_t lastPhase; // -1 until the coils are first energized
+    int64_t rotor;    // half steps
+    int64_t output;   // half steps, through the backlash
+    int64_t slack;    // 0..backlashHalfSteps, rotor ahead of the output
+    int8_t lastDirection;
+    uint64_t halfSteps;
+    uint32_t reversals;
+    uint32_t faults;
+    uint64_t lastStepAt;
+    uint64_t minStepInterval;
+    bool energized;
+    uint64_t energizedSince;
+    uint64_t energizedMicros;
+
+    void observe(uint64_t outputs);
+    void turn(int8_t halfStepsMoved);
+    bool indexActive();
+};
+
+extern SimMotor simMotor;
+
+#endif
@@ -0,0 +1,541 @@
+#include "SimNmeaFeed.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+SimNmeaFeed simNmeaFeed;
+
+// NAV-POSLLH, NAV-DOP, NAV-SOL, NAV-TIMEUTC, NAV-CLOCK, in the order they are sent
+static const uint8_t NAVIGATION_IDS[5] = {0x02, 0x04, 0x06, 0x21, 0x22};
+static const time_t GPS_EPOCH = 315964800; // 1980-01-06
+static const int LEAP_SECONDS = 18;        // GPS ahead of UTC since 2017
+
+static void putLittleEndian(std::vector<uint8_t>& payload, size_t offset, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        payload[offset + i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+SimNmeaFeed::SimNmeaFeed() {
+    startTime = 1735689600; // 2025-01-01 00:00:00 UTC
+    // East Northport, NY, the firmware's default location
+    latitude = 40.5169;
+    longitude = -74.4063;
+    altitude = 0;
+    fixAfter = 30;
+    aidedFixAfter = 0;
+    fixEnabled = true;
+    baud = 9600;
+    hostBaud = 9600;
+    bufferLimit = 0;
+    periodMs = 1000;
+    sentenceMask = 0x3F;
+    memset(navigationRates, 0, sizeof(navigationRates));
+    navigationEpochs = 0;
+    aidings = 0;
+    aidFlags = 0;
+    aidLatitude = 0;
+    aidLongitude = 0;
+    receiverDrift = 1500; // a NEO-6M crystal, 1.5 ppm fast
+    crystalPpm = 0;
+    ppsEnabled = true;
+    ppsGpio = nullptr;
+    ppsPin = 0;
+    ppsTimer = nullptr;
+    ppsHigh = false;
+    nextPulse = 0;
+    outageFrom = 0;
+    outageUntil = 0;
+    pulses = 0;
+    scripted = false;
+    scriptIndex = 0;
+    nextEpoch = 0;
+    sendingOffset = 0;
+    sendingSince = 0;
+    sentences = 0;
+    droppedBytes = 0;
+}
+
+void SimNmeaFeed::setStartTime(time_t utc) {
+    startTime = utc;
+}
+
+time_t SimNmeaFeed::getStartTime() {
+    return startTime;
+}
+
+void SimNmeaFeed::setLocation(double latitude, double longitude, double altitude) {
+    this->latitude = latitude;
+    this->longitude = longitude;
+    this->altitude = altitude;
+}
+
+void SimNmeaFeed::setFixAfter(uint32_t seconds) {
+    fixAfter = seconds;
+}
+
+void SimNmeaFeed::setFixEnabled(bool enabled) {
+    fixEnabled = enabled;
+}
+
+void SimNmeaFeed::setAidedFixAfter(uint32_t seconds) {
+    aidedFixAfter = seconds;
+}
+
+bool SimNmeaFeed::isFixed(uint64_t gpsMicros) {
+    uint32_t after = fixAfter;
+    if ((aidFlags & 0x01) && aidedFixAfter > 0 && aidedFixAfter < after) {
+        after = aidedFixAfter;
+    }
+    return fixEnabled && gpsMicros / 1000000 >= after;
+}
+
+void SimNmeaFeed::setBaud(uint32_t baud) {
+    if (baud > 0) {
+        this->baud = baud;
+    }
+}
+
+void SimNmeaFeed::setHostBaud(uint32_t baud) {
+    pump();
+    hostBaud = baud;
+}
+
+void SimNmeaFeed::setBufferLimit(size_t bytes) {
+    bufferLimit = bytes;
+}
+
+void SimNmeaFeed::setCrystalPpm(double ppm) {
+    crystalPpm = ppm;
+}
+
+void SimNmeaFeed::setPpsEnabled(bool enabled) {
+    ppsEnabled = enabled;
+}
+
+void SimNmeaFeed::setPpsOutage(double fromSeconds, double seconds) {
+    outageFrom = (uint64_t)llround(fromSeconds * 1000000.0);
+    outageUntil = outageFrom + (uint64_t)llround(seconds * 1000000.0);
+}
+
+void SimNmeaFeed::beginPps(SimGpio* gpio, uint8_t pin) {
+    ppsGpio = gpio;
+    ppsPin = pin;
+    ppsGpio->drive(ppsPin, 0);
+    ppsTimer = simClock.createTimer(&SimNmeaFeed::onPpsTimer, this);
+    simClock.startTimer(ppsTimer, toLocal(nextPulse), 0);
+}
+
+void SimNmeaFeed::onPpsTimer(void* arg) {
+    static_cast<SimNmeaFeed*>(arg)->pulse();
+}
+
+void SimNmeaFeed::pulse() {
+    if (ppsHigh) {
+        ppsGpio->drive(ppsPin, 0);
+        ppsHigh = false;
+        nextPulse += 1000000;
+    } else {
+        bool fixed = isFixed(nextPulse);
+        bool outage = nextPulse >= outageFrom && nextPulse < outageUntil;
+        if (ppsEnabled && fixed && !outage && !scripted) {
+            ppsGpio->drive(ppsPin, 1);
+            ppsHigh = true;
+            pulses++;
+        } else {
+            nextPulse += 1000000;
+        }
+    }
+    uint64_t at = toLocal(ppsHigh ? nextPulse + 100000 : nextPulse);
+    uint64_t now = simClock.now();
+    simClock.startTimer(ppsTimer, at > now ? at - now : 0, 0);
+}
+
+uint64_t SimNmeaFeed::toLocal(uint64_t gpsMicros) {
+    return (uint64_t)llround(gpsMicros * (1.0 + crystalPpm * 1e-6));
+}
+
+uint64_t SimNmeaFeed::toGps(uint64_t localMicros) {
+    return (uint64_t)llround(localMicros / (1.0 + crystalPpm * 1e-6));
+}
+
+bool SimNmeaFeed::loadScript(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        char* end = line + strlen(line);
+        while (end > line && (end[-1] == '\n' || end[-1] == '\r')) {
+            *--end = 0;
+        }
+        char* text = line;
+        while (*text == ' ' || *text == '\t') {
+            text++;
+        }
+        if (*text == 0 || *text == '#') {
+            continue;
+        }
+        char* rest = nullptr;
+        double seconds = strtod(text, &rest);
+        while (*rest == ' ' || *rest == '\t') {
+            rest++;
+        }
+        if (*rest == '$') {
+            rest++;
+        }
+        Burst burst;
+        burst.at = (uint64_t)llround(seconds * 1000000.0);
+        burst.text = strchr(rest, '*') ? "$" + std::string(rest) + "\r\n" : withChecksum(rest);
+        script.push_back(burst);
+    }
+    fclose(file);
+    scripted = true;
+    return true;
+}
+
+int SimNmeaFeed::available() {
+    pump();
+    return (int)received.size();
+}
+
+int SimNmeaFeed::read() {
+    pump();
+    if (received.empty()) {
+        return -1;
+    }
+    char c = received.front();
+    received.pop_front();
+    return (unsigned char)c;
+}
+
+int SimNmeaFeed::peek() {
+    pump();
+    return received.empty() ? -1 : (unsigned char)received.front();
+}
+
+void SimNmeaFeed::write(uint8_t c) {
+    pump();
+    if (hostBaud != baud) {
+        return;
+    }
+    if (command.empty() && c != 0xB5) {
+        return;
+    }
+    command.push_back((char)c);
+    if (command.size() == 2 && (uint8_t)command[1] != 0x62) {
+        command.clear();
+        return;
+    }
+    if (command.size() < 6) {
+        return;
+    }
+    const uint8_t* frame = (const uint8_t*)command.data();
+    uint16_t length = frame[4] | (frame[5] << 8);
+    if (command.size() < (size_t)length + 8) {
+        return;
+    }
+    uint8_t a = 0, b = 0;
+    for (size_t i = 2; i < (size_t)length + 6; i++) {
+        a += frame[i];
+        b += a;
+    }
+    if (a == frame[length + 6] && b == frame[length + 7]) {
+        handleCommand(frame[2], frame[3], frame + 6, length);
+    }
+    command.clear();
+}
+
+void SimNmeaFeed::handleCommand(uint8_t messageClass, uint8_t id, const uint8_t* payload, uint16_t length) {
+    if (messageClass == 0x0B && id == 0x01 && length == 48) {
+        // AID-INI, flags: position, time, clock drift, as latitude and longitude
+        aidings++;
+        aidFlags = payload[44] | (payload[45] << 8) | (payload[46] << 16) | ((uint32_t)payload[47] << 24);
+        int32_t lat = (int32_t)(payload[0] | (payload[1] << 8) | (payload[2] << 16) | ((uint32_t)payload[3] << 24));
+        int32_t lon = (int32_t)(payload[4] | (payload[5] << 8) | (payload[6] << 16) | ((uint32_t)payload[7] << 24));
+        aidLatitude = lat * 1e-7;
+        aidLongitude = lon * 1e-7;
+        return;
+    }
+    if (messageClass != 0x06) {
+        return;
+    }
+    bool acknowledged = true;
+    if (id == 0x00 && length == 20) {
+        // CFG-PRT: the new rate applies from the acknowledgement on
+        baud = payload[8] | (payload[9] << 8) | (payload[10] << 16) | ((uint32_t)payload[11] << 24);
+    } else if (id == 0x01 && (length == 3 || length == 8)) {
+        // CFG-MSG, for this port or per port (UART1 is the second rate)
+        uint8_t rate = length == 3 ? payload[2] : payload[3];
+        if (payload[0] == 0xF0 && payload[1] < 6) {
+            sentenceMask = rate ? sentenceMask | (1 << payload[1]) : sentenceMask & ~(1 << payload[1]);
+        }
+        for (int i = 0; i < 5; i++) {
+            if (payload[0] == 0x01 && payload[1] == NAVIGATION_IDS[i]) {
+                navigationRates[i] = rate;
+            }
+        }
+    } else if (id == 0x08 && length == 6) {
+        uint16_t period = payload[0] | (payload[1] << 8);
+        acknowledged = period >= 100;
+        if (acknowledged) {
+            periodMs = period;
+        }
+    }
+    reply(messageClass, id, acknowledged);
+}
+
+void SimNmeaFeed::reply(uint8_t messageClass, uint8_t id, bool acknowledged) {
+    Burst burst;
+    burst.at = simClock.now();
+    burst.text = ubxFrame(0x05, acknowledged ? 0x01 : 0x00, {messageClass, id});
+    replies.push_back(burst);
+}
+
+uint64_t SimNmeaFeed::getSentences() {
+    return sentences;
+}
+
+uint64_t SimNmeaFeed::getDroppedBytes() {
+    return droppedBytes;
+}
+
+uint64_t SimNmeaFeed::getPulses() {
+    return pulses;
+}
+
+uint32_t SimNmeaFeed::getAidings() {
+    return aidings;
+}
+
+uint32_t SimNmeaFeed::getAidFlags() {
+    return aidFlags;
+}
+
+void SimNmeaFeed::getAidPosition(double* latitude, double* longitude) {
+    *latitude = aidLatitude;
+    *longitude = aidLongitude;
+}
+
+int32_t SimNmeaFeed::getReceiverDrift() {
+    return receiverDrift;
+}
+
+uint64_t SimNmeaFeed::getUtcMicros() {
+    return (uint64_t)startTime * 1000000ULL + toGps(simClock.now());
+}
+
+void SimNmeaFeed::pump() {
+    uint64_t now = simClock.now();
+    for (;;) {
+        // Ten bits per byte on the wire
+        uint64_t arrived = (now - sendingSince) * baud / 10 / 1000000;
+        size_t upTo = arrived < sending.size() ? (size_t)arrived : sending.size();
+        if (upTo > sendingOffset) {
+            receive(sending, sendingOffset, upTo);
+            sendingOffset = upTo;
+        }
+        if (sendingOffset < sending.size()) {
+            return;
+        }
+
+        Burst burst;
+        if (!nextBurst(now, &burst)) {
+            return;
+        }
+        // A burst waits for the line to be free
+        uint64_t lineFreeAt = sendingSince + (uint64_t)sending.size() * 10 * 1000000 / baud;
+        sendingSince = burst.at > lineFreeAt ? burst.at : lineFreeAt;
+        sending = burst.text;
+        sendingOffset = 0;
+    }
+}
+
+bool SimNmeaFeed::nextBurst(uint64_t limit, Burst* burst) {
+    if (!replies.empty()) {
+        *burst = replies.front();
+        replies.pop_front();
+        return true;
+    }
+    if (scripted) {
+        if (scriptIndex >= script.size() || script[scriptIndex].at > limit) {
+            return false;
+        }
+        *burst = script[scriptIndex++];
+        sentences++;
+        return true;
+    }
+    if (toLocal(nextEpoch) > limit) {
+        return false;
+    }
+    burst->at = toLocal(nextEpoch);
+    burst->text = generate(nextEpoch);
+    nextEpoch += (uint64_t)periodMs * 1000;
+    return true;
+}
+
+void SimNmeaFeed::receive(const std::string& text, size_t from, size_t to) {
+    for (size_t i = from; i < to; i++) {
+        if (hostBaud != baud || (bufferLimit > 0 && received.size() >= bufferLimit)) {
+            droppedBytes++;
+        } else {
+            received.push_back(text[i]);
+        }
+    }
+}
+
+std::string SimNmeaFeed::generate(uint64_t at) {
+    time_t utc = startTime + (time_t)(at / 1000000);
+    struct tm fields;
+    gmtime_r(&utc, &fields);
+    char clock[16];
+    snprintf(clock, sizeof(clock), "%02d%02d%02d.%02d", fields.tm_hour, fields.tm_min, fields.tm_sec,
+             (int)(at % 1000000 / 10000));
+    char date[24];
+    snprintf(date, sizeof(date), "%02d%02d%02d", fields.tm_mday, fields.tm_mon + 1, fields.tm_year % 100);
+
+    // In the module's order: RMC, VTG, GGA, GSA, GSV, GLL
+    std::vector<std::string> bodies[6];
+    char body[160];
+    bool fixed = isFixed(at);
+    if (!fixed) {
+        // Time from the satellites in view, no position yet
+        snprintf(body, sizeof(body), "GPRMC,%s,V,,,,,,,%s,,,N", clock, date);
+        bodies[0].push_back(body);
+        bodies[1].push_back("GPVTG,,,,,,,,,N");
+        snprintf(body, sizeof(body), "GPGGA,%s,,,,,0,00,99.99,,,,,,", clock);
+        bodies[2].push_back(body);
+        bodies[3].push_back("GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99");
+        bodies[4].push_back("GPGSV,1,1,03,05,,,27,13,,,24,20,,,19");
+        snprintf(body, sizeof(body), "GPGLL,,,,,%s,V,N", clock);
+        bodies[5].push_back(body);
+    } else {
+        double absLatitude = fabs(latitude);
+        double absLongitude = fabs(longitude);
+        int latitudeDegrees = (int)absLatitude;
+        int longitudeDegrees = (int)absLongitude;
+        char position[64];
+        snprintf(position, sizeof(position), "%02d%08.5f,%c,%03d%08.5f,%c",
+                 latitudeDegrees, (absLatitude - latitudeDegrees) * 60.0, latitude < 0 ? 'S' : 'N',
+                 longitudeDegrees, (absLongitude - longitudeDegrees) * 60.0, longitude < 0 ? 'W' : 'E');
+
+        snprintf(body, sizeof(body), "GPRMC,%s,A,%s,0.00,0.00,%s,,,A", clock, position, date);
+        bodies[0].push_back(body);
+        bodies[1].push_back("GPVTG,,T,,M,0.000,N,0.000,K,A");
+        snprintf(body, sizeof(body), "GPGGA,%s,%s,1,08,1.00,%.1f,M,-34.0,M,,", clock, position, altitude);
+        bodies[2].push_back(body);
+        bodies[3].push_back("GPGSA,A,3,05,13,20,02,29,15,18,25,,,,,1.80,1.00,1.50");
+        bodies[4].push_back("GPGSV,2,1,08,02,35,106,41,05,62,045,44,13,48,287,42,15,22,318,38");
+        bodies[4].push_back("GPGSV,2,2,08,18,15,153,36,20,71,201,45,25,09,062,33,29,40,240,40");
+        snprintf(body, sizeof(body), "GPGLL,%s,%s,A,A", position, clock);
+        bodies[5].push_back(body);
+    }
+
+    // Message ids of the six, for the CFG-MSG switches
+    static const uint8_t IDS[6] = {4, 5, 0, 2, 3, 1};
+    std::string result;
+    for (int i = 0; i < 6; i++) {
+        if (!(sentenceMask & (1 << IDS[i]))) {
+            continue;
+        }
+        for (const std::string& text : bodies[i]) {
+            result += withChecksum(text);
+            sentences++;
+        }
+    }
+    return result + navigation(at, fixed, utc);
+}
+
+std::string SimNmeaFeed::navigation(uint64_t at, bool fixed, time_t utc) {
+    uint32_t millisecond = (uint32_t)(at % 1000000 / 1000);
+    uint32_t timeOfWeek = (uint32_t)((utc - GPS_EPOCH + LEAP_SECONDS) % 604800) * 1000 + millisecond;
+    uint16_t week = (uint16_t)((utc - GPS_EPOCH + LEAP_SECONDS) / 604800);
+    std::string result;
+    // A message at rate n goes out with every nth solution
+    uint64_t epoch = navigationEpochs++;
+    for (int i = 0; i < 5; i++) {
+        if (navigationRates[i] == 0 || epoch % navigationRates[i] != 0) {
+            continue;
+        }
+        std::vector<uint8_t> payload;
+        uint8_t id = NAVIGATION_IDS[i];
+        if (id == 0x02) {
+            // Position in 1e-7 degrees and mm, the geoid 34 m below sea level here
+            payload.assign(28, 0);
+            if (fixed) {
+                putLittleEndian(payload, 4, (uint32_t)(int32_t)llround(longitude * 1e7), 4);
+                putLittleEndian(payload, 8, (uint32_t)(int32_t)llround(latitude * 1e7), 4);
+                putLittleEndian(payload, 12, (uint32_t)(int32_t)llround((altitude - 34.0) * 1000), 4);
+                putLittleEndian(payload, 16, (uint32_t)(int32_t)llround(altitude * 1000), 4);
+                putLittleEndian(payload, 20, 2500, 4);
+                putLittleEndian(payload, 24, 4000, 4);
+            } else {
+                putLittleEndian(payload, 20, 0xFFFFFFFF, 4);
+                putLittleEndian(payload, 24, 0xFFFFFFFF, 4);
+            }
+        } else if (id == 0x04) {
+            // DOPs in 0.01
+            payload.assign(18, 0);
+            uint16_t dops[7] = {210, 180, 110, 150, 100, 70, 80};
+            for (int d = 0; d < 7; d++) {
+                putLittleEndian(payload, 4 + 2 * d, fixed ? dops[d] : 9999, 2);
+            }
+        } else if (id == 0x06) {
+            payload.assign(52, 0);
+            putLittleEndian(payload, 8, week, 2);
+            payload[10] = fixed ? 3 : 0;       // 3D fix
+            payload[11] = fixed ? 0x0D : 0x0C; // fix OK, week and time of week set
+            putLittleEndian(payload, 44, fixed ? 180 : 9999, 2);
+            payload[47] = fixed ? 8 : 0;
+        } else if (id == 0x22) {
+            // Clock drift in ns/s, its accuracy in ps/s; the bias is not modelled
+            payload.assign(20, 0);
+            putLittleEndian(payload, 8, fixed ? (uint32_t)receiverDrift : 0, 4);
+            putLittleEndian(payload, 12, fixed ? 30 : 0xFFFFFFFF, 4);
+            putLittleEndian(payload, 16, fixed ? 200000 : 0xFFFFFFFF, 4);
+        } else {
+            struct tm fields;
+            gmtime_r(&utc, &fields);
+            payload.assign(20, 0);
+            putLittleEndian(payload, 4, 30, 4); // accuracy, ns
+            putLittleEndian(payload, 8, millisecond * 1000000, 4);
+            putLittleEndian(payload, 12, (uint32_t)(fields.tm_year + 1900), 2);
+            payload[14] = (uint8_t)(fields.tm_mon + 1);
+            payload[15] = (uint8_t)fields.tm_mday;
+            payload[16] = (uint8_t)fields.tm_hour;
+            payload[17] = (uint8_t)fields.tm_min;
+            payload[18] = (uint8_t)fields.tm_sec;
+            payload[19] = 0x07; // time of week, week and UTC valid
+        }
+        putLittleEndian(payload, 0, timeOfWeek, 4);
+        result += ubxFrame(0x01, id, payload);
+        sentences++;
+    }
+    return result;
+}
+
+std::string SimNmeaFeed::ubxFrame(uint8_t messageClass, uint8_t id, const std::vector<uint8_t>& payload) {
+    std::string frame = {(char)0xB5, (char)0x62, (char)messageClass, (char)id,
+                         (char)(payload.size() & 0xFF), (char)(payload.size() >> 8)};
+    frame.append(payload.begin(), payload.end());
+    uint8_t a = 0, b = 0;
+    for (size_t i = 2; i < frame.size(); i++) {
+        a += (uint8_t)frame[i];
+        b += a;
+    }
+    frame.push_back((char)a);
+    frame.push_back((char)b);
+    return frame;
+}
+
+std::string SimNmeaFeed::withChecksum(const std::string& body) {
+    uint8_t checksum = 0;
+    for (char c : body) {
+        checksum ^= (uint8_t)c;
+    }
+    char suffix[8];
+    snprintf(suffix, sizeof(suffix), "*%02X\r\n", checksum);
+    return "$" + body + suffix;
+}
@@ -0,0 +1,135 @@
+#ifndef SIM_NMEA_FEED_H
+#define SIM_NMEA_FEED_H
+
+#include <stdint.h>
+#include <time.h>
+#include <string>
+#include <deque>
+#include <vector>
+#include "SimClock.h"
+#include "SimGpio.h"
+
+// The NEO-6M as seen from its UART. Like the module it starts at 9600 baud
+// with RMC, VTG, GGA, GSA, GSV and GLL at the top of every virtual second
+// for a fixed position, with no fix until a set time; a script can replace
+// the generator. It answers UBX CFG-PRT (baud rate), CFG-MSG (sentences
+// on or off, and the rate of NAV-POSLLH, NAV-DOP, NAV-SOL, NAV-TIMEUTC and
+// NAV-CLOCK) and CFG-RATE (measurement period) with ACK-ACK, as the module
+// does. It takes AID-INI without an answer; given a position there, its
+// fix can come sooner.
+// Bytes arrive at the line rate, so a slow reader sees sentences build up;
+// an optional receive buffer limit drops what a real UART would, and while
+// the two ends disagree on the baud rate nothing gets through.
+//
+// Once it has a fix its PPS pin rises at the start of every UTC second for
+// 100 ms. GPS time is exact; the simulator's clock stands for the ESP32's
+// crystal, which can be set to run fast or slow against it.
+class SimNmeaFeed {
+public:
+    SimNmeaFeed();
+
+    void setStartTime(time_t utc);
+    time_t getStartTime();
+    void setLocation(double latitude, double longitude, double altitude);
+    void setFixAfter(uint32_t seconds);
+    void setFixEnabled(bool enabled);
+    // Fix this many seconds after the start once aided with a position, if
+    // sooner than without; 0 for no difference
+    void setAidedFixAfter(uint32_t seconds);
+    void setBaud(uint32_t baud);
+    void setHostBaud(uint32_t baud); // the ESP32 UART's rate
+    void setBufferLimit(size_t bytes); // 0 for no limit
+    void setCrystalPpm(double ppm);     // the ESP32's clock runs fast by this much
+    void setPpsEnabled(bool enabled);
+    // No pulses for a while, seconds after the start
+    void setPpsOutage(double fromSeconds, double seconds);
+    void beginPps(SimGpio* gpio, uint8_t pin);
+    // Lines of "<seconds> <sentence>", '#' starts a comment; the checksum
+    // is added when the sentence has none
+    bool loadScript(const char* path);
+
+    int available();
+    int read();
+    int peek();
+    void write(uint8_t c);
+
+    uint64_t getSentences();
+    uint64_t getDroppedBytes();
+    uint64_t getPulses();
+    // AID-INI frames received, and what the last one held
+    uint32_t getAidings();
+    uint32_t getAidFlags();
+    void getAidPosition(double* latitude, double* longitude);
+    int32_t getReceiverDrift(); // ns/s, reported in NAV-CLOCK
+    uint64_t getUtcMicros(); // true UTC now
+
+private:
+    struct Burst {
+        uint64_t at; // virtual microseconds
+        std::string text;
+    };
+
+    time_t startTime;
+    double latitude;
+    double longitude;
+    double altitude;
+    uint32_t fixAfter;
+    uint32_t aidedFixAfter;
+    bool fixEnabled;
+    uint32_t baud;
+    uint32_t hostBaud;
+    size_t bufferLimit;
+    uint16_t periodMs;
+    uint8_t sentenceMask; // bit per NMEA message id, GGA (0) to VTG (5)
+    uint8_t navigationRates[5]; // per entry of NAVIGATION_IDS, 0 when off
+    uint64_t navigationEpochs;
+    uint32_t aidings;
+    uint32_t aidFlags;
+    double aidLatitude;
+    double aidLongitude;
+    int32_t receiverDrift;
+    double crystalPpm;
+
+    bool ppsEnabled;
+    SimGpio* ppsGpio;
+    uint8_t ppsPin;
+    SimTimer* ppsTimer;
+    bool ppsHigh;
+    uint64_t nextPulse;   // GPS microseconds since the start
+    uint64_t outageFrom;  // GPS microseconds, no pulses from here
+    uint64_t outageUntil; // to here
+    uint64_t pulses;
+
+    bool scripted;
+    std::vector<Burst> script;
+    size_t scriptIndex;
+    uint64_t nextEpoch; // GPS microseconds since the start
+    std::string command;              // UBX frame being received
+    std::deque<Burst> replies;        // UBX answers, sent before the next epoch
+
+    std::string sending;   // current burst, on the wire
+    size_t sendingOffset;  // bytes of it already received
+    uint64_t sendingSince;
+    std::deque<char> received;
+    uint64_t sentences;
+    uint64_t droppedBytes; // overflow, or sent at the wrong baud rate
+
+    void pump();
+    bool isFixed(uint64_t gpsMicros);
+    void handleCommand(uint8_t messageClass, uint8_t id, const uint8_t* payload, uint16_t length);
+    void reply(uint8_t messageClass, uint8_t id, bool acknowledged);
+    bool nextBurst(uint64_t limit, Burst* burst);
+    void receive(const std::string& text, size_t from, size_t to);
+    std::string generate(uint64_t at);
+    std::string navigation(uint64_t at, bool fixed, time_t utc);
+    uint64_t toLocal(uint64_t gpsMicros);
+    uint64_t toGps(uint64_t localMicros);
+    static void onPpsTimer(void* arg);
+    void pulse();
+    static std::string withChecksum(const std::string& body);
+    static std::string ubxFrame(uint8_t messageClass, uint8_t id, const std::vector<uint8_t>& payload);
+};
+
+extern SimNmeaFeed simNmeaFeed;
+
+#endif
@@ -0,0 +1,45 @@
+#include "SimRunner.h"
+#include "SimClock.h"
+#include "SimGpio.h"
+#include "SimMotor.h"
+#include "SimNmeaFeed.h"
+
+void setup();
+void loop();
+
+static const uint8_t MOTOR_PINS[4] = {25, 26, 27, 14};
+static const uint8_t INDEX_PIN = 34;
+static const uint8_t PPS_PIN = 35;
+
+SimRunner simRunner;
+
+SimRunner::SimRunner() {
+    loops = 0;
+}
+
+void SimRunner::begin(uint32_t loopMillis) {
+    simClock.setLoopQuantum(loopMillis);
+    simMotor.begin(&simGpio, MOTOR_PINS, INDEX_PIN);
+    simNmeaFeed.beginPps(&simGpio, PPS_PIN);
+    setup();
+}
+
+void SimRunner::runOnce() {
+    uint64_t before = simClock.now();
+    loop();
+    loops++;
+    // loop() always waits on the device; keep time moving if it did not
+    if (simClock.now() == before) {
+        simClock.advanceBy((uint64_t)simClock.getLoopQuantum() * 1000);
+    }
+}
+
+void SimRunner::runUntil(uint64_t micros) {
+    while (simClock.now() < micros) {
+        runOnce();
+    }
+}
+
+uint64_t SimRunner::getLoops() {
+    return loops;
+}
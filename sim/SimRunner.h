@@ -0,0 +1,25 @@
+#ifndef SIM_RUNNER_H
+#define SIM_RUNNER_H
+
+#include <stdint.h>
+
+// Runs the firmware's setup() and loop() on the virtual clock, for the
+// native_sim program and for the tests under test/. Configure the feed,
+// motor and flash first; begin() wires the board and calls setup().
+class SimRunner {
+public:
+    SimRunner();
+
+    void begin(uint32_t loopMillis);
+    // One loop() pass; moves time on by a quantum if loop() did not wait
+    void runOnce();
+    void runUntil(uint64_t micros);
+    uint64_t getLoops();
+
+private:
+    uint64_t loops;
+};
+
+extern SimRunner simRunner;
+
+#endif
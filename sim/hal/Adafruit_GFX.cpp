@@ -0,0 +1,80 @@
+#include "Adafruit_GFX.h"
+
+static const int16_t CHAR_WIDTH = 6;
+static const int16_t CHAR_HEIGHT = 8;
+
+Adafruit_GFX::Adafruit_GFX(int16_t width, int16_t height) {
+    displayWidth = width;
+    displayHeight = height;
+    cursorX = 0;
+    cursorY = 0;
+    textSize = 1;
+    wrap = true;
+    clearText();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    int16_t cellWidth = CHAR_WIDTH * textSize;
+    int16_t cellHeight = CHAR_HEIGHT * textSize;
+    if (c == '\n') {
+        cursorX = 0;
+        cursorY += cellHeight;
+        return 1;
+    }
+    if (c == '\r') {
+        return 1;
+    }
+    if (wrap && cursorX + cellWidth > displayWidth) {
+        cursorX = 0;
+        cursorY += cellHeight;
+    }
+    int16_t row = cursorY / CHAR_HEIGHT;
+    int16_t column = cursorX / CHAR_WIDTH;
+    if (row >= 0 && row < (int16_t)rows.size() && column >= 0 && column < (int16_t)rows[row].size()) {
+        rows[row][column] = (char)c;
+    }
+    cursorX += cellWidth;
+    return 1;
+}
+
+void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+}
+
+void Adafruit_GFX::setTextSize(uint8_t size) {
+    textSize = size > 0 ? size : 1;
+}
+
+void Adafruit_GFX::setTextColor(uint16_t color) {
+    (void)color;
+}
+
+void Adafruit_GFX::setTextColor(uint16_t color, uint16_t background) {
+    (void)color;
+    (void)background;
+}
+
+void Adafruit_GFX::setTextWrap(bool wrap) {
+    this->wrap = wrap;
+}
+
+int16_t Adafruit_GFX::getCursorX() const {
+    return cursorX;
+}
+
+int16_t Adafruit_GFX::getCursorY() const {
+    return cursorY;
+}
+
+int16_t Adafruit_GFX::width() const {
+    return displayWidth;
+}
+
+int16_t Adafruit_GFX::height() const {
+    return displayHeight;
+}
+
+void Adafruit_GFX::clearText() {
+    rows.assign(displayHeight / CHAR_HEIGHT, std::string(displayWidth / CHAR_WIDTH, ' '));
+}
@@ -0,0 +1,39 @@
+#ifndef SIM_ADAFRUIT_GFX_H
+#define SIM_ADAFRUIT_GFX_H
+
+#include <string>
+#include <vector>
+#include "Print.h"
+
+// Text-only Adafruit_GFX: printed characters land in a grid of the
+// built-in 6x8 font's cells. Pixel drawing is not simulated.
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t width, int16_t height);
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    void setCursor(int16_t x, int16_t y);
+    void setTextSize(uint8_t size);
+    void setTextColor(uint16_t color);
+    void setTextColor(uint16_t color, uint16_t background);
+    void setTextWrap(bool wrap);
+    int16_t getCursorX() const;
+    int16_t getCursorY() const;
+    int16_t width() const;
+    int16_t height() const;
+
+protected:
+    int16_t displayWidth;
+    int16_t displayHeight;
+    int16_t cursorX;
+    int16_t cursorY;
+    uint8_t textSize;
+    bool wrap;
+    std::vector<std::string> rows;
+
+    void clearText();
+};
+
+#endif
@@ -0,0 +1,26 @@
+#include "Adafruit_SSD1306.h"
+#include "SimDisplay.h"
+
+TwoWire Wire;
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t width, uint8_t height, TwoWire* wire, int8_t resetPin)
+    : Adafruit_GFX(width, height) {
+    (void)wire;
+    (void)resetPin;
+}
+
+bool Adafruit_SSD1306::begin(uint8_t switchVcc, uint8_t address, bool reset, bool periphBegin) {
+    (void)switchVcc;
+    (void)address;
+    (void)reset;
+    (void)periphBegin;
+    return true;
+}
+
+void Adafruit_SSD1306::clearDisplay() {
+    clearText();
+}
+
+void Adafruit_SSD1306::display() {
+    simDisplay.present(rows);
+}
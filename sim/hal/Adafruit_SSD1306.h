@@ -0,0 +1,27 @@
+#ifndef SIM_ADAFRUIT_SSD1306_H
+#define SIM_ADAFRUIT_SSD1306_H
+
+#include "Adafruit_GFX.h"
+#include "Wire.h"
+
+#define BLACK 0
+#define WHITE 1
+#define INVERSE 2
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+#define SSD1306_EXTERNALVCC 0x01
+#define SSD1306_SWITCHCAPVCC 0x02
+
+// display() hands the text grid to the simulator as one frame
+class Adafruit_SSD1306 : public Adafruit_GFX {
+public:
+    Adafruit_SSD1306(uint8_t width, uint8_t height, TwoWire* wire = &Wire, int8_t resetPin = -1);
+
+    bool begin(uint8_t switchVcc = SSD1306_SWITCHCAPVCC, uint8_t address = 0, bool reset = true,
+               bool periphBegin = true);
+    void clearDisplay();
+    void display();
+};
+
+#endif
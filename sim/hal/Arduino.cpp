@@ -0,0 +1,87 @@
+#include "Arduino.h"
+#include "soc/soc.h"
+#include "SimClock.h"
+#include "SimGpio.h"
+
+unsigned long millis() {
+    return (unsigned long)(simClock.now() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)simClock.now();
+}
+
+void delay(uint32_t ms) {
+    simClock.advanceBy((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    simClock.advanceBy(us);
+}
+
+void yield() {
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    simGpio.setMode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    simGpio.write(pin, value);
+}
+
+int digitalRead(uint8_t pin) {
+    return simGpio.read(pin);
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    simGpio.setInterrupt(pin, handler, arg, mode);
+}
+
+void detachInterrupt(uint8_t pin) {
+    simGpio.setInterrupt(pin, nullptr, nullptr, 0);
+}
+
+void simRegWrite(uint32_t address, uint32_t value) {
+    simGpio.writeRegister(address, value);
+}
+
+uint32_t simRegRead(uint32_t address) {
+    return simGpio.readRegister(address);
+}
+
+// Fixed-seed generator, so runs repeat exactly
+static uint32_t randomState = 1;
+
+long random(long max) {
+    if (max <= 0) {
+        return 0;
+    }
+    randomState = randomState * 1103515245 + 12345;
+    return (long)((randomState >> 1) % (uint32_t)max);
+}
+
+long random(long min, long max) {
+    if (min >= max) {
+        return min;
+    }
+    return min + random(max - min);
+}
+
+void randomSeed(unsigned long seed) {
+    if (seed != 0) {
+        randomState = (uint32_t)seed;
+    }
+}
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+size_t strlcpy(char* destination, const char* source, size_t size) {
+    size_t length = strlen(source);
+    if (size > 0) {
+        size_t count = length < size - 1 ? length : size - 1;
+        memcpy(destination, source, count);
+        destination[count] = 0;
+    }
+    return length;
+}
+#endif
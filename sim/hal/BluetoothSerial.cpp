@@ -0,0 +1,36 @@
+#include "BluetoothSerial.h"
+#include "SimBluetooth.h"
+
+bool BluetoothSerial::begin(const String& name, bool isMaster) {
+    (void)name;
+    (void)isMaster;
+    return true;
+}
+
+void BluetoothSerial::end() {
+}
+
+bool BluetoothSerial::hasClient() {
+    return simBluetooth.hasClient();
+}
+
+int BluetoothSerial::available() {
+    return simBluetooth.available();
+}
+
+int BluetoothSerial::read() {
+    return simBluetooth.read();
+}
+
+int BluetoothSerial::peek() {
+    return simBluetooth.peek();
+}
+
+size_t BluetoothSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t BluetoothSerial::write(const uint8_t* buffer, size_t size) {
+    simBluetooth.send(buffer, size);
+    return size;
+}
@@ -0,0 +1,21 @@
+#ifndef SIM_BLUETOOTH_SERIAL_H
+#define SIM_BLUETOOTH_SERIAL_H
+
+#include "Arduino.h"
+
+// Classic Bluetooth SPP, connected to the simulator's scripted terminal
+class BluetoothSerial : public Stream {
+public:
+    bool begin(const String& name, bool isMaster = false);
+    void end();
+    bool hasClient();
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+};
+
+#endif
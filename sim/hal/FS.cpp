@@ -0,0 +1,226 @@
+#include "FS.h"
+#include "SimFlash.h"
+#include <string.h>
+
+namespace fs {
+
+class FileImpl {
+public:
+    std::string path;
+    std::shared_ptr<std::string> data; // null for a directory
+    size_t position;
+    bool writable;
+    bool append;
+    bool open;
+    std::vector<std::string> entries;
+    size_t nextEntry;
+};
+
+static std::shared_ptr<FileImpl> openFile(const std::string& path, const char* mode) {
+    bool write = mode[0] == 'w' || mode[0] == 'a' || strchr(mode, '+');
+    std::shared_ptr<FileImpl> impl = std::make_shared<FileImpl>();
+    impl->path = path;
+    impl->position = 0;
+    impl->writable = write;
+    impl->append = mode[0] == 'a';
+    impl->open = true;
+    impl->nextEntry = 0;
+
+    if (!write && !simFlash.open(path, false) && simFlash.isDirectory(path)) {
+        impl->entries = simFlash.list(path);
+        return impl;
+    }
+    impl->data = simFlash.open(path, write);
+    if (!impl->data) {
+        return nullptr;
+    }
+    if (mode[0] == 'w') {
+        impl->data->clear();
+    } else if (impl->append) {
+        impl->position = impl->data->size();
+    }
+    return impl;
+}
+
+File::File() {
+}
+
+File::File(std::shared_ptr<FileImpl> impl) {
+    this->impl = impl;
+}
+
+size_t File::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    if (!impl || !impl->open || !impl->data || !impl->writable) {
+        return 0;
+    }
+    if (impl->append) {
+        impl->position = impl->data->size();
+    }
+    size_t end = impl->position + size;
+    size_t growth = end > impl->data->size() ? end - impl->data->size() : 0;
+    if (growth > 0 && !simFlash.reserve(impl->path, growth)) {
+        return 0;
+    }
+    if (end > impl->data->size()) {
+        impl->data->resize(end);
+    }
+    memcpy(&(*impl->data)[impl->position], buffer, size);
+    impl->position = end;
+    return size;
+}
+
+int File::available() {
+    if (!impl || !impl->open || !impl->data) {
+        return 0;
+    }
+    return (int)(impl->data->size() - impl->position);
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+    if (available() <= 0) {
+        return -1;
+    }
+    return (uint8_t)(*impl->data)[impl->position];
+}
+
+void File::flush() {
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    size_t left = (size_t)(available() > 0 ? available() : 0);
+    size_t count = size < left ? size : left;
+    if (count > 0) {
+        memcpy(buffer, impl->data->data() + impl->position, count);
+        impl->position += count;
+    }
+    return count;
+}
+
+bool File::seek(uint32_t position) {
+    if (!impl || !impl->open || !impl->data || position > impl->data->size()) {
+        return false;
+    }
+    impl->position = position;
+    return true;
+}
+
+size_t File::position() const {
+    return impl ? impl->position : 0;
+}
+
+size_t File::size() const {
+    return impl && impl->data ? impl->data->size() : 0;
+}
+
+void File::close() {
+    if (impl) {
+        impl->open = false;
+    }
+}
+
+File::operator bool() const {
+    return impl && impl->open;
+}
+
+const char* File::path() const {
+    return impl ? impl->path.c_str() : nullptr;
+}
+
+const char* File::name() const {
+    if (!impl) {
+        return nullptr;
+    }
+    const char* slash = strrchr(impl->path.c_str(), '/');
+    return slash ? slash + 1 : impl->path.c_str();
+}
+
+bool File::isDirectory() {
+    return impl && impl->open && !impl->data;
+}
+
+File File::openNextFile(const char* mode) {
+    if (!isDirectory()) {
+        return File();
+    }
+    while (impl->nextEntry < impl->entries.size()) {
+        // Skip files removed since the directory was opened
+        std::shared_ptr<FileImpl> next = openFile(impl->entries[impl->nextEntry++], mode);
+        if (next) {
+            return File(next);
+        }
+    }
+    return File();
+}
+
+void File::rewindDirectory() {
+    if (isDirectory()) {
+        impl->entries = simFlash.list(impl->path);
+        impl->nextEntry = 0;
+    }
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+    (void)create;
+    if (!path || path[0] != '/') {
+        return File();
+    }
+    return File(openFile(path, mode));
+}
+
+File FS::open(const String& path, const char* mode, bool create) {
+    return open(path.c_str(), mode, create);
+}
+
+bool FS::exists(const char* path) {
+    return path && simFlash.exists(path);
+}
+
+bool FS::exists(const String& path) {
+    return exists(path.c_str());
+}
+
+bool FS::remove(const char* path) {
+    return path && simFlash.remove(path);
+}
+
+bool FS::remove(const String& path) {
+    return remove(path.c_str());
+}
+
+bool FS::rename(const char* from, const char* to) {
+    return from && to && simFlash.rename(from, to);
+}
+
+bool FS::rename(const String& from, const String& to) {
+    return rename(from.c_str(), to.c_str());
+}
+
+// SPIFFS has no directories, mkdir and rmdir fail as they do on the device
+bool FS::mkdir(const char* path) {
+    (void)path;
+    return false;
+}
+
+bool FS::mkdir(const String& path) {
+    return mkdir(path.c_str());
+}
+
+bool FS::rmdir(const char* path) {
+    (void)path;
+    return false;
+}
+
+bool FS::rmdir(const String& path) {
+    return rmdir(path.c_str());
+}
+
+} // namespace fs
@@ -0,0 +1,70 @@
+#ifndef SIM_FS_H
+#define SIM_FS_H
+
+#include <memory>
+#include <vector>
+#include <string>
+#include "Stream.h"
+
+namespace fs {
+
+class FileImpl;
+
+// Same interface as the ESP32 core's fs::File, backed by the simulator's
+// in-memory flash (SimFlash)
+class File : public Stream {
+public:
+    File();
+    explicit File(std::shared_ptr<FileImpl> impl);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override;
+    size_t read(uint8_t* buffer, size_t size);
+    bool seek(uint32_t position);
+    size_t position() const;
+    size_t size() const;
+    void close();
+    operator bool() const;
+    const char* path() const;
+    const char* name() const;
+    bool isDirectory();
+    File openNextFile(const char* mode = "r");
+    void rewindDirectory();
+
+private:
+    std::shared_ptr<FileImpl> impl;
+};
+
+class FS {
+public:
+    virtual ~FS() {}
+
+    File open(const char* path, const char* mode = "r", bool create = false);
+    File open(const String& path, const char* mode = "r", bool create = false);
+    bool exists(const char* path);
+    bool exists(const String& path);
+    bool remove(const char* path);
+    bool remove(const String& path);
+    bool rename(const char* from, const char* to);
+    bool rename(const String& from, const String& to);
+    bool mkdir(const char* path);
+    bool mkdir(const String& path);
+    bool rmdir(const char* path);
+    bool rmdir(const String& path);
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+#endif
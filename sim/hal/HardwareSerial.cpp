@@ -0,0 +1,92 @@
+#include "HardwareSerial.h"
+#include "SimNmeaFeed.h"
+#include <stdio.h>
+
+HardwareSerial Serial(0);
+HardwareSerial Serial2(2);
+
+static const int GPS_UART = 2;
+
+HardwareSerial::HardwareSerial(int uart) {
+    this->uart = uart;
+    echo = false;
+    bytesWritten = 0;
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t txPin) {
+    (void)config;
+    (void)rxPin;
+    (void)txPin;
+    updateBaudRate(baud);
+}
+
+void HardwareSerial::end() {
+    fflush(stdout);
+}
+
+void HardwareSerial::updateBaudRate(unsigned long baud) {
+    if (uart == GPS_UART) {
+        simNmeaFeed.setHostBaud((uint32_t)baud);
+    }
+}
+
+size_t HardwareSerial::setRxBufferSize(size_t size) {
+    return size;
+}
+
+void HardwareSerial::onReceive(std::function<void(void)> callback, bool onlyOnTimeout) {
+    (void)onlyOnTimeout;
+    receiveCallback = callback;
+}
+
+void HardwareSerial::setEcho(bool echo) {
+    this->echo = echo;
+}
+
+unsigned long HardwareSerial::getBytesWritten() {
+    return bytesWritten;
+}
+
+int HardwareSerial::available() {
+    return uart == GPS_UART ? simNmeaFeed.available() : 0;
+}
+
+int HardwareSerial::read() {
+    return uart == GPS_UART ? simNmeaFeed.read() : -1;
+}
+
+int HardwareSerial::peek() {
+    return uart == GPS_UART ? simNmeaFeed.peek() : -1;
+}
+
+size_t HardwareSerial::read(uint8_t* buffer, size_t size) {
+    return readBytes(buffer, size);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    bytesWritten += size;
+    if (uart == GPS_UART) {
+        for (size_t i = 0; i < size; i++) {
+            simNmeaFeed.write(buffer[i]);
+        }
+        return size;
+    }
+    if (echo) {
+        for (size_t i = 0; i < size; i++) {
+            if (buffer[i] != '\r') {
+                fputc(buffer[i], stdout);
+            }
+        }
+    }
+    return size;
+}
+
+void HardwareSerial::flush() {
+    if (uart != GPS_UART) {
+        fflush(stdout);
+    }
+}
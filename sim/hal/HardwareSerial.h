@@ -0,0 +1,50 @@
+#ifndef SIM_HARDWARE_SERIAL_H
+#define SIM_HARDWARE_SERIAL_H
+
+#include <functional>
+#include "Stream.h"
+
+#define SERIAL_8N1 0x800001c
+
+// UART 0 is the USB console: output goes to stdout when echo is on and is
+// only counted otherwise (the firmware traces every method call); nothing
+// is ever received. UART 2 is wired to the simulated NEO-6M, whatever the
+// pins: it receives its output and hands it what is written. The receive
+// event callback is kept but never called, there are no tasks to wake.
+class HardwareSerial : public Stream {
+public:
+    HardwareSerial(int uart);
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1);
+    void end();
+    void updateBaudRate(unsigned long baud);
+    // The simulated receive buffer is set with --uart-buffer instead
+    size_t setRxBufferSize(size_t size);
+    void onReceive(std::function<void(void)> callback, bool onlyOnTimeout = false);
+    void setEcho(bool echo);
+    unsigned long getBytesWritten();
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t* buffer, size_t size);
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override;
+    using Print::write;
+
+    operator bool() const {
+        return true;
+    }
+
+private:
+    int uart;
+    bool echo;
+    unsigned long bytesWritten;
+    std::function<void(void)> receiveCallback;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+#endif
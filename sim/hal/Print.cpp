@@ -0,0 +1,67 @@
+#include "Print.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (!write(*buffer++)) {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+size_t Print::write(const char* text) {
+    return text ? write((const uint8_t*)text, strlen(text)) : 0;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char small[128];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (length < 0) {
+        return 0;
+    }
+    if ((size_t)length < sizeof(small)) {
+        return write((const uint8_t*)small, length);
+    }
+    char* buffer = new char[length + 1];
+    va_start(args, format);
+    vsnprintf(buffer, length + 1, format, args);
+    va_end(args);
+    size_t n = write((const uint8_t*)buffer, length);
+    delete[] buffer;
+    return n;
+}
+
+size_t Print::print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+size_t Print::print(const char* text) { return write(text); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(unsigned char value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(int value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(unsigned int value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(unsigned long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(long long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(unsigned long long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(double value, int digits) { return print(String(value, (unsigned int)digits)); }
+size_t Print::print(const Printable& value) { return value.printTo(*this); }
+
+size_t Print::println() { return write("\r\n"); }
+size_t Print::println(const String& s) { return print(s) + println(); }
+size_t Print::println(const char* text) { return print(text) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(unsigned char value, int base) { return print(value, base) + println(); }
+size_t Print::println(int value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned int value, int base) { return print(value, base) + println(); }
+size_t Print::println(long value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned long value, int base) { return print(value, base) + println(); }
+size_t Print::println(long long value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned long long value, int base) { return print(value, base) + println(); }
+size_t Print::println(double value, int digits) { return print(value, digits) + println(); }
+size_t Print::println(const Printable& value) { return print(value) + println(); }
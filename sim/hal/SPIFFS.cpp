@@ -0,0 +1,32 @@
+#include "SPIFFS.h"
+#include "SimFlash.h"
+
+fs::SPIFFSFS SPIFFS;
+
+namespace fs {
+
+bool SPIFFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+    (void)formatOnFail;
+    (void)basePath;
+    (void)maxOpenFiles;
+    (void)partitionLabel;
+    return true;
+}
+
+bool SPIFFSFS::format() {
+    simFlash.format();
+    return true;
+}
+
+size_t SPIFFSFS::totalBytes() {
+    return simFlash.getCapacity();
+}
+
+size_t SPIFFSFS::usedBytes() {
+    return simFlash.getUsedBytes();
+}
+
+void SPIFFSFS::end() {
+}
+
+} // namespace fs
@@ -0,0 +1,59 @@
+#ifndef SIM_STREAM_H
+#define SIM_STREAM_H
+
+#include "Print.h"
+
+// Reads never wait: the simulated devices hand over what has arrived by the
+// current virtual time, so the read timeout does not apply
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) {
+        this->timeout = timeout;
+    }
+
+    size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            int c = read();
+            if (c < 0) {
+                break;
+            }
+            *buffer++ = (char)c;
+            count++;
+        }
+        return count;
+    }
+
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        return readBytes((char*)buffer, length);
+    }
+
+    String readString() {
+        String result;
+        int c = read();
+        while (c >= 0) {
+            result += (char)c;
+            c = read();
+        }
+        return result;
+    }
+
+    String readStringUntil(char terminator) {
+        String result;
+        int c = read();
+        while (c >= 0 && c != terminator) {
+            result += (char)c;
+            c = read();
+        }
+        return result;
+    }
+
+protected:
+    unsigned long timeout = 1000;
+};
+
+#endif
@@ -0,0 +1,298 @@
+#include "WString.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <strings.h>
+
+static std::string formatUnsigned(unsigned long long value, unsigned char base) {
+    if (base < 2 || base > 36) {
+        base = 10;
+    }
+    char buffer[66];
+    int i = sizeof(buffer) - 1;
+    buffer[i] = 0;
+    do {
+        int digit = (int)(value % base);
+        buffer[--i] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        value /= base;
+    } while (value > 0);
+    return std::string(buffer + i);
+}
+
+static std::string formatSigned(long long value, unsigned char base) {
+    // Like the core, only decimal shows a sign; other bases print the
+    // two's complement
+    if (base == 10 && value < 0) {
+        return "-" + formatUnsigned(0ULL - (unsigned long long)value, base);
+    }
+    return formatUnsigned((unsigned long long)value, base);
+}
+
+static std::string formatDouble(double value, unsigned int decimalPlaces) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimalPlaces, value);
+    return std::string(buffer);
+}
+
+String::String(const char* text) : text(text ? text : "") {}
+String::String(const String& other) : text(other.text) {}
+String::String(String&& other) : text(std::move(other.text)) {}
+String::String(char c) : text(1, c) {}
+String::String(unsigned char value, unsigned char base) : text(formatUnsigned(value, base)) {}
+String::String(int value, unsigned char base) : text(formatSigned(base == 10 ? (long long)value : (long long)(unsigned int)value, base)) {}
+String::String(unsigned int value, unsigned char base) : text(formatUnsigned(value, base)) {}
+String::String(long value, unsigned char base) : text(formatSigned(base == 10 ? (long long)value : (long long)(unsigned long)value, base)) {}
+String::String(unsigned long value, unsigned char base) : text(formatUnsigned(value, base)) {}
+String::String(long long value, unsigned char base) : text(formatSigned(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : text(formatUnsigned(value, base)) {}
+String::String(float value, unsigned int decimalPlaces) : text(formatDouble(value, decimalPlaces)) {}
+String::String(double value, unsigned int decimalPlaces) : text(formatDouble(value, decimalPlaces)) {}
+
+String& String::operator=(const String& other) {
+    text = other.text;
+    return *this;
+}
+
+String& String::operator=(String&& other) {
+    text = std::move(other.text);
+    return *this;
+}
+
+String& String::operator=(const char* value) {
+    text = value ? value : "";
+    return *this;
+}
+
+bool String::reserve(unsigned int size) {
+    text.reserve(size);
+    return true;
+}
+
+unsigned int String::length() const {
+    return (unsigned int)text.size();
+}
+
+bool String::isEmpty() const {
+    return text.empty();
+}
+
+const char* String::c_str() const {
+    return text.c_str();
+}
+
+bool String::concat(const String& other) {
+    text += other.text;
+    return true;
+}
+
+bool String::concat(const char* value) {
+    if (!value) {
+        return false;
+    }
+    text += value;
+    return true;
+}
+
+bool String::concat(const char* value, unsigned int length) {
+    if (!value) {
+        return false;
+    }
+    text.append(value, length);
+    return true;
+}
+
+bool String::concat(char c) {
+    text += c;
+    return true;
+}
+
+bool String::concat(unsigned char value) { return concat(String(value)); }
+bool String::concat(int value) { return concat(String(value)); }
+bool String::concat(unsigned int value) { return concat(String(value)); }
+bool String::concat(long value) { return concat(String(value)); }
+bool String::concat(unsigned long value) { return concat(String(value)); }
+bool String::concat(long long value) { return concat(String(value)); }
+bool String::concat(unsigned long long value) { return concat(String(value)); }
+bool String::concat(float value) { return concat(String(value)); }
+bool String::concat(double value) { return concat(String(value)); }
+
+int String::compareTo(const String& other) const {
+    return text.compare(other.text);
+}
+
+bool String::equals(const String& other) const {
+    return text == other.text;
+}
+
+bool String::equals(const char* value) const {
+    return text == (value ? value : "");
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    return text.size() == other.text.size() && strcasecmp(text.c_str(), other.text.c_str()) == 0;
+}
+
+bool String::startsWith(const String& prefix) const {
+    return startsWith(prefix, 0);
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const {
+    return offset <= text.size() && text.compare(offset, prefix.text.size(), prefix.text) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return suffix.text.size() <= text.size()
+        && text.compare(text.size() - suffix.text.size(), suffix.text.size(), suffix.text) == 0;
+}
+
+char String::charAt(unsigned int index) const {
+    return index < text.size() ? text[index] : 0;
+}
+
+void String::setCharAt(unsigned int index, char c) {
+    if (index < text.size()) {
+        text[index] = c;
+    }
+}
+
+char String::operator[](unsigned int index) const {
+    return charAt(index);
+}
+
+char& String::operator[](unsigned int index) {
+    static char dummy;
+    if (index >= text.size()) {
+        dummy = 0;
+        return dummy;
+    }
+    return text[index];
+}
+
+static int toIndex(size_t position) {
+    return position == std::string::npos ? -1 : (int)position;
+}
+
+int String::indexOf(char c) const { return toIndex(text.find(c)); }
+int String::indexOf(char c, unsigned int fromIndex) const { return toIndex(text.find(c, fromIndex)); }
+int String::indexOf(const String& value) const { return toIndex(text.find(value.text)); }
+int String::indexOf(const String& value, unsigned int fromIndex) const { return toIndex(text.find(value.text, fromIndex)); }
+int String::lastIndexOf(char c) const { return toIndex(text.rfind(c)); }
+int String::lastIndexOf(char c, unsigned int fromIndex) const { return toIndex(text.rfind(c, fromIndex)); }
+int String::lastIndexOf(const String& value) const { return toIndex(text.rfind(value.text)); }
+
+String String::substring(unsigned int beginIndex) const {
+    return substring(beginIndex, (unsigned int)text.size());
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex > endIndex) {
+        unsigned int t = beginIndex;
+        beginIndex = endIndex;
+        endIndex = t;
+    }
+    if (beginIndex >= text.size()) {
+        return String();
+    }
+    if (endIndex > text.size()) {
+        endIndex = (unsigned int)text.size();
+    }
+    return String(text.substr(beginIndex, endIndex - beginIndex).c_str());
+}
+
+void String::replace(char find, char replacement) {
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == find) {
+            text[i] = replacement;
+        }
+    }
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find.text.empty()) {
+        return;
+    }
+    size_t position = 0;
+    while ((position = text.find(find.text, position)) != std::string::npos) {
+        text.replace(position, find.text.size(), replacement.text);
+        position += replacement.text.size();
+    }
+}
+
+void String::remove(unsigned int index) {
+    if (index < text.size()) {
+        text.erase(index);
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index < text.size()) {
+        text.erase(index, count);
+    }
+}
+
+void String::toLowerCase() {
+    for (size_t i = 0; i < text.size(); i++) {
+        text[i] = (char)tolower((unsigned char)text[i]);
+    }
+}
+
+void String::toUpperCase() {
+    for (size_t i = 0; i < text.size(); i++) {
+        text[i] = (char)toupper((unsigned char)text[i]);
+    }
+}
+
+void String::trim() {
+    size_t begin = 0;
+    while (begin < text.size() && isspace((unsigned char)text[begin])) {
+        begin++;
+    }
+    size_t end = text.size();
+    while (end > begin && isspace((unsigned char)text[end - 1])) {
+        end--;
+    }
+    text = text.substr(begin, end - begin);
+}
+
+long String::toInt() const {
+    return atol(text.c_str());
+}
+
+float String::toFloat() const {
+    return (float)atof(text.c_str());
+}
+
+double String::toDouble() const {
+    return atof(text.c_str());
+}
+
+StringSumHelper operator+(const StringSumHelper& lhs, const String& rhs) {
+    StringSumHelper result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+StringSumHelper operator+(const StringSumHelper& lhs, const char* rhs) {
+    StringSumHelper result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+#define SUM_OPERATOR(TYPE) \
+    StringSumHelper operator+(const StringSumHelper& lhs, TYPE rhs) { \
+        StringSumHelper result(lhs); \
+        result.concat(rhs); \
+        return result; \
+    }
+
+SUM_OPERATOR(char)
+SUM_OPERATOR(unsigned char)
+SUM_OPERATOR(int)
+SUM_OPERATOR(unsigned int)
+SUM_OPERATOR(long)
+SUM_OPERATOR(unsigned long)
+SUM_OPERATOR(long long)
+SUM_OPERATOR(unsigned long long)
+SUM_OPERATOR(float)
+SUM_OPERATOR(double)
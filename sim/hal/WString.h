@@ -0,0 +1,131 @@
+#ifndef SIM_WSTRING_H
+#define SIM_WSTRING_H
+
+#include <stddef.h>
+#include <string>
+
+class StringSumHelper;
+
+// Arduino String on top of std::string, with the same conversions and
+// concatenation rules as the ESP32 core
+class String {
+public:
+    String(const char* text = "");
+    String(const String& other);
+    String(String&& other);
+    explicit String(char c);
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(float value, unsigned int decimalPlaces = 2);
+    explicit String(double value, unsigned int decimalPlaces = 2);
+    ~String() {}
+
+    String& operator=(const String& other);
+    String& operator=(String&& other);
+    String& operator=(const char* text);
+
+    bool reserve(unsigned int size);
+    unsigned int length() const;
+    bool isEmpty() const;
+    const char* c_str() const;
+
+    bool concat(const String& other);
+    bool concat(const char* text);
+    bool concat(const char* text, unsigned int length);
+    bool concat(char c);
+    bool concat(unsigned char value);
+    bool concat(int value);
+    bool concat(unsigned int value);
+    bool concat(long value);
+    bool concat(unsigned long value);
+    bool concat(long long value);
+    bool concat(unsigned long long value);
+    bool concat(float value);
+    bool concat(double value);
+
+    template <typename T>
+    String& operator+=(const T& value) {
+        concat(value);
+        return *this;
+    }
+
+    int compareTo(const String& other) const;
+    bool equals(const String& other) const;
+    bool equals(const char* text) const;
+    bool equalsIgnoreCase(const String& other) const;
+    bool startsWith(const String& prefix) const;
+    bool startsWith(const String& prefix, unsigned int offset) const;
+    bool endsWith(const String& suffix) const;
+    bool operator==(const String& other) const { return equals(other); }
+    bool operator==(const char* text) const { return equals(text); }
+    bool operator!=(const String& other) const { return !equals(other); }
+    bool operator!=(const char* text) const { return !equals(text); }
+    bool operator<(const String& other) const { return compareTo(other) < 0; }
+    bool operator>(const String& other) const { return compareTo(other) > 0; }
+
+    char charAt(unsigned int index) const;
+    void setCharAt(unsigned int index, char c);
+    char operator[](unsigned int index) const;
+    char& operator[](unsigned int index);
+
+    int indexOf(char c) const;
+    int indexOf(char c, unsigned int fromIndex) const;
+    int indexOf(const String& text) const;
+    int indexOf(const String& text, unsigned int fromIndex) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(char c, unsigned int fromIndex) const;
+    int lastIndexOf(const String& text) const;
+    String substring(unsigned int beginIndex) const;
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    void replace(char find, char replacement);
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+private:
+    std::string text;
+};
+
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& s) : String(s) {}
+    StringSumHelper(const char* p) : String(p) {}
+    StringSumHelper(char c) : String(c) {}
+    StringSumHelper(unsigned char value) : String(value) {}
+    StringSumHelper(int value) : String(value) {}
+    StringSumHelper(unsigned int value) : String(value) {}
+    StringSumHelper(long value) : String(value) {}
+    StringSumHelper(unsigned long value) : String(value) {}
+    StringSumHelper(long long value) : String(value) {}
+    StringSumHelper(unsigned long long value) : String(value) {}
+    StringSumHelper(float value) : String(value) {}
+    StringSumHelper(double value) : String(value) {}
+};
+
+StringSumHelper operator+(const StringSumHelper& lhs, const String& rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, const char* rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, char rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, unsigned char rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, int rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, unsigned int rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, long rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, unsigned long rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, long long rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, unsigned long long rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, float rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, double rhs);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+#include <stdint.h>
+
+// Only the OLED sits on I2C, and its driver is simulated whole
+class TwoWire {
+public:
+    bool begin() {
+        return true;
+    }
+    void setClock(uint32_t frequency) {
+        (void)frequency;
+    }
+};
+
+extern TwoWire Wire;
+
+#endif
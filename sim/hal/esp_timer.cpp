@@ -0,0 +1,58 @@
+#include "esp_timer.h"
+#include "SimClock.h"
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+    if (!args || !args->callback || !handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *handle = simClock.createTimer(args->callback, args->arg);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutMicros) {
+    if (!timer) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    simClock.startTimer(timer, timeoutMicros, 0);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodMicros) {
+    if (!timer || periodMicros == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    simClock.startTimer(timer, periodMicros, periodMicros);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    simClock.stopTimer(timer);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (!timer) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    simClock.deleteTimer(timer);
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)simClock.now();
+}
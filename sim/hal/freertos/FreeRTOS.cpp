@@ -0,0 +1,114 @@
+#include "FreeRTOS.h"
+#include "SimClock.h"
+
+// Stands in for the one task the simulator runs, loopTask on core 1
+static int currentTask;
+static int dummyMutex;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* parameters,
+                                   UBaseType_t priority, TaskHandle_t* createdTask, BaseType_t coreId) {
+    (void)function;
+    (void)name;
+    (void)stackDepth;
+    (void)parameters;
+    (void)priority;
+    (void)coreId;
+    if (createdTask) {
+        *createdTask = nullptr;
+    }
+    return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    uint32_t quantum = simClock.getLoopQuantum();
+    uint64_t ms = ticks > quantum ? ticks : quantum;
+    simClock.advanceBy(ms * 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return &currentTask;
+}
+
+BaseType_t xPortGetCoreID() {
+    return 1;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    (void)task;
+    return 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    (void)task;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+    (void)clearCountOnExit;
+    (void)ticksToWait;
+    return 0;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    (void)length;
+    (void)itemSize;
+    return nullptr;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    (void)queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    (void)queue;
+    (void)item;
+    (void)ticksToWait;
+    return pdFALSE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticksToWait) {
+    (void)queue;
+    (void)buffer;
+    (void)ticksToWait;
+    return pdFALSE;
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    (void)queue;
+    (void)item;
+    return pdFALSE;
+}
+
+// One thread: every take succeeds at once
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return &dummyMutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return &dummyMutex;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    (void)semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    return semaphore ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return semaphore ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+    return xSemaphoreTake(semaphore, ticksToWait);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore) {
+    return xSemaphoreGive(semaphore);
+}
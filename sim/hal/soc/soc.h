@@ -0,0 +1,16 @@
+#ifndef SIM_SOC_H
+#define SIM_SOC_H
+
+#include <stdint.h>
+
+// Peripheral registers are routed to the simulated board; only the GPIO
+// output and input registers exist
+void simRegWrite(uint32_t address, uint32_t value);
+uint32_t simRegRead(uint32_t address);
+
+#define REG_WRITE(address, value) simRegWrite((uint32_t)(address), (uint32_t)(value))
+#define REG_READ(address) simRegRead((uint32_t)(address))
+
+#define DR_REG_GPIO_BASE 0x3ff44000
+
+#endif
@@ -0,0 +1,306 @@
+// Entry point of the native_sim build: runs the firmware's setup() and
+// loop() against the simulated board for a span of virtual time, then
+// prints what the board saw. Exit status is 2 if the motor was driven
+// through an illegal coil sequence, 1 on bad arguments.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+#include "SimClock.h"
+#include "SimGpio.h"
+#include "SimMotor.h"
+#include "SimNmeaFeed.h"
+#include "SimBluetooth.h"
+#include "SimFlash.h"
+#include "SimDisplay.h"
+#include "SimRunner.h"
+#include "../src/classes/StepperController.h"
+#include "../src/classes/TimeService.h"
+
+extern StepperController* stepperController;
+extern TimeService* timeService;
+
+// The tests have their own main()
+#ifndef PIO_UNIT_TESTING
+
+struct Options {
+    double seconds = 3600;
+    uint32_t loopMillis = 1;
+    const char* tracePath = nullptr;
+    double traceInterval = 60;
+    const char* fsDump = nullptr;
+    std::vector<const char*> fsFiles;
+};
+
+static void usage() {
+    printf("Usage: program [options]\n"
+           "  --days N, --hours N, --seconds N  virtual time to run (default 1 hour)\n"
+           "  --loop-ms N          least virtual time per loop() pass (default 1)\n"
+           "  --start T            UTC start, epoch seconds or YYYY-MM-DDTHH:MM:SS\n"
+           "  --lat D --lon D --alt M  position reported by the GPS\n"
+           "  --fix-after S        seconds until the GPS has a fix (default 30)\n"
+           "  --no-fix             the GPS never gets a fix\n"
+           "  --aided-fix-after S  seconds until the fix once the GPS is sent a position\n"
+           "  --nmea FILE          replay \"<seconds> <sentence>\" lines instead\n"
+           "  --uart-buffer N      GPS receive buffer in bytes, overflow is dropped\n"
+           "  --crystal-ppm P      the ESP32 clock runs P ppm fast against GPS time\n"
+           "  --no-pps             the GPS PPS pin is not connected\n"
+           "  --pps-outage S,D     no PPS pulses for D seconds from S seconds\n"
+           "  --bt FILE            Bluetooth terminal script, \"<seconds> <text>\" lines\n"
+           "  --gear N             full steps per output revolution (default 2048)\n"
+           "  --backlash N         gear backlash in full steps\n"
+           "  --index-angle D --index-width D  index sensor arc (default 90, 3)\n"
+           "  --flash-size N       SPIFFS capacity in bytes\n"
+           "  --fs-dump DIR        copy the flash files to DIR at the end\n"
+           "  --fs-file FILE       copy FILE into the flash root first (repeatable)\n"
+           "  --trace FILE         CSV of the dial and shaft over time\n"
+           "  --trace-interval S   seconds between trace rows (default 60)\n"
+           "  --serial             echo the firmware's Serial output\n");
+}
+
+static bool parseTime(const char* text, time_t* result) {
+    int year, month, day, hour = 0, minute = 0, second = 0;
+    if (sscanf(text, "%d-%d-%dT%d:%d:%d", &year, &month, &day, &hour, &minute, &second) >= 3) {
+        struct tm fields = {};
+        fields.tm_year = year - 1900;
+        fields.tm_mon = month - 1;
+        fields.tm_mday = day;
+        fields.tm_hour = hour;
+        fields.tm_min = minute;
+        fields.tm_sec = second;
+        *result = timegm(&fields);
+        return true;
+    }
+    char* end = nullptr;
+    long long epoch = strtoll(text, &end, 10);
+    if (end == text || *end != 0) {
+        return false;
+    }
+    *result = (time_t)epoch;
+    return true;
+}
+
+static bool parseOptions(int argc, char** argv, Options* options) {
+    double latitude = 40.5169;
+    double longitude = -74.4063;
+    double altitude = 0;
+    double indexAngle = 90;
+    double indexWidth = 3;
+
+    for (int i = 1; i < argc; i++) {
+        const char* name = argv[i];
+        bool hasValue = i + 1 < argc;
+        const char* value = hasValue ? argv[i + 1] : nullptr;
+
+        if (strcmp(name, "--no-fix") == 0) {
+            simNmeaFeed.setFixEnabled(false);
+            continue;
+        }
+        if (strcmp(name, "--no-pps") == 0) {
+            simNmeaFeed.setPpsEnabled(false);
+            continue;
+        }
+        if (strcmp(name, "--serial") == 0) {
+            Serial.setEcho(true);
+            continue;
+        }
+        if (strcmp(name, "--help") == 0 || strcmp(name, "-h") == 0 || !hasValue) {
+            return false;
+        }
+        i++;
+
+        if (strcmp(name, "--days") == 0) {
+            options->seconds = atof(value) * 86400;
+        } else if (strcmp(name, "--hours") == 0) {
+            options->seconds = atof(value) * 3600;
+        } else if (strcmp(name, "--seconds") == 0) {
+            options->seconds = atof(value);
+        } else if (strcmp(name, "--loop-ms") == 0) {
+            options->loopMillis = (uint32_t)atoi(value);
+        } else if (strcmp(name, "--start") == 0) {
+            time_t start;
+            if (!parseTime(value, &start)) {
+                fprintf(stderr, "Bad start time: %s\n", value);
+                return false;
+            }
+            simNmeaFeed.setStartTime(start);
+        } else if (strcmp(name, "--lat") == 0) {
+            latitude = atof(value);
+        } else if (strcmp(name, "--lon") == 0) {
+            longitude = atof(value);
+        } else if (strcmp(name, "--alt") == 0) {
+            altitude = atof(value);
+        } else if (strcmp(name, "--fix-after") == 0) {
+            simNmeaFeed.setFixAfter((uint32_t)atoi(value));
+        } else if (strcmp(name, "--aided-fix-after") == 0) {
+            simNmeaFeed.setAidedFixAfter((uint32_t)atoi(value));
+        } else if (strcmp(name, "--nmea") == 0) {
+            if (!simNmeaFeed.loadScript(value)) {
+                fprintf(stderr, "Cannot read %s\n", value);
+                return false;
+            }
+        } else if (strcmp(name, "--uart-buffer") == 0) {
+            simNmeaFeed.setBufferLimit((size_t)atol(value));
+        } else if (strcmp(name, "--crystal-ppm") == 0) {
+            simNmeaFeed.setCrystalPpm(atof(value));
+        } else if (strcmp(name, "--pps-outage") == 0) {
+            double from, seconds;
+            if (sscanf(value, "%lf,%lf", &from, &seconds) != 2) {
+                fprintf(stderr, "Bad PPS outage: %s\n", value);
+                return false;
+            }
+            simNmeaFeed.setPpsOutage(from, seconds);
+        } else if (strcmp(name, "--bt") == 0) {
+            if (!simBluetooth.loadScript(value)) {
+                fprintf(stderr, "Cannot read %s\n", value);
+                return false;
+            }
+        } else if (strcmp(name, "--gear") == 0) {
+            simMotor.setGear(atof(value));
+        } else if (strcmp(name, "--backlash") == 0) {
+            simMotor.setBacklash(atof(value));
+        } else if (strcmp(name, "--index-angle") == 0) {
+            indexAngle = atof(value);
+        } else if (strcmp(name, "--index-width") == 0) {
+            indexWidth = atof(value);
+        } else if (strcmp(name, "--flash-size") == 0) {
+            simFlash.setCapacity((size_t)atol(value));
+        } else if (strcmp(name, "--fs-dump") == 0) {
+            options->fsDump = value;
+        } else if (strcmp(name, "--fs-file") == 0) {
+            options->fsFiles.push_back(value);
+        } else if (strcmp(name, "--trace") == 0) {
+            options->tracePath = value;
+        } else if (strcmp(name, "--trace-interval") == 0) {
+            options->traceInterval = atof(value);
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", name);
+            return false;
+        }
+    }
+
+    simNmeaFeed.setLocation(latitude, longitude, altitude);
+    simMotor.setIndex(indexAngle, indexWidth);
+    return options->seconds > 0 && options->traceInterval > 0;
+}
+
+static void writeTraceRow(FILE* trace) {
+    MotorTelemetry motor = stepperController->getTelemetry();
+    double seconds = simClock.now() / 1000000.0;
+    fprintf(trace, "%.3f,%lld,%.4f,%.4f,%llu,%u,%u,%.4f,%u\n",
+            seconds, (long long)simNmeaFeed.getStartTime() + (long long)seconds,
+            motor.degrees, simMotor.getOutputDegrees(), (unsigned long long)simMotor.getHalfSteps(),
+            motor.maxPhaseError, motor.jitterRms, motor.angleError, simMotor.getFaults());
+}
+
+static void printReport(double wallSeconds) {
+    double simSeconds = simClock.now() / 1000000.0;
+    printf("\n=== Simulation report ===\n");
+    printf("Virtual time:    %.1f s (%.2f days) in %.2f s wall, %.0fx\n",
+           simSeconds, simSeconds / 86400.0, wallSeconds, wallSeconds > 0 ? simSeconds / wallSeconds : 0.0);
+    printf("Loop passes:     %llu, quantum %u ms\n", (unsigned long long)simRunner.getLoops(), simClock.getLoopQuantum());
+    printf("Timer events:    %llu\n", (unsigned long long)simClock.getTimerEvents());
+
+    MotorTelemetry motor = stepperController->getTelemetry();
+    printf("Motor:           %llu half steps, %u reversals, %u faults, min step interval %llu us\n",
+           (unsigned long long)simMotor.getHalfSteps(), simMotor.getReversals(), simMotor.getFaults(),
+           (unsigned long long)simMotor.getMinStepInterval());
+    printf("Shaft:           %.4f revolutions, at %.3f deg; dial reports %.3f deg\n",
+           simMotor.getOutputRevolutions(), simMotor.getOutputDegrees(), motor.degrees);
+    printf("Phase error:     max %u us, rms %u us, step records dropped %u\n",
+           motor.maxPhaseError, motor.jitterRms, motor.droppedRecords);
+    if (motor.timeLocked) {
+        printf("Angle error:     %.4f deg\n", motor.angleError);
+    }
+    printf("Coils energized: %.1f%% of the time\n",
+           simSeconds > 0 ? simMotor.getEnergizedMicros() / 10000.0 / simSeconds : 0.0);
+
+    printf("GPS:             %llu sentences or UBX messages, %llu bytes dropped\n",
+           (unsigned long long)simNmeaFeed.getSentences(), (unsigned long long)simNmeaFeed.getDroppedBytes());
+    TimeStatus time = timeService->getStatus();
+    uint64_t utc = timeService->getUtcMicros();
+    printf("Time:            %s, %llu pulses (%u taken, %u rejected, %u realigned)\n",
+           TimeService::getStateName(time.state), (unsigned long long)simNmeaFeed.getPulses(),
+           time.pulses, time.rejected, time.realigned);
+    if (utc != 0) {
+        printf("                 %+lld us against GPS time", (long long)(utc - simNmeaFeed.getUtcMicros()));
+        if (time.pulses > 0) {
+            printf(", last edge offset %+d us", time.lastOffset);
+        }
+        if (time.driftValid) {
+            printf(", crystal %+.3f ppm", time.driftPpb / 1000.0);
+        }
+        printf("\n");
+    }
+    if (simNmeaFeed.getAidings() > 0) {
+        double aidLatitude, aidLongitude;
+        simNmeaFeed.getAidPosition(&aidLatitude, &aidLongitude);
+        uint32_t flags = simNmeaFeed.getAidFlags();
+        printf("Aiding:          %u AID-INI, position %.5f %.5f%s%s\n", simNmeaFeed.getAidings(),
+               aidLatitude, aidLongitude, (flags & 0x02) ? ", time" : "", (flags & 0x04) ? ", clock drift" : "");
+    }
+    printf("Flash:           %zu of %zu bytes in %zu files, %u failed writes\n",
+           simFlash.getUsedBytes(), simFlash.getCapacity(), simFlash.getFileCount(), simFlash.getWriteFailures());
+    printf("Bluetooth:       %llu lines typed, %llu bytes sent\n",
+           (unsigned long long)simBluetooth.getLinesTyped(), (unsigned long long)simBluetooth.getBytesSent());
+    printf("Serial:          %lu bytes written\n", Serial.getBytesWritten());
+
+    printf("Display:         %llu frames, last:\n", (unsigned long long)simDisplay.getFrames());
+    for (const std::string& row : simDisplay.getLastFrame()) {
+        printf("  |%s|\n", row.c_str());
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage();
+        return 1;
+    }
+    for (const char* path : options.fsFiles) {
+        if (!simFlash.load(path)) {
+            fprintf(stderr, "Cannot copy %s into the flash\n", path);
+            return 1;
+        }
+    }
+    FILE* trace = nullptr;
+    if (options.tracePath) {
+        trace = fopen(options.tracePath, "w");
+        if (!trace) {
+            fprintf(stderr, "Cannot write %s\n", options.tracePath);
+            return 1;
+        }
+        fprintf(trace, "seconds,utc,dial_degrees,shaft_degrees,half_steps,max_phase_error_us,"
+                       "jitter_rms_us,angle_error_deg,faults\n");
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+    uint64_t endAt = (uint64_t)(options.seconds * 1000000.0);
+    uint64_t traceEvery = (uint64_t)(options.traceInterval * 1000000.0);
+    uint64_t nextTraceAt = 0;
+
+    simRunner.begin(options.loopMillis);
+    while (simClock.now() < endAt) {
+        simRunner.runOnce();
+        if (trace && simClock.now() >= nextTraceAt) {
+            writeTraceRow(trace);
+            nextTraceAt += traceEvery;
+        }
+    }
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    if (trace) {
+        fclose(trace);
+    }
+    fflush(stdout);
+    printReport(wallSeconds);
+    if (options.fsDump && !simFlash.dump(options.fsDump)) {
+        fprintf(stderr, "Could not dump the flash to %s\n", options.fsDump);
+    }
+    return simMotor.getFaults() > 0 ? 2 : 0;
+}
+#endif
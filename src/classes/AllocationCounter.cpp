@@ -0,0 +1,86 @@
+#ifdef BENCHMARK
+
+#include "AllocationCounter.h"
+#include <new>
+
+static TaskHandle_t countedTask = nullptr;
+static volatile uint32_t allocationCount = 0;
+static volatile uint32_t allocationBytes = 0;
+
+static inline void record(size_t size) {
+    if (countedTask && xTaskGetCurrentTaskHandle() == countedTask) {
+        allocationCount = allocationCount + 1;
+        allocationBytes = allocationBytes + size;
+    }
+}
+
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* pointer, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    record(size);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    record(count * size);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* pointer, size_t size) {
+    // Growing a String in place still goes to the allocator
+    record(size);
+    return __real_realloc(pointer, size);
+}
+
+}
+
+#ifdef SIMULATOR
+// The host's libstdc++ is a shared library, so its operator new reaches
+// malloc without passing the wrapper; count it here instead
+void* operator new(size_t size) {
+    record(size);
+    void* pointer = __real_malloc(size ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    free(pointer);
+}
+#endif
+
+void AllocationCounter::begin() {
+    Serial.println("AllocationCounter::begin()");
+    allocationCount = 0;
+    allocationBytes = 0;
+    countedTask = xTaskGetCurrentTaskHandle();
+}
+
+void AllocationCounter::end() {
+    Serial.println("AllocationCounter::end()");
+    countedTask = nullptr;
+}
+
+uint32_t AllocationCounter::getCount() {
+    return allocationCount;
+}
+
+uint32_t AllocationCounter::getBytes() {
+    return allocationBytes;
+}
+
+#endif
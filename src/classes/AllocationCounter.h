@@ -0,0 +1,19 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <Arduino.h>
+
+// Counts heap allocations made by one task. The benchmark environments
+// link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc so every
+// allocation passes through here; other tasks' allocations are ignored.
+// Compiled in BENCHMARK builds only.
+class AllocationCounter {
+public:
+    // Count from now on, for the calling task
+    static void begin();
+    static void end();
+    static uint32_t getCount();
+    static uint32_t getBytes();
+};
+
+#endif
@@ -0,0 +1,214 @@
+#include "AlmanacBatch.h"
+#include <TimeLib.h>
+
+AlmanacBatch::AlmanacBatch(uint16_t capacity) {
+    Serial.println("AlmanacBatch::AlmanacBatch()");
+    this->capacity = capacity;
+    count = 0;
+    timezoneOffset = 0;
+    columns.localDay = new int32_t[capacity];
+    columns.latitude = new float[capacity];
+    columns.longitude = new float[capacity];
+    columns.sunrise = new uint32_t[capacity];
+    columns.sunset = new uint32_t[capacity];
+    columns.solarNoon = new uint32_t[capacity];
+    columns.sunriseAzimuth = new float[capacity];
+    columns.sunsetAzimuth = new float[capacity];
+    columns.noonElevation = new float[capacity];
+    columns.moonRise = new uint32_t[capacity];
+    columns.moonSet = new uint32_t[capacity];
+    columns.moonRiseAzimuth = new float[capacity];
+    columns.moonSetAzimuth = new float[capacity];
+    columns.illumination = new float[capacity];
+    columns.moonAge = new float[capacity];
+    columns.flags = new uint8_t[capacity];
+    dayStart = new int64_t[capacity];
+}
+
+AlmanacBatch::~AlmanacBatch() {
+    Serial.println("AlmanacBatch::~AlmanacBatch()");
+    delete[] columns.localDay;
+    delete[] columns.latitude;
+    delete[] columns.longitude;
+    delete[] columns.sunrise;
+    delete[] columns.sunset;
+    delete[] columns.solarNoon;
+    delete[] columns.sunriseAzimuth;
+    delete[] columns.sunsetAzimuth;
+    delete[] columns.noonElevation;
+    delete[] columns.moonRise;
+    delete[] columns.moonSet;
+    delete[] columns.moonRiseAzimuth;
+    delete[] columns.moonSetAzimuth;
+    delete[] columns.illumination;
+    delete[] columns.moonAge;
+    delete[] columns.flags;
+    delete[] dayStart;
+}
+
+uint16_t AlmanacBatch::getCapacity() {
+    return capacity;
+}
+
+uint16_t AlmanacBatch::getCount() {
+    return count;
+}
+
+int AlmanacBatch::getTimezoneOffset() {
+    return timezoneOffset;
+}
+
+const AlmanacBatch::Columns& AlmanacBatch::getColumns() {
+    return columns;
+}
+
+bool AlmanacBatch::computeDays(long firstLocalDay, uint16_t rows, int timezone, float latitude, float longitude) {
+    Serial.println("AlmanacBatch::computeDays()");
+    if (rows > capacity) {
+        return false;
+    }
+    int32_t* localDay = columns.localDay;
+    float* latitudes = columns.latitude;
+    float* longitudes = columns.longitude;
+    for (uint16_t i = 0; i < rows; i++) {
+        localDay[i] = (int32_t)firstLocalDay + i;
+        latitudes[i] = latitude;
+        longitudes[i] = longitude;
+    }
+    prepare(rows, timezone);
+    solveRows();
+    return true;
+}
+
+bool AlmanacBatch::computeLocations(long localDay, int timezone, const float* latitudes, const float* longitudes, uint16_t rows) {
+    Serial.println("AlmanacBatch::computeLocations()");
+    if (rows > capacity) {
+        return false;
+    }
+    int32_t* days = columns.localDay;
+    float* latitudeColumn = columns.latitude;
+    float* longitudeColumn = columns.longitude;
+    for (uint16_t i = 0; i < rows; i++) {
+        days[i] = (int32_t)localDay;
+        latitudeColumn[i] = latitudes[i];
+        longitudeColumn[i] = longitudes[i];
+    }
+    prepare(rows, timezone);
+    solveRows();
+    return true;
+}
+
+void AlmanacBatch::prepare(uint16_t rows, int timezone) {
+    count = rows;
+    timezoneOffset = timezone;
+    const int32_t* localDay = columns.localDay;
+    int64_t* start = dayStart;
+    int64_t offset = (int64_t)timezone * 3600;
+    for (uint16_t i = 0; i < rows; i++) {
+        start[i] = (int64_t)localDay[i] * 86400 - offset;
+    }
+}
+
+void AlmanacBatch::solveRows() {
+    // Serial.println("AlmanacBatch::solveRows()"); // Commented out - called frequently
+    for (uint16_t i = 0; i < count; i++) {
+        int64_t start = dayStart[i];
+        int64_t end = start + 86400;
+        uint8_t flags = 0;
+        RiseSetSolver::Events events;
+
+        RiseSetSolver sun(RiseSetSolver::SUN, columns.latitude[i], columns.longitude[i]);
+        sun.solve(start, end, &events);
+        columns.sunrise[i] = events.riseCount > 0 ? (uint32_t)events.rises[0].time : 0;
+        columns.sunriseAzimuth[i] = events.riseCount > 0 ? events.rises[0].azimuth : 0;
+        columns.sunset[i] = events.setCount > 0 ? (uint32_t)events.sets[0].time : 0;
+        columns.sunsetAzimuth[i] = events.setCount > 0 ? events.sets[0].azimuth : 0;
+        columns.solarNoon[i] = events.transitCount > 0 ? (uint32_t)events.transits[0].time : 0;
+        columns.noonElevation[i] = events.transitCount > 0 ? events.transits[0].azimuth : 0;
+        flags |= events.alwaysUp ? AlmanacDay::SUN_UP : 0;
+        flags |= events.alwaysDown ? AlmanacDay::SUN_DOWN : 0;
+
+        RiseSetSolver moon(RiseSetSolver::MOON, columns.latitude[i], columns.longitude[i]);
+        RiseSetSolver::Event rise, set;
+        moon.solveRiseSet(start, end, &events, &rise, &set);
+        columns.moonRise[i] = (uint32_t)rise.time;
+        columns.moonRiseAzimuth[i] = rise.azimuth;
+        columns.moonSet[i] = (uint32_t)set.time;
+        columns.moonSetAzimuth[i] = set.azimuth;
+        flags |= events.alwaysUp ? AlmanacDay::MOON_UP : 0;
+        flags |= events.alwaysDown ? AlmanacDay::MOON_DOWN : 0;
+        columns.flags[i] = flags;
+
+        // At local noon, as in the stored almanac
+        LunarPhase::Info phase;
+        LunarPhase::getInfo((time_t)(start + 43200), &phase);
+        columns.illumination[i] = phase.illumination;
+        columns.moonAge[i] = phase.age;
+    }
+}
+
+void AlmanacBatch::formatTime(uint32_t localTime, char* buffer, size_t size) {
+    tmElements_t tm;
+    breakTime((time_t)localTime, tm);
+    snprintf(buffer, size, "%04d-%02d-%02d %02d:%02d:%02d", tm.Year + 1970, tm.Month, tm.Day,
+             tm.Hour, tm.Minute, tm.Second);
+}
+
+void AlmanacBatch::writeCsv(Print* output, bool withHeader) {
+    Serial.println("AlmanacBatch::writeCsv()");
+    if (withHeader) {
+        output->println("date,latitude,longitude,sunrise,sunset,solar_noon,sunrise_az,sunset_az,noon_elevation,"
+                        "moonrise,moonset,moonrise_az,moonset_az,illumination,moon_age,flags");
+    }
+    uint32_t offset = (uint32_t)(timezoneOffset * 3600);
+    const uint32_t* times[5] = {columns.sunrise, columns.sunset, columns.solarNoon, columns.moonRise, columns.moonSet};
+    char line[256];
+    char text[5][20];
+    for (uint16_t i = 0; i < count; i++) {
+        for (int t = 0; t < 5; t++) {
+            text[t][0] = '\0';
+            if (times[t][i]) {
+                formatTime(times[t][i] + offset, text[t], sizeof(text[t]));
+            }
+        }
+        char date[20];
+        formatTime((uint32_t)columns.localDay[i] * 86400, date, sizeof(date));
+        date[10] = '\0';
+        snprintf(line, sizeof(line), "%s,%.4f,%.4f,%s,%s,%s,%.1f,%.1f,%.1f,%s,%s,%.1f,%.1f,%.3f,%.2f,%u",
+                 date, columns.latitude[i], columns.longitude[i], text[0], text[1], text[2],
+                 columns.sunriseAzimuth[i], columns.sunsetAzimuth[i], columns.noonElevation[i],
+                 text[3], text[4], columns.moonRiseAzimuth[i], columns.moonSetAzimuth[i],
+                 columns.illumination[i], columns.moonAge[i], columns.flags[i]);
+        output->println(line);
+    }
+}
+
+void AlmanacBatch::writeBinary(Print* output) {
+    Serial.println("AlmanacBatch::writeBinary()");
+    // The columns as they are in memory, in Columns order
+    const uint8_t* data[] = {
+        (const uint8_t*)columns.localDay, (const uint8_t*)columns.latitude, (const uint8_t*)columns.longitude,
+        (const uint8_t*)columns.sunrise, (const uint8_t*)columns.sunset, (const uint8_t*)columns.solarNoon,
+        (const uint8_t*)columns.sunriseAzimuth, (const uint8_t*)columns.sunsetAzimuth,
+        (const uint8_t*)columns.noonElevation, (const uint8_t*)columns.moonRise, (const uint8_t*)columns.moonSet,
+        (const uint8_t*)columns.moonRiseAzimuth, (const uint8_t*)columns.moonSetAzimuth,
+        (const uint8_t*)columns.illumination, (const uint8_t*)columns.moonAge, columns.flags
+    };
+    const int columnCount = sizeof(data) / sizeof(data[0]);
+
+    Header header;
+    header.magic = MAGIC;
+    header.version = 1;
+    header.count = count;
+    header.timezoneOffset = (int16_t)timezoneOffset;
+    header.reserved = 0;
+    header.crc = 0;
+    for (int c = 0; c < columnCount; c++) {
+        size_t bytes = (size_t)count * (c == columnCount - 1 ? 1 : 4);
+        header.crc = AlmanacTable::crc32(data[c], bytes, header.crc);
+    }
+    output->write((const uint8_t*)&header, sizeof(header));
+    for (int c = 0; c < columnCount; c++) {
+        output->write(data[c], (size_t)count * (c == columnCount - 1 ? 1 : 4));
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef ALMANAC_BATCH_H
+#define ALMANAC_BATCH_H
+
+#include <Arduino.h>
+#include "AlmanacTable.h"
+#include "RiseSetSolver.h"
+#include "LunarPhase.h"
+
+// Sun and moon events and moon phase for many local dates at one place,
+// or one date at many places, into one array per quantity (structure of
+// arrays) so rows can be exported or compared column by column.
+//
+// The row set-up is branch-free loops over the columns, which the compiler
+// vectorizes on the host; the rise/set search (RiseSetSolver, nearly all
+// of the time) branches per row and runs row by row, with the same
+// results as the stored almanac.
+//
+// Binary export, little-endian: Header (16 bytes), then each column in
+// Columns order, count entries; flags are 1 byte, the rest 4. The CRC-32
+// covers the columns. A long export is several such blocks.
+class AlmanacBatch {
+public:
+    static const uint32_t MAGIC = 0x31424C41; // "ALB1"
+
+    // UTC seconds, 0 when the event does not happen; degrees
+    struct Columns {
+        int32_t* localDay; // days since 1970-01-01 in the batch's timezone
+        float* latitude;
+        float* longitude;
+        uint32_t* sunrise;
+        uint32_t* sunset;
+        uint32_t* solarNoon;
+        float* sunriseAzimuth;
+        float* sunsetAzimuth;
+        float* noonElevation;
+        uint32_t* moonRise;
+        uint32_t* moonSet; // the first after the rise, maybe the next date
+        float* moonRiseAzimuth;
+        float* moonSetAzimuth;
+        float* illumination; // at local noon, 0..1
+        float* moonAge;      // days since new moon, at local noon
+        uint8_t* flags;      // AlmanacDay::SUN_UP...
+    };
+
+    AlmanacBatch(uint16_t capacity);
+    ~AlmanacBatch();
+
+    // count consecutive local dates at one place
+    bool computeDays(long firstLocalDay, uint16_t count, int timezoneOffset, float latitude, float longitude);
+    // One local date at count places
+    bool computeLocations(long localDay, int timezoneOffset, const float* latitudes, const float* longitudes, uint16_t count);
+
+    uint16_t getCapacity();
+    uint16_t getCount();
+    int getTimezoneOffset();
+    const Columns& getColumns();
+
+    // Local times as YYYY-MM-DD HH:MM:SS, empty when there is none
+    void writeCsv(Print* output, bool withHeader);
+    void writeBinary(Print* output);
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t count;
+        int16_t timezoneOffset; // hours
+        uint16_t reserved;
+        uint32_t crc;
+    };
+
+    uint16_t capacity;
+    uint16_t count;
+    int timezoneOffset;
+    Columns columns;
+    int64_t* dayStart; // UTC start of each row's local date
+
+    void prepare(uint16_t rows, int timezone);
+    void solveRows();
+    static void formatTime(uint32_t localTime, char* buffer, size_t size);
+};
+
+static_assert(sizeof(float) == 4, "AlmanacBatch columns are exported raw");
+
+#endif
@@ -0,0 +1,194 @@
+#include "AlmanacTable.h"
+
+AlmanacTable::AlmanacTable(const char* path) {
+    Serial.println("AlmanacTable::AlmanacTable()");
+    this->path = path;
+    mutex = xSemaphoreCreateMutex();
+    loaded = false;
+    memset(&header, 0, sizeof(header));
+    building = false;
+    memset(&pendingHeader, 0, sizeof(pendingHeader));
+    pendingCount = 0;
+}
+
+AlmanacTable::~AlmanacTable() {
+    Serial.println("AlmanacTable::~AlmanacTable()");
+    if (mutex) {
+        vSemaphoreDelete(mutex);
+    }
+}
+
+bool AlmanacTable::load() {
+    Serial.println("AlmanacTable::load()");
+    // A save interrupted between remove and rename leaves only the new file
+    String tempPath = path + ".tmp";
+    File file = SPIFFS.exists(path) ? SPIFFS.open(path, "r") : SPIFFS.open(tempPath, "r");
+    if (!file) {
+        return false;
+    }
+
+    Header fileHeader;
+    AlmanacDay fileDays[DAYS];
+    bool ok = file.read((uint8_t*)&fileHeader, sizeof(fileHeader)) == sizeof(fileHeader)
+        && fileHeader.magic == MAGIC && fileHeader.version == 1
+        && fileHeader.dayCount > 0 && fileHeader.dayCount <= DAYS;
+    if (ok) {
+        size_t bytes = fileHeader.dayCount * sizeof(AlmanacDay);
+        ok = file.read((uint8_t*)fileDays, bytes) == bytes && crc32((const uint8_t*)fileDays, bytes) == fileHeader.crc;
+    }
+    file.close();
+    if (!ok) {
+        Serial.println("Almanac table invalid, ignored");
+        return false;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    header = fileHeader;
+    memcpy(days, fileDays, fileHeader.dayCount * sizeof(AlmanacDay));
+    loaded = true;
+    xSemaphoreGive(mutex);
+    return true;
+}
+
+bool AlmanacTable::isLoaded() {
+    return loaded;
+}
+
+bool AlmanacTable::lookup(long localDay, AlmanacDay* day) {
+    // Serial.println("AlmanacTable::lookup()"); // Commented out - called frequently
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    long index = localDay - header.firstDay;
+    bool found = loaded && index >= 0 && index < header.dayCount;
+    if (found) {
+        *day = days[index];
+    }
+    xSemaphoreGive(mutex);
+    return found;
+}
+
+long AlmanacTable::getFirstDay() {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    long firstDay = header.firstDay;
+    xSemaphoreGive(mutex);
+    return firstDay;
+}
+
+long AlmanacTable::getLastDay() {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    long lastDay = header.firstDay + header.dayCount - 1;
+    xSemaphoreGive(mutex);
+    return lastDay;
+}
+
+void AlmanacTable::getLocation(double* latitude, double* longitude) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    *latitude = header.latitudeE5 / 100000.0;
+    *longitude = header.longitudeE5 / 100000.0;
+    xSemaphoreGive(mutex);
+}
+
+int AlmanacTable::getTimezoneOffset() {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    int timezoneOffset = header.timezoneOffset;
+    xSemaphoreGive(mutex);
+    return timezoneOffset;
+}
+
+void AlmanacTable::requestBuild(long firstDay, double latitude, double longitude, int timezoneOffset) {
+    Serial.println("AlmanacTable::requestBuild()");
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    pendingHeader.magic = MAGIC;
+    pendingHeader.version = 1;
+    pendingHeader.dayCount = DAYS;
+    pendingHeader.firstDay = (int32_t)firstDay;
+    pendingHeader.latitudeE5 = (int32_t)lround(latitude * 100000.0);
+    pendingHeader.longitudeE5 = (int32_t)lround(longitude * 100000.0);
+    pendingHeader.timezoneOffset = (int16_t)timezoneOffset;
+    pendingHeader.reserved = 0;
+    pendingHeader.crc = 0;
+    pendingCount = 0;
+    building = true;
+    xSemaphoreGive(mutex);
+}
+
+bool AlmanacTable::isBuilding() {
+    return building;
+}
+
+bool AlmanacTable::nextBuildDay(long* localDay, double* latitude, double* longitude, int* timezoneOffset) {
+    // Serial.println("AlmanacTable::nextBuildDay()"); // Commented out - called frequently
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool work = building;
+    if (work) {
+        *localDay = pendingHeader.firstDay + pendingCount;
+        *latitude = pendingHeader.latitudeE5 / 100000.0;
+        *longitude = pendingHeader.longitudeE5 / 100000.0;
+        *timezoneOffset = pendingHeader.timezoneOffset;
+    }
+    xSemaphoreGive(mutex);
+    return work;
+}
+
+void AlmanacTable::storeBuildDay(const AlmanacDay& day) {
+    // Serial.println("AlmanacTable::storeBuildDay()"); // Commented out - called frequently
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (!building) {
+        xSemaphoreGive(mutex);
+        return;
+    }
+    pendingDays[pendingCount] = day;
+    pendingCount = pendingCount + 1;
+    if (pendingCount < pendingHeader.dayCount) {
+        xSemaphoreGive(mutex);
+        return;
+    }
+
+    // Complete: it becomes the live table
+    pendingHeader.crc = crc32((const uint8_t*)pendingDays, pendingCount * sizeof(AlmanacDay));
+    header = pendingHeader;
+    memcpy(days, pendingDays, sizeof(days));
+    loaded = true;
+    building = false;
+
+    // requestBuild() may start over on the pending copy as soon as the
+    // mutex is released, so the file is written from a copy of the table
+    Header savedHeader = pendingHeader;
+    AlmanacDay savedDays[DAYS];
+    memcpy(savedDays, pendingDays, pendingCount * sizeof(AlmanacDay));
+    xSemaphoreGive(mutex);
+
+    save(savedHeader, savedDays);
+}
+
+bool AlmanacTable::save(const Header& savedHeader, const AlmanacDay* savedDays) {
+    Serial.println("AlmanacTable::save()");
+    String tempPath = path + ".tmp";
+    File file = SPIFFS.open(tempPath, "w");
+    if (!file) {
+        Serial.println("Failed to open almanac table for writing");
+        return false;
+    }
+    size_t bytes = savedHeader.dayCount * sizeof(AlmanacDay);
+    bool ok = file.write((const uint8_t*)&savedHeader, sizeof(savedHeader)) == sizeof(savedHeader)
+        && file.write((const uint8_t*)savedDays, bytes) == bytes;
+    file.close();
+    if (!ok) {
+        Serial.println("Failed to write almanac table");
+        SPIFFS.remove(tempPath);
+        return false;
+    }
+    // SPIFFS will not rename over an existing file
+    SPIFFS.remove(path);
+    return SPIFFS.rename(tempPath, path);
+}
+
+uint32_t AlmanacTable::crc32(const uint8_t* data, size_t length, uint32_t previous) {
+    uint32_t crc = ~previous;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,91 @@
+#ifndef ALMANAC_TABLE_H
+#define ALMANAC_TABLE_H
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+
+// Sun and moon events of one local date. Times are UTC seconds, 0 when
+// the event does not happen; azimuths in tenths of a degree. The moon set
+// is the first after the rise, which may fall on the next date.
+struct AlmanacDay {
+    // flags: no rise or set all date because the body stays up or down
+    static const uint8_t SUN_UP = 0x01;
+    static const uint8_t SUN_DOWN = 0x02;
+    static const uint8_t MOON_UP = 0x04;
+    static const uint8_t MOON_DOWN = 0x08;
+
+    uint32_t sunrise;
+    uint32_t sunset;
+    uint32_t moonRise;
+    uint32_t moonSet;
+    uint16_t moonRiseAz;
+    uint16_t moonSetAz;
+    uint8_t moonPercent;
+    uint8_t flags;
+    uint8_t reserved[2];
+};
+
+// A rolling table of AlmanacDay for DAYS local dates at one location,
+// persisted to SPIFFS so the almanac is there straight after a reboot.
+// Entries are found by day index in O(1). A builder (the almanac task, or
+// loop() without one) fills a second table one day at a time, which then
+// replaces the live one and is saved.
+//
+// File layout, little-endian: Header (28 bytes), then dayCount AlmanacDay
+// records (24 bytes each); the CRC-32 covers the records.
+class AlmanacTable {
+public:
+    static const uint16_t DAYS = 30;
+    static const uint32_t MAGIC = 0x314D4C41; // "ALM1"
+
+    AlmanacTable(const char* path = "/almanac.bin");
+    ~AlmanacTable();
+
+    bool load();
+    bool isLoaded();
+    bool lookup(long localDay, AlmanacDay* day);
+    long getFirstDay();
+    long getLastDay();
+    void getLocation(double* latitude, double* longitude);
+    int getTimezoneOffset();
+
+    // Builder side
+    void requestBuild(long firstDay, double latitude, double longitude, int timezoneOffset);
+    bool isBuilding();
+    // The next day to compute, false when there is nothing to do
+    bool nextBuildDay(long* localDay, double* latitude, double* longitude, int* timezoneOffset);
+    void storeBuildDay(const AlmanacDay& day);
+
+    // Continues from a previous result when given one
+    static uint32_t crc32(const uint8_t* data, size_t length, uint32_t previous = 0);
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t dayCount;
+        int32_t firstDay;    // local days since 1970-01-01
+        int32_t latitudeE5;  // degrees * 1e5
+        int32_t longitudeE5;
+        int16_t timezoneOffset; // hours, the local dates are in this zone
+        uint16_t reserved;
+        uint32_t crc;
+    };
+
+    String path;
+    SemaphoreHandle_t mutex; // lookups on the control task, builds on the almanac task
+    bool loaded;
+    Header header;
+    AlmanacDay days[DAYS];
+
+    bool building;
+    Header pendingHeader;
+    AlmanacDay pendingDays[DAYS];
+    uint16_t pendingCount;
+
+    bool save(const Header& savedHeader, const AlmanacDay* savedDays);
+};
+
+static_assert(sizeof(AlmanacDay) == 24, "AlmanacDay is part of the file format");
+
+#endif
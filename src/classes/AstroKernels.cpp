@@ -0,0 +1,118 @@
+#include "AstroKernels.h"
+
+namespace {
+
+// Argument = base + rate * days since J2000.0, in degrees
+struct LinearArgument {
+    double base;
+    double rate; // degrees per day
+};
+
+// The Almanac gives the moon's rates per Julian century
+const double PER_CENTURY = 1.0 / 36525.0;
+
+const LinearArgument ARGUMENTS[AstroKernels::ARGUMENT_COUNT] = {
+    {280.460, 0.9856474},                    // SUN_LONGITUDE
+    {357.528, 0.9856003},                    // SUN_ANOMALY
+    {280.46061837, 360.98564736629},         // SIDEREAL_TIME
+    {218.32, 481267.881 * PER_CENTURY},      // MOON_LONGITUDE
+    {135.0, 477198.87 * PER_CENTURY},        // MOON_L1
+    {259.3, -413335.36 * PER_CENTURY},       // MOON_L2
+    {235.7, 890534.22 * PER_CENTURY},        // MOON_L3
+    {269.9, 954397.74 * PER_CENTURY},        // MOON_L4
+    {357.5, 35999.05 * PER_CENTURY},         // MOON_L5
+    {186.5, 966404.03 * PER_CENTURY},        // MOON_L6
+    {93.3, 483202.02 * PER_CENTURY},         // MOON_B1
+    {228.2, 960400.89 * PER_CENTURY},        // MOON_B2
+    {318.3, 6003.15 * PER_CENTURY},          // MOON_B3
+    {217.6, -407332.21 * PER_CENTURY},       // MOON_B4
+};
+
+// The same arguments in fixed point: 2^64 is one revolution, so unsigned
+// overflow is the reduction to 360 deg. A rate is split into whole
+// revolutions per day, which vanish over whole days, and the fraction.
+struct FixedArgument {
+    uint64_t base;
+    int64_t wholeRevolutions;
+    uint64_t fractionalRate;
+};
+
+const double TWO_TO_64 = 18446744073709551616.0;
+
+FixedArgument toFixed(const LinearArgument& argument) {
+    FixedArgument fixed;
+    double base = argument.base / 360.0;
+    fixed.base = (uint64_t)((base - floor(base)) * TWO_TO_64);
+    double rate = argument.rate / 360.0;
+    double whole = floor(rate);
+    fixed.wholeRevolutions = (int64_t)whole;
+    fixed.fractionalRate = (uint64_t)((rate - whole) * TWO_TO_64);
+    return fixed;
+}
+
+struct FixedTable {
+    FixedArgument arguments[AstroKernels::ARGUMENT_COUNT];
+    FixedTable() {
+        for (int i = 0; i < AstroKernels::ARGUMENT_COUNT; i++) {
+            arguments[i] = toFixed(ARGUMENTS[i]);
+        }
+    }
+};
+
+const FixedTable FIXED;
+
+}
+
+AstroKernels::Time AstroKernels::timeFromUnix(int64_t unixSeconds) {
+    int64_t seconds = unixSeconds - J2000_UNIX;
+    int64_t day = seconds / 86400;
+    int64_t remainder = seconds % 86400;
+    if (remainder < 0) {
+        remainder += 86400;
+        day -= 1;
+    }
+    Time time;
+    time.day = (int32_t)day;
+    time.fraction = (uint32_t)(((uint64_t)remainder << 32) / 86400);
+    return time;
+}
+
+double AstroKernels::julianDate(const Time& time) {
+    return 2451545.0 + time.day + (double)time.fraction / 4294967296.0;
+}
+
+double AstroKernels::julianDate(int64_t unixSeconds) {
+    return 2451545.0 + (double)(unixSeconds - J2000_UNIX) / 86400.0;
+}
+
+void AstroKernels::argumentsDouble(int64_t unixSeconds, Arguments<double>* arguments) {
+    double days = (double)(unixSeconds - J2000_UNIX) / 86400.0;
+    arguments->days = days;
+    for (int i = 0; i < ARGUMENT_COUNT; i++) {
+        double degrees = fmod(ARGUMENTS[i].base + ARGUMENTS[i].rate * days, 360.0);
+        arguments->values[i] = degrees * (M_PI / 180.0);
+    }
+}
+
+void AstroKernels::argumentsFloat(int64_t unixSeconds, Arguments<float>* arguments) {
+    float days = (float)(unixSeconds - J2000_UNIX) / 86400.0f;
+    arguments->days = days;
+    for (int i = 0; i < ARGUMENT_COUNT; i++) {
+        float degrees = fmodf((float)ARGUMENTS[i].base + (float)ARGUMENTS[i].rate * days, 360.0f);
+        arguments->values[i] = degrees * (float)(M_PI / 180.0);
+    }
+}
+
+void AstroKernels::argumentsFixed(const Time& time, Arguments<float>* arguments) {
+    arguments->days = (float)time.day + (float)time.fraction / 4294967296.0f;
+    uint64_t day = (uint64_t)(int64_t)time.day;
+    for (int i = 0; i < ARGUMENT_COUNT; i++) {
+        const FixedArgument& argument = FIXED.arguments[i];
+        // Wraps modulo one revolution, negative days included
+        uint64_t angle = argument.base + argument.fractionalRate * day
+            + (argument.fractionalRate >> 32) * time.fraction
+            + ((uint64_t)argument.wholeRevolutions * time.fraction << 32);
+        // Signed top half: [-pi, pi) with 2^-32 revolution steps
+        arguments->values[i] = (float)(int32_t)(angle >> 32) * (float)(2 * M_PI / 4294967296.0);
+    }
+}
@@ -0,0 +1,188 @@
+#ifndef ASTRO_KERNELS_H
+#define ASTRO_KERNELS_H
+
+#include <stdint.h>
+#include <math.h>
+
+// Sun and moon position and moon phase from the low-precision series of
+// the Astronomical Almanac (sun ~0.01 deg, moon ~0.3 deg in longitude and
+// 0.2 deg in latitude, 1950-2050), evaluated three ways:
+//
+//   double  the reference, all in double (software-emulated on the ESP32)
+//   float   the same formulas in float; the arguments such as
+//           218.32 + 13.176 * days lose precision as the days grow
+//   fixed   the arguments accumulated exactly in 64-bit fixed-point
+//           revolutions, which wrap at 360 deg for free, then reduced to
+//           [-pi, pi) before float trigonometry; use this one
+//
+// Errors against the double path, measured by tools/kernel_accuracy.cpp
+// over 1990-2060 and latitudes -80..80 (max, arc-minutes):
+//
+//          sun RA/dec  sun az/el  moon lon/lat  moon RA/dec  moon az/el  illum.
+//   float  0.19        62         2.9           2.9          62          0.04 %
+//   fixed  0.003       0.04       0.003         0.003        0.06        0.0001 %
+//
+// In float the sidereal time, 360.99 deg a day, is the worst: it is off by
+// half a degree by 2030. These are the costs of the cheaper arithmetic alone; the
+// series' own error against the true sky is as quoted above.
+
+class AstroKernels {
+public:
+    // Seconds since 1970 of J2000.0, 2000-01-01 12:00 UT
+    static const int64_t J2000_UNIX = 946728000;
+    // Days since J2000.0 split so that neither part loses precision:
+    // whole days and the fraction of a day in 2^-32 units (20 us)
+    struct Time {
+        int32_t day;
+        uint32_t fraction;
+    };
+
+    static Time timeFromUnix(int64_t unixSeconds);
+    static double julianDate(const Time& time);
+    static double julianDate(int64_t unixSeconds);
+
+    // Fundamental arguments, radians
+    enum Argument {
+        SUN_LONGITUDE = 0, // mean longitude L
+        SUN_ANOMALY,       // mean anomaly g
+        SIDEREAL_TIME,     // Greenwich mean sidereal time
+        MOON_LONGITUDE,
+        MOON_L1, MOON_L2, MOON_L3, MOON_L4, MOON_L5, MOON_L6,
+        MOON_B1, MOON_B2, MOON_B3, MOON_B4,
+        ARGUMENT_COUNT
+    };
+
+    template <typename T>
+    struct Arguments {
+        T days; // since J2000.0, only for slowly varying terms
+        T values[ARGUMENT_COUNT];
+    };
+
+    static void argumentsDouble(int64_t unixSeconds, Arguments<double>* arguments);
+    static void argumentsFloat(int64_t unixSeconds, Arguments<float>* arguments);
+    static void argumentsFixed(const Time& time, Arguments<float>* arguments);
+
+    template <typename T>
+    struct Equatorial {
+        T longitude;      // ecliptic, radians
+        T latitude;
+        T rightAscension; // radians
+        T declination;
+        T distance;       // km
+    };
+
+    template <typename T>
+    struct Horizontal {
+        T azimuth;   // radians from north through east, [0, 2pi)
+        T elevation; // radians, geometric (no refraction)
+    };
+
+    template <typename T>
+    struct Phase {
+        T elongation;   // radians from the sun, [0, 2pi) eastward
+        T phaseAngle;   // radians, 0 full, pi new
+        T illumination; // lit fraction of the disc, 0..1
+    };
+
+    template <typename T>
+    static void sunPosition(const Arguments<T>& arguments, Equatorial<T>* sun);
+
+    template <typename T>
+    static void moonPosition(const Arguments<T>& arguments, Equatorial<T>* moon);
+
+    template <typename T>
+    static void horizontal(const Arguments<T>& arguments, const Equatorial<T>& body,
+                           T latitude, T longitude, Horizontal<T>* result);
+
+    template <typename T>
+    static void moonPhase(const Equatorial<T>& sun, const Equatorial<T>& moon, Phase<T>* phase);
+
+private:
+    template <typename T>
+    static T obliquity(T days);
+    template <typename T>
+    static void toEquatorial(T days, Equatorial<T>* body);
+    template <typename T>
+    static T deg(T degrees) { return degrees * (T)(M_PI / 180.0); }
+};
+
+template <typename T>
+T AstroKernels::obliquity(T days) {
+    return deg<T>((T)23.439 - (T)0.0000004 * days);
+}
+
+template <typename T>
+void AstroKernels::toEquatorial(T days, Equatorial<T>* body) {
+    T epsilon = obliquity(days);
+    T sinLongitude = sin(body->longitude);
+    T cosLatitude = cos(body->latitude);
+    T sinLatitude = sin(body->latitude);
+    T x = cosLatitude * cos(body->longitude);
+    T y = cos(epsilon) * cosLatitude * sinLongitude - sin(epsilon) * sinLatitude;
+    T z = sin(epsilon) * cosLatitude * sinLongitude + cos(epsilon) * sinLatitude;
+    body->rightAscension = atan2(y, x);
+    if (body->rightAscension < 0) {
+        body->rightAscension += (T)(2 * M_PI);
+    }
+    body->declination = asin(z);
+}
+
+template <typename T>
+void AstroKernels::sunPosition(const Arguments<T>& arguments, Equatorial<T>* sun) {
+    T g = arguments.values[SUN_ANOMALY];
+    sun->longitude = arguments.values[SUN_LONGITUDE] + deg<T>((T)1.915) * sin(g) + deg<T>((T)0.020) * sin(2 * g);
+    sun->latitude = 0;
+    sun->distance = ((T)1.00014 - (T)0.01671 * cos(g) - (T)0.00014 * cos(2 * g)) * (T)149597870.7;
+    toEquatorial(arguments.days, sun);
+}
+
+template <typename T>
+void AstroKernels::moonPosition(const Arguments<T>& arguments, Equatorial<T>* moon) {
+    const T* a = arguments.values;
+    moon->longitude = a[MOON_LONGITUDE]
+        + deg<T>((T)6.29) * sin(a[MOON_L1]) - deg<T>((T)1.27) * sin(a[MOON_L2])
+        + deg<T>((T)0.66) * sin(a[MOON_L3]) + deg<T>((T)0.21) * sin(a[MOON_L4])
+        - deg<T>((T)0.19) * sin(a[MOON_L5]) - deg<T>((T)0.11) * sin(a[MOON_L6]);
+    moon->latitude = deg<T>((T)5.13) * sin(a[MOON_B1]) + deg<T>((T)0.28) * sin(a[MOON_B2])
+        - deg<T>((T)0.28) * sin(a[MOON_B3]) - deg<T>((T)0.17) * sin(a[MOON_B4]);
+    // Horizontal parallax, the same arguments as the longitude terms
+    T parallax = deg<T>((T)0.9508) + deg<T>((T)0.0518) * cos(a[MOON_L1])
+        + deg<T>((T)0.0095) * cos(a[MOON_L2]) + deg<T>((T)0.0078) * cos(a[MOON_L3])
+        + deg<T>((T)0.0028) * cos(a[MOON_L4]);
+    moon->distance = (T)6378.14 / sin(parallax);
+    toEquatorial(arguments.days, moon);
+}
+
+template <typename T>
+void AstroKernels::horizontal(const Arguments<T>& arguments, const Equatorial<T>& body,
+                              T latitude, T longitude, Horizontal<T>* result) {
+    T hourAngle = arguments.values[SIDEREAL_TIME] + longitude - body.rightAscension;
+    T sinLatitude = sin(latitude);
+    T cosLatitude = cos(latitude);
+    T sinDeclination = sin(body.declination);
+    T cosDeclination = cos(body.declination);
+    T cosHourAngle = cos(hourAngle);
+    result->elevation = asin(sinLatitude * sinDeclination + cosLatitude * cosDeclination * cosHourAngle);
+    result->azimuth = atan2(-cosDeclination * sin(hourAngle),
+                            cosLatitude * sinDeclination - sinLatitude * cosDeclination * cosHourAngle);
+    if (result->azimuth < 0) {
+        result->azimuth += (T)(2 * M_PI);
+    }
+}
+
+template <typename T>
+void AstroKernels::moonPhase(const Equatorial<T>& sun, const Equatorial<T>& moon, Phase<T>* phase) {
+    T difference = moon.longitude - sun.longitude;
+    T cosLatitude = cos(moon.latitude);
+    T sinLatitude = sin(moon.latitude);
+    T across = cosLatitude * sin(difference);
+    // atan2 rather than acos, which loses precision near new and full moon
+    T cosElongation = cosLatitude * cos(difference);
+    T elongation = atan2(sqrt(across * across + sinLatitude * sinLatitude), cosElongation);
+    // East of the sun while waxing
+    phase->elongation = across >= 0 ? elongation : (T)(2 * M_PI) - elongation;
+    phase->phaseAngle = atan2(sun.distance * sin(elongation), moon.distance - sun.distance * cosElongation);
+    phase->illumination = ((T)1 + cos(phase->phaseAngle)) / 2;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifdef BENCHMARK
+
+#include "Benchmark.h"
+#include "AllocationCounter.h"
+#include <algorithm>
+#ifdef SIMULATOR
+#include <chrono>
+#endif
+
+Benchmark::Benchmark(Print* output, const String& firmwareVersion) {
+    Serial.println("Benchmark::Benchmark()");
+    this->output = output;
+    this->firmwareVersion = firmwareVersion;
+    // Allocated up front, nothing is allocated while timing
+    samples = new uint32_t[MAX_ITERATIONS];
+}
+
+Benchmark::~Benchmark() {
+    Serial.println("Benchmark::~Benchmark()");
+    delete[] samples;
+}
+
+BenchmarkResult Benchmark::run(const char* name, BenchmarkFunction function, uint16_t iterations) {
+    Serial.print("Benchmark::run(");
+    Serial.print(name);
+    Serial.println(")");
+    if (iterations == 0 || iterations > MAX_ITERATIONS) {
+        iterations = MAX_ITERATIONS;
+    }
+
+    // Fill caches and lazy state first
+    for (uint16_t i = 0; i < WARMUP_CALLS; i++) {
+        function();
+    }
+
+    AllocationCounter::begin();
+    for (uint16_t i = 0; i < iterations; i++) {
+        uint32_t start = readClock();
+        function();
+        samples[i] = readClock() - start;
+    }
+    uint32_t allocations = AllocationCounter::getCount();
+    uint32_t bytes = AllocationCounter::getBytes();
+    AllocationCounter::end();
+
+    std::sort(samples, samples + iterations);
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.minNanos = toNanos(samples[0]);
+    result.medianNanos = toNanos(samples[(iterations - 1) / 2]);
+    // Nearest rank
+    result.p99Nanos = toNanos(samples[(iterations * 99 + 99) / 100 - 1]);
+    result.maxNanos = toNanos(samples[iterations - 1]);
+    result.allocationsPerCall = (float)allocations / iterations;
+    result.bytesPerCall = (float)bytes / iterations;
+    return result;
+}
+
+void Benchmark::report(const BenchmarkResult& result) {
+    char line[320];
+    snprintf(line, sizeof(line),
+             "BENCH {\"name\":\"%s\",\"firmware\":\"%s\",\"build\":\"%s %s\",\"clock\":\"%s\","
+             "\"iterations\":%u,\"min_ns\":%lu,\"median_ns\":%lu,\"p99_ns\":%lu,\"max_ns\":%lu,"
+             "\"allocs_per_call\":%.2f,\"alloc_bytes_per_call\":%.1f}",
+             result.name, firmwareVersion.c_str(), __DATE__, __TIME__, getClockName(),
+             (unsigned)result.iterations, (unsigned long)result.minNanos, (unsigned long)result.medianNanos,
+             (unsigned long)result.p99Nanos, (unsigned long)result.maxNanos,
+             result.allocationsPerCall, result.bytesPerCall);
+    output->println(line);
+}
+
+uint32_t Benchmark::readClock() {
+#ifdef SIMULATOR
+    // Wraps every ~4.3 s, calls are timed as differences
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return ESP.getCycleCount();
+#endif
+}
+
+uint32_t Benchmark::toNanos(uint32_t ticks) {
+#ifdef SIMULATOR
+    return ticks;
+#else
+    return (uint32_t)((uint64_t)ticks * 1000 / ESP.getCpuFreqMHz());
+#endif
+}
+
+const char* Benchmark::getClockName() {
+#ifdef SIMULATOR
+    return "host_steady_clock";
+#else
+    return "esp32_ccount";
+#endif
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <Arduino.h>
+
+typedef void (*BenchmarkFunction)();
+
+struct BenchmarkResult {
+    const char* name;
+    uint16_t iterations;
+    uint32_t minNanos;
+    uint32_t medianNanos;
+    uint32_t p99Nanos;
+    uint32_t maxNanos;
+    float allocationsPerCall;
+    float bytesPerCall;
+};
+
+// Times a function over many calls. On the ESP32 the clock is the CPU
+// cycle counter of the calling core; on the host (SIMULATOR) a steady
+// clock, since the simulator's micros() is virtual. Each result is printed
+// as one "BENCH {json}" line so runs can be collected and compared between
+// firmware versions (tools/bench_compare.py). Compiled in BENCHMARK builds
+// only.
+class Benchmark {
+public:
+    static const uint16_t MAX_ITERATIONS = 1000;
+    static const uint16_t WARMUP_CALLS = 3;
+
+    Benchmark(Print* output, const String& firmwareVersion);
+    ~Benchmark();
+
+    BenchmarkResult run(const char* name, BenchmarkFunction function, uint16_t iterations);
+    void report(const BenchmarkResult& result);
+
+private:
+    Print* output;
+    String firmwareVersion;
+    uint32_t* samples;
+
+    static uint32_t readClock();
+    static uint32_t toNanos(uint32_t ticks);
+    static const char* getClockName();
+};
+
+#endif
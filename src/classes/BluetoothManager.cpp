@@ -2,10 +2,17 @@
 #include "LogManager.h"
 #include "ConfigurationManager.h"
 #include "StepperController.h"
+#include "GPSManager.h"
+#include "TimeService.h"
+#include "Ephemeris.h"
+#include "AlmanacBatch.h"
 
 extern LogManager* logManager;
 extern ConfigurationManager* configManager;
 extern StepperController* stepperController;
+extern GPSManager* gpsManager;
+extern TimeService* timeService;
+extern Ephemeris* ephemeris;
 
 // Static instance pointer for callbacks
 BluetoothManager* bluetoothManagerInstance = nullptr;
@@ -16,11 +23,15 @@ BluetoothManager::BluetoothManager() {
     inputBuffer = "";
     menuState = 0;
     isConnected = false;
+    queue = nullptr;
+    memset(&almanacExport, 0, sizeof(almanacExport));
+    exportBatch = nullptr;
     bluetoothManagerInstance = this;
 }
 
 BluetoothManager::~BluetoothManager() {
     Serial.println("BluetoothManager::~BluetoothManager()");
+    delete exportBatch;
 }
 
 void BluetoothManager::begin() {
@@ -39,7 +50,13 @@ void BluetoothManager::begin() {
     Serial.println("Bluetooth initialized successfully");
 }
 
-void BluetoothManager::handleUserInteraction() {
+bool BluetoothManager::beginTaskQueue() {
+    Serial.println("BluetoothManager::beginTaskQueue()");
+    queue = xQueueCreate(8, sizeof(BluetoothEvent));
+    return queue != nullptr;
+}
+
+void BluetoothManager::pollLink() {
     // Check connection status
     bool currentlyConnected = btSerial.hasClient();
     
@@ -54,9 +71,8 @@ void BluetoothManager::handleUserInteraction() {
         // Just disconnected
         Serial.println("Bluetooth client disconnected");
         isConnected = false;
-        userInteracting = false;
         inputBuffer = "";
-        menuState = 0;
+        postEvent(BT_DISCONNECTED, "");
     }
     
     // Only handle interaction if connected
@@ -64,36 +80,118 @@ void BluetoothManager::handleUserInteraction() {
         return;
     }
     
-    if (btSerial.available()) {
+    while (btSerial.available()) {
         char c = btSerial.read();
-        Serial.println("BluetoothManager::handleUserInteraction()"); // Commented out - called frequently
         if (c == '\r' || c == '\n') {
-            if (!userInteracting && inputBuffer.length() == 0) {
-                // User pressed Enter to initiate interaction
-                userInteracting = true;
-                sendLastLogLines();
-                showMainMenu();
-            } else if (userInteracting && inputBuffer.length() > 0) {
-                // Process the input
-                if (menuState == 0) {
-                    processMenuSelection(inputBuffer.charAt(0));
-                }
-                inputBuffer = "";
-            }
-        } else if (c >= 32 && c <= 126) { // Printable characters
+            postEvent(BT_LINE, inputBuffer);
+            inputBuffer = "";
+        } else if (c >= 32 && c <= 126 && inputBuffer.length() < 63) { // Printable characters
             inputBuffer += c;
         }
     }
 }
 
+void BluetoothManager::postEvent(uint8_t type, const String& text) {
+    // Serial.println("BluetoothManager::postEvent()"); // Commented out - called frequently
+    BluetoothEvent event;
+    event.type = type;
+    strlcpy(event.text, text.c_str(), sizeof(event.text));
+    if (!queue) {
+        processEvent(event);
+        return;
+    }
+    if (xQueueSend(queue, &event, 0) != pdTRUE) {
+        Serial.println("BluetoothManager::postEvent() queue full, input dropped");
+    }
+}
+
+void BluetoothManager::handleUserInteraction() {
+    if (!queue) {
+        pollLink();
+    } else {
+        BluetoothEvent event;
+        while (xQueueReceive(queue, &event, 0) == pdTRUE) {
+            processEvent(event);
+        }
+    }
+    // A long export goes out a chunk per loop pass
+    if (menuState == 7) {
+        continueAlmanacExport();
+    }
+}
+
+void BluetoothManager::processEvent(const BluetoothEvent& event) {
+    Serial.println("BluetoothManager::processEvent()");
+    if (event.type == BT_DISCONNECTED) {
+        endAlmanacExport();
+        userInteracting = false;
+        menuState = 0;
+        return;
+    }
+
+    String line = String(event.text);
+    if (!userInteracting && line.length() == 0) {
+        // User pressed Enter to initiate interaction
+        userInteracting = true;
+        sendLastLogLines();
+        showMainMenu();
+    } else if (userInteracting && line.length() > 0) {
+        // Process the input
+        if (menuState == 0) {
+            processMenuSelection(line.charAt(0));
+        } else if (menuState == 1) {
+            processCustomSelection(line.charAt(0));
+        } else if (menuState == 2) {
+            processCustomPeriod(line);
+        } else if (menuState == 3) {
+            processCalibrationSelection(line.charAt(0));
+        } else if (menuState == 4) {
+            processStepsPerRevolution(line);
+        } else if (menuState == 5) {
+            processBacklash(line);
+        } else if (menuState == 6) {
+            processAlmanacExport(line);
+        }
+    }
+}
+
+void BluetoothManager::showStatus() {
+    Serial.println("BluetoothManager::showStatus()");
+    // Published snapshots; nothing here waits on the motor or GPS
+    MotorTelemetry motor = stepperController->getTelemetry();
+    GpsFix fix = gpsManager->getFix();
+    String status = "Dial " + String(motor.degrees, 1) + " deg";
+    status += motor.moving ? ", moving" : (motor.rotating ? ", rotating" : ", stopped");
+    if (motor.timeLocked) {
+        status += ", angle err " + String(motor.angleError, 2);
+    }
+    status += ", jitter " + String(motor.jitterRms) + "us";
+    if (fix.locationValid) {
+        status += ", GPS " + String(fix.latitude, 4) + " " + String(fix.longitude, 4);
+        status += " (" + String(fix.satellites) + " sats, HDOP " + String(fix.hdop, 1) + ")";
+    } else {
+        status += ", no GPS fix";
+    }
+    TimeStatus time = timeService->getStatus();
+    status += ", time " + String(TimeService::getStateName(time.state));
+    if (time.driftValid) {
+        status += " (crystal " + String(time.driftPpb / 1000.0, 2) + " ppm)";
+    }
+    btSerial.println(status);
+}
+
 void BluetoothManager::showMainMenu() {
     Serial.println("BluetoothManager::showMainMenu()");
+    showStatus();
     btSerial.println("1. Rotate the stepper 1 rotation per minute");
     btSerial.println("2. Rotate the stepper 1 rotation per hour");
     btSerial.println("3. Rotate the stepper 1 rotation per day");
     btSerial.println("4. Custom configuration");
     btSerial.println("5. Display last log");
     btSerial.println("6. Clear logs");
+    btSerial.println("7. Toggle time-locked dial");
+    btSerial.println("8. Gear calibration");
+    btSerial.println("9. Export almanac");
     btSerial.print("Select option: ");
 }
 
@@ -102,7 +200,7 @@ void BluetoothManager::processMenuSelection(char selection) {
     Serial.print(selection);
     Serial.println(")");
     
-    Configuration config;
+    Configuration config = configManager->getConfiguration();
     
     switch (selection) {
         case '1':
@@ -158,6 +256,23 @@ void BluetoothManager::processMenuSelection(char selection) {
             resetMenuState();
             break;
             
+        case '7':
+            config.timeLocked = !config.timeLocked;
+            configManager->setConfiguration(config);
+            stepperController->setTimeLocked(config.timeLocked);
+            btSerial.println(config.timeLocked ? "Time-locked dial enabled" : "Time-locked dial disabled");
+            logManager->logInfo(config.timeLocked ? "Time-locked dial enabled" : "Time-locked dial disabled");
+            resetMenuState();
+            break;
+            
+        case '8':
+            handleGearCalibration();
+            break;
+
+        case '9':
+            handleAlmanacExport();
+            break;
+            
         default:
             btSerial.println("Invalid selection. Try again.");
             showMainMenu();
@@ -167,13 +282,290 @@ void BluetoothManager::processMenuSelection(char selection) {
 
 void BluetoothManager::handleCustomConfiguration() {
     Serial.println("BluetoothManager::handleCustomConfiguration()");
-    // This is a simplified version - in practice, you'd need state management
-    // for multi-step input collection
-    btSerial.println("Custom configuration mode not fully implemented in this version");
-    btSerial.println("Please use options 1-3 for now");
+    btSerial.println("1. Rotate once per sidereal day (23h 56m 4.0905s)");
+    btSerial.println("2. Rotate once per mean lunar day (24h 50m 28s)");
+    btSerial.println("3. Enter a rotation period");
+    btSerial.print("Select option: ");
+    menuState = 1;
+}
+
+void BluetoothManager::processCustomSelection(char selection) {
+    Serial.print("BluetoothManager::processCustomSelection(");
+    Serial.print(selection);
+    Serial.println(")");
+
+    Configuration config = configManager->getConfiguration();
+
+    switch (selection) {
+        case '1':
+            config.rotationSpeed = ONCE_PER_SIDEREAL_DAY;
+            configManager->setConfiguration(config);
+            stepperController->setRotationSpeed(ONCE_PER_SIDEREAL_DAY);
+            stepperController->startRotation();
+            btSerial.println("Configuration set: 1 rotation per sidereal day");
+            logManager->logInfo("Configuration changed to 1 rotation per sidereal day");
+            resetMenuState();
+            break;
+
+        case '2':
+            config.rotationSpeed = ONCE_PER_LUNAR_DAY;
+            configManager->setConfiguration(config);
+            stepperController->setRotationSpeed(ONCE_PER_LUNAR_DAY);
+            stepperController->startRotation();
+            btSerial.println("Configuration set: 1 rotation per lunar day");
+            logManager->logInfo("Configuration changed to 1 rotation per lunar day");
+            resetMenuState();
+            break;
+
+        case '3':
+            btSerial.print("Period in seconds (e.g. 86164.0905) or HH:MM:SS: ");
+            menuState = 2;
+            break;
+
+        default:
+            btSerial.println("Invalid selection. Try again.");
+            handleCustomConfiguration();
+            break;
+    }
+}
+
+void BluetoothManager::processCustomPeriod(const String& input) {
+    Serial.print("BluetoothManager::processCustomPeriod(");
+    Serial.print(input);
+    Serial.println(")");
+
+    uint64_t numerator = 0;
+    uint64_t denominator = 1;
+    if (!configManager->parsePeriod(input, numerator, denominator)) {
+        btSerial.println("Invalid period, expected seconds or HH:MM:SS up to 10 days");
+        btSerial.print("Period in seconds (e.g. 86164.0905) or HH:MM:SS: ");
+        return;
+    }
+    applyCustomPeriod(numerator, denominator, input);
+}
+
+void BluetoothManager::applyCustomPeriod(uint64_t numerator, uint64_t denominator, const String& description) {
+    Serial.print("BluetoothManager::applyCustomPeriod(");
+    Serial.print(description);
+    Serial.println(")");
+
+    Configuration config = configManager->getConfiguration();
+    config.rotationSpeed = CUSTOM_PERIOD;
+    config.periodNumerator = numerator;
+    config.periodDenominator = denominator;
+    configManager->setConfiguration(config);
+    stepperController->setCustomPeriod(numerator, denominator);
+    stepperController->startRotation();
+    btSerial.println("Configuration set: 1 rotation per " + description);
+    logManager->logInfo("Configuration changed to 1 rotation per " + description);
+    resetMenuState();
+}
+
+void BluetoothManager::handleGearCalibration() {
+    Serial.println("BluetoothManager::handleGearCalibration()");
+    Configuration config = configManager->getConfiguration();
+    btSerial.print("Steps per revolution: ");
+    btSerial.println(String((double)config.gearStepsNumerator / (double)config.gearStepsDenominator, 3));
+    btSerial.print("Backlash: ");
+    btSerial.println(String(config.backlashSteps) + " steps");
+    btSerial.println("1. Measure with the index sensor (3 revolutions)");
+    btSerial.println("2. Enter full steps per revolution");
+    btSerial.println("3. Enter backlash in full steps");
+    btSerial.print("Select option: ");
+    menuState = 3;
+}
+
+void BluetoothManager::processCalibrationSelection(char selection) {
+    Serial.print("BluetoothManager::processCalibrationSelection(");
+    Serial.print(selection);
+    Serial.println(")");
+
+    switch (selection) {
+        case '1':
+            if (stepperController->startCalibration(3)) {
+                btSerial.println("Calibrating, the result will be logged");
+                logManager->logInfo("Gear calibration started");
+            } else {
+                btSerial.println("Calibration could not start (no index sensor, or a move is running)");
+            }
+            resetMenuState();
+            break;
+
+        case '2':
+            btSerial.print("Full steps per revolution (e.g. 2037.886): ");
+            menuState = 4;
+            break;
+
+        case '3':
+            btSerial.print("Backlash in full steps: ");
+            menuState = 5;
+            break;
+
+        default:
+            btSerial.println("Invalid selection. Try again.");
+            handleGearCalibration();
+            break;
+    }
+}
+
+void BluetoothManager::processStepsPerRevolution(const String& input) {
+    Serial.print("BluetoothManager::processStepsPerRevolution(");
+    Serial.print(input);
+    Serial.println(")");
+
+    uint64_t numerator = 0;
+    uint64_t denominator = 1;
+    if (!configManager->parseDecimal(input, numerator, denominator)
+        || !stepperController->setStepsPerRevolution(numerator, denominator)) {
+        btSerial.println("Invalid steps per revolution, expected 1536 to 2560");
+        btSerial.print("Full steps per revolution (e.g. 2037.886): ");
+        return;
+    }
+
+    Configuration config = configManager->getConfiguration();
+    config.gearStepsNumerator = numerator;
+    config.gearStepsDenominator = denominator;
+    configManager->setConfiguration(config);
+    btSerial.println("Steps per revolution set to " + input);
+    logManager->logInfo("Steps per revolution set to " + input);
+    resetMenuState();
+}
+
+void BluetoothManager::processBacklash(const String& input) {
+    Serial.print("BluetoothManager::processBacklash(");
+    Serial.print(input);
+    Serial.println(")");
+
+    long steps = input.toInt();
+    if (steps < 0 || steps > 200) {
+        btSerial.println("Invalid backlash, expected 0 to 200 steps");
+        btSerial.print("Backlash in full steps: ");
+        return;
+    }
+    stepperController->setBacklash(steps);
+
+    Configuration config = configManager->getConfiguration();
+    config.backlashSteps = steps;
+    configManager->setConfiguration(config);
+    btSerial.println("Backlash set to " + String(steps) + " steps");
+    logManager->logInfo("Backlash set to " + String(steps) + " steps");
     resetMenuState();
 }
 
+void BluetoothManager::handleAlmanacExport() {
+    Serial.println("BluetoothManager::handleAlmanacExport()");
+    btSerial.println("Days from today here (1-" + String(EXPORT_MAX_DAYS) + "), or today at up to "
+                     + String(EXPORT_MAX_LOCATIONS) + " lat,lon places; then csv or bin");
+    btSerial.print("e.g. 30 csv, or 40.52,-74.41 51.48,0.00 bin: ");
+    menuState = 6;
+}
+
+void BluetoothManager::processAlmanacExport(const String& input) {
+    Serial.print("BluetoothManager::processAlmanacExport(");
+    Serial.print(input);
+    Serial.println(")");
+
+    time_t localTime = now();
+    if (localTime < Ephemeris::MIN_VALID_TIME) {
+        btSerial.println("No time yet, wait for the GPS fix");
+        resetMenuState();
+        return;
+    }
+
+    char buffer[64];
+    strlcpy(buffer, input.c_str(), sizeof(buffer));
+    bool binary = false;
+    long days = 0;
+    float latitudes[EXPORT_MAX_LOCATIONS];
+    float longitudes[EXPORT_MAX_LOCATIONS];
+    uint16_t locations = 0;
+    bool valid = true;
+    char* rest = nullptr;
+    for (char* word = strtok_r(buffer, " ", &rest); word; word = strtok_r(nullptr, " ", &rest)) {
+        char* end = nullptr;
+        if (strcmp(word, "csv") == 0) {
+            binary = false;
+        } else if (strcmp(word, "bin") == 0) {
+            binary = true;
+        } else if (strchr(word, ',')) {
+            float latitude = strtof(word, &end);
+            float longitude = *end == ',' ? strtof(end + 1, &end) : 0;
+            valid = valid && *end == '\0' && locations < EXPORT_MAX_LOCATIONS
+                && fabsf(latitude) <= 90 && fabsf(longitude) <= 180;
+            if (valid) {
+                latitudes[locations] = latitude;
+                longitudes[locations] = longitude;
+                locations++;
+            }
+        } else {
+            days = strtol(word, &end, 10);
+            valid = valid && *end == '\0';
+        }
+    }
+    if (!valid || (days > 0) == (locations > 0) || days < 0 || days > EXPORT_MAX_DAYS) {
+        btSerial.println("Invalid export, expected a day count or lat,lon places");
+        handleAlmanacExport();
+        return;
+    }
+
+    // A batch at a time, so memory stays the same for a year of days, and
+    // a chunk per loop pass, so the control task is never held for all of it
+    exportBatch = new AlmanacBatch(EXPORT_CHUNK_ROWS);
+    almanacExport.binary = binary;
+    almanacExport.today = (long)(localTime / 86400);
+    almanacExport.timezoneOffset = ephemeris->getTimezoneOffset();
+    almanacExport.latitude = (float)ephemeris->getLatitude();
+    almanacExport.longitude = (float)ephemeris->getLongitude();
+    memcpy(almanacExport.latitudes, latitudes, locations * sizeof(float));
+    memcpy(almanacExport.longitudes, longitudes, locations * sizeof(float));
+    almanacExport.locations = locations;
+    almanacExport.rows = locations > 0 ? locations : days;
+    almanacExport.nextRow = 0;
+    int timezoneOffset = almanacExport.timezoneOffset;
+    if (binary) {
+        long chunks = (almanacExport.rows + EXPORT_CHUNK_ROWS - 1) / EXPORT_CHUNK_ROWS;
+        // Header and 15 four-byte columns plus the flags per row
+        btSerial.println("=== Almanac binary, " + String(chunks * 16 + almanacExport.rows * 61) + " bytes ===");
+    } else {
+        btSerial.println("=== Almanac CSV, local time UTC" + String(timezoneOffset >= 0 ? "+" : "")
+                         + String(timezoneOffset) + " ===");
+    }
+    menuState = 7;
+}
+
+void BluetoothManager::continueAlmanacExport() {
+    // Serial.println("BluetoothManager::continueAlmanacExport()"); // Commented out - called frequently
+    AlmanacExport& job = almanacExport;
+    long first = job.nextRow;
+    uint16_t count = (uint16_t)(job.rows - first < EXPORT_CHUNK_ROWS ? job.rows - first : EXPORT_CHUNK_ROWS);
+    if (job.locations > 0) {
+        exportBatch->computeLocations(job.today, job.timezoneOffset, job.latitudes, job.longitudes, job.locations);
+    } else {
+        exportBatch->computeDays(job.today + first, count, job.timezoneOffset, job.latitude, job.longitude);
+    }
+    if (job.binary) {
+        exportBatch->writeBinary(&btSerial);
+    } else {
+        exportBatch->writeCsv(&btSerial, first == 0);
+    }
+    job.nextRow = first + count;
+    if (job.nextRow < job.rows) {
+        return;
+    }
+
+    btSerial.println();
+    btSerial.println("=== End Almanac ===");
+    logManager->logInfo("Almanac exported, " + String(job.rows) + (job.locations > 0 ? " places" : " days"));
+    endAlmanacExport();
+    resetMenuState();
+}
+
+void BluetoothManager::endAlmanacExport() {
+    Serial.println("BluetoothManager::endAlmanacExport()");
+    delete exportBatch;
+    exportBatch = nullptr;
+}
+
 void BluetoothManager::displayLastLog() {
     Serial.println("BluetoothManager::displayLastLog()");
     if (logManager) {
@@ -211,8 +603,8 @@ void BluetoothManager::sendLastLogLines() {
 
 void BluetoothManager::resetMenuState() {
     Serial.println("BluetoothManager::resetMenuState()");
+    // inputBuffer belongs to the link side and is already empty here
     userInteracting = false;
-    inputBuffer = "";
     menuState = 0;
 }
 
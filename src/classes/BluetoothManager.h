@@ -4,6 +4,8 @@
 #include <Arduino.h>
 #include <BluetoothSerial.h>
 
+class AlmanacBatch;
+
 class BluetoothManager {
 public:
     BluetoothSerial btSerial;
@@ -16,17 +18,71 @@ public:
     ~BluetoothManager();
     
     void begin();
+    // Link side: connection changes and line assembly, run by the Bluetooth
+    // task (or from handleUserInteraction() when there is no task queue)
+    bool beginTaskQueue();
+    void pollLink();
+    // Control side: acts on the lines received, from loop()
     void handleUserInteraction();
+    void showStatus();
     void showMainMenu();
     void processMenuSelection(char selection);
     void handleCustomConfiguration();
+    void processCustomSelection(char selection);
+    void processCustomPeriod(const String& input);
+    void applyCustomPeriod(uint64_t numerator, uint64_t denominator, const String& description);
+    void handleGearCalibration();
+    void processCalibrationSelection(char selection);
+    void processStepsPerRevolution(const String& input);
+    void processBacklash(const String& input);
+    void handleAlmanacExport();
+    void processAlmanacExport(const String& input);
+    void continueAlmanacExport();
     void displayLastLog();
     void clearLogs();
     void sendLastLogLines();
     
 
 private:
+    // Almanac export: rows computed and sent at a time, and the limits
+    static const uint16_t EXPORT_CHUNK_ROWS = 16;
+    static const uint16_t EXPORT_MAX_DAYS = 366;
+    static const uint16_t EXPORT_MAX_LOCATIONS = 4;
+
+    // The export in progress (menuState 7); continueAlmanacExport() sends
+    // one chunk from nextRow per pass of handleUserInteraction()
+    struct AlmanacExport {
+        bool binary;
+        long today;
+        int timezoneOffset;
+        float latitude;
+        float longitude;
+        float latitudes[EXPORT_MAX_LOCATIONS];
+        float longitudes[EXPORT_MAX_LOCATIONS];
+        uint16_t locations;
+        long rows;
+        long nextRow;
+    };
+
+    AlmanacExport almanacExport;
+    AlmanacBatch* exportBatch;
+
+    enum BluetoothEventType {
+        BT_LINE,
+        BT_DISCONNECTED
+    };
+
+    struct BluetoothEvent {
+        uint8_t type;
+        char text[64];
+    };
+
+    QueueHandle_t queue;
+
+    void postEvent(uint8_t type, const String& text);
+    void processEvent(const BluetoothEvent& event);
     void resetMenuState();
+    void endAlmanacExport();
     void sendPrompt(const String& prompt);
     String readInput();
 };
@@ -0,0 +1,15 @@
+#ifndef COIL_DRIVER_H
+#define COIL_DRIVER_H
+
+#include <stdint.h>
+
+// Pin-output backend for CoilSequencer. write() receives a 4-bit coil
+// pattern (bit n = ULN2003 IN(n+1)) and must apply all four outputs at once.
+class CoilDriver {
+public:
+    virtual ~CoilDriver() {}
+    virtual void begin(const uint8_t pins[4]) = 0;
+    virtual void write(uint8_t pattern) = 0;
+};
+
+#endif
@@ -0,0 +1,59 @@
+#include "CoilSequencer.h"
+
+CoilSequencer::CoilSequencer(CoilDriver* driver, StepMode mode) {
+    this->driver = driver;
+    this->mode = mode;
+    phase = 0;
+    holdDirection = 0;
+    const CoilSequence& sequence = getCoilSequence(mode);
+    for (int i = 0; i < 8; i++) {
+        patterns[i] = sequence.patterns[i];
+    }
+    phaseMask = sequence.phaseCount - 1;
+}
+
+void CoilSequencer::begin(uint8_t pin1, uint8_t pin2, uint8_t pin3, uint8_t pin4) {
+    uint8_t pins[4] = {pin1, pin2, pin3, pin4};
+    driver->begin(pins);
+}
+
+void CoilSequencer::setMode(StepMode newMode) {
+    // Stay on the same rotor position in the new mode's phase grid
+    uint8_t halfStep = phaseToHalfStep(mode, phase);
+    const CoilSequence& sequence = getCoilSequence(newMode);
+    for (int i = 0; i < 8; i++) {
+        patterns[i] = sequence.patterns[i];
+    }
+    phaseMask = sequence.phaseCount - 1;
+    phase = halfStepToPhase(newMode, halfStep);
+    mode = newMode;
+    // Between two of the new mode's positions the phase is the one half a
+    // step to one side; the first step back towards it only energizes it,
+    // so the rotor never moves more than one step of the new mode
+    uint8_t onGrid = phaseToHalfStep(newMode, phase);
+    if (halfStep == onGrid) {
+        holdDirection = 0;
+    } else {
+        holdDirection = ((halfStep - onGrid) & 7) == 1 ? -1 : 1;
+    }
+}
+
+StepMode CoilSequencer::getMode() {
+    return mode;
+}
+
+uint8_t CoilSequencer::getPhase() {
+    return phase;
+}
+
+void CoilSequencer::step(int8_t direction) {
+    if (direction != holdDirection) {
+        phase = (uint8_t)((phase + direction) & phaseMask);
+    }
+    holdDirection = 0;
+    driver->write(patterns[phase]);
+}
+
+void CoilSequencer::release() {
+    driver->write(0);
+}
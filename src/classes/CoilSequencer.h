@@ -0,0 +1,33 @@
+#ifndef COIL_SEQUENCER_H
+#define COIL_SEQUENCER_H
+
+#include <stdint.h>
+#include "StepEngine.h"
+#include "CoilDriver.h"
+#include "MotionProfile.h"
+
+// Lean StepOutput for the ULN2003: keeps the phase index and hands the next
+// pattern from the mode's coil table to a CoilDriver, which applies all four
+// coils in one go.
+class CoilSequencer : public StepOutput {
+public:
+    CoilSequencer(CoilDriver* driver, StepMode mode);
+
+    void begin(uint8_t pin1, uint8_t pin2, uint8_t pin3, uint8_t pin4);
+    void setMode(StepMode mode);
+    StepMode getMode();
+    uint8_t getPhase();
+
+    void step(int8_t direction) override;
+    void release() override;
+
+private:
+    CoilDriver* driver;
+    StepMode mode;
+    uint8_t patterns[8];
+    uint8_t phaseMask;
+    uint8_t phase;
+    int8_t holdDirection; // first step this way after setMode() stays on phase
+};
+
+#endif
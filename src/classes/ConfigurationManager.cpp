@@ -65,6 +65,12 @@ void ConfigurationManager::loadConfiguration() {
     currentConfig.startTime = doc["startTime"].as<String>();
     currentConfig.durationHours = doc["durationHours"].as<int>();
     currentConfig.rewindAfterComplete = doc["rewindAfterComplete"].as<bool>();
+    currentConfig.timeLocked = doc["timeLocked"] | false;
+    currentConfig.periodNumerator = doc["periodNumerator"] | (uint64_t)0;
+    currentConfig.periodDenominator = doc["periodDenominator"] | (uint64_t)1;
+    currentConfig.gearStepsNumerator = doc["gearStepsNumerator"] | (uint64_t)2048;
+    currentConfig.gearStepsDenominator = doc["gearStepsDenominator"] | (uint64_t)1;
+    currentConfig.backlashSteps = doc["backlashSteps"] | 0L;
     
     configLoaded = true;
     Serial.println("Configuration loaded successfully");
@@ -78,6 +84,12 @@ void ConfigurationManager::saveConfiguration() {
     doc["startTime"] = currentConfig.startTime;
     doc["durationHours"] = currentConfig.durationHours;
     doc["rewindAfterComplete"] = currentConfig.rewindAfterComplete;
+    doc["timeLocked"] = currentConfig.timeLocked;
+    doc["periodNumerator"] = currentConfig.periodNumerator;
+    doc["periodDenominator"] = currentConfig.periodDenominator;
+    doc["gearStepsNumerator"] = currentConfig.gearStepsNumerator;
+    doc["gearStepsDenominator"] = currentConfig.gearStepsDenominator;
+    doc["backlashSteps"] = currentConfig.backlashSteps;
     
     File file = SPIFFS.open("/schedule.json", "w");
     if (!file) {
@@ -184,12 +196,168 @@ int ConfigurationManager::getRemainingMinutes() {
     return result;
 }
 
+bool ConfigurationManager::parsePeriod(const String& text, uint64_t& numerator, uint64_t& denominator) {
+    Serial.print("ConfigurationManager::parsePeriod(");
+    Serial.print(text);
+    Serial.println(")");
+
+    // Accepts seconds ("86164.0905") or H:MM:SS ("24:50:28", "23:56:4.0905").
+    // The decimal fraction is kept exactly, down to nanoseconds.
+    uint64_t seconds = 0;
+    uint64_t field = 0;
+    uint64_t fraction = 0;
+    int fractionDigits = 0;
+    bool inFraction = false;
+    bool anyDigit = false;
+    int colons = 0;
+
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text.charAt(i);
+        if (c >= '0' && c <= '9') {
+            anyDigit = true;
+            if (inFraction) {
+                if (fractionDigits < 9) {
+                    fraction = fraction * 10 + (c - '0');
+                    fractionDigits++;
+                }
+            } else {
+                field = field * 10 + (c - '0');
+                if (field > 864000) {
+                    Serial.println("ConfigurationManager::parsePeriod() returning: false");
+                    return false;
+                }
+            }
+        } else if (c == ':' && !inFraction) {
+            // At most H:MM:SS, and checked at each step so many fields
+            // cannot wrap seconds round to a small value
+            colons++;
+            seconds = (seconds + field) * 60;
+            field = 0;
+            if (colons > 2 || seconds > 864000) {
+                Serial.println("ConfigurationManager::parsePeriod() returning: false");
+                return false;
+            }
+        } else if (c == '.' && !inFraction) {
+            inFraction = true;
+        } else if (c != ' ') {
+            Serial.println("ConfigurationManager::parsePeriod() returning: false");
+            return false;
+        }
+    }
+    seconds += field;
+
+    if (!anyDigit || seconds > 864000) {
+        Serial.println("ConfigurationManager::parsePeriod() returning: false");
+        return false;
+    }
+
+    uint64_t scale = 1;
+    for (int i = 0; i < fractionDigits; i++) {
+        scale *= 10;
+    }
+    uint64_t scaled = seconds * scale + fraction; // seconds * 10^fractionDigits
+    if (fractionDigits <= 6) {
+        numerator = scaled;
+        for (int i = fractionDigits; i < 6; i++) {
+            numerator *= 10;
+        }
+        denominator = 1;
+    } else {
+        numerator = scaled;
+        denominator = scale / 1000000;
+    }
+
+    // Reduce the fraction
+    uint64_t a = numerator;
+    uint64_t b = denominator;
+    while (b != 0) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    if (a > 1) {
+        numerator /= a;
+        denominator /= a;
+    }
+
+    bool result = numerator > 0;
+    Serial.print("ConfigurationManager::parsePeriod() returning: ");
+    Serial.println(result);
+    return result;
+}
+
+bool ConfigurationManager::parseDecimal(const String& text, uint64_t& numerator, uint64_t& denominator) {
+    Serial.print("ConfigurationManager::parseDecimal(");
+    Serial.print(text);
+    Serial.println(")");
+
+    // A positive decimal such as "2037.886" as an exact, reduced fraction,
+    // up to six places
+    uint64_t whole = 0;
+    uint64_t scale = 1;
+    bool inFraction = false;
+    bool anyDigit = false;
+
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text.charAt(i);
+        if (c >= '0' && c <= '9') {
+            anyDigit = true;
+            if (inFraction && scale >= 1000000) {
+                continue;
+            }
+            whole = whole * 10 + (c - '0');
+            if (inFraction) {
+                scale *= 10;
+            }
+            if (whole > 1000000000000ULL) {
+                Serial.println("ConfigurationManager::parseDecimal() returning: false");
+                return false;
+            }
+        } else if (c == '.' && !inFraction) {
+            inFraction = true;
+        } else if (c != ' ') {
+            Serial.println("ConfigurationManager::parseDecimal() returning: false");
+            return false;
+        }
+    }
+
+    if (!anyDigit) {
+        Serial.println("ConfigurationManager::parseDecimal() returning: false");
+        return false;
+    }
+
+    numerator = whole;
+    denominator = scale;
+    while (denominator > 1 && numerator % 10 == 0) {
+        numerator /= 10;
+        denominator /= 10;
+    }
+    while (denominator > 1 && numerator % 5 == 0 && denominator % 5 == 0) {
+        numerator /= 5;
+        denominator /= 5;
+    }
+    while (denominator > 1 && numerator % 2 == 0 && denominator % 2 == 0) {
+        numerator /= 2;
+        denominator /= 2;
+    }
+
+    Serial.print("ConfigurationManager::parseDecimal() returning: ");
+    Serial.println(true);
+    return true;
+}
+
 void ConfigurationManager::setDefaultConfiguration() {
     Serial.println("ConfigurationManager::setDefaultConfiguration()");
     currentConfig.rotationSpeed = ONCE_PER_MINUTE;
     currentConfig.startTime = "00:00";
     currentConfig.durationHours = 0;
     currentConfig.rewindAfterComplete = false;
+    currentConfig.timeLocked = false;
+    currentConfig.periodNumerator = 0;
+    currentConfig.periodDenominator = 1;
+    currentConfig.gearStepsNumerator = 2048;
+    currentConfig.gearStepsDenominator = 1;
+    currentConfig.backlashSteps = 0;
     configLoaded = true;
 }
 
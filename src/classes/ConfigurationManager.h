@@ -11,6 +11,12 @@ struct Configuration {
     String startTime;
     int durationHours;
     bool rewindAfterComplete;
+    bool timeLocked = false; // dial angle follows UTC instead of counting steps
+    uint64_t periodNumerator = 0; // CUSTOM_PERIOD revolution is
+    uint64_t periodDenominator = 1; // periodNumerator / periodDenominator us
+    uint64_t gearStepsNumerator = 2048; // calibrated full steps per revolution
+    uint64_t gearStepsDenominator = 1;  // is gearStepsNumerator / gearStepsDenominator
+    long backlashSteps = 0; // gear backlash in full steps
 };
 
 class ConfigurationManager {
@@ -27,6 +33,8 @@ public:
     bool isCompleted();
     int getMinutesUntilStart();
     int getRemainingMinutes();
+    bool parsePeriod(const String& text, uint64_t& numerator, uint64_t& denominator);
+    bool parseDecimal(const String& text, uint64_t& numerator, uint64_t& denominator);
 
 private:
     Configuration currentConfig;
@@ -3,6 +3,9 @@
 DisplayManager::DisplayManager() {
     Serial.println("DisplayManager::DisplayManager()");
     display = nullptr;
+    queue = nullptr;
+    pending.status[0] = 0;
+    pending.activity[0] = 0;
 }
 
 DisplayManager::~DisplayManager() {
@@ -10,6 +13,9 @@ DisplayManager::~DisplayManager() {
     if (display) {
         delete display;
     }
+    if (queue) {
+        vQueueDelete(queue);
+    }
 }
 
 void DisplayManager::begin() {
@@ -68,4 +74,32 @@ void DisplayManager::clearDisplay() {
         display->clearDisplay();
         display->display();
     }
-}
\ No newline at end of file
+}
+bool DisplayManager::beginTaskQueue() {
+    Serial.println("DisplayManager::beginTaskQueue()");
+    // One slot: only the newest text matters
+    queue = xQueueCreate(1, sizeof(DisplayText));
+    return queue != nullptr;
+}
+
+void DisplayManager::show(const String& statusText, const String& activityText) {
+    // Serial.println("DisplayManager::show()"); // Commented out - called frequently
+    if (!queue) {
+        updateDisplay(statusText, activityText);
+        return;
+    }
+    DisplayText text;
+    strlcpy(text.status, statusText.c_str(), sizeof(text.status));
+    strlcpy(text.activity, activityText.c_str(), sizeof(text.activity));
+    xQueueOverwrite(queue, &text);
+}
+
+bool DisplayManager::waitForUpdate(TickType_t ticks) {
+    // Serial.println("DisplayManager::waitForUpdate()"); // Commented out - called frequently
+    return queue && xQueueReceive(queue, &pending, ticks) == pdTRUE;
+}
+
+void DisplayManager::renderPending() {
+    // Serial.println("DisplayManager::renderPending()"); // Commented out - called frequently
+    updateDisplay(String(pending.status), String(pending.activity));
+}
@@ -17,11 +17,24 @@ public:
     void begin();
     void updateDisplay(const String& statusText, const String& activityText);
     void clearDisplay();
+    // Hand-off to the display task. show() posts the newest text (older
+    // unrendered text is replaced), or draws it directly if no task queue
+    bool beginTaskQueue();
+    void show(const String& statusText, const String& activityText);
+    bool waitForUpdate(TickType_t ticks);
+    void renderPending();
 
 private:
+    struct DisplayText {
+        char status[64];
+        char activity[256];
+    };
+
     Adafruit_SSD1306* display;
     String lastStatusText;
     String lastActivityText;
+    QueueHandle_t queue;
+    DisplayText pending;
 };
 
 #endif
\ No newline at end of file
@@ -1,15 +1,29 @@
 #include "Ephemeris.h"
 
 Ephemeris::Ephemeris(GPSManager* gpsManager) : gpsManager(gpsManager), currentTime(0), latitude(0.0), longitude(0.0) {
-    if (gpsManager) {
-        setCurrentTime(gpsManager->getUnixTimestamp());
-        setLatitude(gpsManager->getLatitude());
-        setLongitude(gpsManager->getLongitude());
-    }
-    
+  almanac.valid = false;
+  maxDistanceKm = 5.0f;
+  liveInterval = 60;
+  liveUpdatedAt = 0;
+  sunAzimuth = 0;
+  sunElevation = 0;
+  summaryDirty = true;
+  if (gpsManager) {
+    setCurrentTime(gpsManager->getUnixTimestamp());
+    setLatitude(gpsManager->getLatitude());
+    setLongitude(gpsManager->getLongitude());
+  }
+
+  // Until the GPS is back the last stored table stands in for it
+  almanacTable = new AlmanacTable();
+  storedLocation = almanacTable->load();
+  if (storedLocation) {
+    almanacTable->getLocation(&latitude, &longitude);
+  }
 }
 
 Ephemeris::~Ephemeris() {
+  delete almanacTable;
 }
 
 void Ephemeris::setCurrentTime(unsigned long unixTimestamp) {
@@ -22,6 +36,7 @@ unsigned long Ephemeris::getCurrentTime() {
 
 void Ephemeris::setLatitude(double lat) {
     latitude = lat;
+    storedLocation = false;
 }
 
 double Ephemeris::getLatitude() {
@@ -30,6 +45,7 @@ double Ephemeris::getLatitude() {
 
 void Ephemeris::setLongitude(double lng) {
     longitude = lng;
+    storedLocation = false;
 }
 
 double Ephemeris::getLongitude() {
@@ -70,42 +86,232 @@ String Ephemeris::printTime(double hours) {
 }
 
 String Ephemeris::getAlmanacSummary() {
-  this->moonCalc.calculate(this->getLatitude(), this->getLongitude(), now());
+  time_t localTime = now();
+  int timezoneOffset = getTimezoneOffset();
 
-  int timezoneOffset = gpsManager->getTimezoneOffset();
-  time_t utc = now() - (timezoneOffset * 3600); // Convert local time back to UTC for SolarCalculator
-  
-  double transit, sunrise, sunset, sunSetAz, sunElevation;
-  calcSunriseSunset(utc, this->getLatitude(), this->getLongitude(), transit, sunrise, sunset);
-
-  calcHorizontalCoordinates(utc, latitude, longitude, sunSetAz, sunElevation);
-  time_t dSunRise = doubleToTimeT(sunrise + timezoneOffset);
-  time_t dSunSet = doubleToTimeT(sunset + timezoneOffset);
-  String result = "S: " + hhmm(dSunRise) + " " + hhmm(dSunSet)
-    + " " + String(int(sunSetAz)) + "'"
-    + "\n";
- 
-  moonCalc.calculate(this->getLatitude(), this->getLongitude(), now());
-  
-  // Moon status logic
-  time_t currentTime = now();
-  const long TWELVE_HOURS = 12 * 3600; // 12 hours in seconds
-  
-  if (!moonCalc.hasRise) {
-    result += "No Moon Today\n";
+  refreshAlmanac(localTime, timezoneOffset);
+  checkAlmanacTable(localTime, timezoneOffset);
+  if (liveUpdatedAt == 0 || localTime < liveUpdatedAt || localTime - liveUpdatedAt >= liveInterval) {
+    refreshLiveSun(localTime, timezoneOffset);
+  }
+  if (summaryDirty) {
+    renderSummary();
+  }
+  return summary;
+}
+
+bool Ephemeris::buildAlmanacStep() {
+  // Serial.println("Ephemeris::buildAlmanacStep()"); // Commented out - called frequently
+  long localDay;
+  double lat, lng;
+  int timezoneOffset;
+  if (!almanacTable->nextBuildDay(&localDay, &lat, &lng, &timezoneOffset)) {
+    return false;
+  }
+  AlmanacDay day;
+  computeDay(localDay, timezoneOffset, lat, lng, &day);
+  almanacTable->storeBuildDay(day);
+  return true;
+}
+
+int Ephemeris::getTimezoneOffset() {
+  return storedLocation ? almanacTable->getTimezoneOffset() : gpsManager->getTimezoneOffset();
+}
+
+void Ephemeris::setAlmanacMaxDistance(float kilometres) {
+  maxDistanceKm = kilometres;
+}
+
+void Ephemeris::setLiveInterval(uint16_t seconds) {
+  liveInterval = seconds > 0 ? seconds : 1;
+}
+
+void Ephemeris::invalidateAlmanac() {
+  almanac.valid = false;
+  liveUpdatedAt = 0;
+}
+
+int Ephemeris::getSunAzimuth() {
+  return sunAzimuth;
+}
+
+int Ephemeris::getSunElevation() {
+  return sunElevation;
+}
+
+void Ephemeris::refreshAlmanac(time_t localTime, int timezoneOffset) {
+  long localDay = (long)(localTime / 86400);
+  if (almanac.valid && almanac.localDay == localDay && almanac.timezoneOffset == timezoneOffset
+      && distanceKm(almanac.latitude, almanac.longitude, latitude, longitude) <= maxDistanceKm) {
+    return;
+  }
+  Serial.println("Ephemeris::refreshAlmanac()");
+
+  almanac.valid = true;
+  almanac.localDay = localDay;
+  almanac.timezoneOffset = timezoneOffset;
+  almanac.latitude = round(latitude / LOCATION_QUANTUM) * LOCATION_QUANTUM;
+  almanac.longitude = round(longitude / LOCATION_QUANTUM) * LOCATION_QUANTUM;
+
+  // The stored table if it has this date near here, else just today
+  AlmanacDay day;
+  double tableLatitude, tableLongitude;
+  almanacTable->getLocation(&tableLatitude, &tableLongitude);
+  if (!almanacTable->lookup(localDay, &day)
+      || distanceKm(tableLatitude, tableLongitude, latitude, longitude) > maxDistanceKm) {
+    computeDay(localDay, timezoneOffset, almanac.latitude, almanac.longitude, &day);
+  }
+
+  // Table times are UTC, the display shows local time; 0 stays "none"
+  time_t offset = timezoneOffset * 3600;
+  almanac.sunrise = day.sunrise ? day.sunrise + offset : 0;
+  almanac.sunset = day.sunset ? day.sunset + offset : 0;
+  almanac.moonHasRise = day.moonRise != 0;
+  almanac.moonRise = day.moonRise ? day.moonRise + offset : 0;
+  almanac.moonSet = day.moonSet ? day.moonSet + offset : 0;
+  almanac.moonRiseAz = day.moonRiseAz / 10;
+  almanac.moonSetAz = day.moonSetAz / 10;
+  almanac.moonPercent = day.moonPercent;
+  almanac.flags = day.flags;
+  summaryDirty = true;
+
+  // New date or place, the sun position goes with it
+  refreshLiveSun(localTime, timezoneOffset);
+}
+
+void Ephemeris::checkAlmanacTable(time_t localTime, int timezoneOffset) {
+  // Serial.println("Ephemeris::checkAlmanacTable()"); // Commented out - called frequently
+  // Only once the time and place are real, and one build at a time
+  if (localTime < MIN_VALID_TIME || storedLocation || almanacTable->isBuilding()) {
+    return;
+  }
+  long localDay = (long)(localTime / 86400);
+  if (almanacTable->isLoaded() && almanacTable->getTimezoneOffset() == timezoneOffset
+      && localDay >= almanacTable->getFirstDay() && localDay + TABLE_MARGIN_DAYS <= almanacTable->getLastDay()) {
+    double tableLatitude, tableLongitude;
+    almanacTable->getLocation(&tableLatitude, &tableLongitude);
+    if (distanceKm(tableLatitude, tableLongitude, latitude, longitude) <= maxDistanceKm) {
+      return;
+    }
+  }
+  almanacTable->requestBuild(localDay, almanac.latitude, almanac.longitude, timezoneOffset);
+}
+
+void Ephemeris::computeDay(long localDay, int timezoneOffset, double latitude, double longitude, AlmanacDay* day) {
+  // Serial.println("Ephemeris::computeDay()"); // Commented out - called frequently
+  // The local date, in UTC
+  time_t dayStart = (time_t)localDay * 86400 - timezoneOffset * 3600;
+  time_t dayEnd = dayStart + 86400;
+  day->flags = 0;
+
+  RiseSetSolver::Events events;
+  RiseSetSolver sun(RiseSetSolver::SUN, (float)latitude, (float)longitude);
+  sun.solve(dayStart, dayEnd, &events);
+  day->sunrise = events.riseCount > 0 ? (uint32_t)events.rises[0].time : 0;
+  day->sunset = events.setCount > 0 ? (uint32_t)events.sets[0].time : 0;
+  // No rise or set during polar day and night
+  day->flags |= events.alwaysUp ? AlmanacDay::SUN_UP : 0;
+  day->flags |= events.alwaysDown ? AlmanacDay::SUN_DOWN : 0;
+
+  RiseSetSolver moon(RiseSetSolver::MOON, (float)latitude, (float)longitude);
+  RiseSetSolver::Event rise, set;
+  moon.solveRiseSet(dayStart, dayEnd, &events, &rise, &set);
+  day->flags |= events.alwaysUp ? AlmanacDay::MOON_UP : 0;
+  day->flags |= events.alwaysDown ? AlmanacDay::MOON_DOWN : 0;
+  // The set that follows the rise, past midnight if need be
+  day->moonRise = (uint32_t)rise.time;
+  day->moonRiseAz = rise.time ? (uint16_t)lroundf(rise.azimuth * 10) : 0;
+  day->moonSet = (uint32_t)set.time;
+  day->moonSetAz = set.time ? (uint16_t)lroundf(set.azimuth * 10) : 0;
+
+  day->moonPercent = (uint8_t)lround(getMoonPhase(dayStart + 43200) * 100);
+  memset(day->reserved, 0, sizeof(day->reserved));
+}
+
+void Ephemeris::refreshLiveSun(time_t localTime, int timezoneOffset) {
+  // Serial.println("Ephemeris::refreshLiveSun()"); // Commented out - called frequently
+  liveUpdatedAt = localTime;
+  time_t utc = localTime - (timezoneOffset * 3600);
+  // Single precision with fixed-point arguments, the FPU has no double
+  AstroKernels::Arguments<float> arguments;
+  AstroKernels::Equatorial<float> sun;
+  AstroKernels::Horizontal<float> position;
+  AstroKernels::argumentsFixed(AstroKernels::timeFromUnix(utc), &arguments);
+  AstroKernels::sunPosition(arguments, &sun);
+  AstroKernels::horizontal(arguments, sun, (float)(almanac.latitude * DEG_TO_RAD), (float)(almanac.longitude * DEG_TO_RAD), &position);
+  sunElevation = int(position.elevation * RAD_TO_DEG);
+  // Only the azimuth is shown
+  int azimuth = int(position.azimuth * RAD_TO_DEG);
+  if (azimuth != sunAzimuth) {
+    sunAzimuth = azimuth;
+    summaryDirty = true;
+  }
+}
+
+bool Ephemeris::getPlanetPosition(PlanetEphemeris::Planet planet, time_t utc, float* azimuth, float* elevation) {
+  // Serial.println("Ephemeris::getPlanetPosition()"); // Commented out - called frequently
+  AstroKernels::Equatorial<float> body;
+  if (!PlanetEphemeris::position(planet, utc, &body)) {
+    return false;
+  }
+  AstroKernels::Arguments<float> arguments;
+  AstroKernels::Horizontal<float> position;
+  AstroKernels::argumentsFixed(AstroKernels::timeFromUnix(utc), &arguments);
+  AstroKernels::horizontal(arguments, body, (float)(latitude * DEG_TO_RAD), (float)(longitude * DEG_TO_RAD), &position);
+  *azimuth = position.azimuth * RAD_TO_DEG;
+  *elevation = position.elevation * RAD_TO_DEG;
+  return true;
+}
+
+bool Ephemeris::getPlanetEvents(PlanetEphemeris::Planet planet, time_t localTime, RiseSetSolver::Events* events) {
+  Serial.println("Ephemeris::getPlanetEvents()");
+  long localDay = (long)(localTime / 86400);
+  time_t dayStart = (time_t)localDay * 86400 - getTimezoneOffset() * 3600;
+  if (planet < 0 || planet >= PlanetEphemeris::PLANET_COUNT
+      || !PlanetEphemeris::covers(dayStart) || !PlanetEphemeris::covers(dayStart + 86400)) {
+    return false;
+  }
+  RiseSetSolver solver((RiseSetSolver::Body)(RiseSetSolver::MERCURY + planet), (float)latitude, (float)longitude);
+  solver.solve(dayStart, dayStart + 86400, events);
+  return true;
+}
+
+void Ephemeris::renderSummary() {
+  summaryDirty = false;
+  if (almanac.flags & AlmanacDay::SUN_UP) {
+    summary = "S: up all day";
+  } else if (almanac.flags & AlmanacDay::SUN_DOWN) {
+    summary = "S: down all day";
   } else {
-    // Check if moon rose less than 12 hours ago
-    // long timeSinceRise = currentTime - moonCalc.riseTime;
-    // long timeUntilRise = moonCalc.riseTime - currentTime;
-        
-    result += "Moon ^ " + getDayName(moonCalc.riseTime) + " " + hhmm(moonCalc.riseTime) + " " + String(int(moonCalc.riseAz)) + "'\n";
-    result += "Moon v " + getDayName(moonCalc.setTime)  + " " + hhmm(moonCalc.setTime)  + " " + String(int(moonCalc.setAz))  + "'\n";
+    // A date at the edge of polar day may have only one of the two
+    summary = "S: " + (almanac.sunrise ? hhmm(almanac.sunrise) : String("--:--"))
+      + " " + (almanac.sunset ? hhmm(almanac.sunset) : String("--:--"));
   }
-  
-  result += String(int(getMoonPhase(now()) * 100)) + "% Full";
-  
-result += "\n";
-  return result;
+  summary += " " + String(sunAzimuth) + "'" + "\n";
+
+  if (almanac.flags & AlmanacDay::MOON_UP) {
+    summary += "Moon up all day\n";
+  } else if (!almanac.moonHasRise) {
+    summary += "No Moon Today\n";
+  } else {
+    summary += "Moon ^ " + getDayName(almanac.moonRise) + " " + hhmm(almanac.moonRise) + " " + String(almanac.moonRiseAz) + "'\n";
+    if (almanac.moonSet) {
+      summary += "Moon v " + getDayName(almanac.moonSet)  + " " + hhmm(almanac.moonSet)  + " " + String(almanac.moonSetAz)  + "'\n";
+    } else {
+      summary += "Moon v --\n";
+    }
+  }
+
+  summary += String(almanac.moonPercent) + "% Full";
+  summary += "\n";
+}
+
+float Ephemeris::distanceKm(double lat1, double lng1, double lat2, double lng2) {
+  // Equirectangular, plenty for a few kilometres; in float for the FPU
+  float meanLatitude = (float)((lat1 + lat2) * 0.5 * DEG_TO_RAD);
+  float dx = (float)((lng2 - lng1) * DEG_TO_RAD) * cosf(meanLatitude);
+  float dy = (float)((lat2 - lat1) * DEG_TO_RAD);
+  return 6371.0f * sqrtf(dx * dx + dy * dy);
 }
 
 time_t Ephemeris::doubleToTimeT(double hours) {
@@ -125,29 +331,6 @@ time_t Ephemeris::doubleToTimeT(double hours) {
 }
 
 double Ephemeris::getMoonPhase(time_t t) {
-  // Calculate Julian date from Unix timestamp
-  double jd = (double)t / 86400.0 + 2440587.5;
-  
-  // Calculate days since J2000.0
-  double daysSinceJ2000 = jd - 2451545.0;
-  
-  // Mean elongation of Moon from Sun (D)
-  double D = 297.8501921 + 445267.1114034 * daysSinceJ2000 / 36525.0;
-  
-  // Sun's mean anomaly (M)
-  double M = 357.5291092 + 35999.0502909 * daysSinceJ2000 / 36525.0;
-  
-  // Moon's mean anomaly (M')
-  double Mp = 134.9633964 + 477198.8675055 * daysSinceJ2000 / 36525.0;
-  
-  // Convert to radians
-  D = D * PI / 180.0;
-  M = M * PI / 180.0;
-  Mp = Mp * PI / 180.0;
-  
-  // Phase angle calculation (simplified)
-  double phase = 0.5 * (1.0 - cos(Mp));
-  
-  return phase; // Returns 0.0 (new moon) to 1.0 (full moon)
+  // Lit fraction from the lunation table, 0.0 (new moon) to 1.0 (full moon)
+  return LunarPhase::getIllumination(t);
 }
-
@@ -3,11 +3,17 @@
 
 #include <Arduino.h>
 #include "GPSManager.h"
-#include <SolarCalculator.h> // For sun data
-#include <MoonRise.h> // For moon data
 #include <TimeLib.h>
+#include "AlmanacTable.h"
+#include "AstroKernels.h"
+#include "RiseSetSolver.h"
+#include "LunarPhase.h"
+#include "PlanetEphemeris.h"
 class Ephemeris {
 public:
+    // Anything earlier is a clock that was never set
+    static const time_t MIN_VALID_TIME = 1577836800; // 2020-01-01
+
     Ephemeris(GPSManager* gpsManager);
     ~Ephemeris();
     
@@ -28,18 +34,83 @@ public:
 
     String printTime(double hours);
 
+    // Rise/set times are cached for the local date and location, see
+    // AlmanacCache; only the live sun position is refreshed between
     String getAlmanacSummary();
+    // Computes one day of the stored 30-day table if a build is pending,
+    // false when there was nothing to do. Called by the almanac task.
+    bool buildAlmanacStep();
+    // The GPS timezone, or the stored table's until a location is set
+    int getTimezoneOffset();
+    // Recompute once the location moves further than this (default 5 km)
+    void setAlmanacMaxDistance(float kilometres);
+    // Seconds between live sun azimuth/elevation updates (default 60)
+    void setLiveInterval(uint16_t seconds);
+    void invalidateAlmanac();
+    // Live sun position in whole degrees, as of the last refresh;
+    // geometric, without refraction
+    int getSunAzimuth();
+    int getSunElevation();
+
+    // Planet azimuth/elevation in degrees at a UTC time, here; geometric,
+    // without refraction. False outside the planet table (2025-2055).
+    bool getPlanetPosition(PlanetEphemeris::Planet planet, time_t utc, float* azimuth, float* elevation);
+    // Planet rise, set and transit over the local date of localTime, here,
+    // in UTC; false when the table does not cover the date
+    bool getPlanetEvents(PlanetEphemeris::Planet planet, time_t localTime, RiseSetSolver::Events* events);
 
     time_t doubleToTimeT(double hours);
 
-    double getMoonPhase(time_t t);
+    // Illuminated fraction of the moon at a UTC time, see LunarPhase
+    static double getMoonPhase(time_t t);
 
 private:
+    // Sun and moon events for one local date at one location (rounded to
+    // LOCATION_QUANTUM degrees), in local time. Kept until the date rolls
+    // over, the timezone changes or the location moves more than
+    // maxDistanceKm; taken from the stored table when it covers them.
+    struct AlmanacCache {
+        bool valid;
+        long localDay;
+        int timezoneOffset;
+        double latitude;
+        double longitude;
+        time_t sunrise;
+        time_t sunset;
+        bool moonHasRise;
+        time_t moonRise;
+        time_t moonSet;
+        int moonRiseAz;
+        int moonSetAz;
+        int moonPercent;
+        uint8_t flags; // AlmanacDay::SUN_UP...
+    };
+
+    static constexpr double LOCATION_QUANTUM = 0.01; // ~1 km
+    // Rebuild the table when fewer days than this are left ahead
+    static const long TABLE_MARGIN_DAYS = 7;
+
     GPSManager* gpsManager;
     unsigned long currentTime;
     double latitude;
     double longitude;
-    MoonRise moonCalc;
+    AlmanacTable* almanacTable;
+    bool storedLocation; // latitude/longitude came from the table
+    AlmanacCache almanac;
+    float maxDistanceKm;
+    uint16_t liveInterval;
+    time_t liveUpdatedAt;
+    int sunAzimuth;
+    int sunElevation;
+    String summary;
+    bool summaryDirty;
+
+    void refreshAlmanac(time_t localTime, int timezoneOffset);
+    void checkAlmanacTable(time_t localTime, int timezoneOffset);
+    static void computeDay(long localDay, int timezoneOffset, double latitude, double longitude, AlmanacDay* day);
+    void refreshLiveSun(time_t localTime, int timezoneOffset);
+    void renderSummary();
+    float distanceKm(double lat1, double lng1, double lat2, double lng2);
 };
 
 #endif
\ No newline at end of file
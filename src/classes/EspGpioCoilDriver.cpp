@@ -0,0 +1,67 @@
+#include "EspGpioCoilDriver.h"
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+
+EspGpioCoilDriver::EspGpioCoilDriver() {
+    Serial.println("EspGpioCoilDriver::EspGpioCoilDriver()");
+    for (int p = 0; p < 16; p++) {
+        setMask[p] = 0;
+        clearMask[p] = 0;
+        setMaskHigh[p] = 0;
+        clearMaskHigh[p] = 0;
+    }
+    usesHighBank = false;
+}
+
+void EspGpioCoilDriver::begin(const uint8_t pins[4]) {
+    Serial.print("EspGpioCoilDriver::begin(");
+    Serial.print(pins[0]);
+    Serial.print(", ");
+    Serial.print(pins[1]);
+    Serial.print(", ");
+    Serial.print(pins[2]);
+    Serial.print(", ");
+    Serial.print(pins[3]);
+    Serial.println(")");
+
+    for (int i = 0; i < 4; i++) {
+        pinMode(pins[i], OUTPUT);
+        if (pins[i] >= 32) {
+            usesHighBank = true;
+        }
+    }
+
+    for (int pattern = 0; pattern < 16; pattern++) {
+        for (int i = 0; i < 4; i++) {
+            bool on = (pattern >> i) & 1;
+            if (pins[i] < 32) {
+                uint32_t bit = 1UL << pins[i];
+                if (on) {
+                    setMask[pattern] |= bit;
+                } else {
+                    clearMask[pattern] |= bit;
+                }
+            } else {
+                uint32_t bit = 1UL << (pins[i] - 32);
+                if (on) {
+                    setMaskHigh[pattern] |= bit;
+                } else {
+                    clearMaskHigh[pattern] |= bit;
+                }
+            }
+        }
+    }
+    write(0);
+}
+
+void EspGpioCoilDriver::write(uint8_t pattern) {
+    // Serial.println("EspGpioCoilDriver::write()"); // Commented out - called from the step timer
+    pattern &= 0x0F;
+    // Clear before set so two phases are never driven against each other
+    REG_WRITE(GPIO_OUT_W1TC_REG, clearMask[pattern]);
+    REG_WRITE(GPIO_OUT_W1TS_REG, setMask[pattern]);
+    if (usesHighBank) {
+        REG_WRITE(GPIO_OUT1_W1TC_REG, clearMaskHigh[pattern]);
+        REG_WRITE(GPIO_OUT1_W1TS_REG, setMaskHigh[pattern]);
+    }
+}
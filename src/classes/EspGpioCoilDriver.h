@@ -0,0 +1,25 @@
+#ifndef ESP_GPIO_COIL_DRIVER_H
+#define ESP_GPIO_COIL_DRIVER_H
+
+#include <Arduino.h>
+#include "CoilDriver.h"
+
+// Writes coil patterns straight to the ESP32 GPIO set/clear registers. The
+// register masks for all 16 patterns are precomputed in begin(), so a step
+// is a table lookup and one write to each of W1TC and W1TS.
+class EspGpioCoilDriver : public CoilDriver {
+public:
+    EspGpioCoilDriver();
+
+    void begin(const uint8_t pins[4]) override;
+    void write(uint8_t pattern) override;
+
+private:
+    uint32_t setMask[16];
+    uint32_t clearMask[16];
+    uint32_t setMaskHigh[16];   // GPIO32 and up
+    uint32_t clearMaskHigh[16];
+    bool usesHighBank;
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include "EspStepTimer.h"
+
+EspStepTimer::EspStepTimer(int8_t taskCore, UBaseType_t taskPriority) {
+    Serial.println("EspStepTimer::EspStepTimer()");
+    handle = nullptr;
+    mux = portMUX_INITIALIZER_UNLOCKED;
+    callback = nullptr;
+    arg = nullptr;
+    this->taskCore = taskCore;
+    this->taskPriority = taskPriority;
+    task = nullptr;
+    busyMicros = 0;
+}
+
+EspStepTimer::~EspStepTimer() {
+    Serial.println("EspStepTimer::~EspStepTimer()");
+    if (handle) {
+        esp_timer_stop(handle);
+        esp_timer_delete(handle);
+    }
+    if (task) {
+        vTaskDelete(task);
+    }
+}
+
+void EspStepTimer::begin(Callback callback, void* arg) {
+    Serial.println("EspStepTimer::begin()");
+    this->callback = callback;
+    this->arg = arg;
+
+    if (taskCore >= 0) {
+        if (xTaskCreatePinnedToCore(&EspStepTimer::taskLoop, "motor", 4096, this, taskPriority, &task, taskCore) != pdPASS) {
+            Serial.println("Failed to create motor task, stepping from the timer task");
+            task = nullptr;
+        }
+    }
+
+    esp_timer_create_args_t args = {};
+    args.callback = &EspStepTimer::onExpired;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "step";
+    if (esp_timer_create(&args, &handle) != ESP_OK) {
+        Serial.println("Failed to create step timer");
+        handle = nullptr;
+    }
+}
+
+uint64_t EspStepTimer::nowMicros() {
+    // Serial.println("EspStepTimer::nowMicros()"); // Commented out - called frequently
+    return (uint64_t)esp_timer_get_time();
+}
+
+void EspStepTimer::fireAt(uint64_t whenMicros) {
+    // Serial.println("EspStepTimer::fireAt()"); // Commented out - called frequently
+    if (!handle) {
+        return;
+    }
+    uint64_t now = nowMicros();
+    uint64_t timeout = whenMicros > now ? whenMicros - now : 1;
+    esp_timer_stop(handle); // Not running is fine, start_once needs a stopped timer
+    esp_timer_start_once(handle, timeout);
+}
+
+void EspStepTimer::cancel() {
+    // Serial.println("EspStepTimer::cancel()"); // Commented out - called frequently
+    if (handle) {
+        esp_timer_stop(handle);
+    }
+}
+
+void EspStepTimer::lock() {
+    portENTER_CRITICAL(&mux);
+}
+
+void EspStepTimer::unlock() {
+    portEXIT_CRITICAL(&mux);
+}
+
+TaskHandle_t EspStepTimer::getTaskHandle() {
+    return task;
+}
+
+uint32_t EspStepTimer::getBusyMicros() {
+    return busyMicros;
+}
+
+void EspStepTimer::onExpired(void* arg) {
+    EspStepTimer* timer = static_cast<EspStepTimer*>(arg);
+    if (timer->task) {
+        xTaskNotifyGive(timer->task);
+    } else {
+        timer->runCallback();
+    }
+}
+
+void EspStepTimer::taskLoop(void* arg) {
+    EspStepTimer* timer = static_cast<EspStepTimer*>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        timer->runCallback();
+    }
+}
+
+void EspStepTimer::runCallback() {
+    uint32_t start = (uint32_t)esp_timer_get_time();
+    callback(arg);
+    busyMicros = busyMicros + ((uint32_t)esp_timer_get_time() - start);
+}
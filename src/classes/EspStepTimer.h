@@ -0,0 +1,41 @@
+#ifndef ESP_STEP_TIMER_H
+#define ESP_STEP_TIMER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "StepTimer.h"
+
+// esp_timer backend. With a task core given, each expiry only wakes a
+// dedicated "motor" task pinned to that core, which runs the callback, so
+// stepping is isolated from the esp_timer task and the other core's load.
+class EspStepTimer : public StepTimer {
+public:
+    EspStepTimer(int8_t taskCore = -1, UBaseType_t taskPriority = 20);
+    ~EspStepTimer();
+
+    void begin(Callback callback, void* arg) override;
+    uint64_t nowMicros() override;
+    void fireAt(uint64_t whenMicros) override;
+    void cancel() override;
+    void lock() override;
+    void unlock() override;
+
+    TaskHandle_t getTaskHandle();
+    uint32_t getBusyMicros(); // total callback time, wraps every ~71 minutes
+
+private:
+    esp_timer_handle_t handle;
+    portMUX_TYPE mux;
+    Callback callback;
+    void* arg;
+    int8_t taskCore;
+    UBaseType_t taskPriority;
+    TaskHandle_t task;
+    volatile uint32_t busyMicros;
+
+    static void onExpired(void* arg);
+    static void taskLoop(void* arg);
+    void runCallback();
+};
+
+#endif
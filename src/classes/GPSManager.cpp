@@ -1,50 +1,375 @@
 #include "GPSManager.h"
+#include "Ubx.h"
+#include <TimeLib.h>
+
+// NEO-6M on UART2, pins 16 (RX) and 17 (TX). It starts at 9600 baud with
+// six NMEA sentences once a second; configured, five solutions a second at
+// 38400 baud, as NAV-POSLLH, NAV-SOL, NAV-DOP and NAV-TIMEUTC (150 bytes)
+// or RMC and GGA (about 140 bytes), under a fifth of the line. NAV-CLOCK,
+// the receiver's oscillator drift for the warm start, comes once a second.
+static const int8_t GPS_RX_PIN = 16;
+static const int8_t GPS_TX_PIN = 17;
+static const uint32_t GPS_DEFAULT_BAUD = 9600;
+static const uint32_t GPS_BAUD = 38400;
+static const uint16_t GPS_PERIOD_MS = 200;
+// Driver ring, half a second at 38400 baud, so a stalled reader loses nothing
+static const size_t GPS_RX_BUFFER = 2048;
+static const uint32_t GPS_ACK_TIMEOUT_MS = 300;
+// NAV-CLOCK once every this many solutions
+static const uint8_t GPS_CLOCK_RATE = 5;
+// Drift known to 5 ppm, in ps/s
+static const uint32_t GPS_CLOCK_ACCURACY = 5000000;
 
 GPSManager::GPSManager() {
     Serial.println("GPSManager::GPSManager()");
     useDefaults = false;
     gpsSerial = nullptr;
+    receiveTask = nullptr;
+    configured = false;
+    sequence = 0;
+    positionAt = 0;
+    navigationTow = 0;
+    navigationSeen = 0;
+    protocol = UBX;
+    memset(&navigation, 0, sizeof(navigation));
+    memset(&aiding, 0, sizeof(aiding));
+    aidingSet = false;
+    aidingAt = 0;
+    aided = false;
 }
 
 GPSManager::~GPSManager() {
     Serial.println("GPSManager::~GPSManager()");
     if (gpsSerial) {
-        delete gpsSerial;
+        gpsSerial->end();
     }
 }
 
+void GPSManager::setProtocol(Protocol protocol) {
+    Serial.println("GPSManager::setProtocol()");
+    this->protocol = protocol;
+}
+
+GPSManager::Protocol GPSManager::getProtocol() {
+    return protocol;
+}
+
+void GPSManager::setAiding(const Ubx::AidInit& aid) {
+    Serial.println("GPSManager::setAiding()");
+    aiding = aid;
+    aidingSet = true;
+    aidingAt = millis();
+}
+
+bool GPSManager::isAided() {
+    return aided;
+}
+
 void GPSManager::begin() {
     Serial.println("GPSManager::begin()");
-    // GPS connected to pins 16 (RX) and 17 (TX)
-    gpsSerial = new SoftwareSerial(16, 17);
-    gpsSerial->begin(9600);
+    gpsSerial = &Serial2;
+    // Must precede begin(), which installs the driver
+    gpsSerial->setRxBufferSize(GPS_RX_BUFFER);
+    gpsSerial->begin(GPS_DEFAULT_BAUD, SERIAL_8N1, GPS_RX_PIN, GPS_TX_PIN);
+    configured = configureReceiver();
+    if (configured) {
+        Serial.println(protocol == UBX ? "GPSManager::begin() - receiver at 38400 baud, 5 Hz, UBX NAV messages"
+                                       : "GPSManager::begin() - receiver at 38400 baud, 5 Hz, RMC and GGA");
+    } else {
+        protocol = NMEA;
+        Serial.println("GPSManager::begin() - no UBX acknowledgement, receiver left as it was");
+    }
+    gpsSerial->onReceive([this]() {
+        TaskHandle_t task = receiveTask;
+        if (task) {
+            xTaskNotifyGive(task);
+        }
+    });
+}
+
+bool GPSManager::configureReceiver() {
+    Serial.println("GPSManager::configureReceiver()");
+    uint8_t frame[Ubx::MAX_CONFIG_FRAME];
+    size_t length = Ubx::encodeConfigPort(GPS_BAUD, frame, sizeof(frame));
+
+    // The receiver keeps its port settings over an ESP32 reset, so it may
+    // already be at 38400; the port change is not acknowledged at the old rate
+    sendCommand(frame, length);
+    gpsSerial->updateBaudRate(GPS_BAUD);
+    sendCommand(frame, length);
+    if (!waitForAck(Ubx::CLASS_CFG, Ubx::CFG_PRT, GPS_ACK_TIMEOUT_MS)) {
+        // No receiver, or one that ignores UBX: stay at its default rate
+        gpsSerial->updateBaudRate(GPS_DEFAULT_BAUD);
+        return false;
+    }
+
+    // Class, id, and the rate for NMEA and for UBX
+    uint8_t nmea = protocol == NMEA ? 1 : 0;
+    uint8_t binary = protocol == UBX ? 1 : 0;
+    const uint8_t MESSAGES[][3] = {
+        {Ubx::CLASS_NMEA, Ubx::NMEA_RMC, nmea}, {Ubx::CLASS_NMEA, Ubx::NMEA_GGA, nmea},
+        {Ubx::CLASS_NMEA, Ubx::NMEA_GLL, 0}, {Ubx::CLASS_NMEA, Ubx::NMEA_GSA, 0},
+        {Ubx::CLASS_NMEA, Ubx::NMEA_GSV, 0}, {Ubx::CLASS_NMEA, Ubx::NMEA_VTG, 0},
+        {Ubx::CLASS_NAV, Ubx::NAV_POSLLH, binary}, {Ubx::CLASS_NAV, Ubx::NAV_SOL, binary},
+        {Ubx::CLASS_NAV, Ubx::NAV_DOP, binary}, {Ubx::CLASS_NAV, Ubx::NAV_TIMEUTC, binary},
+        {Ubx::CLASS_NAV, Ubx::NAV_CLOCK, (uint8_t)(binary * GPS_CLOCK_RATE)}
+    };
+    bool acknowledged = true;
+    for (const uint8_t* message : MESSAGES) {
+        length = Ubx::encodeConfigMessage(message[0], message[1], message[2], frame, sizeof(frame));
+        sendCommand(frame, length);
+        acknowledged &= waitForAck(Ubx::CLASS_CFG, Ubx::CFG_MSG, GPS_ACK_TIMEOUT_MS);
+    }
+    length = Ubx::encodeConfigRate(GPS_PERIOD_MS, frame, sizeof(frame));
+    sendCommand(frame, length);
+    acknowledged &= waitForAck(Ubx::CLASS_CFG, Ubx::CFG_RATE, GPS_ACK_TIMEOUT_MS);
+
+    // Last position, time and drift from before the reset; AID messages
+    // get no acknowledgement
+    if (aidingSet) {
+        if (aiding.timeValid) {
+            // The configuration took a while since the time was read
+            aiding.timeOfWeek += millis() - aidingAt;
+            if (aiding.timeOfWeek >= 604800000UL) {
+                aiding.timeOfWeek -= 604800000UL;
+                aiding.week++;
+            }
+        }
+        length = Ubx::encodeAidInit(aiding, frame, sizeof(frame));
+        aided = sendCommand(frame, length);
+    }
+    return acknowledged;
+}
+
+bool GPSManager::sendCommand(const uint8_t* frame, size_t length) {
+    // Serial.println("GPSManager::sendCommand()"); // Commented out - called frequently
+    bool sent = gpsSerial->write(frame, length) == length;
+    // Until the last bit is out, a baud rate change would garble it
+    gpsSerial->flush();
+    return sent;
+}
+
+bool GPSManager::waitForAck(uint8_t messageClass, uint8_t id, uint32_t timeoutMs) {
+    // Serial.println("GPSManager::waitForAck()"); // Commented out - called frequently
+    // ACK-ACK or ACK-NAK for the message, among the NMEA still coming in
+    uint8_t expected[8] = {Ubx::SYNC_1, Ubx::SYNC_2, Ubx::CLASS_ACK, Ubx::ACK_ACK, 2, 0, messageClass, id};
+    uint8_t window[10] = {};
+    uint32_t start = millis();
+    while (millis() - start < timeoutMs) {
+        if (!gpsSerial->available()) {
+            delay(1);
+            continue;
+        }
+        memmove(window, window + 1, sizeof(window) - 1);
+        window[sizeof(window) - 1] = (uint8_t)gpsSerial->read();
+        if (window[0] != Ubx::SYNC_1 || window[1] != Ubx::SYNC_2 || window[2] != Ubx::CLASS_ACK ||
+            memcmp(window + 4, expected + 4, 4) != 0) {
+            continue;
+        }
+        uint8_t a, b;
+        Ubx::checksum(window + 2, 6, &a, &b);
+        if (a == window[8] && b == window[9]) {
+            return window[3] == expected[3];
+        }
+    }
+    return false;
+}
+
+void GPSManager::waitForData(TickType_t ticks) {
+    // Serial.println("GPSManager::waitForData()"); // Commented out - called frequently
+    receiveTask = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, ticks);
 }
 
 void GPSManager::update() {
-    static unsigned long last_timestamp = 0;
     // Serial.println("GPSManager::update()"); // Commented out - called frequently
-    if (gpsSerial && gpsSerial->available()) {
-        while (gpsSerial->available()) {
-            if (gps.encode(gpsSerial->read())) {
-                unsigned long now = GPSManager::getUnixTimestamp();
-                if(now != last_timestamp) {
-                    last_timestamp = now;
-                    // Serial.print("*** GPSManager::update() - ");                    
-                    // Serial.printf("%02d:%02d:%02d", 
-                    //     gps.time.hour(), 
-                    //     gps.time.minute(), 
-                    //     gps.time.second()
-                    // );
-                    // Serial.println();
-                }
-            }
+    if (!gpsSerial) {
+        return;
+    }
+    uint8_t buffer[128];
+    int available;
+    while ((available = gpsSerial->available()) > 0) {
+        size_t count = gpsSerial->read(buffer, available < (int)sizeof(buffer) ? available : sizeof(buffer));
+        decode(buffer, count);
+    }
+}
+
+void GPSManager::decode(const uint8_t* data, size_t length) {
+    // Serial.println("GPSManager::decode()"); // Commented out - called frequently
+    if (protocol == UBX) {
+        ubx.parse(data, length, &GPSManager::onUbxMessage, this);
+        return;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (gps.encode((char)data[i])) {
+            publishNmea();
         }
     }
 }
 
+void GPSManager::publishNmea() {
+    // Serial.println("GPSManager::publishNmea()"); // Commented out - called frequently
+    GpsFix state;
+    state.locationValid = gps.location.isValid();
+    state.dateValid = gps.date.isValid();
+    state.timeValid = gps.time.isValid();
+    state.satellites = gps.satellites.isValid() ? (uint8_t)gps.satellites.value() : 0;
+    state.latitude = (float)gps.location.lat();
+    state.longitude = (float)gps.location.lng();
+    state.altitude = (float)gps.altitude.meters();
+    state.hdop = gps.hdop.isValid() ? (float)gps.hdop.hdop() : 0;
+    state.positionAge = state.locationValid ? gps.location.age() : 0;
+    state.year = gps.date.year();
+    state.month = gps.date.month();
+    state.day = gps.date.day();
+    state.hour = gps.time.hour();
+    state.minute = gps.time.minute();
+    state.second = gps.time.second();
+    state.millisecond = gps.time.centisecond() * 10;
+    state.clockDriftValid = false;
+    state.clockDrift = 0;
+    publishFix(state);
+}
+
+void GPSManager::onUbxMessage(const UbxParser::Message& message, void* context) {
+    static_cast<GPSManager*>(context)->handleUbx(message);
+}
+
+void GPSManager::handleUbx(const UbxParser::Message& message) {
+    // Serial.println("GPSManager::handleUbx()"); // Commented out - called frequently
+    // Offsets and scales from the u-blox 6 Receiver Description
+    const uint8_t* payload = message.payload;
+    if (message.messageClass != Ubx::CLASS_NAV || message.length < 4) {
+        return;
+    }
+    if (message.id == Ubx::NAV_CLOCK) {
+        // After the epoch's four, so it goes out with the next, not part of
+        // it. Accuracy in ps/s; before a fix it is the receiver's startup guess
+        if (message.length >= 20 && UbxParser::readU32(payload + 16) < GPS_CLOCK_ACCURACY) {
+            navigation.clockDrift = UbxParser::readI32(payload + 8);
+            navigation.clockDriftValid = true;
+        }
+        return;
+    }
+    // Every NAV message starts with the epoch's GPS time of week; a new one
+    // before the last was complete means a message was lost, publish it as is
+    uint32_t timeOfWeek = UbxParser::readU32(payload);
+    if (timeOfWeek != navigationTow && navigationSeen != 0) {
+        publishNavigation();
+    }
+    navigationTow = timeOfWeek;
+
+    uint8_t seen;
+    if (message.id == Ubx::NAV_POSLLH && message.length >= 28) {
+        seen = 0x01;
+        navigation.longitude = UbxParser::readI32(payload + 4) * 1e-7f;
+        navigation.latitude = UbxParser::readI32(payload + 8) * 1e-7f;
+        navigation.altitude = UbxParser::readI32(payload + 16) * 0.001f; // above mean sea level
+        positionAt = millis();
+    } else if (message.id == Ubx::NAV_SOL && message.length >= 52) {
+        seen = 0x02;
+        uint8_t fixType = payload[10];
+        bool fixOk = payload[11] & 0x01;
+        navigation.locationValid = fixOk && fixType >= 2 && fixType <= 4; // 2D, 3D, GPS + dead reckoning
+        navigation.satellites = payload[47];
+    } else if (message.id == Ubx::NAV_DOP && message.length >= 18) {
+        seen = 0x04;
+        navigation.hdop = UbxParser::readU16(payload + 12) * 0.01f;
+    } else if (message.id == Ubx::NAV_TIMEUTC && message.length >= 20) {
+        seen = 0x08;
+        // Time of week, week number and the leap seconds known; until the
+        // almanac brings the last (up to 12.5 min after a cold start) the
+        // receiver's UTC can be whole seconds off, and TimeService would
+        // lock to it
+        bool valid = (payload[19] & 0x07) == 0x07;
+        navigation.dateValid = valid;
+        navigation.timeValid = valid;
+        navigation.year = UbxParser::readU16(payload + 12);
+        navigation.month = payload[14];
+        navigation.day = payload[15];
+        navigation.hour = payload[16];
+        navigation.minute = payload[17];
+        navigation.second = payload[18];
+        // Nanoseconds to add, slightly negative when the seconds were rounded up
+        int32_t nano = UbxParser::readI32(payload + 8);
+        navigation.millisecond = nano > 0 ? (uint16_t)(nano / 1000000) : 0;
+    } else {
+        return;
+    }
+    // One snapshot per epoch, once all four are in
+    navigationSeen |= seen;
+    if (navigationSeen == 0x0F) {
+        publishNavigation();
+    }
+}
+
+void GPSManager::publishNavigation() {
+    // Serial.println("GPSManager::publishNavigation()"); // Commented out - called frequently
+    navigation.positionAge = navigation.locationValid ? millis() - positionAt : 0;
+    publishFix(navigation);
+    navigationSeen = 0;
+}
+
+void GPSManager::publishFix(GpsFix& state) {
+    // Serial.println("GPSManager::publishFix()"); // Commented out - called frequently
+    state.sequence = ++sequence;
+    state.updatedAt = millis();
+    state.unixTime = 0;
+    if (state.dateValid && state.timeValid) {
+        state.unixTime = (uint32_t)daysFromCivil(state.year, state.month, state.day) * 86400UL +
+                         state.hour * 3600UL + state.minute * 60UL + state.second;
+    }
+    fix.publish(state);
+}
+
+GpsFix GPSManager::getFix() {
+    // Serial.println("GPSManager::getFix()"); // Commented out - called frequently
+    GpsFix state = fix.read();
+    // A fix, once there is one, replaces the fallback
+    if (!useDefaults || (state.locationValid && state.dateValid && state.timeValid)) {
+        return state;
+    }
+    state.locationValid = false;
+    state.dateValid = false;
+    state.timeValid = false;
+    state.satellites = 0;
+    state.latitude = defaultLat;
+    state.longitude = defaultLng;
+    state.altitude = defaultAlt;
+    state.hdop = 0;
+    state.positionAge = 0;
+    tmElements_t fields;
+    breakTime(defaultTime, fields);
+    state.year = tmYearToCalendar(fields.Year);
+    state.month = fields.Month;
+    state.day = fields.Day;
+    state.hour = fields.Hour;
+    state.minute = fields.Minute;
+    state.second = fields.Second;
+    state.millisecond = 0;
+    state.unixTime = defaultTime;
+    state.updatedAt = 0;
+    return state;
+}
+
+uint32_t GPSManager::getFixSequence() {
+    // Serial.println("GPSManager::getFixSequence()"); // Commented out - called frequently
+    return fix.getVersion() / 2;
+}
+
+uint32_t GPSManager::getFixAge() {
+    // Serial.println("GPSManager::getFixAge()"); // Commented out - called frequently
+    GpsFix state = fix.read();
+    if (useDefaults && !(state.locationValid && state.dateValid && state.timeValid)) {
+        return 0;
+    }
+    return millis() - state.updatedAt + state.positionAge;
+}
+
 bool GPSManager::hasValidFix() {
     //Serial.println("GPSManager::hasValidFix()");
-    bool result = !useDefaults && gps.location.isValid() && gps.date.isValid() && gps.time.isValid();
+    GpsFix state = fix.read();
+    bool result = state.locationValid && state.dateValid && state.timeValid;
     //Serial.print("GPSManager::hasValidFix() returning: ");
     //Serial.println(result);
     return result;
@@ -55,9 +380,18 @@ void GPSManager::setDefaultLocation() {
     useDefaults = true;
 }
 
+void GPSManager::setFallback(float latitude, float longitude, float altitude, uint32_t unixTime) {
+    Serial.println("GPSManager::setFallback()");
+    // Before setDefaultLocation(), while no other task reads them
+    defaultLat = latitude;
+    defaultLng = longitude;
+    defaultAlt = altitude;
+    defaultTime = unixTime;
+}
+
 float GPSManager::getLatitude() {
     //Serial.println("GPSManager::getLatitude()");
-    float result = useDefaults ? defaultLat : (float)gps.location.lat();
+    float result = getFix().latitude;
     // Serial.print("GPSManager::getLatitude() returning: ");
     // Serial.println(result);
     return result;
@@ -65,7 +399,7 @@ float GPSManager::getLatitude() {
 
 float GPSManager::getLongitude() {
     //Serial.println("GPSManager::getLongitude()");
-    float result = useDefaults ? defaultLng : (float)gps.location.lng();
+    float result = getFix().longitude;
     // Serial.print("GPSManager::getLongitude() returning: ");
     // Serial.println(result);
     return result;
@@ -73,7 +407,7 @@ float GPSManager::getLongitude() {
 
 float GPSManager::getAltitude() {
     //Serial.println("GPSManager::getAltitude()");
-    float result = useDefaults ? defaultAlt : (float)gps.altitude.meters();
+    float result = getFix().altitude;
     // Serial.print("GPSManager::getAltitude() returning: ");
     // Serial.println(result);
     return result;
@@ -81,7 +415,7 @@ float GPSManager::getAltitude() {
 
 int GPSManager::getYear() {
     //Serial.println("GPSManager::getYear()");
-    int result = useDefaults ? 2025 : gps.date.year();
+    int result = getFix().year;
     //Serial.print("GPSManager::getYear() returning: ");
     //Serial.println(result);
     return result;
@@ -89,7 +423,7 @@ int GPSManager::getYear() {
 
 int GPSManager::getMonth() {
     //Serial.println("GPSManager::getMonth()");
-    int result = useDefaults ? 8 : gps.date.month();
+    int result = getFix().month;
     //Serial.print("GPSManager::getMonth() returning: ");
     ///Serial.println(result);
     return result;
@@ -97,7 +431,7 @@ int GPSManager::getMonth() {
 
 int GPSManager::getDay() {
     //Serial.println("GPSManager::getDay()");
-    int result = useDefaults ? 27 : gps.date.day();
+    int result = getFix().day;
     //Serial.print("GPSManager::getDay() returning: ");
     //Serial.println(result);
     return result;
@@ -105,7 +439,7 @@ int GPSManager::getDay() {
 
 int GPSManager::getHour() {
     //Serial.println("GPSManager::getHour()");
-    int result = useDefaults ? 12 : gps.time.hour();
+    int result = getFix().hour;
     //Serial.print("GPSManager::getHour() returning: ");
     //Serial.println(result);
     return result;
@@ -113,7 +447,7 @@ int GPSManager::getHour() {
 
 int GPSManager::getMinute() {
     //Serial.println("GPSManager::getMinute()");
-    int result = useDefaults ? 0 : gps.time.minute();
+    int result = getFix().minute;
     //Serial.print("GPSManager::getMinute() returning: ");
     //Serial.println(result);
     return result;
@@ -121,52 +455,26 @@ int GPSManager::getMinute() {
 
 int GPSManager::getSecond() {
     //Serial.println("GPSManager::getSecond()");
-    int result = useDefaults ? 0 : gps.time.second();
+    int result = getFix().second;
     //Serial.print("GPSManager::getSecond() returning: ");
     //Serial.println(result);
     return result;
 }
 
 unsigned long GPSManager::getUnixTimestamp() {
-    int year = getYear();
-    int month = getMonth();
-    int day = getDay();
-    int hour = getHour();
-    int minute = getMinute();
-    int second = getSecond();
-    
-    // Calculate days since Unix epoch (1970-01-01)
-    unsigned long days = 0;
-    
-    // Add days for complete years since 1970
-    for (int y = 1970; y < year; y++) {
-        if ((y % 4 == 0 && y % 100 != 0) || (y % 400 == 0)) {
-            days += 366; // Leap year
-        } else {
-            days += 365;
-        }
-    }
-    
-    // Days in each month (non-leap year)
-    int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    
-    // Adjust February for leap year
-    if ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0)) {
-        daysInMonth[1] = 29;
-    }
-    
-    // Add days for complete months in current year
-    for (int m = 1; m < month; m++) {
-        days += daysInMonth[m - 1];
-    }
-    
-    // Add days in current month (minus 1 since we count from day 1)
-    days += day - 1;
-    
-    // Convert to seconds and add time components
-    unsigned long timestamp = days * 86400UL + hour * 3600UL + minute * 60UL + second;
-    
-    return timestamp;
+    // Serial.println("GPSManager::getUnixTimestamp()"); // Commented out - called frequently
+    return getFix().unixTime;
+}
+
+int32_t GPSManager::daysFromCivil(int year, int month, int day) {
+    // Years from March, so the leap day is the last of the year; 400-year
+    // eras of 146097 days (Howard Hinnant's days_from_civil)
+    year -= month <= 2;
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    uint32_t yearOfEra = (uint32_t)(year - era * 400);
+    uint32_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int32_t)dayOfEra - 719468;
 }
 
 int GPSManager::getTimezoneOffset() {
@@ -208,4 +516,4 @@ bool GPSManager::isDST() {
     
     // December, January, February - no DST
     return false;
-}
\ No newline at end of file
+}
@@ -2,18 +2,47 @@
 #define GPS_MANAGER_H
 
 #include <Arduino.h>
-#include <SoftwareSerial.h>
+#include <HardwareSerial.h>
 #include <TinyGPS++.h>
+#include <atomic>
+#include "Seqlock.h"
+#include "Telemetry.h"
+#include "Ubx.h"
+#include "UbxParser.h"
 
 class GPSManager {
 public:
+    // What the receiver is asked for: UBX NAV messages, decoded in place
+    // from the receive buffer, or RMC and GGA text through TinyGPS++. A
+    // receiver that does not acknowledge the configuration keeps NMEA.
+    enum Protocol {
+        NMEA = 0,
+        UBX
+    };
+
     GPSManager();
     ~GPSManager();
     
+    // Before begin(); UBX unless set
+    void setProtocol(Protocol protocol);
+    Protocol getProtocol();
     void begin();
+    // GPS task: blocks until the UART driver reports received bytes, or
+    // ticks pass; update() then drains its buffer
+    void waitForData(TickType_t ticks);
     void update();
+    // Received bytes in the current protocol, publishing a fix per NMEA
+    // sentence or UBX epoch
+    void decode(const uint8_t* data, size_t length);
     bool hasValidFix();
+    // Until a fix arrives getFix() reports the fallback: the build-time
+    // location, or the last fix from before a reset once it is given
     void setDefaultLocation();
+    void setFallback(float latitude, float longitude, float altitude, uint32_t unixTime);
+    // Before begin(): sent to the receiver once it acknowledges the UBX
+    // configuration, so its first fix needs less searching
+    void setAiding(const Ubx::AidInit& aid);
+    bool isAided();
     
     float getLatitude();
     float getLongitude();
@@ -25,19 +54,55 @@ public:
     int getMinute();
     int getSecond();
     
+    // Every field from the same sentence or epoch, defaults applied; lock-free
+    GpsFix getFix();
+    // GpsFix::sequence of the latest update, without copying it; a reader
+    // that polls it sees whether it has missed any
+    uint32_t getFixSequence();
+    // ms since the position was received, defaults never age
+    uint32_t getFixAge();
     unsigned long getUnixTimestamp();
     int getTimezoneOffset();
     bool isDST();
 
+    // Days since 1970-01-01 of a proleptic Gregorian date, in constant time
+    static int32_t daysFromCivil(int year, int month, int day);
+
 private:
+    // Only update() touches the parsers; readers on other tasks see the
+    // fields it publishes after each sentence or epoch
     TinyGPSPlus gps;
-    SoftwareSerial* gpsSerial;
-    bool useDefaults;
+    UbxParser ubx;
+    GpsFix navigation;      // UBX fields so far, each message updates its own
+    uint32_t navigationTow; // GPS time of week of the epoch, ms
+    uint8_t navigationSeen; // NAV messages of the epoch received, bit each
+    uint32_t positionAt;    // millis() of the last NAV-POSLLH
+    Protocol protocol;
+    Seqlock<GpsFix> fix;
+    uint32_t sequence;
+    HardwareSerial* gpsSerial;
+    TaskHandle_t volatile receiveTask; // woken from the UART event task
+    bool configured; // the receiver acknowledged the UBX configuration
+    std::atomic<bool> useDefaults;
+    Ubx::AidInit aiding;
+    bool aidingSet;
+    uint32_t aidingAt; // millis() of the time in it
+    bool aided; // the aiding went out
     
-    // Default location: East Northport, NY
+    // Default location: East Northport, NY, until setFallback()
     float defaultLat = 40.5169;
     float defaultLng = -74.4063;
     float defaultAlt = 0.0;
+    uint32_t defaultTime = 1756296000; // 2025-08-27 12:00 UTC
+
+    bool configureReceiver();
+    bool sendCommand(const uint8_t* frame, size_t length);
+    bool waitForAck(uint8_t messageClass, uint8_t id, uint32_t timeoutMs);
+    void publishNmea();
+    static void onUbxMessage(const UbxParser::Message& message, void* context);
+    void handleUbx(const UbxParser::Message& message);
+    void publishNavigation();
+    void publishFix(GpsFix& state);
 };
 
 #endif
\ No newline at end of file
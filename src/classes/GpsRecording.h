@@ -0,0 +1,110 @@
+#ifndef GPS_RECORDING_H
+#define GPS_RECORDING_H
+
+// One second of NEO-6M output at 5 Hz, recorded from the simulator's
+// receiver (sim/SimNmeaFeed) configured as GPSManager::begin() leaves it:
+// RMC and GGA text, and the same five solutions as NAV-POSLLH, NAV-SOL,
+// NAV-DOP and NAV-TIMEUTC. Input for the GPSManager::decode benchmarks.
+
+#include <stdint.h>
+
+static const uint8_t GPS_RECORDING_NMEA[725] = {
+    0x24, 0x47, 0x50, 0x52, 0x4D, 0x43, 0x2C, 0x31, 0x36, 0x30, 0x30, 0x31, 0x30, 0x2E, 0x30, 0x30,
+    0x2C, 0x41, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31, 0x34, 0x30, 0x30, 0x2C, 0x4E, 0x2C,
+    0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30, 0x30, 0x2C, 0x57, 0x2C, 0x30, 0x2E,
+    0x30, 0x30, 0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x32, 0x31, 0x30, 0x36, 0x32, 0x35, 0x2C, 0x2C,
+    0x2C, 0x41, 0x2A, 0x34, 0x32, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x47, 0x47, 0x41, 0x2C, 0x31, 0x36,
+    0x30, 0x30, 0x31, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31, 0x34,
+    0x30, 0x30, 0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30, 0x30,
+    0x2C, 0x57, 0x2C, 0x31, 0x2C, 0x30, 0x38, 0x2C, 0x31, 0x2E, 0x30, 0x30, 0x2C, 0x30, 0x2E, 0x30,
+    0x2C, 0x4D, 0x2C, 0x2D, 0x33, 0x34, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2C, 0x2A, 0x36, 0x31, 0x0D,
+    0x0A, 0x24, 0x47, 0x50, 0x52, 0x4D, 0x43, 0x2C, 0x31, 0x36, 0x30, 0x30, 0x31, 0x30, 0x2E, 0x32,
+    0x30, 0x2C, 0x41, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31, 0x34, 0x30, 0x30, 0x2C, 0x4E,
+    0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30, 0x30, 0x2C, 0x57, 0x2C, 0x30,
+    0x2E, 0x30, 0x30, 0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x32, 0x31, 0x30, 0x36, 0x32, 0x35, 0x2C,
+    0x2C, 0x2C, 0x41, 0x2A, 0x34, 0x30, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x47, 0x47, 0x41, 0x2C, 0x31,
+    0x36, 0x30, 0x30, 0x31, 0x30, 0x2E, 0x32, 0x30, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31,
+    0x34, 0x30, 0x30, 0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30,
+    0x30, 0x2C, 0x57, 0x2C, 0x31, 0x2C, 0x30, 0x38, 0x2C, 0x31, 0x2E, 0x30, 0x30, 0x2C, 0x30, 0x2E,
+    0x30, 0x2C, 0x4D, 0x2C, 0x2D, 0x33, 0x34, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2C, 0x2A, 0x36, 0x33,
+    0x0D, 0x0A, 0x24, 0x47, 0x50, 0x52, 0x4D, 0x43, 0x2C, 0x31, 0x36, 0x30, 0x30, 0x31, 0x30, 0x2E,
+    0x34, 0x30, 0x2C, 0x41, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31, 0x34, 0x30, 0x30, 0x2C,
+    0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30, 0x30, 0x2C, 0x57, 0x2C,
+    0x30, 0x2E, 0x30, 0x30, 0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x32, 0x31, 0x30, 0x36, 0x32, 0x35,
+    0x2C, 0x2C, 0x2C, 0x41, 0x2A, 0x34, 0x36, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x47, 0x47, 0x41, 0x2C,
+    0x31, 0x36, 0x30, 0x30, 0x31, 0x30, 0x2E, 0x34, 0x30, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30,
+    0x31, 0x34, 0x30, 0x30, 0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38,
+    0x30, 0x30, 0x2C, 0x57, 0x2C, 0x31, 0x2C, 0x30, 0x38, 0x2C, 0x31, 0x2E, 0x30, 0x30, 0x2C, 0x30,
+    0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2D, 0x33, 0x34, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2C, 0x2A, 0x36,
+    0x35, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x52, 0x4D, 0x43, 0x2C, 0x31, 0x36, 0x30, 0x30, 0x31, 0x30,
+    0x2E, 0x36, 0x30, 0x2C, 0x41, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31, 0x34, 0x30, 0x30,
+    0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30, 0x30, 0x2C, 0x57,
+    0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x32, 0x31, 0x30, 0x36, 0x32,
+    0x35, 0x2C, 0x2C, 0x2C, 0x41, 0x2A, 0x34, 0x34, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x47, 0x47, 0x41,
+    0x2C, 0x31, 0x36, 0x30, 0x30, 0x31, 0x30, 0x2E, 0x36, 0x30, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E,
+    0x30, 0x31, 0x34, 0x30, 0x30, 0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37,
+    0x38, 0x30, 0x30, 0x2C, 0x57, 0x2C, 0x31, 0x2C, 0x30, 0x38, 0x2C, 0x31, 0x2E, 0x30, 0x30, 0x2C,
+    0x30, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2D, 0x33, 0x34, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2C, 0x2A,
+    0x36, 0x37, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x52, 0x4D, 0x43, 0x2C, 0x31, 0x36, 0x30, 0x30, 0x31,
+    0x30, 0x2E, 0x38, 0x30, 0x2C, 0x41, 0x2C, 0x34, 0x30, 0x33, 0x31, 0x2E, 0x30, 0x31, 0x34, 0x30,
+    0x30, 0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33, 0x37, 0x38, 0x30, 0x30, 0x2C,
+    0x57, 0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x30, 0x2E, 0x30, 0x30, 0x2C, 0x32, 0x31, 0x30, 0x36,
+    0x32, 0x35, 0x2C, 0x2C, 0x2C, 0x41, 0x2A, 0x34, 0x41, 0x0D, 0x0A, 0x24, 0x47, 0x50, 0x47, 0x47,
+    0x41, 0x2C, 0x31, 0x36, 0x30, 0x30, 0x31, 0x30, 0x2E, 0x38, 0x30, 0x2C, 0x34, 0x30, 0x33, 0x31,
+    0x2E, 0x30, 0x31, 0x34, 0x30, 0x30, 0x2C, 0x4E, 0x2C, 0x30, 0x37, 0x34, 0x32, 0x34, 0x2E, 0x33,
+    0x37, 0x38, 0x30, 0x30, 0x2C, 0x57, 0x2C, 0x31, 0x2C, 0x30, 0x38, 0x2C, 0x31, 0x2E, 0x30, 0x30,
+    0x2C, 0x30, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2D, 0x33, 0x34, 0x2E, 0x30, 0x2C, 0x4D, 0x2C, 0x2C,
+    0x2A, 0x36, 0x39, 0x0D, 0x0A,
+};
+
+static const uint8_t GPS_RECORDING_UBX[750] = {
+    0xB5, 0x62, 0x01, 0x02, 0x1C, 0x00, 0x60, 0x7D, 0x55, 0x22, 0xE8, 0x7F, 0xA6, 0xD3, 0x68, 0x63,
+    0x26, 0x18, 0x30, 0x7B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x09, 0x00, 0x00, 0xA0, 0x0F,
+    0x00, 0x00, 0x81, 0xE8, 0xB5, 0x62, 0x01, 0x04, 0x12, 0x00, 0x60, 0x7D, 0x55, 0x22, 0xD2, 0x00,
+    0xB4, 0x00, 0x6E, 0x00, 0x96, 0x00, 0x64, 0x00, 0x46, 0x00, 0x50, 0x00, 0xEF, 0x25, 0xB5, 0x62,
+    0x01, 0x06, 0x34, 0x00, 0x60, 0x7D, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00, 0x43, 0x09, 0x03, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB4, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x5F, 0xB5, 0x62, 0x01, 0x21, 0x14, 0x00,
+    0x60, 0x7D, 0x55, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x07, 0x06, 0x15,
+    0x10, 0x00, 0x0A, 0x07, 0xD4, 0x0B, 0xB5, 0x62, 0x01, 0x02, 0x1C, 0x00, 0x28, 0x7E, 0x55, 0x22,
+    0xE8, 0x7F, 0xA6, 0xD3, 0x68, 0x63, 0x26, 0x18, 0x30, 0x7B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xC4, 0x09, 0x00, 0x00, 0xA0, 0x0F, 0x00, 0x00, 0x4A, 0xE3, 0xB5, 0x62, 0x01, 0x04, 0x12, 0x00,
+    0x28, 0x7E, 0x55, 0x22, 0xD2, 0x00, 0xB4, 0x00, 0x6E, 0x00, 0x96, 0x00, 0x64, 0x00, 0x46, 0x00,
+    0x50, 0x00, 0xB8, 0x46, 0xB5, 0x62, 0x01, 0x06, 0x34, 0x00, 0x28, 0x7E, 0x55, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x43, 0x09, 0x03, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x70, 0x32,
+    0xB5, 0x62, 0x01, 0x21, 0x14, 0x00, 0x28, 0x7E, 0x55, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xC2,
+    0xEB, 0x0B, 0xE9, 0x07, 0x06, 0x15, 0x10, 0x00, 0x0A, 0x07, 0x55, 0xA5, 0xB5, 0x62, 0x01, 0x02,
+    0x1C, 0x00, 0xF0, 0x7E, 0x55, 0x22, 0xE8, 0x7F, 0xA6, 0xD3, 0x68, 0x63, 0x26, 0x18, 0x30, 0x7B,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x09, 0x00, 0x00, 0xA0, 0x0F, 0x00, 0x00, 0x12, 0xC3,
+    0xB5, 0x62, 0x01, 0x04, 0x12, 0x00, 0xF0, 0x7E, 0x55, 0x22, 0xD2, 0x00, 0xB4, 0x00, 0x6E, 0x00,
+    0x96, 0x00, 0x64, 0x00, 0x46, 0x00, 0x50, 0x00, 0x80, 0x56, 0xB5, 0x62, 0x01, 0x06, 0x34, 0x00,
+    0xF0, 0x7E, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00, 0x43, 0x09, 0x03, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xD2, 0xB5, 0x62, 0x01, 0x21, 0x14, 0x00, 0xF0, 0x7E, 0x55, 0x22,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x84, 0xD7, 0x17, 0xE9, 0x07, 0x06, 0x15, 0x10, 0x00, 0x0A, 0x07,
+    0xD7, 0x3F, 0xB5, 0x62, 0x01, 0x02, 0x1C, 0x00, 0xB8, 0x7F, 0x55, 0x22, 0xE8, 0x7F, 0xA6, 0xD3,
+    0x68, 0x63, 0x26, 0x18, 0x30, 0x7B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x09, 0x00, 0x00,
+    0xA0, 0x0F, 0x00, 0x00, 0xDB, 0xBE, 0xB5, 0x62, 0x01, 0x04, 0x12, 0x00, 0xB8, 0x7F, 0x55, 0x22,
+    0xD2, 0x00, 0xB4, 0x00, 0x6E, 0x00, 0x96, 0x00, 0x64, 0x00, 0x46, 0x00, 0x50, 0x00, 0x49, 0x77,
+    0xB5, 0x62, 0x01, 0x06, 0x34, 0x00, 0xB8, 0x7F, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00, 0x43, 0x09,
+    0x03, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB4, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0xB5, 0x62, 0x01, 0x21,
+    0x14, 0x00, 0xB8, 0x7F, 0x55, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x46, 0xC3, 0x23, 0xE9, 0x07,
+    0x06, 0x15, 0x10, 0x00, 0x0A, 0x07, 0x5A, 0xEC, 0xB5, 0x62, 0x01, 0x02, 0x1C, 0x00, 0x80, 0x80,
+    0x55, 0x22, 0xE8, 0x7F, 0xA6, 0xD3, 0x68, 0x63, 0x26, 0x18, 0x30, 0x7B, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xC4, 0x09, 0x00, 0x00, 0xA0, 0x0F, 0x00, 0x00, 0xA4, 0xB9, 0xB5, 0x62, 0x01, 0x04,
+    0x12, 0x00, 0x80, 0x80, 0x55, 0x22, 0xD2, 0x00, 0xB4, 0x00, 0x6E, 0x00, 0x96, 0x00, 0x64, 0x00,
+    0x46, 0x00, 0x50, 0x00, 0x12, 0x98, 0xB5, 0x62, 0x01, 0x06, 0x34, 0x00, 0x80, 0x80, 0x55, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x43, 0x09, 0x03, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xCA, 0x78, 0xB5, 0x62, 0x01, 0x21, 0x14, 0x00, 0x80, 0x80, 0x55, 0x22, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xAF, 0x2F, 0xE9, 0x07, 0x06, 0x15, 0x10, 0x00, 0x0A, 0x07, 0xDD, 0x99,
+};
+
+#endif
@@ -0,0 +1,80 @@
+#include "IndexSensor.h"
+
+IndexSensor::IndexSensor(uint8_t pin) {
+    Serial.println("IndexSensor::IndexSensor()");
+    this->pin = pin;
+    output = nullptr;
+    armed = false;
+    lastTriggered = false;
+    steps = 0;
+    hitCount = 0;
+    minSpacing = 0;
+}
+
+void IndexSensor::begin(StepOutput* output) {
+    Serial.print("IndexSensor::begin(");
+    Serial.print(pin);
+    Serial.println(")");
+    this->output = output;
+    // GPIO34-39 have no internal pull-ups, the sensor board needs its own
+    pinMode(pin, INPUT);
+}
+
+void IndexSensor::step(int8_t direction) {
+    // Serial.println("IndexSensor::step()"); // Commented out - called from the step timer
+    output->step(direction);
+    steps = steps + direction;
+    if (!armed) {
+        return;
+    }
+    bool triggered = digitalRead(pin) == LOW;
+    if (triggered && !lastTriggered && hitCount < MAX_HITS) {
+        int32_t spacing = hitCount > 0 ? steps - hits[hitCount - 1] : minSpacing;
+        if (spacing < 0) {
+            spacing = -spacing;
+        }
+        if (spacing >= minSpacing) {
+            hits[hitCount] = steps;
+            hitCount = hitCount + 1;
+        }
+    }
+    lastTriggered = triggered;
+}
+
+void IndexSensor::release() {
+    // Serial.println("IndexSensor::release()"); // Commented out - called from the step timer
+    output->release();
+}
+
+void IndexSensor::arm(int32_t minSpacing) {
+    Serial.println("IndexSensor::arm()");
+    this->minSpacing = minSpacing;
+    hitCount = 0;
+    // Only count a falling edge, not a sensor that is already covered
+    lastTriggered = digitalRead(pin) == LOW;
+    armed = true;
+}
+
+void IndexSensor::disarm() {
+    Serial.println("IndexSensor::disarm()");
+    armed = false;
+}
+
+int IndexSensor::getHitCount() {
+    // Serial.println("IndexSensor::getHitCount()"); // Commented out - called frequently
+    return hitCount;
+}
+
+int32_t IndexSensor::getHitPosition(int index) {
+    Serial.print("IndexSensor::getHitPosition(");
+    Serial.print(index);
+    Serial.println(")");
+    if (index < 0 || index >= hitCount) {
+        return 0;
+    }
+    return hits[index];
+}
+
+uint8_t IndexSensor::getPin() {
+    return pin;
+}
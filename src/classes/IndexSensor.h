@@ -0,0 +1,41 @@
+#ifndef INDEX_SENSOR_H
+#define INDEX_SENSOR_H
+
+#include <Arduino.h>
+#include "StepEngine.h"
+
+// Once-per-revolution index sensor (A3144 hall switch or slotted optical
+// switch, active low) used to measure the real gear ratio. It sits between
+// the step engine and the coil sequencer and samples the pin right after
+// each step, so a hit is recorded to the exact step count without an
+// interrupt handler racing the step timer.
+class IndexSensor : public StepOutput {
+public:
+    static const int MAX_HITS = 16;
+
+    IndexSensor(uint8_t pin = 34);
+
+    void begin(StepOutput* output);
+    void step(int8_t direction) override;
+    void release() override;
+
+    // Start recording hits; edges closer than minSpacing steps to the
+    // previous hit are treated as bounce. Call with the step timer locked.
+    void arm(int32_t minSpacing);
+    void disarm();
+    int getHitCount();
+    int32_t getHitPosition(int index); // step count at the hit
+    uint8_t getPin();
+
+private:
+    uint8_t pin;
+    StepOutput* output;
+    volatile bool armed;
+    bool lastTriggered;
+    volatile int32_t steps;
+    volatile int hitCount;
+    int32_t hits[MAX_HITS];
+    int32_t minSpacing;
+};
+
+#endif
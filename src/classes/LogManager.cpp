@@ -1,10 +1,17 @@
 #include "LogManager.h"
+#include "TimeService.h"
 #include <TimeLib.h>
 
+extern TimeService* timeService;
+
 LogManager::LogManager() {
     Serial.println("LogManager::LogManager()");
     currentLogNumber = startingLogNumber;
     currentLogSize = 0;
+    queue = nullptr;
+    fileMutex = xSemaphoreCreateMutex();
+    pending.text[0] = 0;
+    droppedCount = 0;
 }
 
 LogManager::~LogManager() {
@@ -12,6 +19,9 @@ LogManager::~LogManager() {
     if (currentLogFile) {
         currentLogFile.close();
     }
+    if (queue) {
+        vQueueDelete(queue);
+    }
 }
 
 void LogManager::begin() {
@@ -57,6 +67,7 @@ void LogManager::logError(const String& message) {
 String LogManager::getLastLogContent() {
     Serial.println("LogManager::getLastLogContent()");
     
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
     if (currentLogFile) {
         currentLogFile.close();
     }
@@ -64,6 +75,8 @@ String LogManager::getLastLogContent() {
     String fileName = getCurrentLogFileName();
     File file = SPIFFS.open(fileName, "r");
     if (!file) {
+        openNewLogFile();
+        xSemaphoreGive(fileMutex);
         Serial.print("LogManager::getLastLogContent() returning: ");
         Serial.println("No log file available");
         return "No log file available";
@@ -74,6 +87,7 @@ String LogManager::getLastLogContent() {
     
     // Reopen current log file for writing
     openNewLogFile();
+    xSemaphoreGive(fileMutex);
     
     // Serial.print("LogManager::getLastLogContent() returning content of length: ");
     // Serial.println(content.length());
@@ -111,6 +125,7 @@ String LogManager::getLastLogLines(int numLines) {
 void LogManager::clearAllLogs() {
     Serial.println("LogManager::clearAllLogs()");
     
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
     if (currentLogFile) {
         currentLogFile.close();
     }
@@ -132,6 +147,7 @@ void LogManager::clearAllLogs() {
     currentLogNumber = startingLogNumber;
     currentLogSize = 0;
     openNewLogFile();
+    xSemaphoreGive(fileMutex);
     logInfo("All logs cleared");
 }
 
@@ -229,33 +245,85 @@ void LogManager::writeLogEntry(const String& level, const String& message) {
     // Serial.print(message);
     // Serial.println(")");
     
+    // Stamped here, when it happened, not when the log task gets to it
+    String timestamp = getTimestamp();
+    String logEntry = timestamp + " [" + level + "] " + message + "\n";
+    
+    if (!queue) {
+        writeLine(logEntry.c_str());
+        return;
+    }
+    LogLine line;
+    strlcpy(line.text, logEntry.c_str(), sizeof(line.text));
+    if (logEntry.length() >= sizeof(line.text)) {
+        line.text[sizeof(line.text) - 2] = '\n';
+    }
+    if (xQueueSend(queue, &line, 0) != pdTRUE) {
+        droppedCount = droppedCount + 1;
+    }
+}
+
+void LogManager::writeLine(const char* line) {
+    // Serial.println("LogManager::writeLine()"); // Commented out - called frequently
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
     if (!currentLogFile) {
         openNewLogFile();
     }
     
-    if (!currentLogFile) {
-        return;
+    if (currentLogFile) {
+        currentLogFile.print(line);
+        currentLogFile.flush();
+        currentLogSize += strlen(line);
+        
+        // Check if we need to rotate the log file
+        if (currentLogSize >= maxLogSize) {
+            rotateLogFiles();
+        }
     }
-    
-    String timestamp = getTimestamp();
-    String logEntry = timestamp + " [" + level + "] " + message + "\n";
-    
-    currentLogFile.print(logEntry);
-    currentLogFile.flush();
-    currentLogSize += logEntry.length();
-    
-    // Check if we need to rotate the log file
-    if (currentLogSize >= maxLogSize) {
-        rotateLogFiles();
+    xSemaphoreGive(fileMutex);
+}
+
+bool LogManager::beginTaskQueue() {
+    Serial.println("LogManager::beginTaskQueue()");
+    queue = xQueueCreate(8, sizeof(LogLine));
+    return queue != nullptr;
+}
+
+bool LogManager::waitForEntry(TickType_t ticks) {
+    // Serial.println("LogManager::waitForEntry()"); // Commented out - called frequently
+    return queue && xQueueReceive(queue, &pending, ticks) == pdTRUE;
+}
+
+void LogManager::writePending() {
+    // Serial.println("LogManager::writePending()"); // Commented out - called frequently
+    writeLine(pending.text);
+    // Drain whatever queued up meanwhile
+    while (xQueueReceive(queue, &pending, 0) == pdTRUE) {
+        writeLine(pending.text);
     }
 }
 
+uint32_t LogManager::getDroppedCount() {
+    return droppedCount;
+}
+
 String LogManager::getTimestamp() {
     // Serial.println("LogManager::getTimestamp()");
     
-    char timestamp[24];
-    sprintf(timestamp, "%04d-%02d-%02d %02d:%02d:%02d",
-            year(), month(), day(), hour(), minute(), second());
+    char timestamp[32];
+    // To the millisecond from the time service once it is set, TimeLib's
+    // count from 1970 before that
+    uint64_t local = timeService ? timeService->getLocalMicros() : 0;
+    if (local != 0) {
+        tmElements_t fields;
+        breakTime((time_t)(local / 1000000), fields);
+        sprintf(timestamp, "%04d-%02d-%02d %02d:%02d:%02d.%03d",
+                tmYearToCalendar(fields.Year), fields.Month, fields.Day, fields.Hour, fields.Minute, fields.Second,
+                (int)(local / 1000 % 1000));
+    } else {
+        sprintf(timestamp, "%04d-%02d-%02d %02d:%02d:%02d",
+                year(), month(), day(), hour(), minute(), second());
+    }
     
     String result = String(timestamp);
     // Serial.print("LogManager::getTimestamp() returning: ");
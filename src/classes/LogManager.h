@@ -15,13 +15,31 @@ public:
     String getLastLogContent();
     String getLastLogLines(int numLines);
     void clearAllLogs();
+    // Hand-off to the log task: entries are formatted by the caller and
+    // queued, the task does the flash writes. Without a task queue they are
+    // written directly.
+    bool beginTaskQueue();
+    bool waitForEntry(TickType_t ticks);
+    void writePending();
+    uint32_t getDroppedCount();
 
 private:
+    static const int LOG_LINE_LENGTH = 320;
+    struct LogLine {
+        char text[LOG_LINE_LENGTH];
+    };
+
+    QueueHandle_t queue;
+    SemaphoreHandle_t fileMutex; // log files are read from the control task
+    LogLine pending;
+    volatile uint32_t droppedCount;
     int currentLogNumber;
     File currentLogFile;
     unsigned long currentLogSize;
-    const unsigned long maxLogSize = 1048576; // 1MB
-    const int maxLogFiles = 50;
+    // At most maxLogFiles + 1 files around a rotation; they have to fit the
+    // 1.3MB SPIFFS partition next to the almanac and configuration
+    const unsigned long maxLogSize = 131072; // 128KB
+    const int maxLogFiles = 6;
     const int startingLogNumber = 1000;
     
     void createLogsFolder();
@@ -30,6 +48,7 @@ private:
     void cleanOldLogFiles();
     String getCurrentLogFileName();
     void writeLogEntry(const String& level, const String& message);
+    void writeLine(const char* line);
     String getTimestamp();
 };
 
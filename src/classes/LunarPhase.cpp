@@ -0,0 +1,93 @@
+#include "LunarPhase.h"
+#include "LunationTable.h"
+#include <math.h>
+
+// The mean phases the table is relative to, in microseconds
+static const int64_t MEAN_EPOCH_MICROS = 947168437823998LL; // JDE 2451550.09766
+static const int64_t SYNODIC_MICROS = 2551442877590LL;      // 29.530588861 days
+
+static const float DEG = 0.017453292519943f;
+
+static const char* PHASE_NAMES[8] = {
+    "New Moon", "Waxing Crescent", "First Quarter", "Waxing Gibbous",
+    "Full Moon", "Waning Gibbous", "Last Quarter", "Waning Crescent"
+};
+
+static int64_t floorDivide(int64_t value, int64_t divisor) {
+    int64_t quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+time_t LunarPhase::phaseTime(int32_t k, int half) {
+    int64_t mean = MEAN_EPOCH_MICROS + k * SYNODIC_MICROS + half * (SYNODIC_MICROS / 2);
+    time_t time = (time_t)floorDivide(mean + 500000, 1000000);
+    int32_t index = k - LUNATION_TABLE_FIRST;
+    if (index >= 0 && index < LUNATION_TABLE_COUNT) {
+        time += (time_t)LUNATION_TABLE[index][half] * LUNATION_TABLE_UNIT;
+    }
+    return time;
+}
+
+int32_t LunarPhase::lunationAt(time_t utc) {
+    // The mean lunation, then at most a step either way to the true one
+    int32_t k = (int32_t)floorDivide((int64_t)utc * 1000000 - MEAN_EPOCH_MICROS, SYNODIC_MICROS);
+    while (phaseTime(k, 0) > utc) {
+        k--;
+    }
+    while (phaseTime(k + 1, 0) <= utc) {
+        k++;
+    }
+    return k;
+}
+
+void LunarPhase::getInfo(time_t utc, Info* info) {
+    int32_t k = lunationAt(utc);
+    info->lunation = k;
+    info->newMoon = phaseTime(k, 0);
+    info->nextNewMoon = phaseTime(k + 1, 0);
+    time_t fullMoon = phaseTime(k, 1);
+    info->nextFullMoon = fullMoon > utc ? fullMoon : phaseTime(k + 1, 1);
+    info->age = (float)(utc - info->newMoon) / 86400.0f;
+
+    // Mean elements: days since the mean new moon, and the sun's and the
+    // moon's anomaly at it (per lunation, whole turns dropped)
+    float days = (float)((int64_t)utc * 1000000 - MEAN_EPOCH_MICROS - k * SYNODIC_MICROS) / 86400e6f;
+    float sunAnomaly = fmodf(2.5534f + 29.1053567f * (float)k, 360.0f) + 0.98560028f * days;
+    float moonAnomaly = fmodf(201.5643f + 25.81693528f * (float)k, 360.0f) + 13.06499295f * days;
+    float meanElongation = 12.19074912f * days;
+
+    // 180 deg less the phase angle, Meeus 48.4
+    float d = meanElongation * DEG;
+    float m = sunAnomaly * DEG;
+    float mp = moonAnomaly * DEG;
+    float elongation = meanElongation + 6.289f * sinf(mp) - 2.100f * sinf(m) + 1.274f * sinf(2 * d - mp)
+        + 0.658f * sinf(2 * d) + 0.214f * sinf(2 * mp) - 0.110f * sinf(d);
+    elongation = fmodf(elongation, 360.0f);
+    if (elongation < 0) {
+        elongation += 360.0f;
+    }
+    info->elongation = elongation;
+    info->illumination = (1 - cosf(elongation * DEG)) * 0.5f;
+    info->waxing = elongation < 180.0f;
+    info->phase = (Phase)((int)((elongation + 22.5f) / 45.0f) % 8);
+}
+
+float LunarPhase::getIllumination(time_t utc) {
+    Info info;
+    getInfo(utc, &info);
+    return info.illumination;
+}
+
+time_t LunarPhase::getNextNewMoon(time_t utc) {
+    return phaseTime(lunationAt(utc) + 1, 0);
+}
+
+time_t LunarPhase::getNextFullMoon(time_t utc) {
+    int32_t k = lunationAt(utc);
+    time_t fullMoon = phaseTime(k, 1);
+    return fullMoon > utc ? fullMoon : phaseTime(k + 1, 1);
+}
+
+const char* LunarPhase::getPhaseName(Phase phase) {
+    return PHASE_NAMES[phase];
+}
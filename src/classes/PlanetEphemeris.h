@@ -0,0 +1,54 @@
+#ifndef PLANET_EPHEMERIS_H
+#define PLANET_EPHEMERIS_H
+
+#include <stdint.h>
+#include "AstroKernels.h"
+
+// Geocentric positions of Mercury to Saturn from the Chebyshev blocks in
+// PlanetTable.h (2025-2055), fitted by tools/gen_planet_table.py to the
+// Standish Keplerian elements. Each block holds the heliocentric x, y, z of
+// one body over blockDays; a position is three Clenshaw sums in float for
+// the Earth and three for the planet, the planet's again at the time the
+// light left it, then one atan2 and asin per coordinate pair.
+//
+// The elements are good to 15" (Mercury) .. 10' (Saturn) against the JPL
+// ephemerides and the fit stays within 1" of them. The Earth-Moon
+// barycentre stands in for the Earth (up to 25" for Venus at its nearest)
+// and aberration and nutation are left out (about 20" each), all far below
+// what a dial shows. tools/planet_accuracy.cpp checks the table
+// against the elements on the host.
+class PlanetEphemeris {
+public:
+    enum Planet {
+        MERCURY = 0,
+        VENUS,
+        MARS,
+        JUPITER,
+        SATURN,
+        PLANET_COUNT
+    };
+
+    // One body in PlanetTable.h: blockCount blocks of blockDays, each
+    // coefficientCount coefficients for x, then y, then z (au)
+    struct Series {
+        uint16_t blockDays;
+        uint8_t coefficientCount;
+        uint16_t blockCount;
+        const float* coefficients;
+    };
+
+    static int64_t getFirstTime();
+    static int64_t getLastTime();
+    static bool covers(int64_t unixSeconds);
+
+    // Right ascension and declination of the mean equator and equinox of
+    // date, ecliptic longitude and latitude, distance in km; false outside
+    // the table
+    static bool position(Planet planet, int64_t unixSeconds, AstroKernels::Equatorial<float>* position);
+    static const char* getName(Planet planet);
+
+private:
+    static void heliocentric(int series, int64_t unixSeconds, float* xyz);
+};
+
+#endif
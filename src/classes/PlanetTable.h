@@ -0,0 +1,884 @@
+#ifndef PLANET_TABLE_H
+#define PLANET_TABLE_H
+
+// Generated by tools/gen_planet_table.py, do not edit.
+// Chebyshev blocks of heliocentric x, y, z (au, equator and equinox of
+// date) from 2025-01-01 to 2055-01-01 UTC, fitted to the Standish elements
+// within 1.0" as seen from the Earth.
+
+#include "PlanetEphemeris.h"
+
+static const int64_t PLANET_TABLE_START = 1735689600;
+static const int64_t PLANET_TABLE_END = 2682374400;
+
+static const float MERCURY_COEFFICIENTS[10320] = {
+    0.00285353285f, 0.299223303f, -0.191985111f, -0.103554286f, 0.00127167288f, 0.00533221386f, 0.00348417903f, 0.00107986146f, 0.000113493992f, -9.22813988e-05f, -7.44208789e-05f, -2.86733917e-05f, -5.11232791e-06f, 1.83916167e-06f, 2.01661027e-06f, 9.29935259e-07f, 2.18243427e-07f, -3.32421216e-08f, -6.25468291e-08f, -3.27717624e-08f,
+    -0.115595249f, 0.276899122f, 0.199808989f, -0.0560226552f, -0.0277525253f, -0.00591716474f, -0.000512001885f, 0.000725952368f, 0.000424219973f, 0.000148446154f, 1.80605562e-05f, -1.29222445e-05f, -1.08823355e-05f, -4.45046762e-06f, -8.40678817e-07f, 2.65004683e-07f, 3.18086555e-07f, 1.52026865e-07f, 3.92240906e-08f, 1.06618769e-09f,
+    -0.0619660546f, 0.11655036f, 0.126594234f, -0.0190996466f, -0.0149378531f, -0.00371215827f, -0.000636102525f, 0.000274788449f, 0.000214489727f, 8.88063703e-05f, 1.73876296e-05f, -3.90675273e-06f, -5.27294233e-06f, -2.56582897e-06f, -6.58563124e-07f, 4.45001188e-08f, 1.4695775e-07f, 8.45663092e-08f, 2.74410138e-08f, 3.98274282e-09f,
+    -0.0576388441f, 0.227677191f, 0.238155762f, -0.0808669564f, -0.00812949591f, 0.00446669364f, -0.00275156163f, 0.000749676522f, -9.53044933e-05f, -4.51045543e-05f, 4.25990885e-05f, -1.79716888e-05f, 4.83000091e-06f, -9.64766706e-08f, -6.80941902e-07f, 4.46670454e-07f, -1.69814027e-07f, 3.386825e-08f, 6.45053262e-09f, -8.31189693e-09f,
+    -0.114600591f, -0.306859642f, 0.172014407f, 0.0653872958f, -0.0226377471f, 0.0044015664f, -0.000523863327f, -0.000484327431f, 0.000269026719f, -0.000108563967f, 2.19601478e-05f, 2.01257254e-06f, -4.63885219e-06f, 2.5509877e-06f, -8.42475437e-07f, 1.22044263e-07f, 6.19624582e-08f, -5.93084688e-08f, 2.81849096e-08f, -8.73864781e-09f,
+    -0.0551322505f, -0.187421943f, 0.0669560512f, 0.0433068537f, -0.0112298891f, 0.00188285606f, 7.16918417e-06f, -0.000336474835f, 0.000153448833f, -5.32180987e-05f, 7.27763487e-06f, 2.9458364e-06f, -2.97789574e-06f, 1.37095304e-06f, -3.78508499e-07f, 1.8577101e-08f, 5.07458767e-08f, -3.51680976e-08f, 1.4364133e-08f, -3.79602174e-09f,
+    -0.0270352979f, -0.357111713f, 0.146679089f, 0.133589945f, -0.0446115852f, -0.0145855089f, 0.011080317f, 0.000249819613f, -0.00245146436f, 0.000546425688f, 0.000443143062f, -0.000246948989f, -4.77804759e-05f, 7.60742969e-05f, -7.48778612e-06f, -1.82908906e-05f, 6.89742869e-06f, 3.06279844e-06f, -2.59045503e-06f, 5.17609261e-08f,
+    -0.0896533654f, -0.162351961f, -0.247082888f, 0.0834283458f, 0.0408861764f, -0.0207001339f, -0.00264901879f, 0.0047475086f, -0.000577429783f, -0.000935467878f, 0.000371328001f, 0.000134266354f, -0.000128101494f, -1.15728284e-06f, 3.39441774e-05f, -8.691389e-06f, -6.9240305e-06f, 4.28790386e-06f, 9.05580907e-07f, -1.74097889e-06f,
+    -0.0450107858f, -0.0494064029f, -0.147093171f, 0.0305896972f, 0.0264591927f, -0.00952349945f, -0.00256749884f, 0.0025066461f, -5.26562824e-05f, -0.000555973022f, 0.000151928228f, 9.7354177e-05f, -6.33611575e-05f, -8.54262831e-06f, 1.88883983e-05f, -2.73112611e-06f, -4.41234968e-06f, 1.96840991e-06f, 7.52971937e-07f, -9.34159487e-07f,
+    -0.011767744f, -0.139723154f, -0.304975679f, 0.0220327042f, 0.059439165f, 0.0113354545f, -0.00605183122f, -0.00432600711f, -0.00029124817f, 0.000827705862f, 0.00037289827f, -5.25294682e-05f, -0.000109445415f, -2.93056692e-05f, 1.59635604e-05f, 1.36961906e-05f, 1.29883199e-06f, -2.9980014e-06f, -1.49000004e-06f, 4.19410294e-08f,
+    -0.0913879046f, 0.32668941f, -0.0948163105f, -0.134204937f, -0.00362398449f, 0.0188405411f, 0.00678264699f, -0.00119666434f, -0.00182261045f, -0.000403275174f, 0.000260467045f, 0.000192238933f, 1.09271283e-05f, -4.29207458e-05f, -1.94324234e-05f, 3.30276266e-06f, 6.34277708e-06f, 1.65896949e-06f, -1.10999051e-06f, -1.04461416e-06f,
+    -0.0475269711f, 0.188836326f, -0.0188085073f, -0.0738894118f, -0.00812572559f, 0.00886985353f, 0.00424880918f, -0.000187688908f, -0.000941959993f, -0.000301366233f, 0.000100101304f, 0.000108025825f, 1.72315312e-05f, -1.98436887e-05f, -1.20296844e-05f, 3.35016256e-07f, 3.24834995e-06f, 1.19734491e-06f, -4.36912238e-07f, -5.61637229e-07f,
+    -0.0135034772f, 0.41670249f, -0.0426017034f, -0.103292339f, -0.0051284088f, -0.00106795818f, 0.000685698766f, 0.000489319876f, 0.000134863193f, 5.09804566e-05f, 3.56842064e-06f, -1.20036456e-06f, -1.844104e-06f, -8.3311944e-07f, -2.73025933e-07f, -6.32034121e-08f, 1.92177229e-09f, 8.13969455e-09f, 5.37326493e-09f, 1.99355046e-09f,
+    -0.134039568f, 0.0916176183f, 0.25700299f, -0.00953862383f, -0.017007628f, -0.00287559107f, -0.00155583968f, -8.83230979e-05f, 4.28921135e-06f, 3.41361769e-05f, 1.66227475e-05f, 5.25180948e-06f, 1.4556462e-06f, 2.41939869e-08f, -1.12536478e-07f, -8.98655223e-08f, -3.60485215e-08f, -1.0841694e-08f, -1.85955011e-09f, 1.89575707e-10f,
+    -0.0700990045f, 0.00546023848f, 0.141540299f, 0.00567286403f, -0.00853856937f, -0.00142273563f, -0.000901422609f, -9.8096479e-05f, -1.17631028e-05f, 1.28988667e-05f, 8.49578997e-06f, 2.92669595e-06f, 9.68662038e-07f, 9.97062768e-08f, -3.15879682e-08f, -4.13548102e-08f, -1.94306888e-08f, -6.63167053e-09f, -1.55182057e-09f, -1.06570444e-10f,
+    -0.0508862629f, -0.0044568758f, 0.307842301f, -0.036460409f, -0.0307550478f, 0.0132282339f, -0.0031314803f, -0.000597712943f, 0.000810911932f, -0.000340280951f, 4.04266874e-05f, 4.17591335e-05f, -3.16616267e-05f, 9.96824917e-06f, 6.35050778e-07f, -2.43154631e-06f, 1.30189646e-06f, -2.51897422e-07f, -1.35530319e-07f, 1.29046248e-07f,
+    -0.0952990148f, -0.369947584f, 0.038216633f, 0.110383892f, -0.0254052749f, -0.00081018107f, 0.00374858182f, -0.00189566414f, 0.000357311741f, 0.000129996053f, -0.00013919759f, 5.34850287e-05f, -3.51621187e-06f, -8.63504198e-06f, 5.74043217e-06f, -1.5855631e-06f, -2.64855401e-07f, 4.94768642e-07f, -2.4761292e-07f, 6.21441671e-08f,
+    -0.0455360031f, -0.196888018f, -0.0116864945f, 0.0626839875f, -0.0103484706f, -0.00181038816f, 0.00232598008f, -0.000948989451f, 0.000106126107f, 0.000104800467f, -7.84684139e-05f, 2.41814498e-05f, 1.42295064e-06f, -5.64501651e-06f, 2.99613386e-06f, -5.92501901e-07f, -2.76930208e-07f, 2.90184193e-07f, -1.17971434e-07f, 1.97066074e-08f,
+    -0.0230037972f, -0.38569375f, -0.0331956423f, 0.16277651f, 0.00407452748f, -0.0292736557f, 0.000328750848f, 0.00597935973f, -0.000318146099f, -0.00139186553f, 0.000136850906f, 0.000346496401f, -5.06913518e-05f, -9.00216507e-05f, 1.77285801e-05f, 2.40797255e-05f, -5.97678611e-06f, -6.67804798e-06f, 1.80786603e-06f, 2.29805747e-06f,
+    -0.0916913599f, 0.0206377164f, -0.286743342f, -0.00509984317f, 0.062402813f, -0.000873249011f, -0.0115094881f, 0.000638657964f, 0.00252821931f, -0.000254444786f, -0.000607865133f, 9.04264767e-05f, 0.000154139269f, -3.08320173e-05f, -4.04324395e-05f, 1.03427522e-05f, 1.07926556e-05f, -3.52920006e-06f, -2.73116065e-06f, 1.48815602e-06f,
+    -0.0465161683f, 0.0511963494f, -0.149505966f, -0.0196803542f, 0.0328645001f, 0.00258419398f, -0.00617403631f, -0.000282298509f, 0.00138183729f, 9.28489983e-06f, -0.000338526927f, 1.21366358e-05f, 8.75078553e-05f, -7.068036e-06f, -2.3416024e-05f, 3.00849714e-06f, 6.3801182e-06f, -1.18687506e-06f, -1.64531346e-06f, 5.54426562e-07f,
+    -0.000907203962f, 0.0813035539f, -0.298917029f, -0.0643614292f, 0.029814087f, 0.0163189254f, 0.00367868126f, -0.00105540964f, -0.00116927296f, -0.000394652475f, 2.6231525e-05f, 9.44802371e-05f, 4.47115136e-05f, 3.75914866e-06f, -7.75679321e-06f, -5.08046879e-06f, -1.04818966e-06f, 5.8525121e-07f, 5.93333879e-07f, 2.41224627e-07f,
+    -0.0977659275f, 0.362395123f, 0.0670924415f, -0.112037628f, -0.0308305179f, 0.00173214457f, 0.00512833563f, 0.0022726409f, 0.000184847605f, -0.000329730307f, -0.000208210903f, -4.18920647e-05f, 2.13476229e-05f, 2.04765253e-05f, 6.43378871e-06f, -1.04146579e-06f, -2.02224493e-06f, -8.69864959e-07f, -6.33784e-09f, 1.75130652e-07f,
+    -0.0520592939f, 0.184848929f, 0.066936106f, -0.0530602182f, -0.0195529018f, -0.000776345153f, 0.00235239555f, 0.00132230337f, 0.000220439284f, -0.000134772886f, -0.000113802838f, -3.21916381e-05f, 6.729106e-06f, 1.0531472e-05f, 4.24031377e-06f, -2.62057463e-08f, -9.69545694e-07f, -5.25008222e-07f, -6.52036444e-08f, 6.82885603e-08f,
+    -0.0418333979f, 0.392246976f, 0.106608963f, -0.0951440044f, -0.0029988445f, -0.000992424482f, -0.000742806204f, 0.000354619408f, -6.47230341e-05f, 3.85490558e-05f, 3.77744793e-07f, 5.00621536e-07f, 9.0814994e-07f, -3.56304481e-07f, 1.15439473e-07f, -4.34897848e-08f, 1.96121365e-09f, -1.5606268e-10f, -1.49311067e-09f, 5.11936893e-10f,
+    -0.134452041f, -0.128020937f, 0.246950007f, 0.0248647404f, -0.0152043267f, 0.001495337f, -0.0013531135f, -2.24632957e-05f, -2.0376401e-05f, -2.00443856e-05f, 9.20786822e-06f, -2.35823498e-06f, 1.12594781e-06f, -3.29562107e-08f, 1.48930307e-08f, 3.02203781e-08f, -1.22421359e-08f, 4.54295777e-09f, -1.57947404e-09f, 1.88409896e-10f,
+    -0.0673640979f, -0.109164006f, 0.120625887f, 0.0231775514f, -0.00779816837f, 0.000901114058f, -0.000644414871f, -4.89316645e-05f, -4.1259048e-06f, -1.47093087e-05f, 4.87253712e-06f, -1.31016903e-06f, 5.06007028e-07f, 1.9544024e-08f, -4.08372e-09f, 2.06524399e-08f, -6.73488376e-09f, 2.43970119e-09f, -6.86989743e-10f, 4.71663144e-11f,
+    -0.036698914f, -0.219185166f, 0.278594758f, 0.0474875871f, -0.0552393602f, 0.009379046f, 0.0049072159f, -0.00381076842f, 0.000614723942f, 0.000522870272f, -0.000361109845f, 4.30815692e-05f, 6.36096957e-05f, -3.89423485e-05f, 2.56412551e-06f, 8.31285385e-06f, -4.50628565e-06f, 2.36721919e-08f, 1.19325048e-06f, -6.91885499e-07f,
+    -0.0883437224f, -0.311874008f, -0.120779329f, 0.127282837f, -0.00215352902f, -0.0162011576f, 0.00665552666f, 0.000223345381f, -0.00140615021f, 0.000552550608f, 6.18611039e-05f, -0.000150836041f, 5.33758153e-05f, 1.1239902e-05f, -1.79129223e-05f, 5.50697297e-06f, 1.86358904e-06f, -2.21252564e-06f, 5.34776147e-07f, 2.40206028e-07f,
+    -0.0433015554f, -0.143526776f, -0.0934585249f, 0.0629496027f, 0.00460710226f, -0.00961965149f, 0.00303900594f, 0.000516221381f, -0.000814152703f, 0.000240270588f, 7.06267784e-05f, -8.49512921e-05f, 2.18447679e-05f, 1.00536121e-05f, -9.82267855e-06f, 2.071451e-06f, 1.46366985e-06f, -1.18271984e-06f, 1.60935366e-07f, 2.00230239e-07f,
+    -0.0194804498f, -0.310479117f, -0.202257325f, 0.11822759f, 0.0517852231f, -0.0144916276f, -0.0115548321f, 0.00105266181f, 0.00270936297f, 0.000210024638f, -0.00061804592f, -0.000159759458f, 0.000130480563f, 6.51117187e-05f, -2.3268284e-05f, -2.19216645e-05f, 2.51095953e-06f, 6.6518119e-06f, 3.0092522e-07f, -2.20426762e-06f,
+    -0.091493108f, 0.196504264f, -0.231544666f, -0.0928236291f, 0.0417153543f, 0.0208875811f, -0.00443143749f, -0.0049381126f, 0.000155605799f, 0.00116871574f, 0.000162334754f, -0.000263284793f, -8.79476449e-05f, 5.34264845e-05f, 3.31028689e-05f, -8.50958942e-06f, -1.06553614e-05f, 3.16414964e-07f, 2.91483694e-06f, 7.29466581e-07f,
+    -0.0467758028f, 0.137176868f, -0.102438104f, -0.0618351386f, 0.0168562071f, 0.0126522323f, -0.00115982425f, -0.00274385159f, -0.000199320849f, 0.00060154818f, 0.00015099791f, -0.000123797689f, -6.05109559e-05f, 2.17146389e-05f, 2.0082879e-05f, -2.25498265e-06f, -5.94559484e-06f, -5.24360191e-07f, 1.52351832e-06f, 6.18817096e-07f,
+    0.00307711518f, 0.293533297f, -0.196338385f, -0.103103092f, 0.0018074178f, 0.00566143361f, 0.00358259876f, 0.00108013556f, 9.54195071e-05f, -0.000104503902f, -7.86896968e-05f, -2.90656871e-05f, -4.49405198e-06f, 2.32697715e-06f, 2.21453044e-06f, 9.6106927e-07f, 1.97949477e-07f, -5.34331114e-08f, -7.21998412e-08f, -3.55818153e-08f,
+    -0.114939758f, 0.281415677f, 0.196744859f, -0.0577728908f, -0.0281065267f, -0.00590361669f, -0.000412204765f, 0.000779918891f, 0.000441626925f, 0.000148773823f, 1.48776417e-05f, -1.50901446e-05f, -1.16717386e-05f, -4.5297311e-06f, -7.31717866e-07f, 3.54230058e-07f, 3.54988209e-07f, 1.5805622e-07f, 3.55293667e-08f, -2.25241509e-09f,
+    -0.0616337759f, 0.11952764f, 0.12540973f, -0.0200737286f, -0.0151811162f, -0.00373911853f, -0.000593220005f, 0.000303471355f, 0.00022563253f, 9.02503673e-05f, 1.6136299e-05f, -5.02061004e-06f, -5.75771573e-06f, -2.65877801e-06f, -6.21092451e-07f, 8.88045239e-08f, 1.68732712e-07f, 8.98798721e-08f, 2.64762299e-08f, 2.50643514e-09f,
+    -0.0574679109f, 0.234369665f, 0.234726156f, -0.0816474575f, -0.00771239644f, 0.00420925907f, -0.00267975169f, 0.000744764739f, -0.000104092568f, -3.80148005e-05f, 3.96849065e-05f, -1.72504005e-05f, 4.90022865e-06f, -2.70667773e-07f, -5.76025917e-07f, 4.08616618e-07f, -1.63754242e-07f, 3.69206936e-08f, 3.19911535e-09f, -6.75080491e-09f,
+    -0.115340788f, -0.302820384f, 0.175372369f, 0.0639521003f, -0.022368774f, 0.00438700506f, -0.000589277236f, -0.000449386683f, 0.000254932838f, -0.000106120859f, 2.27424954e-05f, 1.03913018e-06f, -4.12983627e-06f, 2.39184891e-06f, -8.28505863e-07f, 1.42565405e-07f, 4.56625478e-08f, -5.20941422e-08f, 2.62866952e-08f, -8.60748877e-09f,
+    -0.0555369194f, -0.185956758f, 0.0690873405f, 0.0426220573f, -0.0111284108f, 0.00190152935f, -3.50835345e-05f, -0.000317325737f, 0.000146835892f, -5.2646449e-05f, 7.99600206e-06f, 2.35193728e-06f, -2.71361882e-06f, 1.30408663e-06f, -3.81922063e-07f, 3.34671371e-08f, 4.1422303e-08f, -3.16359637e-08f, 1.36887025e-08f, -3.88798971e-09f,
+    -0.0271738532f, -0.354431756f, 0.151898464f, 0.131557197f, -0.0456613477f, -0.013792064f, 0.0111444828f, 6.497395e-06f, -0.00240243324f, 0.000604080472f, 0.000412268252f, -0.000255500454f, -3.59907168e-05f, 7.53111453e-05f, -1.08889618e-05f, -1.70786134e-05f, 7.6113869e-06f, 2.47471642e-06f, -2.66941913e-06f, 2.98346555e-07f,
+    -0.0895848758f, -0.167844594f, -0.244317955f, 0.0856987568f, 0.0396691578f, -0.0209685646f, -0.00224240225f, 0.00471073609f, -0.000684706942f, -0.000894613468f, 0.000391656477f, 0.000116233197f, -0.000129115772f, 4.62888979e-06f, 3.25944211e-05f, -1.00823895e-05f, -6.10501681e-06f, 4.46895338e-06f, 6.10763849e-07f, -1.67696262e-06f,
+    -0.0449541882f, -0.0525945764f, -0.146154521f, 0.0320035784f, 0.0259188476f, -0.00974778241f, -0.00235753944f, 0.00251213217f, -0.000114873646f, -0.000540159273f, 0.000165954518f, 8.8627765e-05f, -6.51224914e-05f, -5.37924189e-06f, 1.85213516e-05f, -3.59835561e-06f, -4.04975563e-06f, 2.12594056e-06f, 6.03983083e-07f, -9.25620428e-07f,
+    -0.0120229804f, -0.146146361f, -0.303352287f, 0.0252082527f, 0.0599290127f, 0.0107612149f, -0.0064159807f, -0.00431533723f, -0.000186600013f, 0.000867298087f, 0.000359395267f, -6.94426045e-05f, -0.000112525985f, -2.56557828e-05f, 1.83839851e-05f, 1.36276261e-05f, 5.49393702e-07f, -3.28990922e-06f, -1.37130397e-06f, 1.99249859e-07f,
+    -0.0913360681f, 0.323886142f, -0.0998316078f, -0.133943798f, -0.00230168298f, 0.0192768508f, 0.00661300332f, -0.00138362038f, -0.00185099021f, -0.000362522975f, 0.000285217576f, 0.000190737881f, 3.15359098e-06f, -4.57062802e-05f, -1.83152645e-05f, 4.58668874e-06f, 6.55099424e-06f, 1.37383784e-06f, -1.28664494e-06f, -1.05624427e-06f,
+    -0.0474675389f, 0.187998336f, -0.0216372699f, -0.0740748491f, -0.00747334285f, 0.00916105367f, 0.00419612907f, -0.000288311625f, -0.000967899206f, -0.000283762702f, 0.000114684188f, 0.000108979624f, 1.34093365e-05f, -2.17066522e-05f, -1.16855749e-05f, 1.0263742e-06f, 3.43714487e-06f, 1.07569226e-06f, -5.43402458e-07f, -5.84182335e-07f,
+    -0.0126242199f, 0.415042563f, -0.0475274482f, -0.103520411f, -0.00513701986f, -0.00098336867f, 0.000746657625f, 0.000506424614f, 0.000141481048f, 5.1062613e-05f, 3.13858907e-06f, -1.61669518e-06f, -2.02795533e-06f, -8.90410845e-07f, -2.84250265e-07f, -6.0612105e-08f, 4.90627192e-09f, 9.86752135e-09f, 6.01786453e-09f, 2.17255503e-09f,
+    -0.133665145f, 0.0984929695f, 0.256284276f, -0.0107769983f, -0.0172391756f, -0.00301556143f, -0.00155897837f, -8.43621425e-05f, 1.01409804e-05f, 3.70046327e-05f, 1.75060206e-05f, 5.48064588e-06f, 1.43167579e-06f, -1.23547696e-08f, -1.36998418e-07f, -9.93054733e-08f, -3.8642268e-08f, -1.10904252e-08f, -1.60593369e-09f, 3.58773145e-10f,
+    -0.0699834705f, 0.00928121147f, 0.141658405f, 0.00504020461f, -0.00866011459f, -0.00150602611f, -0.000909393061f, -9.77790044e-05f, -9.33640424e-06f, 1.44167919e-05f, 9.01074243e-06f, 3.09191901e-06f, 9.75026359e-07f, 8.62099428e-08f, -4.34509077e-08f, -4.66533309e-08f, -2.11234579e-08f, -6.94414529e-09f, -1.48381293e-09f, -3.50552414e-11f,
+    -0.0512442092f, 0.00313400978f, 0.307008748f, -0.0385773856f, -0.0298318444f, 0.0130348245f, -0.00323128873f, -0.000498086362f, 0.000771901979f, -0.000338875572f, 4.85518705e-05f, 3.63854829e-05f, -3.02013227e-05f, 1.03209443e-05f, 6.68880989e-08f, -2.15709951e-06f, 1.26448885e-06f, -2.94746173e-07f, -9.76013674e-08f, 1.13005535e-07f,
+    -0.0957474953f, -0.369902538f, 0.0431838517f, 0.109161856f, -0.025645972f, -0.000442671031f, 0.00356865376f, -0.00187111797f, 0.000381373188f, 0.000109328686f, -0.000131990092f, 5.37827598e-05f, -5.39169504e-06f, -7.52936498e-06f, 5.4898862e-06f, -1.69105654e-06f, -1.38552003e-07f, 4.40738913e-07f, -2.43786758e-07f, 7.037999e-08f,
+    -0.0457311723f, -0.197635727f, -0.00896288504f, 0.0622483124f, -0.010570673f, -0.00159462058f, 0.002240322f, -0.000946159807f, 0.000122979256f, 9.36350355e-05f, -7.54648637e-05f, 2.48960599e-05f, 2.71652094e-07f, -5.09189787e-06f, 2.92138408e-06f, -6.77208333e-07f, -2.05692135e-07f, 2.65813118e-07f, -1.1986589e-07f, 2.5763689e-08f,
+    -0.0230383922f, -0.386422735f, -0.0272864881f, 0.162999398f, 0.00228847155f, -0.0292515604f, 0.000828877441f, 0.00594785488f, -0.000466212497f, -0.00137483847f, 0.000181505727f, 0.000338930718f, -6.42878185e-05f, -8.69351447e-05f, 2.18805485e-05f, 2.28742956e-05f, -7.23539557e-06f, -6.20563205e-06f, 2.15901108e-06f, 2.07191364e-06f,
+    -0.0916713407f, 0.0146667108f, -0.286965491f, -0.00201637833f, 0.0623588459f, -0.00170572666f, -0.0114556419f, 0.000878975271f, 0.00250015425f, -0.000325953943f, -0.000595625413f, 0.000111996141f, 0.000149207969f, -3.73791751e-05f, -3.85358301e-05f, 1.23359035e-05f, 1.00931193e-05f, -4.14756575e-06f, -2.50393645e-06f, 1.72368669e-06f,
+    -0.0464962922f, 0.048099863f, -0.150224254f, -0.0180643177f, 0.0330238083f, 0.00213892075f, -0.00619685307f, -0.000151072628f, 0.00138217925f, -3.0570718e-05f, -0.000336625593f, 2.44135945e-05f, 8.6288353e-05f, -1.08772295e-05f, -2.283563e-05f, 4.19590106e-06f, 6.13781216e-06f, -1.56553239e-06f, -1.56063141e-06f, 7.03471037e-07f,
+    -0.00115987614f, 0.0739586346f, -0.300772458f, -0.0622374082f, 0.0309329259f, 0.0165149929f, 0.00351762423f, -0.00119088868f, -0.00120699127f, -0.000382879975f, 4.24103023e-05f, 0.000100835805f, 4.42870314e-05f, 1.8876891e-06f, -8.73751299e-06f, -5.16972646e-06f, -8.46874323e-07f, 7.24722344e-07f, 6.22408376e-07f, 2.28243178e-07f,
+    -0.0974068516f, 0.363004803f, 0.0621092133f, -0.113473403f, -0.0304717306f, 0.00221304133f, 0.00532318023f, 0.00226464674f, 0.000133995429f, -0.000356946974f, -0.000211124728f, -3.67331346e-05f, 2.50741946e-05f, 2.1323091e-05f, 5.96897876e-06f, -1.5321147e-06f, -2.18922767e-06f, -8.38999693e-07f, 5.91942285e-08f, 2.10354409e-07f,
+    -0.0518362982f, 0.185917971f, 0.0644784767f, -0.0540393427f, -0.0194775864f, -0.000540937335f, 0.00247271546f, 0.00133207915f, 0.00019727785f, -0.000150486148f, -0.000117033465f, -3.01034725e-05f, 8.75840399e-06f, 1.11768918e-05f, 4.09454493e-06f, -2.78379585e-07f, -1.07945469e-06f, -5.23057279e-07f, -3.33000959e-08f, 8.84122341e-08f,
+    -0.0409456864f, 0.395269176f, 0.102048138f, -0.0954187669f, -0.00302586146f, -0.00106695649f, -0.000699019899f, 0.000347275286f, -5.9355263e-05f, 3.88035115e-05f, 3.94074599e-07f, 6.85399127e-07f, 8.28996951e-07f, -3.32548291e-07f, 1.05513111e-07f, -4.34701449e-08f, 2.04729156e-09f, -6.16799509e-10f, -1.31120507e-09f, 4.44391699e-10f,
+    -0.13481564f, -0.121298429f, 0.248220875f, 0.0237645393f, -0.0151014086f, 0.00136905294f, -0.00135894118f, -2.33940664e-05f, -2.34383626e-05f, -1.84361704e-05f, 8.82913629e-06f, -2.14996642e-06f, 1.1275318e-06f, -3.23602418e-08f, 2.26549561e-08f, 2.69178994e-08f, -1.10946078e-08f, 4.11855776e-09f, -1.55651596e-09f, 1.84191403e-10f,
+    -0.0676421052f, -0.105900404f, 0.121762534f, 0.0226214039f, -0.00773955729f, 0.000841480559f, -0.000651990528f, -4.86739563e-05f, -6.31529924e-06f, -1.38783314e-05f, 4.66832627e-06f, -1.21823423e-06f, 5.15011362e-07f, 1.74000139e-08f, 1.08625909e-09f, 1.88888232e-08f, -6.13119788e-09f, 2.26112049e-09f, -6.93569113e-10f, 5.19287023e-11f,
+    -0.0370464555f, -0.213328148f, 0.281187502f, 0.04451033f, -0.0548374941f, 0.00986004519f, 0.00456761288f, -0.00377527341f, 0.000686792663f, 0.000478397533f, -0.000358973441f, 5.42169866e-05f, 5.75431174e-05f, -3.90447917e-05f, 4.31137167e-06f, 7.47513026e-06f, -4.58098085e-06f, 2.92911236e-07f, 1.08189187e-06f, -6.96876026e-07f,
+    -0.0884109193f, -0.315311015f, -0.115938875f, 0.127597046f, -0.00333277683f, -0.0157354979f, 0.0067284822f, 6.70936834e-05f, -0.00135067621f, 0.000567378399f, 3.95823018e-05f, -0.000143989985f, 5.61582687e-05f, 7.96343937e-06f, -1.70699562e-05f, 6.01130919e-06f, 1.37296544e-06f, -2.11300187e-06f, 6.34336324e-07f, 1.51846218e-07f,
+    -0.0432952791f, -0.145946612f, -0.0911504463f, 0.0634192335f, 0.00393827073f, -0.00942089641f, 0.00311279894f, 0.000429300945f, -0.000792023922f, 0.000252768026f, 5.85302892e-05f, -8.24540377e-05f, 2.39562325e-05f, 8.31744356e-06f, -9.55433082e-06f, 2.4271997e-06f, 1.20982363e-06f, -1.15758466e-06f, 2.25577384e-07f, 1.53632049e-07f,
+    -0.0195791242f, -0.314386046f, -0.197640263f, 0.120628231f, 0.0507539499f, -0.0153036946f, -0.0114181606f, 0.00131249649f, 0.00271664697f, 0.000133525455f, -0.000634514967f, -0.000139400651f, 0.00013939954f, 6.04614918e-05f, -2.69408813e-05f, -2.1162353e-05f, 3.81261928e-06f, 6.67853165e-06f, -8.5661639e-08f, -2.33396459e-06f,
+    -0.091531957f, 0.191416047f, -0.23467109f, -0.0905595804f, 0.0429234931f, 0.0204927978f, -0.00483866843f, -0.00489892836f, 0.000282885993f, 0.00118053725f, 0.000125959201f, -0.0002737214f, -7.86751994e-05f, 5.84227522e-05f, 3.11436691e-05f, -1.04541152e-05f, -1.0395765e-05f, 9.92296332e-07f, 2.93460156e-06f, 4.71939408e-07f,
+    -0.0467807788f, 0.134870836f, -0.104567797f, -0.060877098f, 0.0176041126f, 0.0125257328f, -0.00139064363f, -0.00274981622f, -0.000132294437f, 0.000615759545f, 0.000133325816f, -0.000131467258f, -5.64949091e-05f, 2.4859228e-05f, 1.94197991e-05f, -3.37009574e-06f, -5.94234829e-06f, -1.66892215e-07f, 1.57419567e-06f, 4.95015552e-07f,
+    0.00327901931f, 0.287747526f, -0.200644581f, -0.10261112f, 0.00236705472f, 0.0059968064f, 0.00367916718f, 0.00107756554f, 7.56624174e-05f, -0.000117219904f, -8.29084508e-05f, -2.92990433e-05f, -3.77410443e-06f, 2.84950662e-06f, 2.4129144e-06f, 9.84268816e-07f, 1.71912148e-07f, -7.58241207e-08f, -8.20895026e-08f, -3.81574264e-08f,
+    -0.114286844f, 0.28582384f, 0.193604926f, -0.0595334664f, -0.0284533016f, -0.00587899405f, -0.000306855161f, 0.000835370124f, 0.000458661166f, 0.000148468465f, 1.13268166e-05f, -1.73694725e-05f, -1.24517769e-05f, -4.57559046e-06f, -6.01069478e-07f, 4.50953496e-07f, 3.92081118e-07f, 1.62425966e-07f, 3.05676675e-08f, -6.11403326e-09f,
+    -0.0613006935f, 0.122457019f, 0.124180505f, -0.0210574268f, -0.0154230158f, -0.00376083766f, -0.00054720018f, 0.00033323702f, 0.000236751393f, 9.14089881e-05f, 1.46841447e-05f, -6.21021574e-06f, -6.24805399e-06f, -2.73755475e-06f, -5.72127773e-07f, 1.37923869e-07f, 1.91205981e-07f, 9.45383664e-08f, 2.48614022e-08f, 7.16599328e-10f,
+    -0.0572726852f, 0.240984072f, 0.231240232f, -0.0823969463f, -0.00731454718f, 0.00395703309f, -0.00260747369f, 0.000738410578f, -0.000111838572f, -3.13351442e-05f, 3.68546274e-05f, -1.64969989e-05f, 4.93013371e-06f, -4.22370574e-07f, -4.78701967e-07f, 3.71250673e-07f, -1.56590284e-07f, 3.902848e-08f, 4.05098911e-10f, -5.33676359e-09f,
+    -0.116081183f, -0.298666815f, 0.178665324f, 0.0625257567f, -0.0220971749f, 0.0043649638f, -0.000650820969f, -0.0004159705f, 0.000241003881f, -0.000103478028f, 2.33412541e-05f, 1.56806443e-07f, -3.64662395e-06f, 2.23214142e-06f, -8.08527386e-07f, 1.58921352e-07f, 3.10896138e-08f, -4.52378194e-08f, 2.42883509e-08f, -8.35647196e-09f,
+    -0.0559441604f, -0.184423348f, 0.0711897197f, 0.0419389515f, -0.0110235822f, 0.00191568971f, -7.53190626e-05f, -0.00029884272f, 0.000140204368f, -5.19262733e-05f, 8.60782467e-06f, 1.80334142e-06f, -2.45895934e-06f, 1.2346014e-06f, -3.81348027e-07f, 4.60643921e-08f, 3.29060222e-08f, -2.81972703e-08f, 1.291261e-08f, -3.90082268e-09f,
+    -0.0273180888f, -0.351644248f, 0.157063136f, 0.129468174f, -0.0466688203f, -0.0129902831f, 0.0111888721f, -0.000233632513f, -0.00234693822f, 0.00065847557f, 0.000380051521f, -0.000262440754f, -2.42241577e-05f, 7.39781816e-05f, -1.41032996e-05f, -1.57236097e-05f, 8.21474781e-06f, 1.87350681e-06f, -2.70707801e-06f, 5.30384666e-07f,
+    -0.0895169555f, -0.173298014f, -0.241467676f, 0.0879200227f, 0.0384312638f, -0.0212095217f, -0.00183662737f, 0.00466358402f, -0.000788323458f, -0.000851064875f, 0.000409782488f, 9.79159334e-05f, -0.000129246142f, 1.02398104e-05f, 3.09845234e-05f, -1.13306134e-05f, -5.2374095e-06f, 4.58476074e-06f, 3.15326689e-07f, -1.58646896e-06f,
+    -0.0448972987f, -0.0557726674f, -0.145165296f, 0.0333970212f, 0.0253631588f, -0.00995830854f, -0.00214601392f, 0.00251177018f, -0.000175804691f, -0.000522576997f, 0.000178946028f, 7.95843304e-05f, -6.6410679e-05f, -2.25047535e-06f, 1.79964547e-05f, -4.4042519e-06f, -3.6498489e-06f, 2.25006402e-06f, 4.50393687e-07f, -9.01466542e-07f,
+    -0.0122741948f, -0.152510445f, -0.301619795f, 0.0283898651f, 0.0603780422f, 0.0101640845f, -0.00677519547f, -0.00429391496f, -7.881387e-05f, 0.000904482172f, 0.000343699683f, -8.650189e-05f, -0.000114914828f, -2.16473838e-05f, 2.07283254e-05f, 1.34040778e-05f, -2.4348519e-07f, -3.55046193e-06f, -1.22457332e-06f, 3.62695926e-07f,
+    -0.0912905062f, 0.32099131f, -0.104814739f, -0.133616427f, -0.000961328455f, 0.01969598f, 0.00642823681f, -0.00157117497f, -0.00187417688f, -0.000319195114f, 0.000309303784f, 0.000188041798f, -4.92518343e-06f, -4.82181843e-05f, -1.69724931e-05f, 5.87749918e-06f, 6.68548711e-06f, 1.05417632e-06f, -1.45136866e-06f, -1.04880887e-06f,
+    -0.0474118588f, 0.187106081f, -0.0244598457f, -0.0742258408f, -0.00680724693f, 0.00944547162f, 0.0041349116f, -0.000390355885f, -0.000991400137f, -0.000264541359f, 0.000129139703f, 0.000109312614f, 9.35324919e-06f, -2.34610136e-05f, -1.1213486e-05f, 1.73743275e-06f, 3.59117768e-06f, 9.32403926e-07f, -6.46441911e-07f, -5.9720825e-07f,
+    -0.0117593645f, 0.413233656f, -0.0524546741f, -0.103741633f, -0.00513697067f, -0.000892308843f, 0.000809412438f, 0.000524225428f, 0.000148015863f, 5.1034733e-05f, 2.62466218e-06f, -2.06924723e-06f, -2.22213532e-06f, -9.48998119e-07f, -2.94250605e-07f, -5.70507187e-08f, 8.39718027e-09f, 1.17680147e-08f, 6.69889753e-09f, 2.35107681e-09f,
+    -0.133271291f, 0.105330519f, 0.255496162f, -0.0120293482f, -0.0174805227f, -0.00315486636f, -0.00156118428f, -7.95227931e-05f, 1.64277512e-05f, 3.99992731e-05f, 1.84166265e-05f, 5.69794756e-06f, 1.39753178e-06f, -5.49367587e-08f, -1.636746e-07f, -1.09265058e-07f, -4.12127115e-08f, -1.12242819e-08f, -1.2789725e-09f, 5.58957911e-10f,
+    -0.0698561707f, 0.0130969612f, 0.141740067f, 0.00439952046f, -0.00878776447f, -0.0015896276f, -0.000917057175f, -9.70672075e-05f, -6.6701096e-06f, 1.60131864e-05f, 9.54897855e-06f, 3.25477161e-06f, 9.77056736e-07f, 6.96386639e-08f, -5.66191036e-08f, -5.23293379e-08f, -2.28565341e-08f, -7.21344794e-09f, -1.3805564e-09f, 5.300741e-11f,
+    -0.0515944586f, 0.010742121f, 0.306070649f, -0.0406494205f, -0.0289137771f, 0.0128290138f, -0.00332098608f, -0.000401943301f, 0.000732381889f, -0.000336112592f, 5.58888813e-05f, 3.11723126e-05f, -2.86312098e-05f, 1.0554723e-05f, -4.50724571e-07f, -1.8844207e-06f, 1.21460429e-06f, -3.28755327e-07f, -6.23840069e-08f, 9.69099118e-08f,
+    -0.0962097733f, -0.369728933f, 0.048121706f, 0.107911953f, -0.0258583312f, -8.82409842e-05f, 0.00338891602f, -0.00184296991f, 0.00040282276f, 8.94278033e-05f, -0.000124573514f, 5.37221026e-05f, -7.08072918e-06f, -6.45159907e-06f, 5.20712422e-06f, -1.76712388e-06f, -2.33332911e-08f, 3.86099386e-07f, -2.36364766e-07f, 7.63047742e-08f,
+    -0.0459344306f, -0.198317196f, -0.00624449154f, 0.0617933627f, -0.0107772658f, -0.0013845608f, 0.00215373693f, -0.000941055437f, 0.000138492775f, 8.273892e-05f, -7.22689459e-05f, 2.54031366e-05f, -7.91558737e-07f, -4.54140757e-06f, 2.82424743e-06f, -7.46044144e-07f, -1.39075847e-07f, 2.4020384e-07f, -1.19562847e-07f, 3.05941579e-08f,
+    -0.0230736459f, -0.38704362f, -0.0213680351f, 0.163143782f, 0.000503021201f, -0.0291961794f, 0.00132662202f, 0.00590311491f, -0.000612531494f, -0.00135281025f, 0.000225192317f, 0.00032953865f, -7.74134167e-05f, -8.3199297e-05f, 2.58210852e-05f, 2.14427326e-05f, -8.40544768e-06f, -5.65409479e-06f, 2.47860729e-06f, 1.81211071e-06f,
+    -0.0916488151f, 0.00868932965f, -0.287088214f, 0.00106639092f, 0.0622688752f, -0.0025348591f, -0.0113830398f, 0.00111678649f, 0.00246488494f, -0.000396058297f, -0.000580728979f, 0.000132876858f, 0.000143326133f, -4.36138789e-05f, -3.63079446e-05f, 1.4193818e-05f, 9.28174317e-06f, -4.70725946e-06f, -2.24293677e-06f, 1.9283534e-06f,
+    -0.0464750092f, 0.0449893712f, -0.150890871f, -0.016440801f, 0.0331586466f, 0.00169204592f, -0.00620945862f, -1.98261802e-05f, 0.00137850992f, -7.01922806e-05f, -0.000333210752f, 3.65118146e-05f, 8.45142545e-05f, -1.45870129e-05f, -2.20569942e-05f, 5.33463063e-06f, 5.82678427e-06f, -1.92111516e-06f, -1.45469415e-06f, 8.39554933e-07f,
+    -0.00141856747f, 0.066609003f, -0.302523977f, -0.0600614273f, 0.0320537185f, 0.0166931942f, 0.00334425118f, -0.00132857289f, -0.00124222222f, -0.000368824585f, 5.92678957e-05f, 0.000106922571f, 4.34875801e-05f, -1.37809949e-07f, -9.70225395e-06f, -5.20308545e-06f, -6.15514541e-07f, 8.66063211e-07f, 6.4314614e-07f, 2.09124497e-07f,
+    -0.0970596275f, 0.363492274f, 0.0570932687f, -0.114873607f, -0.0300790749f, 0.00270554147f, 0.00551398285f, 0.00225036672f, 8.03562113e-05f, -0.000383972021f, -0.000213057906f, -3.10134072e-05f, 2.8856269e-05f, 2.2035737e-05f, 5.40392722e-06f, -2.04543406e-06f, -2.34079066e-06f, -7.9209993e-07f, 1.30253944e-07f, 2.45336833e-07f,
+    -0.0516190139f, 0.186922775f, 0.061993207f, -0.0550049123f, -0.0193845263f, -0.0002975417f, 0.00259215476f, 0.00133874263f, 0.000172378541f, -0.000166333233f, -0.000119812678f, -2.76891643e-05f, 1.08560426e-05f, 1.17669905e-05f, 3.89376393e-06f, -5.4841559e-07f, -1.18426901e-06f, -5.12762379e-07f, 2.41196715e-09f, 1.09044343e-07f,
+    -0.0400445101f, 0.398150159f, 0.0974677055f, -0.0956900907f, -0.00305915311f, -0.00113676934f, -0.000655913867f, 0.000340583045f, -5.39172371e-05f, 3.90459779e-05f, 4.4479075e-07f, 8.53825863e-07f, 7.54248157e-07f, -3.10877793e-07f, 9.54625447e-08f, -4.33904803e-08f, 2.00091379e-09f, -1.0234338e-09f, -1.14884265e-09f, 3.83445612e-10f,
+    -0.135157154f, -0.114531451f, 0.249429508f, 0.0226692852f, -0.0150080889f, 0.00124179298f, -0.00136461771f, -2.47412328e-05f, -2.6244881e-05f, -1.68811549e-05f, 8.48518649e-06f, -1.93953864e-06f, 1.12854989e-06f, -2.99115531e-08f, 2.95764994e-08f, 2.38829329e-08f, -1.00546713e-08f, 3.69323191e-09f, -1.53090853e-09f, 1.74394504e-10f,
+    -0.0679097604f, -0.102599264f, 0.122868218f, 0.0220676683f, -0.00768541985f, 0.000780852892f, -0.000659417109f, -4.87056805e-05f, -8.37583962e-06f, -1.30746625e-05f, 4.479119e-06f, -1.12347765e-06f, 5.23260064e-07f, 1.64598706e-08f, 5.82086787e-09f, 1.72619659e-08f, -5.57120991e-09f, 2.07648158e-09f, -6.96712917e-10f, 5.3033042e-11f,
+    -0.0373993073f, -0.207388372f, 0.28367635f, 0.0415355639f, -0.054399175f, 0.0103177512f, 0.0042277445f, -0.00373146663f, 0.000754355834f, 0.000433573729f, -0.000355136884f, 6.45479818e-05f, 5.13518168e-05f, -3.8817745e-05f, 5.92260065e-06f, 6.60354789e-06f, -4.59376089e-06f, 5.40616038e-07f, 9.60638285e-07f, -6.88948897e-07f,
+    -0.088486737f, -0.318657674f, -0.111062143f, 0.127848438f, -0.00448974892f, -0.0152593986f, 0.0067872613f, -8.4979456e-05f, -0.00129264144f, 0.000579383362f, 1.79820131e-05f, -0.000136576683f, 5.84120046e-05f, 4.78618491e-06f, -1.61089073e-05f, 6.42052923e-06f, 8.95585171e-07f, -1.99072281e-06f, 7.17229785e-07f, 6.76252595e-08f,
+    -0.0432930149f, -0.148326945f, -0.0888128651f, 0.0638552769f, 0.00327761235f, -0.0092142267f, 0.00317907503f, 0.000343756131f, -0.000768070405f, 0.000263798132f, 4.66205645e-05f, -7.95718654e-05f, 2.57988541e-05f, 6.60017815e-06f, -9.20903291e-06f, 2.73575624e-06f, 9.56640924e-07f, -1.11809711e-06f, 2.8235964e-07f, 1.07903876e-07f,
+    -0.0196736962f, -0.318199374f, -0.192953941f, 0.122975664f, 0.0496801123f, -0.0161029277f, -0.0112613348f, 0.00157143009f, 0.00271593441f, 5.57331559e-05f, -0.000648239624f, -0.000118005785f, 0.000147514618f, 5.52707109e-05f, -3.04283549e-05f, -2.01703121e-05f, 5.09198335e-06f, 6.6158324e-06f, -4.77392717e-07f, -2.42603212e-06f,
+    -0.091570474f, 0.186278817f, -0.237716177f, -0.0882469985f, 0.0441050291f, 0.0200717824f, -0.00524067054f, -0.0048482566f, 0.000410506994f, 0.00118805565f, 8.85805599e-05f, -0.000282760844f, -6.87515857e-05f, 6.30386915e-05f, 2.8871547e-05f, -1.23244914e-05f, -1.00092989e-05f, 1.66940091e-06f, 2.91240337e-06f, 1.99990176e-07f,
+    -0.0467859934f, 0.132529701f, -0.106661332f, -0.0598880258f, 0.0183422154f, 0.0123840022f, -0.00162074321f, -0.0027495825f, -6.42661514e-05f, 0.000627814903f, 0.000114837508f, -0.000138500053f, -5.20493371e-05f, 2.78571489e-05f, 1.85709856e-05f, -4.46978143e-06f, -5.86923161e-06f, 2.00480096e-07f, 1.60305443e-06f, 3.59634375e-07f,
+    0.00345952725f, 0.281868629f, -0.204901644f, -0.102077265f, 0.00295068876f, 0.00633795875f, 0.00377353254f, 0.00107196978f, 5.41893708e-05f, -0.000130401322f, -8.70442767e-05f, -2.93558408e-05f, -2.94812279e-06f, 3.40517241e-06f, 2.6093471e-06f, 9.981268e-07f, 1.39718839e-07f, -1.00346275e-07f, -9.20506291e-08f, -4.03978891e-08f,
+    -0.113637121f, 0.290122131f, 0.190389674f, -0.0613034801f, -0.0287919212f, -0.00584288304f, -0.000195900987f, 0.000892202527f, 0.000475221084f, 0.000147479568f, 7.39810295e-06f, -1.97532575e-05f, -1.3214189e-05f, -4.58360771e-06f, -4.47616406e-07f, 5.5481895e-07f, 4.28796498e-07f, 1.6480201e-07f, 2.42314061e-08f, -1.05286305e-08f,
+    -0.0609671624f, 0.125337459f, 0.12290661f, -0.0220503783f, -0.0156630711f, -0.00377705838f, -0.000497979263f, 0.000364049229f, 0.000247795834f, 9.22525158e-05f, 1.30224705e-05f, -7.47368869e-06f, -6.74001814e-06f, -2.79963664e-06f, -5.10824831e-07f, 1.9181466e-07f, 2.14117808e-07f, 9.83569197e-08f, 2.25221496e-08f, -1.40251997e-09f,
+    -0.0570529686f, 0.247517633f, 0.227699642f, -0.0831164371f, -0.00693573919f, 0.00371018422f, -0.00253492479f, 0.000730745053f, -0.000118589822f, -2.50604363e-05f, 3.41173575e-05f, -1.57198413e-05f, 4.92402958e-06f, -5.52872387e-07f, -3.89027878e-07f, 3.34923754e-07f, -1.48576867e-07f, 4.0302528e-08f, -1.95820127e-09f, -4.07045839e-09f,
+    -0.116821027f, -0.294400489f, 0.181892977f, 0.0611087621f, -0.0218236433f, 0.00433578774f, -0.000708618807f, -0.000384087151f, 0.000227279926f, -0.000100665995f, 2.37706341e-05f, -6.37667267e-07f, -3.19015593e-06f, 2.07343113e-06f, -7.83511982e-07f, 1.71483791e-07f, 1.81916156e-08f, -3.87880157e-08f, 2.2239378e-08f, -8.01050244e-09f,
+    -0.0563535973f, -0.182822259f, 0.0732628765f, 0.0412579023f, -0.0109157935f, 0.00192550422f, -0.000113583768f, -0.000281043467f, 0.000133580434f, -5.10743746e-05f, 9.11975147e-06f, 1.2991595e-06f, -2.21486054e-06f, 1.16346445e-06f, -3.77298875e-07f, 5.65310549e-08f, 2.51954562e-08f, -2.48893032e-08f, 1.20650054e-08f, -3.84773478e-09f,
+    -0.0274681129f, -0.34874952f, 0.162171192f, 0.127324301f, -0.0476332977f, -0.0121813999f, 0.0112135858f, -0.000469967309f, -0.00228525551f, 0.000709430181f, 0.0003466823f, -0.000267757635f, -1.25659782e-05f, 7.20995845e-05f, -1.71039838e-05f, -1.42446557e-05f, 8.70288163e-06f, 1.26807173e-06f, -2.70391505e-06f, 7.44174839e-07f,
+    -0.0894497883f, -0.17871068f, -0.238533051f, 0.0900910066f, 0.0371738257f, -0.0214228727f, -0.00143250335f, 0.0046062974f, -0.000887975453f, -0.000805047936f, 0.000425650151f, 7.94330858e-05f, -0.000128510074f, 1.56319467e-05f, 2.91365945e-05f, -1.24260268e-05f, -4.33351687e-06f, 4.63583509e-06f, 2.38706211e-08f, -1.47213391e-06f,
+    -0.0448402033f, -0.0589398364f, -0.144125838f, 0.0347692841f, 0.0247927614f, -0.0101548837f, -0.00193336215f, 0.0025056292f, -0.000235259798f, -0.000503327858f, 0.000190853683f, 7.02856813e-05f, -6.72262902e-05f, 8.18020458e-07f, 1.7322724e-05f, -5.1415429e-06f, -3.21870685e-06f, 2.34013501e-06f, 2.94703806e-07f, -8.62720369e-07f,
+    -0.0125212527f, -0.158813914f, -0.299778877f, 0.0315756034f, 0.0607853517f, 0.00954470464f, -0.00712862707f, -0.00426160108f, 3.17853842e-05f, 0.000939030245f, 0.000325838015f, -0.000103598752f, -0.000116570117f, -1.73039658e-05f, 2.29689264e-05f, 1.30217055e-05f, -1.07089684e-06f, -3.77415821e-06f, -1.05103834e-06f, 5.29397719e-07f,
+    -0.0912509841f, 0.318006163f, -0.109763792f, -0.133222618f, 0.000395868617f, 0.0200970514f, 0.00622850938f, -0.00175880603f, -0.0018919733f, -0.000273424818f, 0.000332574097f, 0.000184132009f, -1.32562694e-05f, -5.0423565e-05f, -1.54092676e-05f, 7.16003211e-06f, 6.74103417e-06f, 7.03074474e-07f, -1.60078935e-06f, -1.0213108e-06f,
+    -0.0473598192f, 0.18616008f, -0.0272751617f, -0.0743420858f, -0.00612798791f, 0.00972257766f, 0.00406515647f, -0.000493558813f, -0.00101232489f, -0.00024374964f, 0.000143384583f, 0.000109003716f, 5.08710821e-06f, -2.50868606e-05f, -1.06133116e-05f, 2.46052162e-06f, 3.70675075e-06f, 7.68555967e-07f, -7.44108598e-07f, -5.99886291e-07f,
+    -0.0109096201f, 0.411276446f, -0.0573824571f, -0.103955307f, -0.00512770317f, -0.000794637834f, 0.000874013578f, 0.000542695432f, 0.000154445014f, 5.08819089e-05f, 2.02045382e-06f, -2.55948383e-06f, -2.4265758e-06f, -1.00845211e-06f, -3.02746874e-07f, -5.23856133e-08f, 1.24349229e-08f, 1.38452926e-08f, 7.41158472e-09f, 2.52546532e-09f,
+    -0.132858556f, 0.112127612f, 0.254638162f, -0.0132961193f, -0.0177314972f, -0.0032933562f, -0.00156234527f, -7.37490428e-05f, 2.31635241e-05f, 4.31215289e-05f, 1.93510554e-05f, 5.90125646e-06f, 1.35188908e-06f, -1.04001447e-07f, -1.92637916e-07f, -1.19709526e-07f, -4.37173319e-08f, -1.12193918e-08f, -8.68731189e-10f, 7.9299287e-10f,
+    -0.0697173253f, 0.0169060226f, 0.14178494f, 0.00375050271f, -0.00892148476f, -0.00167347573f, -0.000924360732f, -9.59286254e-05f, -3.75445205e-06f, 1.76903597e-05f, 1.01092764e-05f, 3.41410104e-06f, 9.74042042e-07f, 4.9709059e-08f, -7.11604226e-08f, -5.83782575e-08f, -2.46115138e-08f, -7.4273128e-09f, -1.23626927e-09f, 1.59520286e-10f,
+    -0.0519364002f, 0.0183646186f, 0.305028985f, -0.0426760701f, -0.0280019764f, 0.0126115849f, -0.00340076578f, -0.000309431145f, 0.000692541499f, -0.00033208683f, 6.24451584e-05f, 2.61457325e-05f, -2.69731264e-05f, 1.06773207e-05f, -9.16561569e-07f, -1.6167974e-06f, 1.15422614e-06f, -3.54327846e-07f, -3.02061548e-08f, 8.10852585e-08f,
+    -0.0966857751f, -0.369426196f, 0.0530283117f, 0.106635697f, -0.0260429435f, 0.000252877063f, 0.00320979659f, -0.00181148522f, 0.000421711233f, 7.03477035e-05f, -0.000117006804f, 5.33293132e-05f, -8.58362134e-06f, -5.40991344e-06f, 4.8982117e-06f, -1.81563423e-06f, 8.0295894e-08f, 3.31782551e-07f, -2.25893046e-07f, 8.0091807e-08f,
+    -0.0461458011f, -0.198931846f, -0.00353240564f, 0.0613198994f, -0.0109684499f, -0.00118041093f, 0.00206647218f, -0.000933802615f, 0.000152674402f, 7.21507054e-05f, -6.89128232e-05f, 2.57139981e-05f, -1.76460855e-06f, -3.99869219e-06f, 2.70783052e-06f, -7.9966767e-07f, -7.75543854e-08f, 2.13894852e-07f, -1.17319618e-07f, 3.4256808e-08f,
+    -0.0231097338f, -0.38755618f, -0.0154423484f, 0.163209626f, -0.00128019265f, -0.0291076365f, 0.00182103098f, 0.00584528154f, -0.000756628703f, -0.00132588464f, 0.000267696301f, 0.000318382549f, -8.99776039e-05f, -7.88475033e-05f, 2.95139493e-05f, 1.98017284e-05f, -9.47321995e-06f, -5.03171383e-06f, 2.76214293e-06f, 1.52353497e-06f,
+    -0.0916237976f, 0.00270697818f, -0.287111449f, 0.00414673224f, 0.0621330318f, -0.00335950902f, -0.0112918529f, 0.00135148968f, 0.00242254382f, -0.00046447572f, -0.000563258074f, 0.00015294649f, 0.000136538663f, -4.94862752e-05f, -3.37712047e-05f, 1.5897041e-05f, 8.36881862e-06f, -5.20078539e-06f, -1.95208219e-06f, 2.09870154e-06f,
+    -0.0464523093f, 0.0418655902f, -0.151505584f, -0.0148107162f, 0.0332689218f, 0.00124418495f, -0.00621184734f, 0.000111106815f, 0.00137085139f, -0.00010941925f, -0.000328304218f, 4.83599551e-05f, 8.2200161e-05f, -1.81674332e-05f, -2.10883234e-05f, 6.41261473e-06f, 5.45109981e-06f, -2.24878e-06f, -1.3291239e-06f, 9.60334642e-07f,
+    -0.00168279419f, 0.0592572367f, -0.304170557f, -0.0578342016f, 0.0331750782f, 0.0168527494f, 0.00315859691f, -0.0014681001f, -0.00127471418f, -0.000352448333f, 7.67360209e-05f, 0.000112679355f, 4.2295867e-05f, -2.30753591e-06f, -1.06384664e-05f, -5.17552972e-06f, -3.5498254e-07f, 1.00705881e-06f, 6.54328438e-07f, 1.83598269e-07f,
+    -0.0967242156f, 0.363858059f, 0.0520466105f, -0.116236719f, -0.0296522674f, 0.00320904816f, 0.0057001539f, 0.00222961044f, 2.40321835e-05f, -0.000410658166f, -0.000213945653f, -2.47421388e-05f, 3.26643038e-05f, 2.25977539e-05f, 4.7376571e-06f, -2.57637073e-06f, -2.47327264e-06f, -7.28491975e-07f, 2.05987913e-07f, 2.79283805e-07f,
+    -0.0514074681f, 0.187863368f, 0.0594812523f, -0.0559560518f, -0.0192734311f, -4.63951311e-05f, 0.0027103973f, 0.00134215571f, 0.000145769809f, -0.000182239824f, -0.000122099028f, -2.49473276e-05f, 1.30081015e-05f, 1.22918707e-05f, 3.63615476e-06f, -8.34144461e-07f, -1.28195072e-06f, -4.93535917e-07f, 4.16045644e-08f, 1.29790267e-07f,
+    -0.0391306808f, 0.400888887f, 0.0928682756f, -0.0959583955f, -0.00309828765f, -0.00120190779f, -0.000613421833f, 0.000334557014f, -4.84134462e-05f, 3.928223e-05f, 5.26780929e-07f, 1.00661465e-06f, 6.83506967e-07f, -2.91353361e-07f, 8.53130479e-08f, -4.32863878e-08f, 1.83732393e-09f, -1.38091503e-09f, -1.00425881e-09f, 3.29073914e-10f,
+    -0.135476197f, -0.107722521f, 0.25057599f, 0.0215784353f, -0.0149244923f, 0.00111360705f, -0.00137019237f, -2.64684249e-05f, -2.88021654e-05f, -1.53742193e-05f, 8.17677989e-06f, -1.72722464e-06f, 1.12940952e-06f, -2.58105734e-08f, 3.57141989e-08f, 2.10902703e-08f, -9.12447905e-09f, 3.26847226e-09f, -1.50481484e-09f, 1.59820596e-10f,
+    -0.0681667788f, -0.0992618121f, 0.123942934f, 0.0215160977f, -0.00763586544f, 0.000719261994f, -0.00066672775f, -4.90089398e-05f, -1.0310416e-05f, -1.22961644e-05f, 4.30563678e-06f, -1.02611785e-06f, 5.31011408e-07f, 1.66229359e-08f, 1.01477655e-08f, 1.57620898e-08f, -5.05762691e-09f, 1.88709079e-09f, -6.9775715e-10f, 5.09094187e-11f,
+    -0.0377572775f, -0.201367217f, 0.286060396f, 0.0385651974f, -0.0539254579f, 0.0107518267f, 0.00388837466f, -0.00367969215f, 0.000817294032f, 0.000388618715f, -0.000349685212f, 7.40382819e-05f, 4.50902241e-05f, -3.8279321e-05f, 7.3880198e-06f, 5.71042966e-06f, -4.54820324e-06f, 7.64470012e-07f, 8.32204601e-07f, -6.69246909e-07f,
+    -0.0885714496f, -0.321912433f, -0.106151122f, 0.128037447f, -0.00562349009f, -0.0147738321f, 0.00683203924f, -0.000232535328f, -0.00123233944f, 0.000588604172f, -2.84348872e-06f, -0.000128669177f, 6.01429459e-05f, 1.73240055e-06f, -1.50460403e-05f, 6.73503721e-06f, 4.37118583e-07f, -1.84893955e-06f, 7.83095745e-07f, -1.11517854e-08f,
+    -0.0432949271f, -0.150666825f, -0.0864467428f, 0.0642577755f, 0.00262573932f, -0.00900012475f, 0.00323785025f, 0.000259801938f, -0.000742436157f, 0.000273359074f, 3.49575315e-05f, -7.63399478e-05f, 2.7370209e-05f, 4.91659352e-06f, -8.79444118e-06f, 2.99606918e-06f, 7.07510211e-07f, -1.06575059e-06f, 3.30810192e-07f, 6.3858886e-08f,
+    -0.0197642679f, -0.321918388f, -0.188200048f, 0.125268446f, 0.048564561f, -0.0168881409f, -0.0110845507f, 0.00182878157f, 0.00270716493f, -2.30395541e-05f, -0.000659122408f, -9.56936907e-05f, 0.000154757472f, 4.95756192e-05f, -3.36942702e-05f, -1.89527222e-05f, 6.33274221e-06f, 6.46276824e-06f, -8.68428441e-07f, -2.47793243e-06f,
+    -0.0916085171f, 0.181093926f, -0.240678873f, -0.0858871123f, 0.0452587598f, 0.0196250058f, -0.00563662443f, -0.00478615168f, 0.000538045043f, 0.00119120075f, 5.03788337e-05f, -0.000290332288f, -5.8240235e-05f, 6.72304295e-05f, 2.6304018e-05f, -1.40988279e-05f, -9.49883573e-06f, 2.33805764e-06f, 2.84799005e-06f, -8.16996281e-08f,
+    -0.0467913609f, 0.130154105f, -0.108717989f, -0.058868429f, 0.0190697939f, 0.0122271708f, -0.0018496685f, -0.00274311007f, 4.54510867e-06f, 0.000637645005f, 9.56186762e-05f, -0.000144846231f, -4.72009567e-05f, 3.06813405e-05f, 1.7542008e-05f, -5.54165315e-06f, -5.72609296e-06f, 5.72707239e-07f, 1.60935802e-06f, 2.14903682e-07f,
+    0.00361894561f, 0.275899281f, -0.209107511f, -0.101500444f, 0.00355838183f, 0.00668448568f, 0.00386533022f, 0.0010631684f, 3.09736528e-05f, -0.000144014672f, -9.10619709e-05f, -2.92183118e-05f, -2.01240127e-06f, 3.99180253e-06f, 2.8011336e-06f, 1.00119256e-06f, 1.01006882e-07f, -1.26877393e-07f, -1.01888937e-07f, -4.21925938e-08f,
+    -0.112991187f, 0.294309136f, 0.187099649f, -0.0630819806f, -0.0291214416f, -0.0057948785f, -7.9307034e-05f, 0.000950299979f, 0.000491200127f, 0.000145756905f, 3.08356633e-06f, -2.22328751e-05f, -1.39499975e-05f, -4.5492864e-06f, -2.70419501e-07f, 6.65308107e-07f, 4.64489725e-07f, 1.64838883e-07f, 1.64264064e-08f, -1.54942285e-08f,
+    -0.0606335305f, 0.128167956f, 0.121588128f, -0.0230521914f, -0.015900789f, -0.00378752479f, -0.000445501086f, 0.000395864922f, 0.000258712074f, 9.27508276e-05f, 1.1143423e-05f, -8.80828541e-06f, -7.22922116e-06f, -2.84240864e-06f, -4.36405035e-07f, 2.50351682e-07f, 2.37162969e-07f, 1.01139093e-07f, 1.93882059e-08f, -3.86135474e-09f,
+    -0.0568085952f, 0.253967611f, 0.224106014f, -0.0838069523f, -0.00657573789f, 0.00346885938f, -0.00246228889f, 0.000721895325f, -0.000124394318f, -1.91835177e-05f, 3.14806813e-05f, -1.4926569e-05f, 4.88606529e-06f, -6.63526099e-07f, -3.06962542e-07f, 2.99923794e-07f, -1.39943937e-07f, 4.08504172e-08f, -3.92110003e-09f, -2.94949669e-09f,
+    -0.117559562f, -0.290023015f, 0.185055081f, 0.0597015656f, -0.0215488513f, 0.00429981688f, -0.000762799958f, -0.000353738377f, 0.000213796725f, -9.77134602e-05f, 2.40446286e-05f, -1.34790488e-06f, -2.76101096e-06f, 1.91708097e-06f, -7.54363245e-07f, 1.80623498e-07f, 6.89917697e-09f, -3.27789153e-08f, 2.01820144e-08f, -7.59201038e-09f,
+    -0.0567648459f, -0.181154074f, 0.0753065242f, 0.0405792516f, -0.0108054257f, 0.0019311394f, -0.000149927978f, -0.000263941797f, 0.000126988028f, -5.01067876e-05f, 9.53846994e-06f, 8.38245273e-07f, -1.98205591e-06f, 1.09154132e-06f, -3.70260733e-07f, 6.50352954e-08f, 1.82772448e-08f, -2.17413626e-08f, 1.1171538e-08f, -3.74093621e-09f,
+    -0.0276240282f, -0.345747925f, 0.167220732f, 0.12512704f, -0.048554126f, -0.0113666535f, 0.0112187692f, -0.000701921137f, -0.00221768156f, 0.000756781945f, 0.000312353636f, -0.000271449927f, -1.09888103e-06f, 6.97039859e-05f, -1.98670483e-05f, -1.26615166e-05f, 9.07283016e-06f, 6.67089076e-07f, -2.66107137e-06f, 9.36501589e-07f,
+    -0.0893835629f, -0.184081045f, -0.235515118f, 0.0922106081f, 0.0358981928f, -0.0216085319f, -0.00103082978f, 0.00453914921f, -0.000983377453f, -0.000756797017f, 0.000439217152f, 6.09022698e-05f, -0.000126931514f, 2.07646557e-05f, 2.70747295e-05f, -1.33606406e-05f, -3.40582716e-06f, 4.62363302e-06f, -2.59173575e-07f, -1.33695864e-06f,
+    -0.0447829912f, -0.0620952392f, -0.143036507f, 0.0361196412f, 0.0242083053f, -0.0103373378f, -0.00172002338f, 0.00249379486f, -0.00029305707f, -0.00048251992f, 0.000201635252f, 6.07942711e-05f, -6.7573589e-05f, 3.8016766e-06f, 1.6510523e-05f, -5.80394325e-06f, -2.76267397e-06f, 2.39603554e-06f, 1.39390353e-07f, -8.10648681e-07f,
+    -0.0127640296f, -0.165055309f, -0.297830247f, 0.0347635214f, 0.0611500869f, 0.00890376224f, -0.00747543115f, -0.0042182893f, 0.000144855559f, 0.000970722826f, 0.000305850523f, -0.000120621396f, -0.000117454965f, -1.26530857e-05f, 2.50782921e-05f, 1.24785435e-05f, -1.92304949e-06f, -3.95582185e-06f, -8.52465875e-07f, 6.96241526e-07f,
+    -0.0912172674f, 0.314931955f, -0.114676877f, -0.132762216f, 0.00176866935f, 0.0204792126f, 0.00601402167f, -0.00194598335f, -0.00190420063f, -0.00022536038f, 0.00035487822f, 0.000178998079f, -2.17830104e-05f, -5.22914475e-05f, -1.36334161e-05f, 8.4186465e-06f, 6.71334904e-06f, 3.24268741e-07f, -1.7316725e-06f, -9.73117191e-07f,
+    -0.0473113074f, 0.185160856f, -0.030082151f, -0.0744233093f, -0.0054361356f, 0.00999185078f, 0.00398688429f, -0.000597649874f, -0.00103054355f, -0.000221443832f, 0.000157334836f, 0.000108035894f, 6.37240273e-07f, -2.65648838e-05f, -9.88638121e-06f, 3.18752311e-06f, 3.78057276e-06f, 5.85601908e-07f, -8.34498573e-07f, -5.91557606e-07f,
+    -0.0100756711f, 0.409171677f, -0.0623098346f, -0.104160702f, -0.00510865386f, -0.000690214254f, 0.000940506035f, 0.000561803929f, 0.000160743634f, 5.05883695e-05f, 1.3196641e-06f, -3.08877208e-06f, -2.64108451e-06f, -1.06827259e-06f, -3.09428191e-07f, -4.64756555e-08f, 1.7059022e-08f, 1.61010566e-08f, 8.14945052e-09f, 2.69131251e-09f,
+    -0.132427512f, 0.118881603f, 0.253709789f, -0.0145777343f, -0.017991909f, -0.00343086977f, -0.0015623435f, -6.69840309e-05f, 3.03619203e-05f, 4.63719961e-05f, 2.03052862e-05f, 6.08786305e-06f, 1.29334931e-06f, -1.59998333e-07f, -2.23944656e-07f, -1.3059037e-07f, -4.61066325e-08f, -1.10495313e-08f, -3.64880477e-10f, 1.06357264e-09f,
+    -0.069567169f, 0.0207069284f, 0.141792674f, 0.003092851f, -0.00906123238f, -0.00175750011f, -0.000931245939f, -9.43299505e-05f, -5.79632772e-07f, 1.94502682e-05f, 1.06901545e-05f, 3.56861118e-06f, 9.65219407e-07f, 2.61303471e-08f, -8.71371149e-08f, -6.47889863e-08f, -2.63661938e-08f, -7.5719737e-09f, -1.04478414e-09f, 2.86375221e-10f,
+    -0.0522694168f, 0.0259986281f, 0.303884789f, -0.0446569581f, -0.0270975354f, 0.0123833234f, -0.00347084446f, -0.000220676198f, 0.000652562367f, -0.000326894989f, 6.82331425e-05f, 2.13284611e-05f, -2.52480592e-05f, 1.06970421e-05f, -1.33015034e-06f, -1.35713084e-06f, 1.0852993e-06f, -3.71970267e-07f, -1.29804209e-09f, 6.58105068e-08f,
+    -0.0971754051f, -0.368993814f, 0.0579018194f, 0.105334604f, -0.0262004353f, 0.000580488827f, 0.0030317045f, -0.00177693034f, 0.000438099169f, 5.2134667e-05f, -0.000109346144f, 5.26315134e-05f, -9.90242871e-06f, -4.41140084e-06f, 4.56899542e-06f, -1.83866321e-06f, 1.72062534e-07f, 2.78616534e-07f, -2.12915481e-07f, 8.19383488e-08f,
+    -0.046365296f, -0.199479125f, -0.000827705998f, 0.0608286902f, -0.0111444491f, -0.000982353235f, 0.00197876736f, -0.000924530385f, 0.000165537921f, 6.19048994e-05f, -6.54276932e-05f, 2.58407692e-05f, -2.6464431e-06f, -3.46838303e-06f, 2.57520049e-06f, -8.38886833e-07f, -2.1473337e-08f, 1.8737966e-07f, -1.13402365e-07f, 3.68280332e-08f,
+    -0.0231468318f, -0.387960208f, -0.00951149708f, 0.163196943f, -0.0030595423f, -0.0289861072f, 0.00231115912f, 0.00577453313f, -0.000898038682f, -0.00129418686f, 0.000308810267f, 0.00030553587f, -0.000101894377f, -7.39184089e-05f, 3.29255193e-05f, 1.79702954e-05f, -1.04263399e-05f, -4.3477658e-06f, 3.0056635e-06f, 1.21157955e-06f,
+    -0.091596308f, -0.00327893518f, -0.287035164f, 0.0072229149f, 0.061951495f, -0.00417854707f, -0.0111822917f, 0.00158249264f, 0.00237328841f, -0.000530932247f, -0.000543308556f, 0.000172088484f, 0.000128897115f, -5.4949881e-05f, -3.0951029e-05f, 1.74279985e-05f, 7.36588221e-06f, -5.62168461e-06f, -1.63572984e-06f, 2.23194558e-06f,
+    -0.046428185f, 0.0387292386f, -0.152068178f, -0.0131749788f, 0.0333545664f, 0.00079595422f, -0.00620403547f, 0.000241393813f, 0.00135923996f, -0.000148093244f, -0.000321935744f, 5.98885126e-05f, 7.93646745e-05f, -2.15897926e-05f, -1.99396865e-05f, 7.41854458e-06f, 5.01562483e-06f, -2.54413261e-06f, -1.18583236e-06f, 1.06377048e-06f,
+    -0.00195208113f, 0.0519058817f, -0.305711229f, -0.0555565095f, 0.0342955963f, 0.0169929027f, 0.00296073325f, -0.00160908909f, -0.00130421883f, -0.000333725061f, 9.47387036e-05f, 0.000118044313f, 4.06973437e-05f, -4.60940459e-06f, -1.15330598e-05f, -5.0825423e-06f, -6.67034745e-08f, 1.14530742e-06f, 6.54824061e-07f, 1.51514997e-07f,
+    -0.0964005624f, 0.364102726f, 0.046971262f, -0.117561236f, -0.0291910753f, 0.00372292797f, 0.00588110099f, 0.00220220578f, -3.48577025e-05f, -0.000436853545f, -0.000213727256f, -1.7933674e-05f, 3.64666943e-05f, 2.29930021e-05f, 3.97041925e-06f, -3.11921852e-06f, -2.5830151e-06f, -6.47745654e-07f, 2.853642e-07f, 3.11338537e-07f,
+    -0.0512016794f, 0.188739807f, 0.0569435841f, -0.0568918907f, -0.019144035f, 0.00021224368f, 0.00282712171f, 0.00134218804f, 0.000117489303f, -0.000198127968f, -0.000123852443f, -2.18792105e-05f, 1.51992827e-05f, 1.27417039e-05f, 3.32049814e-06f, -1.13299836e-06f, -1.3704063e-06f, -4.64900491e-07f, 8.38457277e-08f, 1.50209563e-07f,
+    -0.0382050277f, 0.403484374f, 0.08825044f, -0.096224069f, -0.00314283412f, -0.00126241148f, -0.00057147516f, 0.000329210469f, -4.28475228e-05f, 3.9517504e-05f, 6.37027043e-07f, 1.14441229e-06f, 6.16356576e-07f, -2.74026742e-07f, 7.50809631e-08f, -4.3189449e-08f, 1.5705546e-09f, -1.6936903e-09f, -8.755649e-10f, 2.81252785e-10f,
+    -0.135772415f, -0.100874169f, 0.251660389f, 0.020491434f, -0.0148507353f, 0.000984540158f, -0.00137570988f, -2.85397975e-05f, -3.11157908e-05f, -1.39100497e-05f, 7.9045929e-06f, -1.51321587e-06f, 1.13047384e-06f, -2.02473052e-08f, 4.11190353e-08f, 1.85135919e-08f, -8.30575852e-09f, 2.84506255e-09f, -1.48005586e-09f, 1.41159411e-10f,
+    -0.068412889f, -0.095889286f, 0.124986667f, 0.0209664353f, -0.00759099894f, 0.000656735664f, -0.000673953414f, -4.95660164e-05f, -1.21216678e-05f, -1.15405419e-05f, 4.14854634e-06f, -9.26323062e-07f, 5.38502118e-07f, 1.77932611e-08f, 1.4092564e-08f, 1.43784148e-08f, -4.59280477e-09f, 1.69382481e-09f, -6.97868063e-10f, 4.59282036e-11f,
+    -0.0381201608f, -0.195266104f, 0.288338781f, 0.0356011235f, -0.0534174376f, 0.0111619849f, 0.00355025196f, -0.00362031351f, 0.000875510767f, 0.000343746331f, -0.000342710684f, 8.2659253e-05f, 3.88110793e-05f, -3.74499097e-05f, 8.69998708e-06f, 4.80772031e-06f, -4.44852796e-06f, 9.62674985e-07f, 6.99271825e-07f, -6.39068922e-07f,
+    -0.08866533f, -0.325073745f, -0.101207822f, 0.128164562f, -0.0067330871f, -0.0142797757f, 0.0068630249f, -0.000375258237f, -0.00117006567f, 0.000595092887f, -2.28061146e-05f, -0.00012034138f, 6.13612966e-05f, -1.17600698e-06f, -1.3897968e-05f, 6.9564426e-06f, 2.62660668e-09f, -1.69101421e-06f, 8.31909708e-07f, -8.33896134e-08f,
+    -0.0433011807f, -0.1529653f, -0.0840530563f, 0.0646268014f, 0.00198324556f, -0.00877908087f, 0.00328915997f, 0.000177643099f, -0.000715268532f, 0.000281456744f, 2.35974986e-05f, -7.2794698e-05f, 2.86703243e-05f, 3.28044665e-06f, -8.31861723e-06f, 3.2077674e-06f, 4.65561394e-07f, -1.00215082e-06f, 3.70639647e-07f, 2.22145677e-08f,
+    -0.0198509458f, -0.325542389f, -0.183380296f, 0.127505168f, 0.0474081935f, -0.0176581673f, -0.0108880489f, 0.00208387102f, 0.00269030731f, -0.000102473223f, -0.000667080648f, -7.25903516e-05f, 0.000161065776f, 4.34173967e-05f, -3.67040165e-05f, -1.75195093e-05f, 7.5188819e-06f, 6.21974252e-06f, -1.25287591e-06f, -2.48785062e-06f,
+    -0.0916459489f, 0.175862727f, -0.243558156f, -0.083481182f, 0.0463835107f, 0.0191529818f, -0.00602572077f, -0.00471270124f, 0.00066507402f, 0.00118992169f, 1.15400933e-05f, -0.000296373835f, -4.72097901e-05f, 7.09573545e-05f, 2.34618566e-05f, -1.57560274e-05f, -8.86891454e-06f, 2.98853152e-06f, 2.74176889e-06f, -3.68162917e-07f,
+    -0.0467967972f, 0.127744696f, -0.110737065f, -0.0578188342f, 0.0197861369f, 0.0120553932f, -0.00207696585f, -0.0027303763f, 7.39162358e-05f, 0.000645190175f, 7.57597442e-05f, -0.000150459964f, -4.19798663e-05f, 3.33059698e-05f, 1.63403552e-05f, -6.5734641e-06f, -5.51369696e-06f, 9.4456697e-07f, 1.59271522e-06f, 6.32799796e-08f,
+    0.00375760442f, 0.269842193f, -0.213260114f, -0.100879605f, 0.00419015112f, 0.00703595058f, 0.00395418366f, 0.0010509843f, 5.99584181e-06f, -0.000158020893f, -9.49240955e-05f, -2.88687123e-05f, -9.6400685e-07f, 4.60659101e-06f, 2.98530599e-06f, 9.91991766e-07f, 5.54779575e-08f, -1.55236452e-07f, -1.11380891e-07f, -4.34222247e-08f,
+    -0.112349622f, 0.298383511f, 0.183735452f, -0.0648679677f, -0.0294409063f, -0.00573458576f, 4.29439901e-05f, 0.0010095336f, 0.000506487129f, 0.000143250941f, -1.62242889e-06f, -2.47979738e-05f, -1.46495401e-05f, -4.46812697e-06f, -6.87549471e-08f, 7.81727374e-07f, 4.98441952e-07f, 1.62185564e-07f, 7.07653388e-09f, -2.09946621e-08f,
+    -0.0603001382f, 0.130947534f, 0.12022517f, -0.0240624457f, -0.0161356652f, -0.00379198329f, -0.000389717747f, 0.000428633994f, 0.000269443134f, 9.28735938e-05f, 9.0401386e-06f, -1.02103432e-05f, -7.71083269e-06f, -2.86318856e-06f, -3.48175952e-07f, 3.13319042e-07f, 2.59990133e-07f, 1.026794e-07f, 1.53958654e-08f, -6.66369658e-09f,
+    -0.0565394319f, 0.260331315f, 0.220460953f, -0.0844695201f, -0.0062342847f, 0.00323318486f, -0.00238973673f, 0.000711984412f, -0.00012930039f, -1.36954547e-05f, 2.89507572e-05f, -1.41241156e-05f, 4.82020044e-06f, -7.5572557e-07f, -2.32380138e-07f, 2.66480295e-07f, -1.30896657e-07f, 4.07748201e-08f, -5.51623471e-09f, -1.96905038e-09f,
+    -0.118296021f, -0.285536056f, 0.18815143f, 0.0583045694f, -0.0212734489f, 0.00425738519f, -0.000813497718f, -0.000324919881f, 0.000200585867f, -9.46472643e-05f, 2.41769241e-05f, -1.97779263e-06f, -2.35944258e-06f, 1.76426041e-06f, -7.21913609e-07f, 1.86704845e-07f, -2.87074745e-09f, -2.72321225e-08f, 1.81516609e-08f, -7.12102714e-09f,
+    -0.0571775139f, -0.179419408f, 0.0773204008f, 0.0399033163f, -0.0106928507f, 0.00193276064f, -0.000184405522f, -0.000247547891f, 0.000120448897f, -4.9038737e-05f, 9.87064897e-06f, 4.19235242e-07f, -1.76108621e-06f, 1.01959858e-06f, -3.60690442e-07f, 7.17478489e-08f, 1.21281998e-08f, -1.8775537e-08f, 1.0254449e-08f, -3.59160786e-09f,
+    -0.0277859324f, -0.34263984f, 0.172209876f, 0.122877887f, -0.0494307045f, -0.0105472867f, 0.0112046109f, -0.000928926889f, -0.00214453171f, 0.000800387564f, 0.000277260978f, -0.000273527394f, 1.00975593e-05f, 6.68241116e-05f, -2.23715835e-05f, -1.09946791e-05f, 9.32331086e-06f, 7.88838125e-08f, -2.58031343e-06f, 1.10468252e-06f,
+    -0.0893184732f, -0.18940756f, -0.232414946f, 0.0942777647f, 0.034605731f, -0.0217664608f, -0.000632394735f, 0.00446243936f, -0.0010742634f, -0.000706553744f, 0.000450454837f, 4.243936e-05f, -0.000124540564f, 2.56005231e-05f, 2.48246982e-05f, -1.41285625e-05f, -2.46682552e-06f, 4.55050598e-06f, -5.29618653e-07f, -1.18423604e-06f,
+    -0.0447257549f, -0.0652380273f, -0.141897686f, 0.0374473832f, 0.0236104544f, -0.0105055258f, -0.00150643508f, 0.00247636897f, -0.00034902301f, -0.000460267038f, 0.000211255519f, 5.11727417e-05f, -6.74604346e-05f, 6.67722283e-06f, 1.55714188e-05f, -6.38620921e-06f, -2.28826498e-06f, 2.4181601e-06f, -1.31351179e-08f, -7.46728368e-07f,
+    -0.0130024109f, -0.1712332f, -0.295774667f, 0.0379516657f, 0.0614714424f, 0.00824198895f, -0.00781476977f, -0.00416390691f, 0.000260038423f, 0.000999350166f, 0.000283791244f, -0.000137455597f, -0.000117537885f, -7.72619461e-06f, 2.7029419e-05f, 1.1774592e-05f, -2.78938517e-06f, -4.09070223e-06f, -6.31145359e-07f, 8.59937408e-07f,
+    -0.091189122f, 0.31176995f, -0.119552123f, -0.132235118f, 0.00315580821f, 0.0208416385f, 0.00578501274f, -0.00213217029f, -0.00191069942f, -0.000175164608f, 0.000376068137f, 0.00017263809f, -3.04454321e-05f, -5.37931547e-05f, -1.16554305e-05f, 9.63741599e-06f, 6.59918354e-06f, -7.78909538e-08f, -1.84098816e-06f, -9.03992704e-07f,
+    -0.0472662102f, 0.184108942f, -0.0328797538f, -0.074469263f, -0.00473227872f, 0.0102527797f, 0.00390013672f, -0.000702351748f, -0.0010459348f, -0.000197688914f, 0.000170906273f, 0.000106396389f, -3.9677121e-06f, -2.7876595e-05f, -9.03549065e-06f, 3.90996572e-06f, 3.80982552e-06f, 3.85365305e-07f, -9.1576284e-07f, -5.71756631e-07f,
+    -0.00925817596f, 0.406920156f, -0.0672358041f, -0.104357048f, -0.00507925435f, -0.000578896974f, 0.00100892891f, 0.000581516152f, 0.000166884531f, 5.01374954e-05f, 5.15913935e-07f, -3.6583528e-06f, -2.86532966e-06f, -1.1278822e-06f, -3.13952144e-07f, -3.91730902e-08f, 2.23072566e-08f, 1.85341648e-08f, 8.90413029e-09f, 2.8434013e-09f,
+    -0.13197875f, 0.125589854f, 0.252710555f, -0.0158745913f, -0.0182615495f, -0.00356723399f, -0.00156105548f, -5.91701895e-05f, 3.80360208e-05f, 4.97503473e-05f, 2.12747473e-05f, 6.25479906e-06f, 1.2204454e-06f, -2.2337125e-07f, -2.57630822e-07f, -1.41843665e-07f, -4.83239167e-08f, -1.06860213e-08f, 2.43127733e-10f, 1.37323387e-09f,
+    -0.0694059498f, 0.02449821f, 0.141762916f, 0.00242627432f, -0.00920695491f, -0.00184162407f, -0.000937651415f, -9.22370806e-05f, 2.86410216e-06f, 2.12944662e-05f, 1.1289848e-05f, 3.71685553e-06f, 9.49775025e-07f, -1.39325558e-09f, -1.04603935e-07f, -7.15429222e-08f, -2.80943654e-08f, -7.63206434e-09f, -7.99621136e-10f, 4.35464459e-10f,
+    -0.0525928865f, 0.0336412407f, 0.302639154f, -0.046591775f, -0.0262015078f, 0.0121450148f, -0.00353146029f, -0.000135783977f, 0.000612617153f, -0.000320634887f, 7.32698633e-05f, 1.6739849e-05f, -2.34759831e-05f, 1.06226133e-05f, -1.6917114e-06f, -1.10792805e-06f, 1.00970121e-06f, -3.82272428e-07f, 2.42015449e-08f, 5.13171065e-08f,
+    -0.0976785457f, -0.368431334f, 0.0627404165f, 0.104010186f, -0.0263314671f, 0.000894437255f, 0.00285502898f, -0.00173957162f, 0.000452056093f, 3.48270913e-05f, -0.000101644669f, 5.16563785e-05f, -1.10408041e-05f, -3.46207967e-06f, 4.2250425e-06f, -1.83844154e-06f, 2.51906778e-07f, 2.27320353e-07f, -1.97962376e-07f, 8.20581178e-08f,
+    -0.0465929162f, -0.199958509f, 0.0018685428f, 0.0603205083f, -0.0113055088f, -0.000790550194f, 0.00189085366f, -0.000913369837f, 0.000177102788f, 5.20319268e-05f, -6.18435995e-05f, 2.5796212e-05f, -3.43696109e-06f, -2.95458225e-06f, 2.4293464e-06f, -8.64632533e-07f, 2.89422001e-08f, 1.61102189e-07f, -1.08079411e-07f, 3.83978782e-08f,
+    -0.0231851158f, -0.38825551f, -0.00357755337f, 0.163105796f, -0.0048334051f, -0.0288318185f, 0.00279607178f, 0.00569108418f, -0.0010363067f, -0.00125786299f, 0.000348334935f, 0.000291082638f, -0.000113082941f, -6.84555307e-05f, 3.6025137e-05f, 1.59695237e-05f, -1.12539435e-05f, -3.61237339e-06f, 3.20583155e-06f, 8.82035034e-07f,
+    -0.0915663716f, -0.00926699878f, -0.286859366f, 0.0102932109f, 0.0617244924f, -0.00499085369f, -0.0110546061f, 0.00180921472f, 0.00231730067f, -0.000595163358f, -0.000520989321f, 0.000190192654f, 0.000120459275f, -5.9962001e-05f, -2.78755571e-05f, 1.87712002e-05f, 6.28556004e-06f, -5.96462903e-06f, -1.29860525e-06f, 2.32601898e-06f,
+    -0.0464026315f, 0.0355810384f, -0.152578454f, -0.0115345081f, 0.0334155392f, 0.00034797005f, -0.00618606106f, 0.00037070475f, 0.00134372599f, -0.000186058783f, -0.000314142833f, 7.10302882e-05f, 7.60302382e-05f, -2.48269088e-05f, -1.86229021e-05f, 8.3420065e-06f, 4.52595966e-06f, -2.80329341e-06f, -1.02699063e-06f, 1.14816448e-06f,
+    -0.00222596226f, 0.0445574519f, -0.30714508f, -0.0532291907f, 0.035413844f, 0.0171129249f, 0.00275076956f, -0.00175114072f, -0.00133049255f, -0.00031264106f, 0.000113192521f, 0.000122955467f, 3.86805151e-05f, -7.02906554e-06f, -1.23725474e-05f, -4.92021347e-06f, 2.47325115e-07f, 1.27825129e-06f, 6.43622637e-07f, 1.12862441e-07f,
+    -0.0960886009f, 0.364226879f, 0.0418692642f, -0.118845682f, -0.0286953172f, 0.00424651196f, 0.00605623084f, 0.0021680002f, -9.61778538e-05f, -0.000462402521f, -0.000212346737f, -1.06075742e-05f, 4.02299918e-05f, 2.32061436e-05f, 3.10377215e-06f, -3.66765997e-06f, -2.66642708e-06f, -5.49702677e-07f, 3.67179734e-07f, 3.40596539e-07f,
+    -0.0510016582f, 0.189552169f, 0.054381189f, -0.0578115645f, -0.0189960975f, 0.000478094575f, 0.00294200232f, 0.00133871779f, 8.75839828e-05f, -0.000213916433f, -0.000125034596f, -1.84888167e-05f, 1.74129951e-05f, 1.31068542e-05f, 2.94622881e-06f, -1.44202195e-06f, -1.44751906e-06f, -4.26507134e-07f, 1.286e-07f, 1.69822232e-07f,
+    -0.0372683967f, 0.405935684f, 0.0836147722f, -0.0964874668f, -0.00319236215f, -0.00131831457f, -0.000530003039f, 0.00032455574f, -3.72223251e-05f, 3.97565052e-05f, 7.72596067e-07f, 1.26779381e-06f, 5.52362461e-07f, -2.58943116e-07f, 6.477474e-08f, -4.31274362e-08f, 1.21367239e-09f, -1.96575507e-09f, -7.6080356e-10f, 2.39911788e-10f,
+    -0.136045481f, -0.0939889317f, 0.252682755f, 0.0194077144f, -0.0147869261f, 0.00085463294f, -0.00138121045f, -3.09199716e-05f, -3.31906574e-05f, -1.24831593e-05f, 7.66923172e-06f, -1.29763113e-06f, 1.13206294e-06f, -1.34023069e-08f, 4.58363338e-08f, 1.61256258e-08f, -7.59968607e-09f, 2.42329314e-09f, -1.45817901e-09f, 1.19066565e-10f,
+    -0.0686478332f, -0.0924829329f, 0.125999395f, 0.0204184152f, -0.00755092095f, 0.000593298783f, -0.000681122873f, -5.03593516e-05f, -1.38119535e-05f, -1.08053538e-05f, 4.0084684e-06f, -8.24215324e-07f, 5.45947812e-07f, 1.98792941e-08f, 1.76786712e-08f, 1.30992658e-08f, -4.17870615e-09f, 1.4972505e-09f, -6.98073137e-10f, 3.84462139e-11f,
+    -0.0384877379f, -0.189086501f, 0.290510696f, 0.0326452171f, -0.0528762467f, 0.0115479905f, 0.00321410764f, -0.00355371192f, 0.000928932429f, 0.000299163314f, -0.000334311915f, 9.03898664e-05f, 3.25649996e-05f, -3.63518595e-05f, 9.85300399e-06f, 3.9068389e-06f, -4.29949523e-06f, 1.1339514e-06f, 5.64436205e-07f, -5.99830127e-07f,
+    -0.0887686481f, -0.328140076f, -0.0962342746f, 0.128230325f, -0.00781767012f, -0.0137782099f, 0.00688045967f, -0.000512856308f, -0.00110611608f, 0.000598914289f, -4.18263188e-05f, -0.000111667442f, 6.20812796e-05f, -3.91962227e-06f, -1.26814309e-05f, 7.08747707e-06f, -4.03484037e-07f, -1.52035711e-06f, 8.63964386e-07f, -1.48211399e-07f,
+    -0.0433119406f, -0.155221424f, -0.081632798f, 0.0649624565f, 0.00135070575f, -0.00855159209f, 0.00333305859f, 9.74734809e-05f, -0.000686717448f, 0.000288104522f, 1.25928771e-05f, -6.89734305e-05f, 2.97015818e-05f, 1.7043689e-06f, -7.78991002e-06f, 3.37113103e-06f, 2.33631476e-07f, -9.28982349e-07f, 4.01736223e-07f, -1.6415981e-08f,
+    -0.0199338407f, -0.3290707f, -0.178496414f, 0.12968446f, 0.0462119529f, -0.0184118613f, -0.0106721141f, 0.00233602174f, 0.00266535977f, -0.000182243165f, -0.00067204707f, -4.88280812e-05f, 0.000166383757f, 3.6841823e-05f, -3.9425201e-05f, -1.58832613e-05f, 8.63490662e-06f, 5.88852706e-06f, -1.62488374e-06f, -2.45474495e-06f,
+    -0.0916826362f, 0.170586572f, -0.246353033f, -0.0810304986f, 0.0474781368f, 0.0186562656f, -0.00640716217f, -0.00462802598f, 0.000791167109f, 0.00118418726f, -2.77445749e-05f, -0.000300833022f, -3.57335909e-05f, 7.41825318e-05f, 2.0368905e-05f, -1.72760552e-05f, -8.12569538e-06f, 3.61117732e-06f, 2.59480523e-06f, -6.54241388e-07f,
+    -0.0468022205f, 0.12530212f, -0.112717869f, -0.0567397879f, 0.020490544f, 0.0118688483f, -0.00230218353f, -0.00271137646f, 0.000143620774f, 0.00065040065f, 5.53553649e-05f, -0.000155299791f, -3.64193305e-05f, 3.57066865e-05f, 1.49753739e-05f, -7.55325936e-06f, -5.23372344e-06f, 1.31074403e-06f, 1.5530891e-06f, -9.25988538e-08f,
+    0.00387585597f, 0.263700108f, -0.217357386f, -0.100213729f, 0.00484596765f, 0.00739188526f, 0.00403970534f, 0.00103524423f, -2.07555456e-05f, -0.000172375198f, -9.85911182e-05f, -2.82895107e-05f, 1.99102859e-07f, 5.24606339e-06f, 3.15863561e-06f, 9.69049089e-07f, 2.91317603e-09f, -1.85178733e-07f, -1.20274611e-07f, -4.39604005e-08f,
+    -0.111712986f, 0.302343976f, 0.180297745f, -0.0666603942f, -0.0297493476f, -0.00566162238f, 0.000170850454f, 0.00106976163f, 0.00052096669f, 0.000139913267f, -6.72296542e-06f, -2.74364141e-05f, -1.53025138e-05f, -4.33568861e-06f, 1.57847344e-07f, 9.03196646e-07f, 5.29863842e-07f, 1.56492459e-07f, -3.87154453e-09f, -2.69976802e-08f,
+    -0.0599673178f, 0.133675251f, 0.118817878f, -0.0250806927f, -0.0163671847f, -0.00379018352f, -0.000330590239f, 0.000462299126f, 0.000279928978f, 9.25904933e-05f, 6.70689187e-06f, -1.16752283e-05f, -8.17959014e-06f, -2.85925627e-06f, -2.45552949e-07f, 3.80401855e-07f, 2.82202285e-07f, 1.02766516e-07f, 1.04906052e-08f, -9.80551827e-09f,
+    -0.0562453793f, 0.2666061f, 0.216766041f, -0.0851051718f, -0.00591109875f, 0.00300326723f, -0.00231742595f, 0.000701130931f, -0.000133356365f, -8.58576649e-06f, 2.65324167e-05f, -1.33187215e-05f, 4.730186e-06f, -8.30883727e-07f, -1.65083348e-07f, 2.34769261e-07f, -1.21615713e-07f, 4.0172549e-08f, -6.77749692e-09f, -1.12237712e-09f,
+    -0.119029631f, -0.280941332f, 0.191181858f, 0.0569181292f, -0.020998064f, 0.00420881978f, -0.000860848657f, -0.000297621809f, 0.000187674957f, -9.14923771e-05f, 2.4180824e-05f, -2.5314212e-06f, -1.98541521e-06f, 1.61595654e-06f, -6.86922763e-07f, 1.9008136e-07f, -1.12112375e-08f, -2.21582197e-08f, 1.61773059e-08f, -6.61499451e-09f,
+    -0.0575912023f, -0.177618907f, 0.0793042682f, 0.0392303893f, -0.0105784306f, 0.0019305316f, -0.000217073287f, -0.000231868528f, 0.000113982669f, -4.78846065e-05f, 1.01228879e-05f, 4.05863278e-08f, -1.55231678e-06f, 9.48307515e-07f, -3.49013367e-07f, 7.6839145e-08f, 6.71727425e-09f, -1.60074367e-08f, 9.33268879e-09f, -3.40974637e-09f,
+    -0.0279539176f, -0.339425667f, 0.17713676f, 0.120578376f, -0.0502624857f, -0.00972454283f, 0.0111713427f, -0.00115043793f, -0.00206613872f, 0.000840123321f, 0.000241600958f, -0.000274010498f, 2.09475113e-05f, 6.34963871e-05f, -2.45999038e-05f, -9.26508084e-06f, 9.45469586e-06f, -4.88690804e-07f, -2.46398975e-06f, 1.24660407e-06f,
+    -0.0892547177f, -0.194688669f, -0.22923364f, 0.0962914521f, 0.033297821f, -0.0218966678f, -0.00023797282f, 0.00437649351f, -0.00116038757f, -0.0006545657f, 0.000459348206f, 2.41576827e-05f, -0.00012137313f, 3.01056642e-05f, 2.24136217e-05f, -1.47260207e-05f, -1.52881492e-06f, 4.41963444e-06f, -7.83588458e-07f, -1.0174737e-06f,
+    -0.0446685899f, -0.0683673473f, -0.140709774f, 0.0387518175f, 0.0229998857f, -0.0106593268f, -0.00129303191f, 0.00245346906f, -0.000402993162f, -0.000436688216f, 0.000219686402f, 4.14834704e-05f, -6.68981528e-05f, 9.42288769e-06f, 1.45180274e-05f, -6.88417893e-06f, -1.80206741e-06f, 2.40739274e-06f, -1.60566779e-07f, -6.72609115e-07f,
+    -0.0132362917f, -0.177346188f, -0.293612935f, 0.0411380778f, 0.0617486625f, 0.00756015965f, -0.00814581372f, -0.00409841544f, 0.000376961072f, 0.00102471354f, 0.000259727914f, -0.000153985526f, -0.00011679321f, -2.55842054e-06f, 2.87961338e-05f, 1.09118832e-05f, -3.65871464e-06f, -4.17457196e-06f, -3.89863607e-07f, 1.01708237e-06f,
+    -0.0911663145f, 0.30852142f, -0.124387681f, -0.131641273f, 0.0045559948f, 0.0211835322f, 0.00554175975f, -0.0023168257f, -0.00191133052f, -0.000123014192f, 0.000395999124f, 0.000165058844f, -3.91806959e-05f, -5.49026717e-05f, -9.48842868e-06f, 1.08003321e-05f, 6.39641723e-06f, -4.98486325e-07f, -1.9259757e-06f, -8.14125773e-07f,
+    -0.0472244138f, 0.183004876f, -0.0356669174f, -0.0744797248f, -0.00401702409f, 0.010504864f, 0.0038049764f, -0.000807381229f, -0.00105838667f, -0.000172558354f, 0.000184015053f, 0.000104076907f, -8.69698842e-06f, -2.90045432e-05f, -8.06491624e-06f, 4.61912538e-06f, 3.7922254e-06f, 1.70025794e-07f, -9.86144377e-07f, -5.40231512e-07f,
+    -0.0084577659f, 0.404522759f, -0.0721593222f, -0.104543544f, -0.00503893194f, -0.000460545966f, 0.00107931486f, 0.000601792995f, 0.000172838117f, 4.95118437e-05f, -3.97214469e-07f, -4.26930754e-06f, -3.09882359e-06f, -1.18662108e-06f, -3.15944525e-07f, -3.03247306e-08f, 2.82144485e-08f, 2.1139863e-08f, 9.66506368e-09f, 2.9756252e-09f,
+    -0.131512881f, 0.132249739f, 0.251639975f, -0.0171870629f, -0.0185401904f, -0.00370226358f, -0.00155835222f, -5.02494146e-05f, 4.61981939e-05f, 5.32552378e-05f, 2.22542784e-05f, 6.39883207e-06f, 1.13164754e-06f, -2.9455166e-07f, -2.93707814e-07f, -1.53388179e-07f, -5.03045995e-08f, -1.00978015e-08f, 9.66024355e-10f, 1.72427194e-09f,
+    -0.069233929f, 0.028278398f, 0.14169531f, 0.0017504919f, -0.0093585901f, -0.0019257643f, -0.000943512193f, -8.96151819e-05f, 6.5863781e-06f, 2.32240544e-05f, 1.19062842e-05f, 3.85723092e-06f, 9.26845632e-07f, -3.31595401e-08f, -1.23605881e-07f, -7.86128354e-08f, -2.97653229e-08f, -7.59057739e-09f, -4.93974612e-10f, 6.08644642e-10f,
+    -0.0529061827f, 0.0412895158f, 0.301293224f, -0.0484802783f, -0.0253149068f, 0.0118974417f, -0.00358287127f, -5.48396094e-05f, 0.000572869078f, -0.000313404725f, 7.75765094e-05f, 1.23959371e-05f, -2.16757257e-05f, 1.04630402e-05f, -2.00209293e-06f, -8.71301247e-07f, 9.29216638e-07f, -3.85887306e-07f, 4.62377773e-08f, 3.7789722e-08f,
+    -0.0981950564f, -0.367738366f, 0.0675423296f, 0.10266395f, -0.0264367306f, 0.0011946019f, 0.00268013866f, -0.0016996741f, 0.000463659639f, 1.84556799e-05f, -9.39522405e-05f, 5.04318403e-05f, -1.20038336e-05f, -2.56691047e-06f, 3.87158905e-06f, -1.8173055e-06f, 3.19961062e-07f, 1.78501972e-07f, -1.81540494e-07f, 8.06741394e-08f,
+    -0.0468286512f, -0.200369503f, 0.00455529143f, 0.0597961306f, -0.0114518955f, -0.000605144587f, 0.00180295335f, -0.00090045341f, 0.000187393726f, 4.25581563e-05f, -5.81892649e-05f, 2.5593563e-05f, -4.13694166e-06f, -2.4608572e-06f, 2.27314524e-06f, -8.7793237e-07f, 7.35790681e-08f, 1.3545368e-07f, -1.0161516e-07f, 3.90661571e-08f,
+    -0.0232247616f, -0.388441907f, 0.00235740771f, 0.162936299f, -0.00660016528f, -0.0286450484f, 0.00327484698f, 0.00559518458f, -0.00117099049f, -0.00121707921f, 0.000386080276f, 0.000275116847f, -0.000123468335f, -6.25068342e-05f, 3.87854175e-05f, 1.38223127e-05f, -1.19468134e-05f, -2.83633958e-06f, 3.35997703e-06f, 5.40972663e-07f,
+    -0.0915340189f, -0.0152557976f, -0.286584089f, 0.0133558962f, 0.0614522994f, -0.00579532106f, -0.0109090845f, 0.00203108853f, 0.00225478623f, -0.000656915214f, -0.000496421645f, 0.000207155905f, 0.000111288672f, -6.44841045e-05f, -2.45753433e-05f, 1.99134145e-05f, 5.1413973e-06f, -6.22549629e-06f, -9.45728205e-07f, 2.37960951e-06f,
+    -0.0463756472f, 0.0324217145f, -0.15303623f, -0.00989022617f, 0.0334518246f, -9.9152372e-05f, -0.00615798389f, 0.000498713027f, 0.00132437365f, -0.000223164014f, -0.000304970505f, 8.17208353e-05f, 7.22229443e-05f, -2.78533579e-05f, -1.7151408e-05f, 9.1736025e-06f, 3.98836238e-06f, -3.02295427e-06f, -8.54994872e-07f, 1.21219114e-06f,
+    -0.00250398099f, 0.037214428f, -0.308471257f, -0.0508531457f, 0.0365283752f, 0.0172121156f, 0.00252885321f, -0.00189383916f, -0.00135329791f, -0.000289195641f, 0.00013200692f, 0.000127351259f, 3.62372306e-05f, -9.54993779e-06f, -1.31432065e-05f, -4.68534593e-06f, 5.84522799e-07f, 1.4032132e-06f, 6.19867951e-07f, 6.7780186e-08f,
+    -0.095788251f, 0.364231166f, 0.0367426747f, -0.120088602f, -0.028164864f, 0.00477909684f, 0.00622495134f, 0.00212686188f, -0.000159776215f, -0.000487146544f, -0.000209753485f, -2.78869976e-06f, 4.39191547e-05f, 2.32228776e-05f, 2.14064711e-06f, -4.21482153e-06f, -2.72005335e-06f, -4.34501551e-07f, 4.50072495e-07f, 3.66123088e-07f,
+    -0.0508074074f, 0.19030056f, 0.0517950678f, -0.0587142156f, -0.0188294039f, 0.000750856331f, 0.00305471024f, 0.00133163246f, 5.61101653e-05f, -0.00022952111f, -0.000125609279f, -1.47830066e-05f, 1.96314574e-05f, 1.33780068e-05f, 2.51348656e-06f, -1.75789092e-06f, -1.5111843e-06f, -3.78152314e-07f, 1.75231479e-07f, 1.88116489e-07f,
+    -0.0363216489f, 0.408241935f, 0.0789618298f, -0.0967489117f, -0.00324644172f, -0.00136964548f, -0.000488932672f, 0.000320604308f, -3.15400204e-05f, 4.00034154e-05f, 9.30629754e-07f, 1.37725755e-06f, 4.91074569e-07f, -2.46142924e-07f, 5.43959868e-08f, -4.31245291e-08f, 7.78799031e-10f, -2.20057146e-09f, -6.57975742e-10f, 2.04959131e-10f,
+    -0.136295097f, -0.0870693588f, 0.253643117f, 0.018326699f, -0.0147331654f, 0.000723922117f, -0.00138672975f, -3.3573968e-05f, -3.50309547e-05f, -1.10879076e-05f, 7.47124545e-06f, -1.08052565e-06f, 1.1344556e-06f, -5.44786362e-09f, 4.99052825e-08f, 1.38983175e-08f, -7.00728032e-09f, 2.00289475e-09f, -1.44058251e-09f, 9.41013425e-11f,
+    -0.0688713675f, -0.0890440099f, 0.126981086f, 0.0198717626f, -0.00751572798f, 0.000528973545f, -0.000688262703f, -5.13715204e-05f, -1.53833238e-05f, -1.00880242e-05f, 3.88598572e-06f, -7.19874849e-07f, 5.53543676e-07f, 2.27934428e-08f, 2.09269263e-08f, 1.19121847e-08f, -3.81711267e-09f, 1.29758128e-09f, -6.99324581e-10f, 2.87710758e-11f,
+    -0.0388597756f, -0.182829918f, 0.292575387f, 0.029699333f, -0.0523030536f, 0.0119096591f, 0.00288065358f, -0.0034802845f, 0.000977508131f, 0.000255068289f, -0.000324592994f, 9.7216599e-05f, 2.64000844e-05f, -3.50091476e-05f, 1.08436806e-05f, 3.01854586e-06f, -4.10629931e-06f, 1.2775293e-06f, 4.30162806e-07f, -5.5302237e-07f,
+    -0.0888816715f, -0.331109905f, -0.0912325277f, 0.128235329f, -0.00887641406f, -0.0132701162f, 0.00688461629f, -0.000645062187f, -0.00104078566f, 0.000600145162f, -5.98333831e-05f, -0.000102721135f, 6.23208416e-05f, -6.48162273e-06f, -1.14130849e-05f, 7.1318989e-06f, -7.77492527e-07f, -1.34036647e-06f, 8.79844977e-07f, -2.04961601e-07f,
+    -0.0433273718f, -0.15743425f, -0.0791869747f, 0.0652648719f, 0.00072867445f, -0.008318161f, 0.00336961908f, 1.94755273e-05f, -0.000656934614f, 0.000293322989f, 1.99194073e-06f, -6.49140246e-05f, 3.04686012e-05f, 1.99778472e-07f, -7.21683932e-06f, 3.48705411e-06f, 1.42368627e-08f, -8.47975663e-07f, 4.24157335e-07f, -5.15296168e-08f,
+    -0.0200130674f, -0.33250266f, -0.173550151f, 0.131804987f, 0.0449768268f, -0.0191481006f, -0.0104370746f, 0.00258456234f, 0.00263235007f, -0.000262020999f, -0.000673970284f, -2.45446545e-05f, 0.000170662713f, 2.9898894e-05f, -4.18280203e-05f, -1.4059109e-05f, 9.66605567e-06f, 5.47225904e-06f, -1.97873686e-06f, -2.37838202e-06f,
+    -0.0917184505f, 0.165266817f, -0.249062541f, -0.0785363828f, 0.0485415241f, 0.0181354532f, -0.00678016517f, -0.00453227944f, 0.000915898465f, 0.00117398621f, -6.72801533e-05f, -0.000303667261f, -2.3889117e-05f, 7.68730875e-05f, 1.7051846e-05f, -1.86402e-05f, -7.27689095e-06f, 4.19659492e-06f, 2.40881004e-06f, -9.34686123e-07f,
+    -0.0468075508f, 0.122827028f, -0.114659726f, -0.0556318558f, 0.0211823272f, 0.0116677387f, -0.0025248728f, -0.00268612373f, 0.000213429789f, 0.00065323687f, 3.4503897e-05f, -0.000159328937f, -3.05555358e-05f, 3.78608663e-05f, 1.34581863e-05f, -8.46952616e-06f, -4.88875327e-06f, 1.66591302e-06f, 1.49080013e-06f, -2.49963447e-07f,
+    0.00397407363f, 0.257475799f, -0.221397258f, -0.0995018316f, 0.00552575496f, 0.0077517901f, 0.0041214979f, 0.00101577996f, -4.92834248e-05f, -0.000187026973f, -0.000102021583f, -2.74635916e-05f, 1.47796137e-06f, 5.90604852e-06f, 3.31765189e-06f, 9.30914129e-07f, -5.68115903e-08f, -2.16391736e-07f, -1.28291498e-07f, -4.36759468e-08f,
+    -0.111081817f, 0.306189321f, 0.176787249f, -0.0684581664f, -0.0300457888f, -0.00557562005f, 0.00030439085f, 0.00113082943f, 0.000534519616f, 0.000135697063f, -1.22183235e-05f, -3.01342231e-05f, -1.58980321e-05f, -4.14765714e-06f, 4.09565214e-07f, 1.02864017e-06f, 5.5790097e-07f, 1.47419284e-07f, -1.64432055e-08f, -3.34527911e-08f,
+    -0.0596353936f, 0.1363502f, 0.117366428f, -0.0261064556f, -0.0165948231f, -0.00378187941f, -0.000268089072f, 0.000496795653f, 0.000290106677f, 9.18714458e-05f, 4.13924585e-06f, -1.31972917e-05f, -8.62981685e-06f, -2.82788685e-06f, -1.28081578e-07f, 4.51178721e-07f, 3.03358011e-07f, 1.0118704e-07f, 4.62999277e-09f, -1.32735929e-08f,
+    -0.0559263724f, 0.272789371f, 0.213022831f, -0.0857149395f, -0.00560587855f, 0.00277919442f, -0.00224550135f, 0.000689448904f, -0.000136610263f, -3.84264196e-06f, 2.4229265e-05f, -1.25159548e-05f, 4.61954964e-06f, -8.90413399e-07f, -1.04815894e-07f, 2.04918357e-07f, -1.1225814e-07f, 3.91336904e-08f, -7.73919808e-09f, -4.01333327e-10f,
+    -0.119759613f, -0.276240609f, 0.194146236f, 0.0555425545f, -0.0207233017f, 0.00415444016f, -0.000904991851f, -0.000271829238f, 0.000175087814f, -8.82718973e-05f, 2.40691836e-05f, -3.01302353e-06f, -1.63863926e-06f, 1.47298585e-06f, -6.50077466e-07f, 1.9109203e-07f, -1.82224994e-08f, -1.75583607e-08f, 1.4282052e-08f, -6.08898491e-09f,
+    -0.0580055056f, -0.175753252f, 0.0812579115f, 0.038560739f, -0.0104625177f, 0.0019246138f, -0.00024799079f, -0.000216907325f, 0.00010760692f, -4.66579175e-05f, 1.03016719e-05f, -2.9938886e-07f, -1.35595477e-06f, 8.78248439e-07f, -3.35622018e-07f, 8.0476812e-08f, 2.00719652e-09f, -1.34469544e-08f, 8.42211272e-09f, -3.20422873e-09f,
+    -0.0281280699f, -0.336105831f, 0.181999538f, 0.118230073f, -0.0510489768f, -0.00889966434f, 0.0111192386f, -0.00136592977f, -0.00198285125f, 0.00087588548f, 0.000205570174f, -0.000272930082f, 3.13794581e-05f, 5.97605112e-05f, -2.65376726e-05f, -7.49383879e-06f, 9.46896606e-06f, -1.02836071e-06f, -2.3149777e-06f, 1.3607437e-06f,
+    -0.0891924999f, -0.199922812f, -0.225972338f, 0.0982506856f, 0.0319758565f, -0.0219992079f, 0.000151676736f, 0.00428166184f, -0.00124152543f, -0.000601085103f, 0.000465895816f, 6.16723625e-06f, -0.000117470514f, 3.42499836e-05f, 1.98696397e-05f, -1.515136e-05f, -6.03743395e-07f, 4.23495067e-06f, -1.01757877e-06f, -8.40314645e-07f,
+    -0.0446115947f, -0.0714823417f, -0.139473193f, 0.0400322689f, 0.0223772884f, -0.0107986453f, -0.0010802446f, 0.00242522791f, -0.0004548127f, -0.000411906946f, 0.000226907027f, 3.17881236e-05f, -6.59013779e-05f, 1.20185801e-05f, 1.33638494e-05f, -7.29479796e-06f, -1.31064506e-06f, 2.36507706e-06f, -3.00742329e-07f, -5.9007349e-07f,
+    -0.0134655767f, -0.183392901f, -0.291345896f, 0.0443207955f, 0.0619810425f, 0.00685909108f, -0.00846774483f, -0.00402181111f, 0.000495237367f, 0.00104662649f, 0.000233741785f, -0.000170094601f, -0.000115201471f, 2.81169363e-06f, 3.03534293e-05f, 9.89452026e-06f, -4.51936665e-06f, -4.20381932e-06f, -1.31869017e-07f, 1.16422901e-06f,
+    -0.0911486125f, 0.305187644f, -0.129181723f, -0.130980677f, 0.00596791564f, 0.0215041273f, 0.00528457741f, -0.00249940567f, -0.00190597603f, -6.90989714e-05f, 0.000414530748f, 0.000156276008f, -4.792359e-05f, -5.55969894e-05f, -7.14808055e-06f, 1.18915147e-05f, 6.10413163e-06f, -9.32087658e-07f, -1.98420496e-06f, -7.04145913e-07f,
+    -0.0471858038f, 0.181849203f, -0.0384425967f, -0.074454499f, -0.00329099579f, 0.0107476151f, 0.00370148704f, -0.000912450156f, -0.00106779706f, -0.00014613385f, 0.00019657823f, 0.000101073783f, -1.35179324e-05f, -2.99325234e-05f, -6.98041045e-06f, 5.30613321e-06f, 3.72607808e-06f, -5.79016626e-08f, -1.04401433e-06f, -4.96960392e-07f,
+    -0.00767504424f, 0.401980429f, -0.077079304f, -0.104719355f, -0.00498711027f, -0.000335023192f, 0.0011516896f, 0.000622590748f, 0.000178572339f, 4.86931811e-05f, -1.42613045e-06f, -4.92252302e-06f, -3.34090593e-06f, -1.24374132e-06f, -3.14999445e-07f, -1.97735504e-08f, 3.48113597e-08f, 2.39092547e-08f, 1.04192541e-08f, 3.08094298e-09f,
+    -0.131030537f, 0.138858644f, 0.250497567f, -0.018515494f, -0.0188275831f, -0.0038357607f, -0.00155409933f, -4.01632636e-05f, 5.48599094e-05f, 5.68842095e-05f, 2.32380937e-05f, 6.51646218e-06f, 1.02537112e-06f, -3.73951093e-07f, -3.32157784e-07f, -1.65123616e-07f, -5.19759354e-08f, -9.25168713e-09f, 1.81446456e-09f, 2.11850571e-09f,
+    -0.0690513803f, 0.0320460233f, 0.141589494f, 0.00106523407f, -0.00951606536f, -0.00200983071f, -0.00094875974f, -8.6428766e-05f, 1.05966003e-05f, 2.52396248e-05f, 1.25370579e-05f, 3.98797207e-06f, 8.9552096e-07f, -6.94648668e-08f, -1.44175719e-07f, -8.59617744e-08f, -3.13436043e-08f, -7.42894635e-09f, -1.20825687e-10f, 8.07616287e-10f,
+    -0.0532086763f, 0.0489404829f, 0.299848197f, -0.0503222918f, -0.0244387028f, 0.0116413824f, -0.00362535357f, 2.20916746e-05f, 0.000533471476f, -0.000305302393f, 8.11779868e-05f, 8.30954471e-06f, -1.98648554e-05f, 1.02274753e-05f, -2.26270169e-06f, -6.48973897e-07f, 8.45516971e-07f, -3.83511856e-07f, 6.48309184e-08f, 2.53680352e-08f,
+    -0.0987247737f, -0.36691458f, 0.0723058256f, 0.101297396f, -0.0265169474f, 0.00148089817f, 0.00250738089f, -0.00165750026f, 0.00047299469f, 3.04368161e-06f, -8.63152565e-05f, 4.8985808e-05f, -1.27978696e-05f, -1.7298253e-06f, 3.51349821e-06f, -1.77765063e-06f, 3.76527958e-07f, 1.32658744e-07f, -1.64124968e-07f, 7.80124337e-08f,
+    -0.0470724785f, -0.200711642f, 0.00723150698f, 0.0592563368f, -0.0115838952f, -0.000426259666f, 0.00171527918f, -0.000885914208f, 0.000196440317f, 3.3505957e-05f, -5.44919464e-05f, 2.52463748e-05f, -4.74796676e-06f, -1.99024246e-06f, 2.10933255e-06f, -8.79885347e-07f, 1.12426369e-07f, 1.10770964e-07f, -9.42648857e-08f, 3.8938906e-08f,
+    -0.0232659446f, -0.388519238f, 0.00829130888f, 0.162688615f, -0.00835821577f, -0.0284261252f, 0.00374657759f, 0.00548711883f, -0.00130166188f, -0.00117202095f, 0.000421866577f, 0.00025774178f, -0.00013298201f, -5.61242683e-05f, 4.11825236e-05f, 1.15530819e-05f, -1.24974938e-05f, -2.03097205e-06f, 3.46613698e-06f, 1.94622734e-07f,
+    -0.0914992857f, -0.0212439134f, -0.286209403f, 0.0164092516f, 0.0611352394f, -0.00659085489f, -0.0107460531f, 0.00224756166f, 0.00218597362f, -0.000715945829f, -0.000469738453f, 0.000222882917f, 0.000101454057f, -6.84821624e-05f, -2.10830254e-05f, 2.08438144e-05f, 3.9476758e-06f, -6.40142388e-06f, -5.8233399e-07f, 2.39217852e-06f,
+    -0.0463472329f, 0.0292519951f, -0.153441343f, -0.00824305708f, 0.0334634335f, -0.000544799993f, -0.00611988526f, 0.000625096503f, 0.00130126069f, -0.000259261425f, -0.000294471017f, 9.18988882e-05f, 6.79723133e-05f, -3.06457013e-05f, -1.55401132e-05f, 9.90505714e-06f, 3.40966365e-06f, -3.20042537e-06f, -6.72428606e-07f, 1.25492017e-06f,
+    -0.00278569061f, 0.0298792572f, -0.309688965f, -0.0484293347f, 0.0376377291f, 0.0172898052f, 0.00229516981f, -0.00203675329f, -0.0013724051f, -0.000263401624f, 0.000151084601f, 0.000131171133f, 3.33629506e-05f, -1.21532765e-05f, -1.38312517e-05f, -4.37555535e-06f, 9.41726123e-07f, 1.51743795e-06f, 5.82890089e-07f, 1.65716138e-08f,
+    -0.0954994201f, 0.364116271f, 0.0315935654f, -0.121288572f, -0.0275996394f, 0.00531994635f, 0.0063866735f, 0.00207868082f, -0.00022548455f, -0.000510925068f, -0.000205902884f, 5.49275633e-06f, 4.74978293e-05f, 2.30301747e-05f, 1.08539719e-06f, -4.75334175e-06f, -2.74064549e-06f, -3.02598298e-07f, 5.32538466e-07f, 3.86973312e-07f,
+    -0.050618922f, 0.190985106f, 0.0491862349f, -0.0595989949f, -0.018643766f, 0.00103020714f, 0.00316491434f, 0.00132082953f, 2.31335268e-05f, -0.000244855446f, -0.000125542771f, -1.07715738e-05f, 2.18358206e-05f, 1.35462996e-05f, 2.02316001e-06f, -2.07693781e-06f, -1.55934701e-06f, -3.19793214e-07f, 2.23009515e-07f, 2.04558211e-07f,
+    -0.0353656592f, 0.410402292f, 0.0742921561f, -0.0970086941f, -0.00330464293f, -0.0014164266f, -0.000448189446f, 0.000317366893f, -2.58021694e-05f, 4.02618991e-05f, 1.10833311e-06f, 1.47322096e-06f, 4.32028944e-07f, -2.35663469e-07f, 4.39403592e-08f, -4.32014145e-08f, 2.77315802e-10f, -2.40113963e-09f, -5.65082008e-10f, 1.76361382e-10f,
+    -0.136520995f, -0.0801180074f, 0.254541488f, 0.017247801f, -0.0146895468f, 0.000592440989f, -0.00139229896f, -3.64671358e-05f, -3.66401302e-05f, -9.7185169e-06f, 7.31113722e-06f, -8.61899826e-07f, 1.13789037e-06f, 3.45079399e-09f, 5.33586937e-08f, 1.18030834e-08f, -6.52943163e-09f, 1.58320014e-09f, -1.42837291e-09f, 6.66602168e-11f,
+    -0.0690832624f, -0.0855737836f, 0.127931703f, 0.0193261942f, -0.00748551266f, 0.00046377969f, -0.000695397263f, -5.25852019e-05f, -1.68374958e-05f, -9.38585174e-06f, 3.78165021e-06f, -6.13344219e-07f, 5.61464932e-07f, 2.64515887e-08f, 2.38553835e-08f, 1.0804076e-08f, -3.50966167e-09f, 1.09477065e-09f, -7.02419189e-10f, 1.71174248e-11f,
+    -0.0392360266f, -0.176497912f, 0.294532149f, 0.0267653036f, -0.0516990606f, 0.0122468577f, 0.00255058041f, -0.0034004424f, 0.00102120941f, 0.000211650822f, -0.000313662572f, 0.00010313327f, 2.03615592e-05f, -3.3447044e-05f, 1.16706743e-05f, 2.15282628e-06f, -3.87446088e-06f, 1.39313071e-06f, 2.98744154e-07f, -5.00175519e-07f,
+    -0.0890046645f, -0.333981723f, -0.0862046476f, 0.12818022f, -0.00990853981f, -0.0127564743f, 0.00687579757f, -0.000771633626f, -0.000974367011f, 0.000598873505f, -7.67656276e-05f, -9.3575265e-05f, 6.21013307e-05f, -8.8478454e-06f, -1.01092992e-05f, 7.0943859e-06f, -1.11638205e-06f, -1.15437176e-06f, 8.80399666e-07f, -2.53203593e-07f,
+    -0.0433476391f, -0.159602832f, -0.0767166076f, 0.0655342085f, 0.000117685216f, -0.00807929449f, 0.00339893249f, -5.61802343e-05f, -0.00062607275f, 0.000297139606f, -8.16137829e-06f, -6.06545931e-05f, 3.09781055e-05f, -1.2231893e-06f, -6.60798205e-06f, 3.55699953e-06f, -1.90447283e-07f, -7.60875113e-07f, 4.38118154e-07f, -8.27358497e-08f,
+    -0.0200887449f, -0.335837626f, -0.168543276f, 0.133865452f, 0.0437038466f, -0.0198657878f, -0.0101833013f, 0.00282882886f, 0.00259133549f, -0.00034147622f, -0.000672815187f, 1.1760761e-07f, 0.000173861462f, 2.26423925e-05f, -4.38856065e-05f, -1.20645734e-05f, 1.05985112e-05f, 4.97541488e-06f, -2.30894917e-06f, -2.2593555e-06f,
+    -0.0917532679f, 0.159904817f, -0.251685749f, -0.0760001841f, 0.0495725905f, 0.0175911804f, -0.00714396203f, -0.00442564763f, 0.00103884489f, 0.00115932739f, -0.000106868808f, -0.000304844204f, -1.17573905e-05f, 7.90005558e-05f, 1.35399423e-05f, -1.98313195e-05f, -6.33167554e-06f, 4.73578333e-06f, 2.18611694e-06f, -1.2042614e-06f,
+    -0.0468127099f, 0.120320073f, -0.116561972f, -0.0544956224f, 0.0218608106f, 0.0114522906f, -0.00274458894f, -0.00265464926f, 0.000283112755f, 0.000653669718f, 1.33068542e-05f, -0.000162515599f, -2.442732e-05f, 3.97478393e-05f, 1.18015867e-05f, -9.31134051e-06f, -4.48224131e-06f, 2.00482294e-06f, 1.40652346e-06f, -4.05966202e-07f,
+    0.0040526506f, 0.251172066f, -0.225377667f, -0.0987429654f, 0.00622938789f, 0.00811513439f, 0.00419915538f, 0.000992429393f, -7.95815375e-05f, -0.000201919712f, -0.000105172318f, -2.63744743e-05f, 2.87247677e-06f, 6.581658e-06f, 3.45866704e-06f, 8.76190305e-07f, -1.23709933e-07f, -2.48491998e-07f, -1.35128732e-07f, -4.24354233e-08f,
+    -0.110456637f, 0.309918404f, 0.173204745f, -0.0702601459f, -0.0303292462f, -0.00547622643f, 0.000443522903f, 0.00119256947f, 0.000547023417f, 0.000130557571f, -1.81057386e-05f, -3.2875568e-05f, -1.64246956e-05f, -3.89991872e-06f, 6.86246133e-07f, 1.15678004e-06f, 5.81641661e-07f, 1.34643835e-07f, -3.06309314e-08f, -4.02895463e-08f,
+    -0.0593046806f, 0.138971505f, 0.115871024f, -0.0271392304f, -0.0168180472f, -0.00376683012f, -0.000202194867f, 0.000532051465f, 0.000299910611f, 9.06868591e-05f, 1.3342016e-06f, -1.47698311e-05f, -9.05544773e-06f, -2.76638759e-06f, 4.53962754e-09f, 5.25115276e-07f, 3.22974028e-07f, 9.77298234e-08f, -2.21343393e-09f, -1.70443209e-08f,
+    -0.0555823803f, 0.278878581f, 0.209232847f, -0.086299854f, -0.00531830363f, 0.00256103666f, -0.00217409504f, 0.000677047599f, -0.000139109529f, 5.46853322e-07f, 2.20437835e-05f, -1.17207366e-05f, 4.49158573e-06f, -9.35710782e-07f, -5.12742483e-08f, 1.77012226e-07f, -1.02958444e-07f, 3.77410224e-08f, -8.43536899e-09f, 2.03261433e-10f,
+    -0.120485184f, -0.271435707f, 0.197044475f, 0.0541781099f, -0.020449745f, 0.00409455752f, -0.000946068152f, -0.000247522644f, 0.00016284467f, -8.50070682e-05f, 2.38543567e-05f, -3.42691831e-06f, -1.31860496e-06f, 1.33600711e-06f, -6.11992609e-07f, 1.90058338e-07f, -2.40090591e-08f, -1.3425762e-08f, 1.24835767e-08f, -5.55579317e-09f,
+    -0.0584200128f, -0.173823152f, 0.0831811378f, 0.0378946096f, -0.010345454f, 0.00191516606f, -0.000277219768f, -0.000202664965f, 0.000101337255f, -4.53713167e-05f, 1.04133328e-05f, -6.02489364e-07f, -1.17206615e-06f, 8.09915874e-07f, -3.20875427e-07f, 8.28235519e-08f, -2.0439176e-09f, -1.10990006e-08f, 7.53565477e-09f, -2.98282431e-09f,
+    -0.0283084695f, -0.332680782f, 0.186796383f, 0.115834576f, -0.0517897397f, -0.0080738899f, 0.0110486138f, -0.00157490162f, -0.00189503222f, 0.000907590585f, 0.000169363987f, -0.000270326983f, 4.13267227e-05f, 5.56590032e-05f, -2.81739869e-05f, -5.70198211e-06f, 9.36964184e-06f, -1.53352542e-06f, -2.13662194e-06f, 1.4461788e-06f,
+    -0.0891320279f, -0.205108428f, -0.222632214f, 0.100154521f, 0.0306412426f, -0.0220741832f, 0.000535811918f, 0.00417831772f, -0.00131747435f, -0.000546367465f, 0.000470109607f, -1.14260528e-05f, -0.000112878964f, 3.80073926e-05f, 1.72215712e-05f, -1.54050099e-05f, 2.96959431e-07f, 4.001052e-06f, -1.22851015e-06f, -6.56458194e-07f,
+    -0.0445548711f, -0.074582148f, -0.138188382f, 0.0412880807f, 0.0217433631f, -0.0109234107f, -0.000868498932f, 0.00239179298f, -0.000504336986f, -0.00038605053f, 0.000232903756f, 2.21472229e-05f, -6.44878682e-05f, 1.44460507e-05f, 1.21230982e-05f, -7.61612981e-06f, -8.20444019e-07f, 2.29297966e-06f, -4.31677422e-07f, -5.00995776e-07f,
+    -0.0136901798f, -0.189371997f, -0.288974431f, 0.0474978552f, 0.0621679294f, 0.0061396404f, -0.00877975819f, -0.00393412518f, 0.000614469456f, 0.00106491604f, 0.00020592736f, -0.000185666363f, -0.000112749721f, 8.34249632e-06f, 3.1677796e-05f, 8.72868938e-06f, -5.35935044e-06f, -4.175534e-06f, 1.391743e-07f, 1.29795836e-06f,
+    -0.0911357847f, 0.301769906f, -0.133932446f, -0.130253382f, 0.00739023603f, 0.0218026892f, 0.00501381743f, -0.00267936545f, -0.00189454001f, -1.36211308e-05f, 0.000431527851f, 0.000146314185f, -5.66070521e-05f, -5.58564231e-05f, -4.65250163e-06f, 1.28954267e-05f, 5.7226671e-06f, -1.37282188e-06f, -2.01363279e-06f, -5.75132139e-07f,
+    -0.0471502657f, 0.180642475f, -0.0412057548f, -0.0743934166f, -0.00255483423f, 0.0109805571f, 0.00358977324f, -0.00101726636f, -0.00107407434f, -0.000118505018f, 0.000208514306f, 9.73881111e-05f, -1.83962365e-05f, -3.06457775e-05f, -5.789179e-06f, 5.96208833e-06f, 3.61032546e-06f, -2.95594136e-07f, -1.08790676e-06f, -4.42163376e-07f,
+    -0.00691058533f, 0.399294179f, -0.0819946219f, -0.104883613f, -0.00492321013f, -0.000202193536f, 0.00122607129f, 0.000643860832f, 0.000184052627f, 4.76625288e-05f, -2.5771813e-06f, -5.61865259e-06f, -3.59072616e-06f, -1.29840228e-06f, -3.10680016e-07f, -7.36029954e-09f, 4.21232431e-08f, 2.68285076e-08f, 1.11511383e-08f, 3.15139117e-09f,
+    -0.130532365f, 0.145413971f, 0.249282858f, -0.0198602005f, -0.0191234581f, -0.00396751472f, -0.0015481572f, -2.88531785e-05f, 6.40315421e-05f, 6.0633591e-05f, 2.42197465e-05f, 6.60392161e-06f, 8.99986382e-07f, -4.6195249e-07f, -3.72928881e-07f, -1.76928814e-07f, -5.32568487e-08f, -8.11251787e-09f, 2.79862493e-09f, 2.5573184e-09f,
+    -0.0688585899f, 0.0357996175f, 0.14144511f, 0.000370243139f, -0.00967929731f, -0.00209372611f, -0.00095332199f, -8.26417808e-05f, 1.49038551e-05f, 2.73412037e-05f, 1.31794071e-05f, 4.10714738e-06f, 8.54847066e-07f, -1.10600066e-07f, -1.66331384e-07f, -9.3541938e-08f, -3.27887515e-08f, -7.12704165e-09f, 3.26857104e-10f, 1.03394473e-09f,
+    -0.053499736f, 0.0565911434f, 0.298305323f, -0.0521177057f, -0.0235738229f, 0.0113776081f, -0.00365919968f, 9.49639558e-05f, 0.000494567434f, -0.00029642481f, 8.41024703e-05f, 4.49038547e-06f, -1.80595929e-05f, 9.92509251e-06f, -2.47543158e-06f, -4.42293075e-07f, 7.60143661e-07f, -3.75868901e-07f, 8.00668773e-08f, 1.41494746e-08f,
+    -0.0992675106f, -0.365959713f, 0.0770292143f, 0.099912012f, -0.0265728659f, 0.00175327648f, 0.00233708123f, -0.00161330895f, 0.000480152504f, -1.13928254e-05f, -7.87765059e-05f, 4.7345908e-05f, -1.3430361e-05f, -9.53768539e-07f, 3.15522775e-06f, -1.72188879e-06f, 4.22056957e-07f, 9.01801686e-08f, -1.46152873e-07f, 7.42963838e-08f,
+    -0.0473243633f, -0.200984492f, 0.00989617407f, 0.0587019073f, -0.011701813f, -0.000253999392f, 0.001628034f, -0.000869885339f, 0.000204276575f, 2.48937836e-05f, -5.07773133e-05f, 2.47683661e-05f, -5.27233993e-06f, -1.54524887e-06f, 1.94047787e-06f, -8.71637749e-07f, 1.455648e-07f, 8.73360812e-08f, -8.62703347e-08f, 3.81251028e-08f,
+    -0.0233088401f, -0.388487355f, 0.0142220712f, 0.162362956f, -0.01010596f, -0.0281754272f, 0.00421037336f, 0.00536720511f, -0.00142790846f, -0.00112289197f, 0.000455525436f, 0.000239069272f, -0.000141562341f, -4.93632641e-05f, 4.31963995e-05f, 9.18746377e-06f, -1.29003818e-05f, -1.2079008e-06f, 3.52308377e-06f, -1.50749438e-07f,
+    -0.0914622132f, -0.0272299242f, -0.285735413f, 0.0194515641f, 0.0607736829f, -0.00737637628f, -0.0105658753f, 0.00245809832f, 0.00211111327f, -0.000772026193f, -0.000441083524f, 0.000237286758f, 9.10288276e-05f, -7.19269376e-05f, -1.74329718e-05f, 2.15540912e-05f, 2.7192219e-06f, -6.490842e-06f, -2.13791279e-07f, 2.3639644e-06f,
+    -0.0463173926f, 0.0260726113f, -0.153793645f, -0.00659392672f, 0.0334504027f, -0.000988362921f, -0.00607186781f, 0.000749538453f, 0.00127447807f, -0.000294208525f, -0.000282703539f, 0.000101506766f, 6.33110437e-05f, -3.31826907e-05f, -1.38052339e-05f, 1.05293095e-05f, 2.79717394e-06f, -3.33367124e-06f, -4.82021888e-07f, 1.27583105e-06f,
+    -0.00307065454f, 0.0225543526f, -0.310797468f, -0.0459587756f, 0.038740433f, 0.0173453572f, 0.00204994336f, -0.00217943807f, -0.0013875934f, -0.000235285754f, 0.000170321982f, 0.000134356121f, 3.0056985e-05f, -1.48182715e-05f, -1.44230188e-05f, -3.98936365e-06f, 1.31519895e-06f, 1.61813843e-06f, 5.32235997e-07f, -4.0287279e-08f,
+    -0.0952220041f, 0.363882914f, 0.0264240213f, -0.122444193f, -0.0269996201f, 0.0058682926f, 0.00654081358f, 0.00202336992f, -0.000293118825f, -0.000533576498f, -0.000200756901f, 1.4201286e-05f, 5.09286607e-05f, 2.26165077e-05f, -5.61718693e-08f, -5.27545202e-06f, -2.72523418e-06f, -1.54782581e-07f, 6.12953343e-07f, 4.02214609e-07f,
+    -0.05043619f, 0.191605956f, 0.0465557167f, -0.0604650627f, -0.0184390222f, 0.00131580514f, 0.00327228238f, 0.00130621718f, -1.12709544e-05f, -0.00025983091f, -0.000124804204f, -6.4672966e-06f, 2.40063076e-05f, 1.36034553e-05f, 1.47692197e-06f, -2.39518534e-06f, -1.59004137e-06f, -2.51561047e-07f, 2.71117086e-07f, 2.18601934e-07f,
+    -0.0344013151f, 0.412415973f, 0.0696062818f, -0.0972670713f, -0.00336653562f, -0.00145867409f, -0.000407697091f, 0.000314853528f, -2.00098097e-05f, 4.05351084e-05f, 1.30296167e-06f, 1.55601676e-06f, 3.74749305e-07f, -2.27540125e-07f, 3.33983946e-08f, -4.33755274e-08f, -2.8014001e-10f, -2.56982006e-09f, -4.8001336e-10f, 1.54113106e-10f,
+    -0.136722938f, -0.0731374435f, 0.255377859f, 0.0161704249f, -0.0146561563f, 0.000460219935f, -0.00139794473f, -3.95650741e-05f, -3.80208615e-05f, -8.36908772e-06f, 7.18937384e-06f, -6.4170782e-07f, 1.14256649e-06f, 1.3134276e-08f, 5.62226658e-08f, 9.81066608e-09f, -6.16698655e-09f, 1.16330709e-09f, -1.42247611e-09f, 3.72854572e-11f,
+    -0.0692833033f, -0.0820735298f, 0.128851195f, 0.0187814191f, -0.00746036389f, 0.000397734742f, -0.000702548687f, -5.39831453e-05f, -1.817583e-05f, -8.69601845e-06f, 3.69598946e-06f, -5.04632586e-07f, 5.69867133e-07f, 3.07725652e-08f, 2.64790465e-08f, 9.76115399e-09f, -3.2578908e-09f, 8.88580616e-10f, -7.08068952e-10f, 3.77457926e-12f,
+    -0.0396162293f, -0.170092086f, 0.296380333f, 0.0238449368f, -0.0510655015f, 0.0125595044f, 0.00222455568f, -0.0033146089f, 0.00106002985f, 0.000169090568f, -0.000301632952f, 0.000108140818f, 1.44914628e-05f, -3.16917751e-05f, 1.2334604e-05f, 1.31879098e-06f, -3.60972053e-06f, 1.48094422e-06f, 1.72265787e-07f, -4.42820966e-07f,
+    -0.0891378874f, -0.336754034f, -0.0811527166f, 0.128065692f, -0.0109133154f, -0.0122382604f, 0.006854335f, -0.000892353952f, -0.000907149025f, 0.000595197692f, -9.25705454e-05f, -8.43011049e-05f, 6.14471505e-05f, -1.10068203e-05f, -8.78596791e-06f, 6.98042042e-06f, -1.41784521e-06f, -9.65581444e-07f, 8.66706093e-07f, -2.9271218e-07f,
+    -0.0433729066f, -0.161726231f, -0.0742227317f, 0.0657706564f, -0.000481750218f, -0.0078355026f, 0.00342110743f, -0.000129335631f, -0.000594284826f, 0.000299588357f, -1.78276531e-05f, -5.62331596e-05f, 3.12387684e-05f, -2.55573399e-06f, -5.97186303e-06f, 3.58294803e-06f, -3.78600805e-07f, -6.69408611e-07f, 4.43977277e-07f, -1.09756606e-07f,
+    -0.0201609957f, -0.339074973f, -0.163477574f, 0.135864598f, 0.0423940852f, -0.0205638529f, -0.00991120732f, 0.00306816679f, 0.00254240278f, -0.000420277777f, -0.000668563255f, 2.50127906e-05f, 0.000175946733f, 1.51294185e-05f, -4.55743414e-05f, -9.91938047e-06f, 1.14195943e-05f, 4.40376135e-06f, -2.61035287e-06f, -2.09908774e-06f,
+    -0.091786969f, 0.154501931f, -0.254221756f, -0.0734232796f, 0.0505702874f, 0.0170241216f, -0.00749780262f, -0.00430834849f, 0.00115958749f, 0.00114023976f, -0.000146311025f, -0.000304342032f, 5.77653768e-07f, 8.05411861e-05f, 9.86474432e-06f, -2.08340707e-05f, -5.30057293e-06f, 5.2202905e-06f, 1.92964852e-06f, -1.45784994e-06f,
+    -0.0468176221f, 0.117781909f, -0.118423962f, -0.0533316906f, 0.0225253322f, 0.0112227534f, -0.00296089234f, -0.00261700208f, 0.000352438446f, 0.000651680712f, -8.13166803e-06f, -0.000164833202f, -1.8075877e-05f, 4.13491003e-05f, 1.00199185e-05f, -1.0068508e-05f, -4.01847684e-06f, 2.32238181e-06f, 1.30128016e-06f, -5.57737063e-07f,
+    0.00411199864f, 0.244791734f, -0.229296556f, -0.0979362239f, 0.00695669154f, 0.00848135673f, 0.0042722645f, 0.000965037764f, -0.000111633873f, -0.000216991007f, -0.000107998674f, -2.50065427e-05f, 4.38131878e-06f, 7.26727439e-06f, 3.57780778e-06f, 8.03565922e-07f, -1.97670009e-07f, -2.81023565e-07f, -1.40463468e-07f, -4.0106576e-08f,
+    -0.109837944f, 0.313530153f, 0.169551072f, -0.072065151f, -0.0305987311f, -0.00536310692f, 0.000588182738f, 0.0012548015f, 0.000558352857f, 0.000124452597f, -2.4379171e-05f, -3.56427468e-05f, -1.68706773e-05f, -3.5886383e-06f, 9.8737011e-07f, 1.28613265e-06f, 6.001271e-07f, 1.17871739e-07f, -4.63891223e-08f, -4.74160301e-08f,
+    -0.0589754849f, 0.141538325f, 0.114331904f, -0.0281784862f, -0.0170363164f, -0.00374480112f, -0.000132898929f, 0.000567986958f, 0.000309272705f, 8.90078904e-05f, -1.70965486e-06f, -1.63850637e-05f, -9.4500627e-06f, -2.67213836e-06f, 1.52436209e-07f, 6.01559121e-07f, 3.40529013e-07f, 9.21909912e-08f, -1.00489741e-08f, -2.10825697e-08f,
+    -0.0552134073f, 0.284871235f, 0.205397584f, -0.0868609426f, -0.00504803614f, 0.00234884758f, -0.0021033268f, 0.000664031423f, -0.000140900785f, 4.59658227e-06f, 1.99774297e-05f, -1.09373701e-05f, 4.34934929e-06f, -9.68140985e-07f, -4.11834862e-09f, 1.51097266e-07f, -9.38298391e-08f, 3.60697075e-08f, -8.89887239e-09f, 7.01181291e-10f,
+    -0.121205558f, -0.266528489f, 0.199876517f, 0.0528250153f, -0.0201779538f, 0.00402947419f, -0.000984219499f, -0.000224678358f, 0.000150962389f, -8.17173075e-05f, 2.35481527e-05f, -3.77745891e-06f, -1.02461454e-06f, 1.2055343e-06f, -5.73212999e-07f, 1.87282149e-07f, -2.86773733e-08f, -9.74720183e-09f, 1.0794886e-08f, -5.02603185e-09f,
+    -0.0588343079f, -0.171829346f, 0.0850737758f, 0.0372322214f, -0.0102275715f, 0.00190234416f, -0.000304823783f, -0.000189139437f, 9.51874033e-05f, -4.40365722e-05f, 1.04640168e-05f, -8.70595676e-07f, -1.00059222e-06f, 7.43724001e-07f, -3.05098999e-07f, 8.40355279e-08f, -5.48116599e-09f, -8.96427192e-09f, 6.68363816e-09f, -2.75219988e-09f,
+    -0.0284951903f, -0.329150998f, 0.191525489f, 0.113393515f, -0.0524843921f, -0.00724845228f, 0.0109598239f, -0.00177687788f, -0.00180305721f, 0.000935175642f, 0.000133175342f, -0.000266251563f, 5.07279408e-05f, 5.12367293e-05f, -2.95014176e-05f, -3.91019126e-06f, 9.16169143e-06f, -1.99833834e-06f, -1.93266463e-06f, 1.50258243e-06f,
+    -0.0890735146f, -0.210243949f, -0.219214476f, 0.102002056f, 0.0292953939f, -0.0221217419f, 0.000913709736f, 0.0040668563f, -0.00138805422f, -0.000490670253f, 0.000472014636f, -2.8521032e-05f, -0.000107649186f, 4.13559811e-05f, 1.44985754e-05f, -1.54894269e-05f, 1.16253459e-06f, 3.72310543e-06f, -1.41377237e-06f, -4.69582215e-07f,
+    -0.0444985238f, -0.0776658995f, -0.136855802f, 0.0425186146f, 0.0210988212f, -0.0110335776f, -0.00065821461f, 0.00235332582f, -0.000551432063f, -0.000359249384f, 0.000237670163f, 1.26197245e-05f, -6.26782959e-05f, 1.66890318e-05f, 1.08105242e-05f, -7.8473518e-06f, -3.37702303e-07f, 2.19324771e-06f, -5.51596437e-07f, -4.07300167e-07f,
+    -0.0139100242f, -0.195282164f, -0.286499463f, 0.050667293f, 0.0623087229f, 0.00540270356f, -0.0090810644f, -0.00383542416f, 0.000734249362f, 0.00107942378f, 0.000176392016f, -0.000200585365f, -0.000109431803f, 1.39895736e-05f, 3.2747544e-05f, 7.42264325e-06f, -6.16652821e-06f, -4.08758397e-06f, 4.19241815e-07f, 1.41495582e-06f,
+    -0.0911276012f, 0.298269497f, -0.138638065f, -0.129459485f, 0.00882160184f, 0.022078517f, 0.00472986781f, -0.0028561613f, -0.00187694924f, 4.32056934e-05f, 0.000446861515f, 0.000135206915f, -6.51627214e-05f, -5.56649022e-05f, -2.02211292e-06f, 1.37970898e-05f, 5.25366137e-06f, -1.8144507e-06f, -2.01265335e-06f, -4.28611261e-07f,
+    -0.0471176846f, 0.179385248f, -0.0439553629f, -0.0742963353f, -0.00180919533f, 0.0112032282f, 0.00346996039f, -0.00112153465f, -0.00107713791f, -8.97690415e-05f, 0.000219743776f, 9.302583e-05f, -2.32962069e-05f, -3.11311836e-05f, -4.49983953e-06f, 6.57817406e-06f, 3.44458384e-06f, -5.39954325e-07f, -1.11655107e-06f, -3.76309449e-07f,
+    -0.0061649337f, 0.396465087f, -0.0869041053f, -0.105035417f, -0.00484665025f, -6.19257938e-05f, 0.00130246997f, 0.000665549549f, 0.00018924186f, 4.64002177e-05f, -3.85659122e-06f, -6.35807516e-06f, -3.84722597e-06f, -1.34966613e-06f, -3.02519704e-07f, 7.07400757e-09f, 5.01683733e-08f, 2.98782815e-08f, 1.18422026e-08f, 3.17783523e-09f,
+    -0.130019029f, 0.151913137f, 0.247995379f, -0.0212214677f, -0.0194275237f, -0.00409730198f, -0.00154038125f, -1.62607374e-05f, 7.37221625e-05f, 6.44983956e-05f, 2.51920955e-05f, 6.65717712e-06f, 7.53830381e-07f, -5.58900725e-07f, -4.15930068e-07f, -1.88660006e-07f, -5.40574767e-08f, -6.64352097e-09f, 3.92805983e-09f, 3.04125465e-09f,
+    -0.0686558551f, 0.0395377143f, 0.141261797f, -0.000334725665f, -0.0098481912f, -0.00217734604f, -0.000957123397f, -7.82177166e-05f, 1.95168031e-05f, 2.9528192e-05f, 1.38301892e-05f, 4.21265595e-06f, 8.03830806e-07f, -1.56845865e-07f, -1.90073099e-07f, -1.01293499e-07f, -3.40549138e-08f, -6.66330411e-09f, 8.56082001e-10f, 1.28887151e-09f,
+    -0.0537787297f, 0.064238473f, 0.296665899f, -0.0538664752f, -0.0227211494f, 0.0111068809f, -0.00368471671f, 0.000163749958f, 0.000456289515f, -0.000286867317f, 8.63809549e-05f, 9.45208152e-07f, -1.62747461e-05f, 9.56497315e-06f, -2.64259144e-06f, -2.52246574e-07f, 6.74495807e-07f, -3.63690722e-07f, 9.20875692e-08f, 4.19246851e-09f,
+    -0.099823056f, -0.364873565f, 0.0817108493f, 0.0985092755f, -0.0266052598f, 0.00201172125f, 0.002169543f, -0.0015673543f, 0.000485229845f, -2.48446084e-05f, -7.13750668e-05f, 4.5539246e-05f, -1.39096842e-05f, -2.4074754e-07f, 2.80080668e-06f, -1.65240915e-06f, 4.57121056e-07f, 5.13525855e-08f, -1.28018397e-07f, 6.97418053e-08f,
+    -0.0475842585f, -0.201187653f, 0.0125482959f, 0.0581336223f, -0.0118059716f, -8.8448751e-05f, 0.00154141028f, -0.000852499288f, 0.000210940506f, 1.67362874e-05f, -4.70693466e-05f, 2.41732809e-05f, -5.7130027e-06f, -1.12787885e-06f, 1.76896491e-06f, -8.54360628e-07f, 1.7315545e-07f, 6.53770954e-08f, -7.78561723e-08f, 3.67337078e-08f,
+    -0.0233536229f, -0.388346128f, 0.0201476144f, 0.161959587f, -0.0118418138f, -0.0278933822f, 0.00466536298f, 0.00523579428f, -0.00154933509f, -0.00106991335f, 0.000486900692f, 0.00021921891f, -0.000149155098f, -4.22822028e-05f, 4.48109633e-05f, 6.75198385e-06f, -1.31517924e-05f, -3.78892443e-07f, 3.53034203e-06f, -4.88966878e-07f,
+    -0.0914228478f, -0.0332124047f, -0.285162254f, 0.0224811282f, 0.0603680477f, -0.00815082352f, -0.0103689506f, 0.00266218098f, 0.00203047657f, -0.000824941321f, -0.000410610622f, 0.000250289444f, 8.00904263e-05f, -7.47942287e-05f, -1.36609107e-05f, 2.20385357e-05f, 1.47120747e-06f, -6.49348506e-06f, 1.54481863e-07f, 2.29597014e-06f,
+    -0.046286133f, 0.0228842976f, -0.154093007f, -0.00494376191f, 0.033412795f, -0.00142923545f, -0.00601405528f, 0.000871728524f, 0.00124412962f, -0.000327868513f, -0.00026973379f, 0.000110490747f, 5.82747379e-05f, -3.54454516e-05f, -1.19641164e-05f, 1.10405891e-05f, 2.15858447e-06f, -3.42133598e-06f, -2.86608435e-07f, 1.27481907e-06f,
+    -0.00335844671f, 0.0152420924f, -0.311796087f, -0.0434425435f, 0.0398350045f, 0.0173781704f, 0.00179343623f, -0.00232143613f, -0.00139865259f, -0.000204889025f, 0.000189609723f, 0.000136849444f, 2.63227003e-05f, -1.75221776e-05f, -1.49051587e-05f, -3.52628302e-06f, 1.70065473e-06f, 1.70254584e-06f, 4.67696981e-07f, -1.02142666e-07f,
+    -0.0949558876f, 0.363531852f, 0.021236138f, -0.123554097f, -0.0263648366f, 0.00642333764f, 0.00668679505f, 0.00196086584f, -0.000362479691f, -0.000554939187f, -0.00019428465f, 2.3296136e-05f, 5.41736283e-05f, 2.19720759e-05f, -1.27679032e-06f, -5.77306957e-06f, -2.67120141e-06f, 7.81221825e-09f, 6.89598824e-07f, 4.10950631e-07f,
+    -0.0502591922f, 0.192163283f, 0.0439045515f, -0.0613115895f, -0.0182150388f, 0.00160728903f, 0.00337648204f, 0.00128771495f, -4.70191092e-05f, -0.000274357478f, -0.000123365905f, -1.88596191e-06f, 2.61223707e-05f, 1.35419141e-05f, 8.77255328e-07f, -2.70838709e-06f, -1.60143137e-06f, -1.73771581e-07f, 3.18661937e-07f, 2.29703059e-07f,
+    -0.0334295154f, 0.414282247f, 0.0649047274f, -0.0975242675f, -0.00343168912f, -0.00149639764f, -0.000367377843f, 0.000313073618f, -1.41635401e-05f, 4.08256864e-05f, 1.51180831e-06f, 1.62588963e-06f, 3.18748128e-07f, -2.21807498e-07f, 2.27564384e-08f, -4.36612253e-08f, -8.8333076e-10f, -2.70837963e-09f, -4.00691817e-10f, 1.38178111e-10f,
+    -0.136900719f, -0.0661302419f, 0.256152201f, 0.0150939677f, -0.0146330733f, 0.000327286908f, -0.00140368921f, -4.28335508e-05f, -3.91750325e-05f, -7.03361231e-06f, 7.10639364e-06f, -4.19866045e-07f, 1.14864492e-06f, 2.34475215e-08f, 5.85164648e-08f, 7.89137662e-09f, -5.92095857e-09f, 7.41942924e-10f, -1.42358671e-09f, 6.31028754e-12f,
+    -0.0694712903f, -0.0785445337f, 0.129739504f, 0.018237139f, -0.00744036697f, 0.000330854256f, -0.000709736866f, -5.5548133e-05f, -1.93993092e-05f, -8.01559702e-06f, 3.62951225e-06f, -3.93719838e-07f, 5.78886642e-07f, 3.56774699e-08f, 2.88097116e-08f, 8.76908992e-09f, -3.06338627e-09f, 6.78514187e-10f, -7.16859414e-10f, -1.10764212e-11f,
+    -0.0400001074f, -0.163614088f, 0.298119344f, 0.0209400136f, -0.0504036396f, 0.0128475679f, 0.0019032221f, -0.00322321753f, 0.00109398453f, 0.000127556492f, -0.00028861917f, 0.000112247018f, 8.82837913e-06f, -2.97701894e-05f, 1.28379424e-05f, 5.24595194e-07f, -3.31793395e-06f, 1.54159279e-06f, 5.25773391e-08f, -3.82457748e-07f,
+    -0.0892815965f, -0.339425359f, -0.0760788316f, 0.127892493f, -0.0118900572f, -0.0117164447f, 0.00682058729f, -0.00100703241f, -0.00083941553f, 0.000589225586f, -0.000107204863f, -7.49678628e-05f, 6.0385396e-05f, -1.29497694e-05f, -7.45833526e-06f, 6.7961672e-06f, -1.68027719e-06f, -7.77035645e-07f, 8.40035079e-07f, -3.2346206e-07f,
+    -0.0434033377f, -0.163803507f, -0.0717063948f, 0.0659744349f, -0.00106914275f, -0.00758729724f, 0.00343626944f, -0.000199845223f, -0.000561723304f, 0.000300709354f, -2.69720877e-05f, -5.16873477e-05f, 3.12610482e-05f, -3.79042364e-06f, -5.3168515e-06f, 3.56734148e-06f, -5.48765671e-07f, -5.75259081e-07f, 4.42220409e-07f, -1.32423562e-07f,
+    -0.0202299464f, -0.342214091f, -0.158354846f, 0.137801207f, 0.041048657f, -0.0212412545f, -0.00962124682f, 0.00330193315f, 0.00248566787f, -0.000498095664f, -0.000661212745f, 4.99923702e-05f, 0.000176893491f, 7.41988436e-06f, -4.68741375e-05f, -7.64524528e-06f, 1.21179451e-05f, 3.76428447e-06f, -2.87818278e-06f, -1.89981446e-06f,
+    -0.0918194389f, 0.149059515f, -0.256669691f, -0.0708070733f, 0.0515336004f, 0.0164349887f, -0.00784095614f, -0.00418063135f, 0.00127771333f, 0.00111677241f, -0.000185406762f, -0.000302149682f, 1.30298279e-05f, 8.14762059e-05f, 6.05977069e-06f, -2.16351184e-05f, -4.19532475e-06f, 5.64235651e-06f, 1.64287337e-06f, -1.69055733e-06f,
+    -0.0468222136f, 0.115213192f, -0.120245062f, -0.0521406813f, 0.0231752439f, 0.0109793992f, -0.0031733495f, -0.00257324901f, 0.000421175831f, 0.000647262139f, -2.97055824e-05f, -0.000166260609f, -1.15444408e-05f, 4.26485006e-05f, 8.12893336e-06f, -1.07316969e-05f, -3.50253219e-06f, 2.61374005e-06f, 1.17642308e-06f, -7.02440616e-07f,
+    0.00415254688f, 0.238337649f, -0.233151879f, -0.0970807433f, 0.00770744029f, 0.00884986568f, 0.00434040606f, 0.00093345885f, -0.000145414131f, -0.000232172578f, -0.000110454803f, -2.33452869e-05f, 6.00181087e-06f, 7.95654908e-06f, 3.67105391e-06f, 7.11848128e-07f, -2.78439533e-07f, -3.13457582e-07f, -1.43957361e-07f, -3.65619427e-08f,
+    -0.109226215f, 0.317023565f, 0.165827129f, -0.0738719579f, -0.0308532523f, -0.00523594658f, 0.000738284126f, 0.00131733276f, 0.00056838057f, 0.000117343012f, -3.10290889e-05f, -3.8416202e-05f, -1.72238217e-05f, -3.21034248e-06f, 1.31201478e-06f, 1.41500888e-06f, 6.12363465e-07f, 9.68467953e-08f, -6.36294829e-08f, -5.47175167e-08f,
+    -0.0586481029f, 0.144049854f, 0.112749338f, -0.0292236655f, -0.0172490833f, -0.00371556516f, -6.02037899e-05f, 0.000604515017f, 0.000318122692f, 8.68067194e-05f, -4.99200936e-06f, -1.80341078e-05f, -9.80692816e-06f, -2.54263535e-06f, 3.15535254e-07f, 6.79736387e-07f, 3.55468488e-07f, 8.43793901e-08f, -1.88648469e-08f, -2.53405865e-08f,
+    -0.0548194929f, 0.290764889f, 0.201518505f, -0.0873992267f, -0.00479472239f, 0.00214266526f, -0.00203330431f, 0.00065049985f, -0.000142029617f, 8.32115328e-06f, 1.80307375e-05f, -1.01695737e-05f, 4.19565358e-06f, -9.89026371e-07f, 3.70185962e-08f, 1.27187026e-07f, -8.49659813e-08f, 3.41873936e-08f, -9.16129796e-09f, 1.10251899e-09f,
+    -0.121919948f, -0.261520868f, 0.202642338f, 0.0514834471f, -0.0199084656f, 0.00395948309f, -0.00101958828f, -0.000203269013f, 0.000139454679f, -7.84202475e-05f, 2.31618047e-05f, -4.06898823e-06f, -7.55812414e-07f, 1.08195e-06f, -5.34216123e-07f, 1.8304432e-07f, -3.23339012e-08f, -6.5042303e-09f, 9.22473981e-09f, -4.50834425e-09f,
+    -0.0592479707f, -0.169772605f, 0.0869356742f, 0.0365737709f, -0.0101091913f, 0.00188630041f, -0.000330867851f, -0.000176326259f, 8.91693038e-05f, -4.26645763e-05f, 1.04596563e-05f, -1.10564236e-06f, -8.41365495e-07f, 6.8001256e-07f, -2.88584993e-07f, 8.42610715e-08f, -8.35165413e-09f, -7.03990581e-09f, 5.87399182e-09f, -2.5180051e-09f,
+    -0.0286882997f, -0.32551698f, 0.196185072f, 0.110908553f, -0.0531326079f, -0.00642457608f, 0.0108532636f, -0.00197140953f, -0.00170731274f, 0.000958598185f, 9.71936139e-05f, -0.000260763189f, 5.95274786e-05f, 4.65404129e-05f, -3.05160093e-05f, -2.13854809e-06f, 8.85141975e-06f, -2.41777203e-06f, -1.70717039e-06f, 1.53020674e-06f,
+    -0.0890171771f, -0.215327805f, -0.215720363f, 0.103792429f, 0.0279397326f, -0.0221420784f, 0.00128466798f, 0.00394769304f, -0.00145310804f, -0.000434251539f, 0.000471648727f, -4.50219798e-05f, -0.000101835835f, 4.42781432e-05f, 1.17298149e-05f, -1.54090114e-05f, 1.98303167e-06f, 3.40674681e-06f, -1.57125907e-06f, -2.83268834e-07f,
+    -0.0444426607f, -0.080732725f, -0.135475932f, 0.0437232519f, 0.0204443835f, -0.0111291257f, -0.000449804286f, 0.00231000146f, -0.000595975113f, -0.000331636332f, 0.000241206969f, 3.26261691e-06f, -6.04960148e-05f, 1.87333535e-05f, 9.44123557e-06f, -7.98873632e-06f, 1.31634805e-07f, 2.068362e-06f, -6.58958595e-07f, -3.10919549e-07f,
+    -0.014125042f, -0.201122115f, -0.283921952f, 0.0538271467f, 0.0624028761f, 0.00464921373f, -0.00937089175f, -0.00372580993f, 0.000854160618f, 0.00109000697f, 0.000145255553f, -0.000214738067f, -0.000105248564f, 1.97061338e-05f, 3.35431101e-05f, 5.98665531e-06f, -6.92879558e-06f, -3.93868255e-06f, 7.04012396e-07f, 1.51208766e-06f,
+    -0.0911238334f, 0.294687716f, -0.143296825f, -0.128599136f, 0.0102606414f, 0.0223309444f, 0.00443315204f, -0.00302925237f, -0.00185315376f, 0.000101157375f, 0.000460409996f, 0.000122996601f, -7.35215128e-05f, -5.50102275e-05f, 7.20531917e-07f, 1.45822983e-05f, 4.70006789e-06f, -2.25045846e-06f, -1.98014142e-06f, -2.66546316e-07f,
+    -0.0470879457f, 0.178078085f, -0.046690401f, -0.0741631389f, -0.0010547496f, 0.011415181f, 0.00334219446f, -0.00122495776f, -0.00107691862f, -6.00302599e-05f, 0.000230189674f, 8.79977808e-05f, -2.8181047e-05f, -3.13774312e-05f, -3.12236134e-06f, 7.14577626e-06f, 3.22917215e-06f, -7.8765034e-07f, -1.12890155e-06f, -3.00118209e-07f,
+    -0.00543860331f, 0.393494302f, -0.0918065397f, -0.105173835f, -0.00475684828f, 8.59063045e-05f, 0.00138088701f, 0.000687597829f, 0.000194100339f, 4.48859565e-05f, -5.27039364e-06f, -7.14085191e-06f, -4.10912166e-06f, -1.39649452e-06f, -2.9002434e-07f, 2.36855486e-08f, 5.89561941e-08f, 3.30328699e-08f, 1.24709879e-08f, 3.15025136e-09f,
+    -0.129491207f, 0.158353577f, 0.246634674f, -0.0225995487f, -0.0197394659f, -0.00422488565f, -0.00153062214f, -2.3279323e-06f, 8.39393173e-05f, 6.84722183e-05f, 2.61472752e-05f, 6.67193596e-06f, 5.85221052e-07f, -6.6509151e-07f, -4.61025585e-07f, -2.00149082e-07f, -5.42795905e-08f, -4.80688485e-09f, 5.2112016e-09f, 3.57005268e-09f,
+    -0.0684434844f, 0.04325885f, 0.141039195f, -0.00104990331f, -0.0100226405f, -0.00226057854f, -0.000960085008f, -7.31197279e-05f, 2.44435654e-05f, 3.17993034e-05f, 1.44858577e-05f, 4.30222628e-06f, 7.41445493e-07f, -2.08467365e-07f, -2.15380224e-07f, -1.09143412e-07f, -3.50908801e-08f, -6.01496038e-09f, 1.47356775e-09f, 1.57330251e-09f,
+    -0.0540450258f, 0.0718794239f, 0.294931269f, -0.0555686205f, -0.0218815187f, 0.0108299519f, -0.00370222456f, 0.000228440301f, 0.00041875957f, -0.000276723109f, 8.8046809e-05f, -2.3220418e-06f, -1.45236667e-05f, 9.15600258e-06f, -2.76683306e-06f, -7.94847369e-08f, 5.89821698e-07f, -3.47703594e-07f, 1.0108067e-07f, -4.47941273e-09f,
+    -0.100391175f, -0.363656006f, 0.0863491303f, 0.0970906465f, -0.0266149254f, 0.00225624984f, 0.00200504701f, -0.00151988473f, 0.000488328116f, -3.73089195e-05f, -6.41462455e-05f, 4.3592191e-05f, -1.4244975e-05f, 4.08108118e-07f, 2.45382066e-06f, -1.57154345e-06f, 4.82393569e-07f, 1.6365339e-08f, -1.10069657e-07f, 6.45531962e-08f,
+    -0.047852104f, -0.201320754f, 0.0151868954f, 0.05755226f, -0.0118967102f, 7.03258825e-05f, 0.00145558981f, -0.000833887312f, 0.000216473672f, 9.04445078e-06f, -4.33902615e-05f, 2.3474757e-05f, -6.07344999e-06f, -7.39647336e-07f, 1.59697642e-06f, -8.29229068e-07f, 1.95428324e-07f, 4.50697929e-08f, -6.92272299e-08f, 3.48712406e-08f,
+    -0.0234004671f, -0.388095441f, 0.0260658579f, 0.16147882f, -0.013564207f, -0.0275804664f, 0.00511069611f, 0.00509326874f, -0.00166556541f, -0.00101332236f, 0.000515849271f, 0.000198317184f, -0.000155713834f, -3.49418575e-05f, 4.6014254e-05f, 4.27373228e-06f, -1.32499977e-05f, 4.44335973e-07f, 3.48819323e-06f, -8.14061493e-07f,
+    -0.0913812415f, -0.0391899259f, -0.284490096f, 0.0254962463f, 0.0599187979f, -0.00891315389f, -0.0101557138f, 0.00285931185f, 0.00194435469f, -0.00087449123f, -0.000378482583f, 0.000261822432f, 6.87197002e-05f, -7.70650626e-05f, -9.80354523e-06f, 2.22940857e-05f, 2.18946632e-07f, -6.41038114e-06f, 5.17103008e-07f, 2.1899353e-06f,
+    -0.0462534637f, 0.0196877918f, -0.154339315f, -0.00329348993f, 0.0333506992f, -0.00186681705f, -0.00594659216f, 0.000991363665f, 0.00121033157f, -0.0003601109f, -0.000255633638f, 0.000118801423f, 5.29016031e-05f, -3.74176428e-05f, -1.00350479e-05f, 1.14344744e-05f, 1.50186321e-06f, -3.46275675e-06f, -8.90809015e-08f, 1.25219285e-06f,
+    -0.00364865175f, 0.00794482004f, -0.312684205f, -0.0408817686f, 0.0409199545f, 0.0173876803f, 0.00152594898f, -0.00246227942f, -0.00140538434f, -0.00017226692f, 0.000208833322f, 0.000138597121f, 2.216769e-05f, -2.02404764e-05f, -1.52648365e-05f, -2.98688929e-06f, 2.09328977e-06f, 1.76796274e-06f, 3.8933246e-07f, -1.68161899e-07f,
+    -0.0947009444f, 0.363063875f, 0.0160320208f, -0.124616951f, -0.0256953732f, 0.00698425505f, 0.00682405068f, 0.00189112989f, -0.000433353076f, -0.000574852449f, -0.00018646291f, 3.27314316e-05f, 5.71944056e-05f, 2.10890176e-05f, -2.56773351e-06f, -6.23790116e-06f, -2.57635177e-06f, 1.83704325e-07f, 7.60693031e-07f, 4.12346845e-07f,
+    -0.0500879028f, 0.192657279f, 0.0412337879f, -0.0621377576f, -0.0179717094f, 0.00190427868f, 0.00347718205f, 0.00126525433f, -8.40177454e-05f, -0.000288344157f, -0.000121203741f, 2.95363802e-06f, 2.81628645e-05f, 1.33549632e-05f, 2.27468738e-07f, -3.01207502e-06f, -1.59185211e-06f, -8.69330902e-08f, 3.64690289e-07f, 2.37331331e-07f,
+    -0.0324511688f, 0.41600043f, 0.0601880043f, -0.0977804732f, -0.00349967182f, -0.00152960028f, -0.000327152592f, 0.000312035998f, -8.26360551e-06f, 4.11357691e-05f, 1.73218908e-06f, 1.68299337e-06f, 2.63527574e-07f, -2.18500459e-07f, 1.19976798e-08f, -4.40696877e-08f, -1.5224431e-09f, -2.81800665e-09f, -3.24957702e-10f, 1.28600712e-10f,
+    -0.137054161f, -0.0590989852f, 0.256864463f, 0.0140178197f, -0.0146203705f, 0.000193667944f, -0.00140955002f, -4.62384162e-05f, -4.0103713e-05f, -5.70598733e-06f, 7.06261271e-06f, -1.96262028e-07f, 1.1562487e-06f, 3.42382408e-08f, 6.02522283e-08f, 6.01498312e-09f, -5.79248366e-09f, 3.17677371e-10f, -1.43231912e-09f, -2.58382584e-11f,
+    -0.0696470391f, -0.0749880891f, 0.130596562f, 0.0176930486f, -0.00742560375f, 0.000263152064f, -0.000716979429f, -5.72629395e-05f, -2.05085185e-05f, -7.34155782e-06f, 3.58271336e-06f, -2.8056102e-07f, 5.88640712e-07f, 4.10889426e-08f, 3.08557043e-08f, 7.81294166e-09f, -2.92775644e-09f, 4.63930489e-10f, -7.29342127e-10f, -2.72130915e-11f,
+    -0.0403873702f, -0.157065614f, 0.299748643f, 0.0180522862f, -0.0497147653f, 0.0131110671f, 0.00158719598f, -0.00312671012f, 0.00112310944f, 8.7206181e-05f, -0.000274738085f, 0.000115466154f, 3.40721553e-06f, -2.77094312e-05f, 1.31848884e-05f, -2.22623575e-07f, -3.00497183e-06f, 1.57609546e-06f, -5.87291026e-08f, -3.2052181e-07f,
+    -0.0894360432f, -0.341994236f, -0.0709851032f, 0.127661418f, -0.0128381308f, -0.0111919889f, 0.00677493885f, -0.0011155044f, -0.000771444033f, 0.000581073608f, -0.000120634528f, -6.56421877e-05f, 5.89454748e-05f, -1.46705749e-05f, -6.14083923e-06f, 6.54834756e-06f, -1.90275712e-06f, -5.91565165e-07f, 8.01812318e-07f, -3.45612088e-07f,
+    -0.0434390948f, -0.165833728f, -0.0691686574f, 0.0661457923f, -0.00164402666f, -0.00733519101f, 0.00344456038f, -0.000267576617f, -0.000528539408f, 0.000300548416f, -3.55646026e-05f, -4.7054084e-05f, 3.1057009e-05f, -4.92121108e-06f, -4.65106455e-06f, 3.51302236e-06f, -6.99846259e-07f, -4.8003877e-07f, 4.33442188e-07f, -1.50672931e-07f,
+    -0.0202957268f, -0.34525439f, -0.153176913f, 0.139674098f, 0.0396687157f, -0.021896982f, -0.00931391408f, 0.00352949847f, 0.00242127556f, -0.00057460251f, -0.000650778788f, 7.490622e-05f, 0.000176685197f, -4.24022686e-07f, -4.77686801e-05f, -5.26562859e-06f, 1.26836871e-05f, 3.06509676e-06f, -3.10815426e-06f, -1.66455204e-06f,
+    -0.0918505678f, 0.14357893f, -0.259028715f, -0.068152995f, 0.052461551f, 0.0158245301f, -0.00817271291f, -0.00404277623f, 0.00139281706f, 0.00108899437f, -0.000223956606f, -0.000298266985f, 2.55113722e-05f, 8.17920379e-05f, 2.16016506e-06f, -2.22233211e-05f, -3.02874089e-06f, 5.99504747e-06f, 1.32975379e-06f, -1.89781316e-06f,
+    -0.0468264125f, 0.112614583f, -0.122024654f, -0.0509232329f, 0.0238099126f, 0.0107225224f, -0.00338153406f, -0.0025234745f, 0.000489094974f, 0.000640417134f, -5.13074147e-05f, -0.000166782307f, -4.87794978e-06f, 4.36324177e-05f, 6.14563356e-06f, -1.12925618e-05f, -2.94019999e-06f, 2.87437114e-06f, 1.03361702e-06f, -8.37333201e-07f,
+    0.00417474047f, 0.231812674f, -0.2369416f, -0.096175705f, 0.00848135703f, 0.00922004046f, 0.00440315646f, 0.000897556175f, -0.000180885216f, -0.000247390369f, -0.000112493963f, -2.13775522e-05f, 7.72983047e-06f, 8.64241137e-06f, 3.73428374e-06f, 5.99998372e-07f, -3.65612478e-07f, -3.45193677e-07f, -1.45262775e-07f, -3.16832299e-08f,
+    -0.108621907f, 0.320397706f, 0.162033873f, -0.0756793031f, -0.0310918182f, -0.0050944519f, 0.000893717812f, 0.00137995822f, 0.000576977711f, 0.000109193278f, -3.80422705e-05f, -4.11745567e-05f, -1.74717581e-05f, -2.76200559e-06f, 1.65882341e-06f, 1.54151804e-06f, 6.17336884e-07f, 7.13618306e-08f, -8.22166499e-08f, -6.20559309e-08f,
+    -0.0583228212f, 0.146505322f, 0.111123627f, -0.0302741851f, -0.0174557953f, -0.00367890334f, 1.58762867e-05f, 0.00064154105f, 0.000326388417f, 8.4056832e-05f, -8.51068286e-06f, -1.97069765e-05f, -1.01190467e-05f, -2.37553773e-06f, 4.93543744e-07f, 7.58750167e-07f, 3.6721139e-07f, 7.41224967e-08f, -2.86252259e-08f, -2.97572588e-08f,
+    -0.054400712f, 0.296557154f, 0.197597041f, -0.0879157201f, -0.00455799437f, 0.0019425133f, -0.00196412353f, 0.000636547389f, -0.000142540381f, 1.17357502e-05f, 1.62034136e-05f, -9.42051526e-06f, 4.03307076e-06f, -9.99637041e-07f, 7.25215652e-08f, 1.05266488e-07f, -7.64420751e-08f, 3.21538206e-08f, -9.25217551e-09f, 1.41728747e-09f,
+    -0.122627567f, -0.256414797f, 0.205341943f, 0.0501535391f, -0.0196417955f, 0.00388486729f, -0.00105231673f, -0.00018326397f, 0.000128332315f, -7.51317857e-05f, 2.27059452e-05f, -4.30579882e-06f, -5.11213706e-07f, 9.65518579e-07f, -4.95415363e-07f, 1.7760348e-07f, -3.50831557e-08f, -3.67450182e-09f, 7.77835226e-09f, -4.009606e-09f,
+    -0.0596605775f, -0.167653723f, 0.088766701f, 0.0359194313f, -0.00999062438f, 0.00186718332f, -0.000355418087f, -0.00016421871f, 8.3293209e-05f, -4.12653555e-05f, 1.04059482e-05f, -1.30959324e-06f, -6.94124934e-07f, 6.19052951e-07f, -2.71593355e-07f, 8.36395962e-08f, -1.07033443e-08f, -5.32015047e-09f, 5.11254239e-09f, -2.28493903e-09f,
+    -0.0288878583f, -0.321779258f, 0.200773366f, 0.108381378f, -0.0537341177f, -0.00560347536f, 0.0107293657f, -0.00215807545f, -0.00160819455f, 0.000977836235f, 6.16034905e-05f, -0.000253929631f, 6.76757926e-05f, 4.16181339e-05f, -3.12172375e-05f, -4.0629921e-07f, 8.44633879e-06f, -2.78766782e-06f, -1.46444632e-06f, 1.52985418e-06f,
+    -0.0889632374f, -0.22035842f, -0.212151152f, 0.105524823f, 0.0265756865f, -0.0221354326f, 0.00164800693f, 0.00382126217f, -0.00151250226f, -0.000377368671f, 0.000469062047f, -6.08392111e-05f, -9.54969587e-05f, 4.67606565e-05f, 8.94412691e-06f, -1.51700008e-05f, 2.74943135e-06f, 3.05797547e-06f, -1.69939257e-06f, -1.00934907e-07f,
+    -0.0443873926f, -0.0837817488f, -0.134049272f, 0.0449013934f, 0.0197807793f, -0.0112100601f, -0.000243672509f, 0.00226200769f, -0.00063785485f, -0.000303345891f, 0.00024352193f, -5.8694603e-06f, -5.79668076e-05f, 2.05670374e-05f, 8.03051919e-06f, -8.04161838e-06f, 5.81993168e-07f, 1.92108595e-06f, -7.52479379e-07f, -2.13755572e-07f,
+    -0.0143351743f, -0.206890593f, -0.281242896f, 0.0569754574f, 0.0624498962f, 0.00388013956f, -0.00964848835f, -0.00360541969f, 0.00097377997f, 0.0010965395f, 0.000112649638f, -0.000228013734f, -0.000100208004f, 2.54434253e-05f, 3.40473474e-05f, 4.4329455e-06f, -7.63426642e-06f, -3.72844297e-06f, 9.88939379e-07f, 1.58647719e-06f,
+    -0.0911242549f, 0.291025863f, -0.147906989f, -0.127672535f, 0.0117059672f, 0.0225593415f, 0.00412412819f, -0.00319810259f, -0.00182312738f, 0.000160000333f, 0.000472059623f, 0.000109734368f, -8.16142094e-05f, -5.38842918e-05f, 3.55094965e-06f, 1.52378283e-05f, 4.06615397e-06f, -2.67414782e-06f, -1.91548714e-06f, -9.13140265e-08f,
+    -0.0470609343f, 0.176721553f, -0.0494098581f, -0.0739937381f, -0.000292181196f, 0.011615984f, 0.00320664172f, -0.0013272374f, -0.00107335922f, -2.93997262e-05f, 0.000239778103f, 8.231972e-05f, -3.30131559e-05f, -3.13751818e-05f, -1.66798726e-06f, 7.65660191e-06f, 2.96513004e-06f, -1.03516091e-06f, -1.12416321e-06f, -2.14555735e-07f,
+    -0.00473207675f, 0.390383043f, -0.0967006669f, -0.105297907f, -0.0046532218f, 0.00024142302f, 0.00146131443f, 0.000709940998f, 0.000198585785f, 4.30989133e-05f, -6.82435578e-06f, -7.96668042e-06f, -4.37488659e-06f, -1.43774605e-06f, -2.72675277e-07f, 4.26244032e-08f, 6.84856195e-08f, 3.62593956e-08f, 1.30126688e-08f, 3.05754525e-09f,
+    -0.128949593f, 0.164732746f, 0.245200301f, -0.0239946633f, -0.0200589468f, -0.00435001558f, -0.00151872607f, 1.30025233e-05f, 9.46887983e-05f, 7.25471319e-05f, 2.7076669e-05f, 6.64365584e-06f, 3.9247415e-07f, -7.80760047e-07f, -5.08029443e-07f, -2.11202187e-07f, -5.38164698e-08f, -2.56403615e-09f, 6.65508514e-09f, 4.14236691e-09f,
+    -0.0682217967f, 0.046961565f, 0.140776946f, -0.00177550604f, -0.0102025263f, -0.00234330403f, -0.000962124557f, -6.73107714e-05f, 2.96916017e-05f, 3.41525013e-05f, 1.51424409e-05f, 4.37341672e-06f, 6.66638046e-07f, -2.65708278e-07f, -2.42208006e-07f, -1.17004334e-07f, -3.58398352e-08f, -5.15808566e-09f, 2.18564165e-09f, 1.88767946e-09f,
+    -0.0542979942f, 0.0795109273f, 0.293102824f, -0.0572242253f, -0.0210557205f, 0.010547559f, -0.00371205413f, 0.000289042688f, 0.000382088629f, -0.000266082725f, 8.91353365e-05f, -5.31004249e-06f, -1.28182285e-05f, 8.70677891e-06f, -2.85108102e-06f, 7.56544975e-08f, 5.07214012e-07f, -3.2861507e-07f, 1.07270087e-07f, -1.18735326e-08f,
+    -0.100971608f, -0.362306972f, 0.0909425043f, 0.0956575677f, -0.0266026796f, 0.00248691138f, 0.00184385132f, -0.00147114203f, 0.000489552511f, -4.87891048e-05f, -5.71215531e-05f, 4.15301836e-05f, -1.44459667e-05f, 9.92480764e-07f, 2.11740565e-06f, -1.48153591e-06f, 4.98625298e-07f, -1.46815159e-08f, -9.26068678e-08f, 5.89202038e-08f,
+    -0.0481278267f, -0.201383461f, 0.0178110162f, 0.0569585957f, -0.0119743838f, 0.000222276306f, 0.00137074339f, -0.000814178873f, 0.000220920748f, 1.82574343e-06f, -3.97604506e-05f, 2.26862059e-05f, -6.3576457e-06f, -3.81607631e-07f, 1.4264837e-06f, -7.97403606e-07f, 2.12670675e-07f, 2.65404833e-08f, -6.05665568e-08f, 3.26394959e-08f,
+    -0.0234495459f, -0.387735195f, 0.0319747206f, 0.160921017f, -0.0152715854f, -0.0272372038f, 0.00554554527f, 0.00494004121f, -0.00177624326f, -0.000953371295f, 0.000542241966f, 0.000176496588f, -0.00016120022f, -2.74048151e-05f, 4.67985333e-05f, 1.78003044e-06f, -1.31952388e-05f, 1.25030018e-06f, 3.39766815e-06f, -1.12038918e-06f,
+    -0.0913374516f, -0.0451610549f, -0.283719142f, 0.0284952309f, 0.0594264438f, -0.00966234538f, -0.0099266339f, 0.00304901443f, 0.00185305749f, -0.000920491841f, -0.000344870337f, 0.000271827038f, 5.70002379e-05f, -7.87258363e-05f, -5.89816042e-06f, 2.23203397e-05f, -1.02230867e-06f, -6.24382034e-06f, 8.68809261e-07f, 2.04829326e-06f,
+    -0.0462193972f, 0.0164838351f, -0.154532476f, -0.00164403783f, 0.0332642301f, -0.00230051342f, -0.00586964337f, 0.00110814903f, 0.0011732121f, -0.000390812111f, -0.000240480659f, 0.000126394003f, 4.72321329e-05f, -3.90855906e-05f, -8.03705803e-06f, 1.17079344e-05f, 8.35147461e-07f, -3.45796569e-06f, 1.07654473e-07f, 1.20866342e-06f,
+    -0.00394086526f, 0.000664843269f, -0.313461261f, -0.0382776351f, 0.0419937896f, 0.0173733614f, 0.00124782009f, -0.00260149084f, -0.00140760364f, -0.000137489551f, 0.000227873771f, 0.00013954856f, 1.76039057e-05f, -2.29470693e-05f, -1.54899352e-05f, -2.37288141e-06f, 2.48782879e-06f, 1.81181841e-06f, 2.97489695e-07f, -2.37336948e-07f,
+    -0.0944570383f, 0.362479805f, 0.0108137826f, -0.125631452f, -0.0249913679f, 0.00755019159f, 0.00695202453f, 0.00181414872f, -0.00050551086f, -0.00059315761f, -0.000177276599f, 4.24563546e-05f, 5.99527388e-05f, 1.996161e-05f, -3.91885278e-06f, -6.66155666e-06f, -2.43898018e-06f, 3.71066071e-07f, 8.2442464e-07f, 4.05656564e-07f,
+    -0.0499222897f, 0.193088157f, 0.0385444844f, -0.0629427618f, -0.0177089558f, 0.00220637591f, 0.00357405327f, 0.00123877933f, -0.000122164871f, -0.000301699519f, -0.000118297434f, 8.02973874e-06f, 3.01062335e-05f, 1.30368624e-05f, -4.68298872e-07f, -3.30161369e-06f, -1.5598504e-06f, 8.24926348e-09f, 4.08202928e-07f, 2.40985021e-07f,
+    -0.0314671925f, 0.417569892f, 0.0554566175f, -0.0980358456f, -0.00357005088f, -0.00155827827f, -0.000286941031f, 0.000311748961f, -2.30998223e-06f, 4.14669849e-05f, 1.96142825e-06f, 1.72738839e-06f, 2.0858029e-07f, -2.17654572e-07f, 1.10272228e-09f, -4.46091395e-08f, -2.1877618e-09f, -2.89929334e-09f, -2.50652613e-10f, 1.25410889e-10f,
+    -0.13718312f, -0.052046264f, 0.257514575f, 0.0129413653f, -0.0146181136f, 5.93876649e-05f, -0.00141554028f, -4.97455136e-05f, -4.08071413e-05f, -4.38002554e-06f, 7.05842928e-06f, 2.92376305e-08f, 1.1654632e-06f, 4.53557403e-08f, 6.14349779e-08f, 4.15086999e-09f, -5.78285786e-09f, -1.11135792e-10f, -1.44901061e-09f, -5.88860632e-11f,
+    -0.069810381f, -0.071405499f, 0.131422288f, 0.0171488363f, -0.00741615273f, 0.000194640532f, -0.000724291724f, -5.91102879e-05f, -2.15036283e-05f, -6.67077501e-06f, 3.55607748e-06f, -1.65090304e-07f, 5.99227584e-07f, 4.69305821e-08f, 3.26218283e-08f, 6.87726138e-09f, -2.85268576e-09f, 2.44011626e-10f, -7.45920943e-10f, -4.44929331e-11f,
+    -0.0407777123f, -0.150448408f, 0.301267748f, 0.0151834754f, -0.0490001938f, 0.0133500708f, 0.00127706565f, -0.00302553484f, 0.00114746075f, 4.81852545e-05f, -0.000260107482f, 0.000117818636f, -1.74097176e-06f, -2.55366242e-05f, 1.33812226e-05f, -9.1678906e-07f, -2.67662544e-06f, 1.58582439e-06f, -1.60333651e-07f, -2.58359571e-07f,
+    -0.0896014735f, -0.344459219f, -0.065873654f, 0.127373311f, -0.013756952f, -0.0106658445f, 0.00671779811f, -0.00121763159f, -0.000703504508f, 0.000570865779f, -0.000132834626f, -5.63877143e-05f, 5.71587189e-05f, -1.6165716e-05f, -4.84697268e-06f, 6.24411156e-06f, -2.08501938e-06f, -4.11756092e-07f, 7.5357917e-07f, -3.59486848e-07f,
+    -0.043480339f, -0.167815963f, -0.066610592f, 0.0662850058f, -0.00220596033f, -0.00707969593f, 0.00344613763f, -0.000332410723f, -0.000494882405f, 0.000299156614f, -4.35798811e-05f, -4.2369318e-05f, 3.06401323e-05f, -5.94343263e-06f, -3.98227871e-06f, 3.42317024e-06f, -8.31103803e-07f, -3.8526601e-07f, 4.18326841e-07f, -1.64538363e-07f,
+    -0.0203584703f, -0.348195294f, -0.147945611f, 0.141482135f, 0.0382554531f, -0.0225300571f, -0.0089897424f, 0.00375024874f, 0.00234939902f, -0.000649475155f, -0.000637293387f, 9.96036352e-05f, 0.000175313996f, -8.33840303e-06f, -4.82456294e-05f, -2.80546829e-06f, 1.31085697e-05f, 2.31532441e-06f, -3.29653343e-06f, -1.39704827e-06f,
+    -0.0918802502f, 0.138061537f, -0.26129802f, -0.0654624993f, 0.0533531972f, 0.0151935291f, -0.00849238605f, -0.00389509305f, 0.0015045025f, 0.00105699437f, -0.000261762935f, -0.000292704729f, 3.79336535e-05f, 8.14804673e-05f, -1.79766753e-06f, -2.25898904e-05f, -1.81453456e-06f, 6.27237733e-06f, 9.94685517e-07f, -2.07546706e-06f,
+    -0.0468301494f, 0.10998674f, -0.123762136f, -0.0496800007f, 0.0244287207f, 0.0104524392f, -0.0035850278f, -0.00246778041f, 0.000555967928f, 0.000631159715f, -7.28289193e-05f, -0.00016638854f, 1.87730467e-06f, 4.42899016e-05f, 4.08809972e-06f, -1.17438557e-05f, -2.33792028e-06f, 3.10014791e-06f, 8.74813924e-07f, -9.59819004e-07f,
+    0.00417903936f, 0.225219692f, -0.240663702f, -0.095220338f, 0.00927811248f, 0.00959123187f, 0.00446008925f, 0.000857204228f, -0.000217998798f, -0.000262564685f, -0.000114068865f, -1.90917947e-05f, 9.55971869e-06f, 9.31708918e-06f, 3.76332665e-06f, 4.6716944e-07f, -4.58616661e-07f, -3.75563018e-07f, -1.44029962e-07f, -2.53658609e-08f,
+    -0.108025454f, 0.323651711f, 0.158172319f, -0.0774858846f, -0.031313439f, -0.00493835255f, 0.00105435092f, 0.00144246105f, 0.000584014678f, 9.99719661e-05f, -4.54016278e-05f, -4.38946746e-05f, -1.76020268e-05f, -2.2411377e-06f, 2.02597651e-06f, 1.66357625e-06f, 6.14030423e-07f, 4.12699674e-08f, -1.01964471e-07f, -6.92697179e-08f,
+    -0.057999916f, 0.148903991f, 0.109455106f, -0.0313294371f, -0.0176558955f, -0.00363460613f, 9.53148301e-05f, 0.000678963073f, 0.000333996163f, 8.07333118e-05f, -1.22615028e-05f, -2.13925834e-05f, -1.03792151e-05f, -2.16871641e-06f, 6.85928039e-07f, 8.37581144e-07f, 3.75157796e-07f, 6.1272715e-08f, -3.92675183e-08f, -3.4257573e-08f,
+    -0.0539571748f, 0.302245694f, 0.193634586f, -0.088411427f, -0.00433747122f, 0.00174840189f, -0.00189586908f, 0.000622263586f, -0.000142476044f, 1.48559754e-05f, 1.44944315e-05f, -8.69284908e-06f, 3.86393563e-06f, -1.00118322e-06f, 1.02785923e-07f, 8.52968252e-08f, -6.83172271e-08f, 3.00215273e-08f, -9.19922294e-09f, 1.65547381e-09f,
+    -0.12332763f, -0.251212273f, 0.207975366f, 0.0488353835f, -0.0193784363f, 0.00380589965f, -0.00108254637f, -0.000164629721f, 0.00011760336f, -7.18661433e-05f, 2.2190592e-05f, -4.49209828e-06f, -2.8973003e-07f, 8.56399066e-07f, -4.57163732e-07f, 1.71195742e-07f, -3.70266906e-08f, -1.2326889e-09f, 6.45761463e-09f, -3.53503381e-09f,
+    -0.060071702f, -0.165473527f, 0.0905667426f, 0.0352693526f, -0.00987217092f, 0.0018451373f, -0.000378541373f, -0.000152808037f, 7.75677845e-05f, -3.98480857e-05f, 1.0308336e-05f, -1.4844193e-06f, -5.58530093e-07f, 5.61054306e-07f, -2.54352923e-07f, 8.23009547e-08f, -1.25842736e-08f, -3.79692493e-09f, 4.4031595e-09f, -2.05681391e-09f,
+    -0.0290939197f, -0.317938388f, 0.205288631f, 0.10581371f, -0.0542887092f, -0.0047863514f, 0.0105885997f, -0.00233648356f, -0.00150610581f, 0.000992888143f, 2.65839018e-05f, -0.00024582642f, 7.51297274e-05f, 3.65188245e-05f, -3.16079266e-05f, 1.26836394e-06f, 7.95502292e-06f, -3.10476929e-06f, -1.20895914e-06f, 1.50283823e-06f,
+    -0.0889119214f, -0.225334217f, -0.208508149f, 0.107198465f, 0.0252046877f, -0.0221020894f, 0.00200307097f, 0.00368801511f, -0.00156612717f, -0.000320276947f, 0.000464316602f, -7.58896261e-05f, -8.86934422e-05f, 4.87947139e-05f, 6.16970554e-06f, -1.47803411e-05f, 3.45375005e-06f, 2.68304645e-06f, -1.79713818e-06f, 7.42314044e-08f,
+    -0.0443328333f, -0.0868120907f, -0.132576341f, 0.0460524608f, 0.0191087459f, -0.0112764108f, -4.02147349e-05f, 0.00220954433f, -0.000676971868f, -0.000274513562f, 0.000244629673f, -1.47245746e-05f, -5.51186156e-05f, 2.21803645e-05f, 6.59366351e-06f, -8.0083499e-06f, 1.00824025e-06f, 1.75441181e-06f, -8.31146632e-07f, -1.1764088e-07f,
+    -0.0145403706f, -0.212586366f, -0.278463332f, 0.060110271f, 0.062449345f, 0.0030964834f, -0.00991312418f, -0.00347442577f, 0.00109267911f, 0.00109891277f, 7.87171704e-05f, -0.00024030532f, -9.43253659e-05f, 3.11511847e-05f, 3.42457921e-05f, 2.7755774e-06f, -8.27145995e-06f, -3.45742023e-06f, 1.26932788e-06f, 1.63557823e-06f,
+    -0.0911286408f, 0.287285248f, -0.152466848f, -0.126679931f, 0.0131561782f, 0.022763116f, 0.00380328791f, -0.00336218251f, -0.00178686807f, 0.000219492627f, 0.00048170565f, 9.54798434e-05f, -8.93720671e-05f, -5.22832612e-05f, 6.44295989e-06f, 1.57516383e-05f, 3.35747745e-06f, -3.07874223e-06f, -1.8186219e-06f, 9.43273228e-08f,
+    -0.0470365356f, 0.175316226f, -0.0521127325f, -0.0737880699f, 0.000477812973f, 0.011805222f, 0.00306348842f, -0.0014280752f, -0.00106641479f, 2.00528597e-06f, 0.000248438751f, 7.60122953e-05f, -3.77544408e-05f, -3.11172106e-05f, -1.49137595e-07f, 8.10279629e-06f, 2.65422464e-06f, -1.27882549e-06f, -1.10181341e-06f, -1.20825099e-07f,
+    -0.00404580463f, 0.387132597f, -0.101585184f, -0.105406642f, -0.00453518945f, 0.000404737495f, 0.0015437344f, 0.000732508553f, 0.000202653353f, 4.10178109e-05f, -8.52389605e-06f, -8.83484684e-06f, -4.64273433e-06f, -1.47217499e-06f, -2.49932738e-07f, 6.40312266e-08f, 7.87428009e-08f, 3.95172553e-08f, 1.34392092e-08f, 2.88764221e-09f,
+    -0.128394891f, 0.171048122f, 0.24369183f, -0.0254069956f, -0.0203856049f, -0.00447242824f, -0.00150453514f, 2.97868595e-05f, 0.000105974403f, 7.67135843e-05f, 2.7970888e-05f, 6.56755887e-06f, 1.73921757e-07f, -9.06067942e-07f, -5.56699783e-07f, -2.21598224e-07f, -5.25533976e-08f, 1.23235127e-10f, 8.26470471e-09f, 4.75548108e-09f,
+    -0.0679911206f, 0.0506444041f, 0.140474698f, -0.00251173444f, -0.010387717f, -0.0024253951f, -0.000963156581f, -6.07537601e-05f, 3.52675821e-05f, 3.6584934e-05f, 1.57955214e-05f, 4.42361802e-06f, 5.78337047e-07f, -3.2878412e-07f, -2.70484249e-07f, -1.24773483e-07f, -3.62393898e-08f, -4.06814398e-09f, 2.99788156e-09f, 2.23181813e-09f,
+    -0.054537008f, 0.0871298959f, 0.291181995f, -0.058833436f, -0.0202444971f, 0.0102604257f, -0.00371454559f, 0.000345581029f, 0.000346376874f, -0.000255033589f, 8.96833505e-05f, -8.01990154e-06f, -1.11688251e-05f, 8.22553357e-06f, -2.89846495e-06f, 2.1311758e-07f, 4.27608821e-07f, -3.0710237e-07f, 1.10906252e-07f, -1.80234097e-08f,
+    -0.101564071f, -0.360826467f, 0.095489467f, 0.0942114611f, -0.0265693572f, 0.00270378547f, 0.00168619121f, -0.00142136055f, 0.000489011181f, -5.92941886e-05f, -5.03287201e-05f, 3.93775685e-05f, -1.45228327e-05f, 1.51279384e-06f, 1.79424888e-06f, -1.38451773e-06f, 5.0662332e-07f, -4.17687031e-08f, -7.58821463e-08f, 5.30156871e-08f,
+    -0.0484113404f, -0.201375473f, 0.0204197236f, 0.0563533995f, -0.0120393613f, 0.000367371999f, 0.00128703067f, -0.000793501105f, 0.000224329083f, -4.91570317e-06f, -3.61984483e-05f, 2.18207039e-05f, -6.56993958e-06f, -5.43808991e-08f, 1.25924014e-06f, -7.60013799e-07f, 2.25215818e-07f, 9.86933992e-09f, -5.20343165e-08f, 3.01340208e-08f,
+    -0.0235010318f, -0.387265307f, 0.0378721222f, 0.160286591f, -0.0169624126f, -0.0268641653f, 0.00596910778f, 0.00477655339f, -0.00188103393f, -0.000890326216f, 0.000565964111f, 0.000153894685f, -0.000165584306f, -1.97348843e-05f, 4.71603403e-05f, -7.01901836e-07f, -1.29897103e-05f, 2.02792541e-06f, 3.26052773e-06f, -1.40273655e-06f,
+    -0.0912915406f, -0.0511243553f, -0.28284963f, 0.0314764047f, 0.0588915413f, -0.0103973984f, -0.00968221299f, 0.00323083487f, 0.00175691222f, -0.000962775802f, -0.000309951891f, 0.000280254794f, 4.50176839e-05f, -7.97684051e-05f, -1.98222459e-06f, 2.21195362e-05f, -2.23757178e-06f, -5.99730324e-06f, 1.20453979e-06f, 1.87411458e-06f,
+    -0.046183949f, 0.0132731719f, -0.154672413f, 3.66812645e-06f, 0.0331535282f, -0.00272973743f, -0.00578339383f, 0.00122179885f, 0.00113291078f, -0.000419856046f, -0.000224357671f, 0.000133228607f, 4.13087705e-05f, -4.04383957e-05f, -5.98971251e-06f, 1.18593518e-05f, 1.66634413e-07f, -3.40768067e-06f, 3.00723684e-07f, 1.14532507e-06f,
+    -0.00423469397f, -0.00659556569f, -0.314126754f, -0.0356313795f, 0.0430550151f, 0.0173347289f, 0.000959425501f, -0.00273858607f, -0.00140514002f, -0.000100641711f, 0.000246608273f, 0.000139657161f, 1.26477456e-05f, -2.56144998e-05f, -1.55692593e-05f, -1.68712691e-06f, 2.87858219e-06f, 1.83172582e-06f, 1.92817679e-07f, -3.08492657e-07f,
+    -0.0942240238f, 0.361780496f, 0.00558354225f, -0.126596336f, -0.024253013f, 0.00812026905f, 0.00707017397f, 0.00172993499f, -0.000578711661f, -0.000609699058f, -0.000166719202f, 5.2415375e-05f, 6.24108413e-05f, 1.85864509e-05f, -5.31862813e-06f, -7.03567115e-06f, -2.25793596e-06f, 5.67732912e-07f, 8.78990392e-07f, 3.90247405e-07f,
+    -0.0497623144f, 0.19345615f, 0.0358377082f, -0.0637258102f, -0.0174267283f, 0.0025131652f, 0.00366676978f, 0.00120824698f, -0.000161349971f, -0.000314332253f, -0.00011463086f, 1.33176659e-05f, 3.19307123e-05f, 1.25829634e-05f, -1.20508523e-06f, -3.57226031e-06f, -1.50422478e-06f, 1.10872344e-07f, 4.48173703e-07f, 2.40205835e-07f,
+    -0.0304785109f, 0.418990051f, 0.050711067f, -0.0982905076f, -0.00364239179f, -0.00158242093f, -0.000246661795f, 0.000312220295f, 3.69753652e-06f, 4.18204527e-05f, 2.19684321e-06f, 1.75903947e-06f, 1.53390103e-07f, -2.19306617e-07f, -9.94929117e-09f, -4.52847752e-08f, -2.86971983e-09f, -2.95214575e-09f, -1.7553748e-10f, 1.28790074e-10f,
+    -0.137287481f, -0.0449746764f, 0.258102442f, 0.0118639843f, -0.0146263622f, -7.55302014e-05f, -0.00142166851f, -5.33205883e-05f, -4.12847114e-05f, -3.04946712e-06f, 7.09422654e-06f, 2.56778164e-07f, 1.17633623e-06f, 5.66490373e-08f, 6.20622407e-08f, 2.26799974e-09f, -5.89378741e-09f, -5.46163733e-10f, -1.47382392e-09f, -9.24697711e-11f,
+    -0.0699611629f, -0.067798075f, 0.13221659f, 0.0166041845f, -0.00741208911f, 0.000125330817f, -0.000731686791f, -6.10728036e-05f, -2.23843778e-05f, -6.00003228e-06f, 3.55008233e-06f, -4.72255933e-08f, 6.10726441e-07f, 5.31259968e-08f, 3.41090486e-08f, 5.94606708e-09f, -2.84006289e-09f, 1.785724e-11f, -7.66915422e-10f, -6.27418813e-11f,
+    -0.0411708133f, -0.143764259f, 0.302676233f, 0.0123352689f, -0.0482612626f, 0.0135646968f, 0.000973390063f, -0.00292014427f, 0.001167114f, 1.06268608e-05f, -0.000244845189f, 0.000119330577f, -6.58910456e-06f, -2.32785711e-05f, 1.34341482e-05f, -1.55291093e-06f, -2.33851922e-06f, 1.57245779e-06f, -2.51196501e-07f, -1.97205491e-07f,
+    -0.0897781274f, -0.346818884f, -0.0607466172f, 0.127029066f, -0.0146459875f, -0.0101389505f, 0.00664959589f, -0.00131330188f, -0.000635858252f, 0.000558732731f, -0.000143789224f, -4.72646519e-05f, 5.50579933e-05f, -1.7434178e-05f, -3.58916459e-06f, 5.8909104e-06f, -2.22741517e-06f, -2.39921312e-07f, 6.96953369e-07f, -3.65555574e-07f,
+    -0.0435272296f, -0.169749288f, -0.0640332819f, 0.0663923808f, -0.00275452691f, -0.00682132228f, 0.00344117343f, -0.000394241946f, -0.000460898915f, 0.000296589802f, -5.09973772e-05f, -3.76677604e-05f, 3.00251214e-05f, -6.85379048e-06f, -3.31785047e-06f, 3.30123637e-06f, -9.42144888e-07f, -2.9234524e-07f, 3.97628084e-07f, -1.7414204e-07f,
+    -0.0204183129f, -0.351036245f, -0.142662787f, 0.143224224f, 0.0368100998f, -0.0231395348f, -0.00864930319f, 0.00396358684f, 0.00227023902f, -0.000722396055f, -0.00062080509f, 0.000123934403f, 0.000172780716f, -1.62583233e-05f, -4.82967688e-05f, -2.90821214e-07f, 1.33861292e-05f, 1.52496142e-06f, -3.44023476e-06f, -1.1017403e-06f,
+    -0.0919083898f, 0.132508692f, -0.263476834f, -0.0627370659f, 0.0542076358f, 0.0145428041f, -0.00879931266f, -0.00373792095f, 0.00161238393f, 0.0010208804f, -0.000298630942f, -0.000285484535f, 5.02078649e-05f, 8.05386758e-05f, -5.77648448e-06f, -2.27284925e-05f, -5.67090536e-07f, 6.46943e-06f, 6.42396552e-07f, -2.2199153e-06f,
+    -0.0468333593f, 0.107330324f, -0.12545692f, -0.0484116574f, 0.0250310672f, 0.0101694874f, -0.00378342138f, -0.00240628578f, 0.000621569479f, 0.000619514691f, -9.41616563e-05f, -0.000165075349f, 8.67404921e-06f, 4.46127624e-05f, 1.97528085e-06f, -1.20795208e-05f, -1.70267384e-06f, 3.28742246e-06f, 7.02209167e-07f, -1.06752168e-06f,
+    0.00416590084f, 0.218561534f, -0.244316226f, -0.0942139197f, 0.0100973344f, 0.00996276826f, 0.00451077794f, 0.000812289323f, -0.000256695368f, -0.000277610618f, -0.00011513208f, -1.6478314e-05f, 1.14842259e-05f, 9.97215224e-06f, 3.75402252e-06f, 3.12741339e-07f, -5.56705355e-07f, -4.0383453e-07f, -1.39915525e-07f, -1.75241495e-08f,
+    -0.107437257f, 0.326784804f, 0.154243514f, -0.079290388f, -0.0315171348f, -0.00476740187f, 0.00122002836f, 0.00150461394f, 0.000589362022f, 8.96521852e-05f, -5.30861491e-05f, -4.65517853e-05f, -1.7602224e-05f, -1.64586769e-06f, 2.41117345e-06f, 1.7789213e-06f, 6.01443428e-07f, 6.49546053e-09f, -1.22633436e-07f, -7.61743551e-08f,
+    -0.0576796454f, 0.151245177f, 0.107744129f, -0.0323888018f, -0.0178488278f, -0.0035824742f, 0.000178073617f, 0.000716672348f, 0.000340871149f, 7.68131103e-05f, -1.62382309e-05f, -2.30787848e-05f, -1.05800948e-05f, -1.92030256e-06f, 8.91898022e-07f, 9.15091762e-07f, 3.78698332e-07f, 4.5713774e-08f, -5.07001254e-08f, -3.875235e-08f,
+    -0.0534890073f, 0.307828314f, 0.189632448f, -0.0888873568f, -0.00413275882f, 0.00156032627f, -0.00182861393f, 0.000607732964f, -0.000141878057f, 1.76977505e-05f, 1.29021016e-05f, -7.98874542e-06f, 3.69034949e-06f, -9.94809505e-07f, 1.28210865e-07f, 6.7219326e-08f, -6.06354726e-08f, 2.78359339e-08f, -9.02775266e-09f, 1.82650909e-09f,
+    -0.124019354f, -0.245915238f, 0.210542717f, 0.0475290165f, -0.0191188576f, 0.00372284156f, -0.00111041812f, -0.000147330082f, 0.000107273255f, -6.86359003e-05f, 2.16251372e-05f, -4.63198275e-06f, -9.0191014e-08f, 7.54656644e-07f, -4.197576e-07f, 1.64034834e-07f, -3.82616492e-08f, 8.48520567e-10f, 5.2620851e-09f, -3.0884735e-09f,
+    -0.0604809175f, -0.163232824f, 0.092335736f, 0.0346236557f, -0.00975412012f, 0.00182030217f, -0.000400305446f, -0.000142083558f, 7.20001451e-05f, -3.84211009e-05f, 1.01719977e-05f, -1.63208152e-06f, -4.34172961e-07f, 5.06169018e-07f, -2.37062734e-07f, 8.03651115e-08f, -1.40416767e-08f, -2.46035856e-09f, 3.74822139e-09f, -1.83665377e-09f,
+    -0.0293065284f, -0.313994842f, 0.20972927f, 0.103207232f, -0.0547962446f, -0.00397437042f, 0.0104314674f, -0.00250627648f, -0.0014014529f, 0.00100377273f, -7.69386475e-06f, -0.000236535945f, 8.18529317e-05f, 3.1291638e-05f, -3.16941361e-05f, 2.86854627e-06f, 7.38693835e-06f, -3.36674714e-06f, -9.45245128e-07f, 1.45093374e-06f,
+    -0.0888634692f, -0.230253734f, -0.204792607f, 0.108812674f, 0.0238281373f, -0.0220423785f, 0.00234923908f, 0.00354841562f, -0.00161389843f, -0.000263226924f, 0.000457485551f, -9.00975709e-05f, -8.148825e-05f, 5.03759555e-05f, 3.43373068e-06f, -1.42495281e-05f, 4.08914282e-06f, 2.28835308e-06f, -1.86401004e-06f, 2.39330377e-07f,
+    -0.044279105f, -0.0898229415f, -0.131057641f, 0.0471759279f, 0.0184290117f, -0.0113282351f, 0.000160188706f, 0.00215282129f, -0.00071323993f, -0.000245274403f, 0.000244551532f, -2.32540493e-05f, -5.19811828e-05f, 2.35659575e-05f, 5.14574967e-06f, -7.89223987e-06f, 1.40575733e-06f, 1.57150077e-06f, -8.94232923e-07f, -2.43022313e-08f,
+    -0.0147406111f, -0.218208424f, -0.275584234f, 0.0632297573f, 0.0624008426f, 0.00229924988f, -0.0101641035f, -0.00333303039f, 0.00121043102f, 0.00109703658f, 4.36102335e-05f, -0.000251510791f, -8.76229053e-05f, 3.67783279e-05f, 3.41269023e-05f, 1.03026102e-06f, -8.82950815e-06f, -3.12712575e-06f, 1.54042707e-06f, 1.6572451e-06f,
+    -0.0911367775f, 0.283467035f, -0.156974881f, -0.125621588f, 0.014609916f, 0.0229417228f, 0.00347114323f, -0.00352097749f, -0.00174439677f, 0.000279387407f, 0.00048925341f, 8.03003069e-05f, -9.67277166e-05f, -5.02076408e-05f, 9.36905647e-06f, 1.61130748e-05f, 2.58081274e-06f, -3.45750856e-06f, -1.69002945e-06f, 2.87287976e-07f,
+    -0.0470146379f, 0.173862622f, -0.0547981306f, -0.0735460932f, 0.00125455317f, 0.0119825049f, 0.00291293506f, -0.00152717765f, -0.00105605268f, 3.40630287e-05f, 0.000256105717f, 6.91007281e-05f, -4.2366819e-05f, -3.05985124e-05f, 1.42076268e-06f, 8.47707243e-06f, 2.29893261e-06f, -1.51490791e-06f, -1.06161736e-06f, -2.03469544e-08f,
+    -0.00338018626f, 0.383744158f, -0.10645897f, -0.105499037f, -0.004402166f, 0.000575963047f, 0.00162812289f, 0.000755225222f, 0.000206255874f, 3.86209249e-05f, -1.03740903e-05f, -9.74422468e-06f, -4.91061736e-06f, -1.49843305e-06f, -2.21239693e-07f, 8.80341976e-08f, 8.96998796e-08f, 4.27574097e-08f, 1.37191434e-08f, 2.62764904e-09f,
+    -0.127827777f, 0.177297482f, 0.24210879f, -0.0268367617f, -0.0207190727f, -0.00459185295f, -0.00148788716f, 4.80808166e-05f, 0.000117798292f, 8.09605234e-05f, 2.88198022e-05f, 6.43864519e-06f, -7.20777011e-08f, -1.04109689e-06f, -6.0673571e-07f, -2.31088475e-07f, -5.03683681e-08f, 3.29248378e-09f, 1.00425448e-08f, 5.40519515e-09f,
+    -0.0677517739f, 0.0543060826f, 0.140132091f, -0.00325880735f, -0.0105780784f, -0.00250672063f, -0.000963092722f, -5.34113707e-05f, 4.1177553e-05f, 3.90930029e-05f, 1.64402539e-05f, 4.45006034e-06f, 4.75457895e-07f, -3.97878712e-07f, -3.0010723e-07f, -1.32332118e-07f, -3.62218272e-08f, -2.72006812e-09f, 3.9148899e-09f, 2.60483171e-09f,
+    -0.0547614421f, 0.0947336297f, 0.289170158f, -0.0603965457f, -0.0194485044f, 0.0099692443f, -0.00371004666f, 0.00039809721f, 0.000311711953f, -0.000243659041f, 8.97287717e-05f, -1.04550746e-05f, -9.58430662e-06f, 7.72003907e-06f, -2.91225604e-06f, 3.3311149e-07f, 3.51783101e-07f, -2.83802043e-07f, 1.12257493e-07f, -2.29846691e-08f,
+    -0.102168283f, -0.359214468f, 0.099988806f, 0.0927536565f, -0.0265158076f, 0.0029069913f, 0.0015322714f, -0.00137076395f, 0.00048681435f, -6.88389268e-05f, -4.3791418e-05f, 3.71573427e-05f, -1.44860374e-05f, 1.97015974e-06f, 1.48658137e-06f, -1.28248096e-06f, 5.07230395e-07f, -6.49496483e-08f, -6.00993754e-08f, 4.6993447e-08f,
+    -0.0487025606f, -0.201296513f, 0.0230122442f, 0.0557374079f, -0.0120920286f, 0.000505606641f, 0.00120459578f, -0.000771977298f, 0.000226748404f, -1.11792243e-05f, -3.27207418e-05f, 2.08908498e-05f, -6.71499413e-06f, 2.41825542e-07f, 1.09677075e-06f, -7.18141881e-07f, 2.33432425e-07f, -4.90636412e-09f, -4.37668301e-08f, 2.74424907e-08f,
+    -0.0235551018f, -0.386685656f, 0.0437563542f, 0.159575964f, -0.0186352783f, -0.0264619439f, 0.00638063414f, 0.00460326388f, -0.00197963187f, -0.000824461465f, 0.000586917542f, 0.000130651659f, -0.00016884492f, -1.19960017e-05f, 4.71004934e-05f, -3.14543063e-06f, -1.26374949e-05f, 2.76676161e-06f, 3.0792197e-06f, -1.65643409e-06f,
+    -0.0912435864f, -0.0570787589f, -0.281881773f, 0.0344382905f, 0.0583146578f, -0.0111173839f, -0.00942296914f, 0.00340435456f, 0.0016562559f, -0.00100119572f, -0.000273908984f, 0.000287068159f, 3.28582654e-05f, -8.01901444e-05f, 1.90725693e-06f, 2.16964719e-05f, -3.41239438e-06f, -5.67544804e-06f, 1.51953411e-06f, 1.67102501e-06f,
+    -0.0461471421f, 0.0100563464f, -0.154759073f, 0.00164880719f, 0.0330187531f, -0.00315393728f, -0.00568804233f, 0.00133204441f, 0.00108957536f, -0.000447136371f, -0.000207351151f, 0.00013927089f, 3.5175166e-05f, -4.14680796e-05f, -3.91277007e-06f, 1.18885293e-05f, -4.95570781e-07f, -3.31327812e-06f, 4.8734168e-07f, 1.06362345e-06f,
+    -0.00452979875f, -0.0138346961f, -0.314680286f, -0.0329440916f, 0.0441022194f, 0.0172713363f, 0.000661155267f, -0.0028730859f, -0.00139783843f, -6.18198146e-05f, 0.000264912437f, 0.00013888082f, 7.31968199e-06f, -2.82144059e-05f, -1.54927295e-05f, -9.33630714e-07f, 3.25954389e-06f, 1.82553702e-06f, 7.62658696e-08f, -3.80306055e-07f,
+    -0.0940017318f, 0.360966756f, 0.000343039329f, -0.127510449f, -0.0234804977f, 0.00869363031f, 0.00717798038f, 0.00163852095f, -0.000652707442f, -0.000624326469f, -0.000154792215f, 6.25493261e-05f, 6.45319651e-05f, 1.69624926e-05f, -6.75435577e-06f, -7.35205744e-06f, -2.03266258e-06f, 7.7123568e-07f, 9.22637865e-07f, 3.65624691e-07f,
+    -0.0496079205f, 0.193761526f, 0.0331143351f, -0.0644861863f, -0.0171249842f, 0.00282423848f, 0.00375501706f, 0.00117362521f, -0.000201457452f, -0.000326152674f, -0.000110191981f, 1.87903544e-05f, 3.36146681e-05f, 1.19897746e-05f, -1.9771846e-06f, -3.81924911e-06f, -1.42405663e-06f, 2.19846487e-07f, 4.8357239e-07f, 2.34593345e-07f,
+    -0.0294859746f, 0.420260469f, 0.0459514648f, -0.0985445801f, -0.00371626562f, -0.00160201209f, -0.000206229315f, 0.000313457527f, 9.75976773e-06f, 4.21968251e-05f, 2.43575029e-06f, 1.77781565e-06f, 9.74279584e-08f, -2.23495684e-07f, -2.1180885e-08f, -4.60988288e-08f, -3.55859152e-09f, -2.9758771e-09f, -9.73501037e-11f, 1.38870878e-10f,
+    -0.137367151f, -0.0378862477f, 0.258628002f, 0.0107849668f, -0.0146451737f, -0.000211073725f, -0.00142793954f, -5.69295252e-05f, -4.15349792e-05f, -1.70787897e-06f, 7.17038546e-06f, 4.86528026e-07f, 1.18887945e-06f, 6.79663184e-08f, 6.21242911e-08f, 3.34682997e-10f, -6.12703114e-09f, -9.89019802e-10f, -1.50686669e-09f, -1.26147395e-10f,
+    -0.07009925f, -0.0641668375f, 0.132979436f, 0.0160587276f, -0.00741348654f, 5.52272132e-05f, -0.000739176136f, -6.31331681e-05f, -2.3150124e-05f, -5.32597371e-06f, 3.5652048e-06f, 7.3137577e-08f, 6.23198627e-07f, 5.95986308e-08f, 3.53146441e-08f, 5.00272676e-09f, -2.89182205e-09f, -2.15466123e-10f, -7.92618484e-10f, -8.17389148e-11f,
+    -0.0415663646f, -0.137014392f, 0.303973854f, 0.00950906741f, -0.0474992638f, 0.0137551281f, 0.000676671188f, -0.00281098381f, 0.00118216448f, -2.53519129e-05f, -0.000229066827f, 0.000120033389f, -1.11145603e-05f, -2.09612623e-05f, 1.33521115e-05f, -2.12714147e-06f, -1.99600119e-06f, 1.53792709e-06f, -3.30566508e-07f, -1.38158603e-07f,
+    -0.0899662601f, -0.349072013f, -0.0556056737f, 0.126629589f, -0.0155048323f, -0.00961218452f, 0.00657077674f, -0.00140243726f, -0.000568750867f, 0.000544809456f, -0.00015349201f, -3.8328628e-05f, 5.2677087e-05f, -1.84774246e-05f, -2.37857432e-06f, 5.4963353e-06f, -2.33087432e-06f, -7.80649179e-08f, 6.33585163e-07f, -3.64409057e-07f,
+    -0.0435799327f, -0.171632952f, -0.0614375882f, 0.0664682612f, -0.00328938256f, -0.00656055439f, 0.00342985314f, -0.000452983545f, -0.000426729224f, 0.000292907792f, -5.7801887e-05f, -3.29822264e-05f, 2.92276281e-05f, -7.65038872e-06f, -2.66458846e-06f, 3.15086395e-06f, -1.03291243e-06f, -2.02542639e-07f, 3.72146683e-07f, -1.79684808e-07f,
+    -0.0204754135f, -0.353776963f, -0.137329781f, 0.144899477f, 0.0353337673f, -0.0237245689f, -0.00829316711f, 0.00416895801f, 0.00218401534f, -0.000793062875f, -0.000601377833f, 0.000147752087f, 0.000169095073f, -2.41187466e-05f, -4.79181223e-05f, 2.25136675e-06f, 1.35115987e-05f, 7.04709737e-07f, -3.536702e-06f, -7.83525584e-07f,
+    -0.0919348926f, 0.126921214f, -0.265564607f, -0.0599779167f, 0.0550240841f, 0.0138731339f, -0.00909288773f, -0.00357160939f, 0.00171609975f, 0.000980775545f, -0.000334374066f, -0.000276638413f, 6.22470213e-05f, 7.89695427e-05f, -9.7387824e-06f, -2.2635484e-05f, 6.98587747e-07f, 6.58239028e-06f, 2.78004456e-07f, -2.32799739e-06f,
+    -0.046835976f, 0.104645737f, -0.127108594f, -0.0471187599f, 0.0256164281f, 0.00987399429f, -0.00397633641f, -0.00233911943f, 0.000685685334f, 0.000605516425f, -0.000115200002f, -0.000162844684f, 1.54650695e-05f, 4.45958262e-05f, -1.73300185e-07f, -1.22948371e-05f, -1.04194475e-06f, 3.43305894e-06f, 5.18259654e-07f, -1.15825299e-06f,
+    0.00413583219f, 0.211840539f, -0.247897469f, -0.0931556744f, 0.0109386557f, 0.0103339753f, 0.00455479733f, 0.000762706796f, -0.000296906345f, -0.000292438977f, -0.000115636316f, -1.35292822e-05f, 1.34945677e-05f, 1.05985836e-05f, 3.70227562e-06f, 1.36345858e-07f, -6.58955012e-07f, -4.29222817e-07f, -1.32590767e-07f, -8.09559447e-09f,
+    -0.106857668f, 0.32979652f, 0.150248231f, -0.0810915769f, -0.0317019348f, -0.00458136382f, 0.00139058278f, 0.00156618243f, 0.000592890886f, 7.82112187e-05f, -6.10712501e-05f, -4.91197012e-05f, -1.74601121e-05f, -9.74981488e-07f, 2.81163771e-06f, 1.88513418e-06f, 5.78609627e-07f, -3.29580325e-08f, -1.43930019e-07f, -8.25638683e-08f,
+    -0.0573622479f, 0.153528412f, 0.105990936f, -0.0334517074f, -0.0180340416f, -0.00352231359f, 0.000264107863f, 0.000754555459f, 0.000346937975f, 7.22749485e-05f, -2.04327219e-05f, -2.47524924e-05f, -1.07142771e-05f, -1.62871523e-06f, 1.11040434e-06f, 9.90035135e-07f, 3.77223536e-07f, 2.73659334e-08f, -6.28012311e-08f, -4.31386063e-08f,
+    -0.0529963855f, 0.313303166f, 0.185591652f, -0.0893444993f, -0.00394344059f, 0.0013782598f, -0.00176241578f, 0.000593033917f, -0.000140786037f, 2.02772543e-05f, 1.14240862e-05f, -7.30989142e-06f, 3.51417519e-06f, -9.81588763e-07f, 1.49194265e-07f, 5.09583799e-08f, -5.3427358e-08f, 2.56354287e-08f, -8.7606338e-09f, 1.93948373e-09f,
+    -0.12470203f, -0.240525398f, 0.213044224f, 0.0462343513f, -0.0188634846f, 0.00363593706f, -0.00113607182f, -0.000131325795f, 9.73445511e-05f, -6.54518595e-05f, 2.1018293e-05f, -4.72940741e-06f, 8.86404196e-08f, 6.60269927e-07f, -3.8343895e-07f, 1.56311396e-07f, -3.88799948e-08f, 2.59765428e-09f, 4.18906291e-09f, -2.67251528e-09f,
+    -0.0608878318f, -0.160932335f, 0.0940737084f, 0.0339823942f, -0.00963673993f, 0.00179281072f, -0.000420779022f, -0.00013203233f, 6.65956782e-05f, -3.69918148e-05f, 1.00018147e-05f, -1.7545152e-06f, -3.20585573e-07f, 4.54496005e-07f, -2.19892709e-07f, 7.79414627e-08f, -1.51214141e-08f, -1.29920923e-09f, 3.14865087e-09f, -1.6267786e-09f,
+    -0.0295257557f, -0.309949041f, 0.214093788f, 0.100563563f, -0.0552566358f, -0.00316865908f, 0.0102584939f, -0.00266713017f, -0.00129464225f, 0.00101052766f, -4.10670579e-05f, -0.000226146344f, 8.78158635e-05f, 2.59854022e-05f, -3.1484932e-05f, 4.37881567e-06f, 6.75225756e-06f, -3.57218961e-06f, -6.77824164e-07f, 1.37631503e-06f,
+    -0.0888180898f, -0.235115637f, -0.201005693f, 0.110366825f, 0.0224473931f, -0.021956661f, 0.00268592456f, 0.00340293514f, -0.00165575551f, -0.00020646291f, 0.000448651929f, -0.00010339509f, -7.39457065e-05f, 5.1504301e-05f, 7.62085191e-07f, -1.35884085e-05f, 4.64995546e-06f, 1.88031536e-06f, -1.90005841e-06f, 3.91796721e-07f,
+    -0.0442263104f, -0.0928135651f, -0.129493643f, 0.0482713061f, 0.0177422868f, -0.0113656111f, 0.000357173359f, 0.00209205589f, -0.000746585417f, -0.000215762069f, 0.000243314956f, -3.14127116e-05f, -4.85856717e-05f, 2.47187467e-05f, 3.70147771e-06f, -7.69746575e-06f, 1.7704862e-06f, 1.37562257e-06f, -9.41297622e-07f, 6.46703255e-08f,
+    -0.0149358431f, -0.223755757f, -0.272606595f, 0.0663320557f, 0.0623040424f, 0.00148947829f, -0.0104007486f, -0.00318146864f, 0.00132660535f, 0.0010908386f, 7.49077652e-06f, -0.000261533096f, -8.01299877e-05f, 4.22731257e-05f, 3.36821974e-05f, -7.85731152e-07f, -9.29828879e-06f, -2.74004365e-06f, 1.79749821e-06f, 1.64978872e-06f,
+    -0.0911484275f, 0.279572434f, -0.161429544f, -0.124497796f, 0.0160657964f, 0.0230946447f, 0.00312823765f, -0.00367397951f, -0.00169575774f, 0.000339431156f, 0.000494618054f, 6.42708678e-05f, -0.000103615284f, -4.76623596e-05f, 1.23005425e-05f, 1.63129928e-05f, 1.74411173e-06f, -3.80384173e-06f, -1.53075176e-06f, 4.84189174e-07f,
+    -0.0469951202f, 0.172361286f, -0.0574651436f, -0.0732677761f, 0.00203734257f, 0.0121474536f, 0.00275520057f, -0.00162425142f, -0.00104225228f, 6.66463934e-05f, 0.000262717298f, 6.16149042e-05f, -4.68122717e-05f, -2.98163641e-05f, 3.02734115e-06f, 8.7727835e-06f, 1.90243307e-06f, -1.73963962e-06f, -1.0036381e-06f, 8.52572308e-08f,
+    -0.00273558692f, 0.380219109f, -0.111320672f, -0.105574026f, -0.00425357228f, 0.000755197405f, 0.00171444084f, 0.000778008129f, 0.000209343368f, 3.58863431e-05f, -1.23794135e-05f, -1.06931355e-05f, -5.17618128e-06f, -1.51506556e-06f, -1.86029027e-07f, 1.14742538e-07f, 1.0131129e-07f, 4.59213614e-08f, 1.38175857e-08f, 2.26386748e-09f,
+    -0.127248996f, 0.183478419f, 0.240450738f, -0.0282840817f, -0.0210589364f, -0.00470799897f, -0.00146861612f, 6.7937725e-05f, 0.000130159638f, 8.5274847e-05f, 2.96124162e-05f, 6.25171416e-06f, -3.47096574e-07f, -1.18582127e-06f, -6.57766337e-07f, -2.39394526e-07f, -4.71327293e-08f, 6.97910616e-09f, 1.19880671e-08f, 6.08553407e-09f,
+    -0.0675041157f, 0.0579451973f, 0.139748758f, -0.00401689935f, -0.0107734511f, -0.00258713723f, -0.000961841035f, -4.52467692e-05f, 4.74262697e-05f, 4.16720419e-05f, 1.7071272e-05f, 4.44980999e-06f, 3.56920798e-07f, -4.73129996e-07f, -3.30939138e-07f, -1.39543766e-07f, -3.57140583e-08f, -1.0889516e-09f, 4.94002049e-09f, 3.0049746e-09f,
+    -0.05497071f, 0.102318969f, 0.287068793f, -0.061913799f, -0.0186683878f, 0.00967470119f, -0.00369890866f, 0.000446643893f, 0.00027817269f, -0.000232038985f, 8.93101061e-05f, -1.26208549e-05f, -8.07217899e-06f, 7.19759827e-06f, -2.89579928e-06f, 4.36057923e-07f, 2.80367881e-07f, -2.59304545e-07f, 1.11601523e-07f, -2.68300299e-08f,
+    -0.102783916f, -0.357471126f, 0.10443908f, 0.0912855153f, -0.0264428865f, 0.00309666226f, 0.00138228229f, -0.00131956902f, 0.000483073281f, -7.74421865e-05f, -3.75300267e-05f, 3.48912338e-05f, -1.43461744e-05f, 2.36624593e-06f, 1.19622489e-06f, -1.1772712e-06f, 5.01305166e-07f, -8.43377468e-08f, -4.54176854e-08f, 4.09880262e-08f,
+    -0.0490013734f, -0.20114635f, 0.0255876718f, 0.0551113687f, -0.0121327753f, 0.000636981982f, 0.00112357562f, -0.000749728157f, 0.000228229881f, -1.69666907e-05f, -2.93421262e-05f, 1.99087546e-05f, -6.7976782e-06f, 5.07147909e-07f, 9.40390265e-07f, -6.72814153e-07f, 2.37712627e-07f, -1.7786028e-08f, -3.58775549e-08f, 2.46440863e-08f,
+    -0.0236119263f, -0.385996218f, 0.049625188f, 0.158789635f, -0.0202886393f, -0.0260312011f, 0.00677936301f, 0.00442066965f, -0.00207174492f, -0.000756067567f, 0.000605017185f, 0.000106912733f, -0.000170969029f, -4.25280782e-06f, 4.66239723e-05f, -5.52444162e-06f, -1.21445217e-05f, 3.45701726e-06f, 2.85685657e-06f, -1.87739622e-06f,
+    -0.0911936361f, -0.0630226745f, -0.28081587f, 0.0373791554f, 0.0576964365f, -0.0118213296f, -0.00914946885f, 0.00356916234f, 0.00155144792f, -0.00103561788f, -0.000236931223f, 0.000292239291f, 2.06099142e-05f, -7.99937332e-05f, 5.73352952e-06f, 2.10584384e-05f, -4.53286763e-06f, -5.28393833e-06f, 1.80935341e-06f, 1.44315242e-06f,
+    -0.0461089838f, 0.00683419091f, -0.154792397f, 0.00329041506f, 0.0328600906f, -0.00357253119f, -0.00558381202f, 0.00143861696f, 0.00104336674f, -0.000472552337f, -0.000189553089f, 0.000144491138f, 2.88767088e-05f, -4.21694067e-05f, -1.82628389e-06f, 1.17966482e-05f, -1.14345955e-06f, -3.17676857e-06f, 6.64825834e-07f, 9.65331417e-07f,
+    -0.00482575991f, -0.021050021f, -0.31512141f, -0.0302172219f, 0.0451338514f, 0.0171827798f, 0.000353471122f, -0.00300448917f, -0.00138556043f, -2.11393301e-05f, 0.000282657145f, 0.00013718244f, 1.64529318e-06f, -3.07172323e-05f, -1.52515609e-05f, -1.17692018e-07f, 3.62438743e-06f, 1.79139576e-06f, -5.08915346e-08f, -4.51308827e-07f,
+    -0.0937900073f, 0.360039537f, -0.00490536309f, -0.128372532f, -0.0226741488f, 0.00926932346f, 0.00727492479f, 0.00153997547f, -0.000727229238f, -0.000636892274f, -0.000141507603f, 7.27936541e-05f, 6.62802889e-05f, 1.5091467e-05f, -8.21194952e-06f, -7.6027604e-06f, -1.763287e-06f, 9.78782194e-07f, 9.53695591e-07f, 3.3145928e-07f,
+    -0.0494590676f, 0.194004543f, 0.030375567f, -0.0652230796f, -0.0168037387f, 0.00313913298f, 0.00383847294f, 0.00113489911f, -0.000242358902f, -0.000337070585f, -0.000104973822f, 2.44173641e-05f, 3.51364319e-05f, 1.12551565e-05f, -2.7780233e-06f, -4.03780358e-06f, -1.31875718e-06f, 3.33880223e-07f, 5.13378123e-07f, 2.23820009e-07f,
+    -0.0284905824f, 0.421380577f, 0.0411785962f, -0.0987980797f, -0.00379122696f, -0.00161702477f, -0.000165562955f, 0.000315467273f, 1.58766365e-05f, 4.25961377e-05f, 2.67538807e-06f, 1.78348149e-06f, 4.01650484e-08f, -2.3026125e-07f, -3.26127967e-08f, -4.70502955e-08f, -4.24415109e-09f, -2.96912142e-09f, -1.37810749e-11f, 1.55868692e-10f,
+    -0.137422104f, -0.0307840324f, 0.259091049f, 0.00970374922f, -0.0146745893f, -0.000347210755f, -0.00143435169f, -6.05373169e-05f, -4.15555575e-05f, -3.48969517e-07f, 7.28725448e-06f, 7.18616314e-07f, 1.20306243e-06f, 7.9150725e-08f, 6.16035382e-08f, -1.68089178e-09f, -6.48469922e-09f, -1.44145993e-09f, -1.54784258e-09f, -1.59692094e-10f,
+    -0.0702245283f, -0.0605133415f, 0.133710643f, 0.0155121674f, -0.00742041183f, -1.56563521e-05f, -0.000746767299f, -6.52734997e-05f, -2.37996284e-05f, -4.64525555e-06f, 3.60191292e-06f, 1.96093623e-07f, 6.36683111e-07f, 6.62693177e-08f, 3.62315222e-08f, 4.03021124e-09f, -3.010138e-09f, -4.57038662e-10f, -8.23113063e-10f, -1.01386479e-10f,
+    -0.0419640102f, -0.130201229f, 0.305160165f, 0.00670670839f, -0.0467156195f, 0.0139215568f, 0.000387429698f, -0.00269851631f, 0.00119272141f, -5.96408753e-05f, -0.000212888893f, 0.000119962963f, -1.52979944e-05f, -1.86101958e-05f, 1.31446231e-05f, -2.63660845e-06f, -1.65416047e-06f, 1.48437121e-06f, -3.97953798e-07f, -8.21851335e-08f,
+    -0.0901660752f, -0.351217048f, -0.0504533755f, 0.126175871f, -0.0163329835f, -0.009086493f, 0.00648181383f, -0.00148496924f, -0.000502428367f, 0.000529237433f, -0.000161943285f, -2.96326807e-05f, 5.00508834e-05f, -1.92989537e-05f, -1.22533169e-06f, 5.06809171e-06f, -2.39682021e-06f, 7.20903771e-08f, 5.65135877e-07f, -3.56735394e-07f,
+    -0.0436385922f, -0.173465892f, -0.0588248142f, 0.066512988f, -0.00381011752f, -0.00629791401f, 0.00341237523f, -0.000508551996f, -0.000392515253f, 0.000288174528f, -6.3981625e-05f, -2.83446136e-05f, 2.82642199e-05f, -8.3324626e-06f, -2.0288631e-06f, 2.97585708e-06f, -1.10363845e-06f, -1.16996067e-07f, 3.42716211e-07f, -1.81432976e-07f,
+    -0.0205298888f, -0.356416653f, -0.131948986f, 0.146506695f, 0.0338278969f, -0.0242842181f, -0.00792200979f, 0.004365781f, 0.00209098882f, -0.000861165972f, -0.00057909384f, 0.000170907942f, 0.000164275446f, -3.18536336e-05f, -4.71099608e-05f, 4.79347491e-06f, 1.34823109e-05f, -1.34076531e-07f, -3.58427067e-06f, -4.47998049e-07f,
+    -0.0919596526f, 0.121301006f, -0.267560405f, -0.0571868426f, 0.0558016215f, 0.0131854645f, -0.00937246691f, -0.00339656753f, 0.00181527782f, 0.000936828096f, -0.000368802529f, -0.000266209831f, 7.39627902e-05f, 7.67812075e-05f, -1.36464014e-05f, -2.23096696e-05f, 1.96721628e-06f, 6.60870922e-06f, -9.32865392e-08f, -2.39740958e-06f,
+    -0.0468379314f, 0.101933905f, -0.128716428f, -0.0458021349f, 0.026184171f, 0.00956636546f, -0.00416336261f, -0.00226643906f, 0.000748091324f, 0.000589211884f, -0.000135834734f, -0.000159704327f, 2.22015433e-05f, 4.42366067e-05f, -2.33733449e-06f, -1.23863153e-05f, -3.63582587e-07f, 3.53452708e-06f, 3.25560397e-07f, -1.23020814e-06f,
+    0.00408932147f, 0.20506024f, -0.251405141f, -0.0920450845f, 0.0118015143f, 0.0107040911f, 0.00459171796f, 0.000708375309f, -0.00033854402f, -0.000306953222f, -0.00011553488f, -1.02397633e-05f, 1.55798887e-05f, 1.11866991e-05f, 3.60414491e-06f, -6.20511851e-08f, -7.6423612e-07f, -4.50892212e-07f, -1.21754127e-07f, 2.9509002e-09f,
+    -0.106287105f, 0.332685895f, 0.14618803f, -0.0828878844f, -0.0318668517f, -0.0043800635f, 0.00156579269f, 0.00162691169f, 0.00059447358f, 6.56340059e-05f, -6.93267493e-05f, -5.15703783e-05f, -1.71638462e-05f, -2.28180395e-07f, 3.22400906e-06f, 1.97963848e-06f, 5.44627447e-07f, -7.69868774e-08f, -1.65500835e-07f, -8.82116344e-08f,
+    -0.0570479937f, 0.15575284f, 0.104196119f, -0.0345173792f, -0.0182109575f, -0.00345395366f, 0.000353344465f, 0.000792485739f, 0.000352119881f, 6.71008486e-05f, -2.48337981e-05f, -2.63993329e-05f, -1.0774347e-05f, -1.29279024e-06f, 1.34007168e-06f, 1.06104611e-06f, 3.70136919e-07f, 6.19733676e-09f, -7.54143978e-08f, -4.72991222e-08f,
+    -0.0524795467f, 0.31866759f, 0.181513841f, -0.0897837887f, -0.00376912419f, 0.00120219599f, -0.00169733401f, 0.000578242885f, -0.000139238116f, 2.2610277e-05f, 1.00578285e-05f, -6.65769487e-06f, 3.33709383e-06f, -9.62524679e-07f, 1.66123464e-07f, 3.6428772e-08f, -4.67134419e-08f, 2.34526876e-08f, -8.4185628e-09f, 2.00285735e-09f,
+    -0.125374815f, -0.235045311f, 0.21547978f, 0.0449514799f, -0.018612772f, 0.00354543464f, -0.00115964169f, -0.000116578618f, 8.78194535e-05f, -6.23239404e-05f, 2.03782729e-05f, -4.78815491e-06f, 2.48009448e-07f, 5.73164855e-07f, -3.48408712e-07f, 1.48196185e-07f, -3.89680508e-08f, 4.04336535e-09f, 3.23430721e-09f, -2.28881226e-09f,
+    -0.0612919747f, -0.158573146f, 0.0957804451f, 0.033345711f, -0.00952031131f, 0.00176279597f, -0.000440027621f, -0.000122641765f, 6.13594366e-05f, -3.55671301e-05f, 9.80242455e-06f, -1.85359193e-06f, -2.17277133e-07f, 4.06099033e-07f, -2.02989802e-07f, 7.51297889e-08f, -1.58673642e-08f, -3.0158117e-10f, 2.60432656e-09f, -1.42894383e-09f,
+    -0.0297516033f, -0.305801914f, 0.218380182f, 0.0978847053f, -0.0556698077f, -0.00237043137f, 0.0100702631f, -0.00281873239f, -0.00118609713f, 0.00101320943f, -7.33771267e-05f, -0.000214752823f, 9.29951374e-05f, 2.0649045e-05f, -3.09923164e-05f, 5.78512881e-06f, 6.06180931e-06f, -3.72056889e-06f, -4.11164753e-07f, 1.2815107e-06f,
+    -0.0887760382f, -0.239917954f, -0.197149102f, 0.111860162f, 0.021063997f, -0.021845359f, 0.00301252587f, 0.00325207787f, -0.00169165718f, -0.000150231061f, 0.000437910131f, -0.000115720372f, -6.6132266e-05f, 5.21837901e-05f, -1.82047754e-06f, -1.28091469e-05f, 5.13169575e-06f, 1.46534886e-06f, -1.90585439e-06f, 5.29414727e-07f,
+    -0.044174584f, -0.0957828339f, -0.127885043f, 0.0493379963f, 0.0170493803f, -0.0113886398f, 0.000550360781f, 0.002027484f, -0.00077694319f, -0.000186113125f, 0.000240953844f, -3.91579235e-05f, -4.49650065e-05f, 2.56358401e-05f, 2.27524928e-06f, -7.42904811e-06f, 2.09891871e-06f, 1.17013568e-06f, -9.72182284e-07f, 1.47836096e-07f,
+    -0.0151260367f, -0.229226833f, -0.269531754f, 0.0694150329f, 0.0621586798f, 0.000668313853f, -0.0106223907f, -0.0030200257f, 0.00144076151f, 0.00108026747f, -2.94668652e-05f, -0.000270280623f, -7.18838943e-05f, 4.75833048e-05f, 3.29065863e-05f, -2.65356998e-06f, -9.66858892e-06f, -2.2996768e-06f, 2.03588349e-06f, 1.61204117e-06f,
+    -0.0911633816f, 0.275603007f, -0.165828907f, -0.123309026f, 0.0175222925f, 0.0232213987f, 0.00277517901f, -0.00382067959f, -0.00164102551f, 0.000399359956f, 0.000497725737f, 4.74757045e-05f, -0.000109970606f, -4.46572023e-05f, 1.52075878e-05f, 1.63439537e-05f, 8.56507779e-07f, -4.1113589e-06f, -1.34240726e-06f, 6.81405398e-07f,
+    -0.046977874f, 0.170812892f, -0.0601126216f, -0.0729531536f, 0.0028254003f, 0.0122996963f, 0.00259053893f, -0.00171899747f, -0.00102500797f, 9.96206007e-05f, 0.000268216349f, 5.35900815e-05f, -5.10528721e-05f, -2.87705642e-05f, 4.65527395e-06f, 8.98402806e-06f, 1.46862662e-06f, -1.94926478e-06f, -9.28253382e-07f, 1.94180912e-07f,
+    -0.00211240111f, 0.376559129f, -0.116168582f, -0.105630544f, -0.00408884407f, 0.000942516089f, 0.00180263265f, 0.000800767011f, 0.000211863413f, 3.2792306e-05f, -1.45435743e-05f, -1.16792834e-05f, -5.43675579e-06f, -1.52051977e-06f, -1.43733428e-07f, 1.44240376e-07f, 1.13511504e-07f, 4.89407544e-08f, 1.36964924e-08f, 1.78208632e-09f,
+    -0.126659302f, 0.189588126f, 0.238717403f, -0.0297489487f, -0.0214047424f, -0.00482055648f, -0.00144655534f, 8.94074134e-05f, 0.000143054106f, 8.96413117e-05f, 3.03369065e-05f, 6.00142195e-06f, -6.52597724e-07f, -1.3400895e-06f, -7.09345187e-07f, -2.462084e-07f, -4.2713204e-08f, 1.12151048e-08f, 1.40966144e-08f, 6.78839256e-09f,
+    -0.0672485052f, 0.0615601023f, 0.139324387f, -0.00478611734f, -0.0109736533f, -0.00266648912f, -0.000959307525f, -3.62242129e-05f, 5.40168816e-05f, 4.4316234e-05f, 1.76826909e-05f, 4.41979324e-06f, 2.21671214e-07f, -5.54619311e-07f, -3.62802069e-07f, -1.46253649e-07f, -3.46384604e-08f, 8.49337228e-10f, 6.07476892e-09f, 3.42942346e-09f,
+    -0.0551641692f, 0.109882415f, 0.284879557f, -0.0633854496f, -0.0179047882f, 0.00937748173f, -0.00368148988f, 0.000491285174f, 0.000245829192f, -0.000220249921f, 8.84663288e-05f, -1.45242537e-05f, -6.63864258e-06f, 6.66501851e-06f, -2.85247257e-06f, 5.22567478e-07f, 2.13853891e-07f, -2.34149369e-07f, 1.09218586e-07f, -2.96452525e-08f,
+    -0.10341058f, -0.355596725f, 0.108838722f, 0.0898084648f, -0.0263514748f, 0.00327295069f, 0.00123639963f, -0.00126798645f, 0.000477900487f, -8.51268656e-05f, -3.15617071e-05f, 3.25996691e-05f, -1.41138904e-05f, 2.70321863e-06f, 9.24608106e-07f, -1.07057894e-06f, 4.89708334e-07f, -1.00098092e-07f, -3.19540629e-08f, 3.51146507e-08f,
+    -0.0493076378f, -0.200924787f, 0.0281450152f, 0.0544760656f, -0.012162005f, 0.000761509859f, 0.00104410002f, -0.000726872298f, 0.000228826229f, -2.22824612e-05f, -2.60757325e-05f, 1.88860125e-05f, -6.82302233e-06f, 7.42038638e-07f, 7.91207539e-07f, -6.24993745e-07f, 2.38464073e-07f, -2.88018195e-08f, -2.845777e-08f, 2.18090468e-08f,
+    -0.0236716686f, -0.385196965f, 0.0554763188f, 0.1579282f, -0.0219209575f, -0.0255726609f, 0.00716456077f, 0.00422929819f, -0.00215710604f, -0.00068544654f, 0.000620194401f, 8.28257685e-05f, -0.000171952548f, 3.43049106e-06f, 4.57400112e-05f, -7.81384505e-06f, -1.15185069e-05f, 4.0897723e-06f, 2.59716683e-06f, -2.06222282e-06f,
+    -0.0911417847f, -0.0689544208f, -0.279652302f, 0.0402972464f, 0.0570375935f, -0.0125082854f, -0.0088623173f, 0.00372487335f, 0.00144286393f, -0.0010659277f, -0.000199212911f, 0.000295751456f, 8.36074719e-06f, -7.91873947e-05f, 9.46077397e-06f, 2.02151678e-05f, -5.58590829e-06f, -4.82942448e-06f, 2.0699811e-06f, 1.1950343e-06f,
+    -0.0460695077f, 0.00360758534f, -0.15477236f, 0.00492750652f, 0.0326777653f, -0.00398494266f, -0.00547094932f, 0.00154125859f, 0.000994457037f, -0.000496012163f, -0.000171059646f, 0.000148865262f, 2.24598039e-05f, -4.25401308e-05f, 2.4975251e-07f, 1.15862921e-05f, -1.76927795e-06f, -3.0007662e-06f, 8.30654404e-07f, 8.52510359e-07f,
+};
+
+static const float VENUS_COEFFICIENTS[1935] = {
+    0.067725084f, 0.146608093f, 0.144161799f, -0.558728197f, -0.0685659597f, 0.122939257f, 0.00751356867f, -0.010438521f, 5.65601777e-05f, 0.000397324651f, -9.79084981e-05f, 5.07030619e-06f, 1.22100765e-05f, -2.14473875e-06f, -6.94497147e-07f,
+    0.247621623f, -0.0266986748f, 0.580273871f, 0.103126548f, -0.280158943f, -0.0212807274f, 0.0362280982f, 0.000980058903f, -0.00208951916f, 0.000172785581f, 3.58881043e-05f, -3.48307786e-05f, 4.92586656e-06f, 2.94268413e-06f, -7.62839023e-07f,
+    0.107025796f, -0.0212916565f, 0.251724385f, 0.0817512965f, -0.121599377f, -0.0173534972f, 0.0158100382f, 0.00110171753f, -0.000942904083f, 5.25104843e-05f, 2.23346491e-05f, -1.59790697e-05f, 1.44100388e-06f, 1.45869789e-06f, -2.98940041e-07f,
+    -0.166398239f, 0.119311239f, -0.393600066f, -0.455657385f, 0.189668754f, 0.0992808185f, -0.0240529101f, -0.00786056846f, 0.00121945846f, 0.000159599968f, 9.9447757e-06f, 2.44405534e-05f, -6.0349072e-06f, -2.65722128e-06f, 4.17133891e-07f,
+    0.195893423f, 0.0861701396f, 0.461260026f, -0.328920519f, -0.222124277f, 0.0718354032f, 0.0279741738f, -0.00578689066f, -0.0013472553f, 0.00014394049f, -2.63058353e-05f, 1.39371303e-05f, 8.40111297e-06f, -1.70435084e-06f, -5.05115017e-07f,
+    0.098600531f, 0.0311764165f, 0.23228427f, -0.118996045f, -0.111865702f, 0.0260035218f, 0.0140987146f, -0.00210349984f, -0.000682864113f, 5.45983561e-05f, -1.24556869e-05f, 4.71698561e-06f, 4.15880796e-06f, -5.97848962e-07f, -2.53483407e-07f,
+    -0.276781981f, 0.00657326948f, -0.647283094f, -0.0237901091f, 0.312118654f, 0.0065288095f, -0.0398483996f, -0.00131173659f, 0.00211418299f, 0.000241185197f, -7.87079027e-07f, -3.01189406e-05f, -9.19832432e-06f, 2.0441853e-06f, 9.2755856e-07f,
+    -0.0010001027f, 0.137298876f, 0.00905666869f, -0.523774659f, -0.00518127393f, 0.114709838f, 0.00172513449f, -0.00942529055f, -0.000480312201f, 0.000279980414f, 8.28021807e-05f, 1.6957682e-05f, -8.0987731e-06f, -2.78316282e-06f, 2.90268826e-07f,
+    0.017083662f, 0.0613027614f, 0.0450761188f, -0.233940492f, -0.0221001724f, 0.0511507883f, 0.00329954371f, -0.00415375789f, -0.000349817232f, 0.000110578607f, 3.72703828e-05f, 9.53063039e-06f, -3.05789629e-06f, -1.38056296e-06f, 7.17288619e-08f,
+    -0.183887097f, -0.111129384f, -0.43417466f, 0.424052542f, 0.210965355f, -0.0927496525f, -0.0290369823f, 0.00754368495f, 0.00231969728f, -0.000197201952f, -0.00017301684f, -2.09654796e-05f, 1.33541925e-05f, 3.68609221e-06f, -7.59292176e-07f,
+    -0.199899994f, 0.089987957f, -0.448178382f, -0.34120445f, 0.21608906f, 0.0768826674f, -0.0275589663f, -0.00759333944f, 0.00144472076f, 0.000566942852f, 7.48868957e-06f, -4.49510699e-05f, -8.80452737e-06f, 3.20538145e-06f, 1.23817669e-06f,
+    -0.0782083477f, 0.0474929279f, -0.17395608f, -0.18023814f, 0.0837704549f, 0.040434754f, -0.0105487244f, -0.00389110824f, 0.000502480792f, 0.00026733561f, 1.43256129e-05f, -1.88778011e-05f, -4.80360985e-06f, 1.2073567e-06f, 6.04666192e-07f,
+    0.0437070457f, -0.149169753f, 0.0890808595f, 0.566230585f, -0.0425336832f, -0.126944659f, 0.00487794883f, 0.0121757418f, -4.60692684e-05f, -0.000836322549f, -5.21514261e-05f, 6.30918979e-05f, 9.12028804e-06f, -5.29377065e-06f, -1.25768792e-06f,
+    -0.258032332f, -0.0222444862f, -0.582175335f, 0.0853359044f, 0.282567151f, -0.0181857967f, -0.0384889541f, 0.00119060096f, 0.00294471173f, 5.21020327e-05f, -0.000205940092f, -1.99883598e-05f, 1.69587389e-05f, 2.8204887e-06f, -1.52688573e-06f,
+    -0.118754784f, -0.00054633488f, -0.26733256f, 0.00248807133f, 0.129708678f, -0.000133046018f, -0.017609794f, -0.000236085169f, 0.00132656455f, 7.63953348e-05f, -8.92663847e-05f, -1.2981272e-05f, 7.04522374e-06f, 1.6031407e-06f, -6.06666852e-07f,
+    0.242896712f, -0.0797204368f, 0.547326527f, 0.302967823f, -0.265875457f, -0.0675482901f, 0.0365059351f, 0.00625984567f, -0.00289886223f, -0.000377534177f, 0.000221934813f, 2.2411689e-05f, -2.0369445e-05f, -1.49805181e-06f, 2.11809538e-06f,
+    -0.135223953f, -0.118615003f, -0.299720925f, 0.449951755f, 0.145228455f, -0.101188416f, -0.0194617089f, 0.00988999496f, 0.0013750793f, -0.000725613748f, -7.71897931e-05f, 6.10107569e-05f, 4.7992463e-06f, -5.73272439e-06f, -3.11213607e-07f,
+    -0.0761699369f, -0.0482650788f, -0.169397653f, 0.183056332f, 0.0821220365f, -0.0412042704f, -0.0110603909f, 0.0040489297f, 0.000801713736f, -0.000302242112f, -4.87546309e-05f, 2.60041234e-05f, 3.44754052e-06f, -2.4819138e-06f, -2.74060599e-07f,
+    0.272203548f, 0.0471076672f, 0.614456357f, -0.177557737f, -0.297275631f, 0.041116426f, 0.0392424551f, -0.00470448228f, -0.00255506769f, 0.000501224484f, 0.000102569217f, -5.66151974e-05f, -1.71151495e-06f, 5.50366519e-06f, -4.56467131e-07f,
+    0.0809907362f, -0.129460188f, 0.19758806f, 0.492658278f, -0.0966824547f, -0.10914756f, 0.0141850131f, 0.00970560968f, -0.00144199138f, -0.000481704175f, 0.000157369355f, 1.40086039e-05f, -1.66358725e-05f, 4.3330577e-07f, 1.56052383e-06f,
+    0.019159025f, -0.0611758914f, 0.0498832943f, 0.232690053f, -0.0246243345f, -0.0516645452f, 0.00388997231f, 0.00466050798f, -0.000486296682f, -0.000248268337f, 6.42375787e-05f, 9.88305558e-06f, -7.36912136e-06f, -1.53879404e-07f, 7.30344478e-07f,
+    0.109557117f, 0.139753126f, 0.240287234f, -0.532093495f, -0.114962962f, 0.117603524f, 0.0134961144f, -0.0102929285f, -0.000280096205f, 0.000469755456f, -9.51578226e-05f, -7.67583252e-06f, 1.38501247e-05f, -1.12964872e-06f, -9.94710671e-07f,
+    0.236597269f, -0.047247002f, 0.554992991f, 0.181468519f, -0.268275234f, -0.0384835981f, 0.0351119414f, 0.00241852182f, -0.00217724229f, 0.000125411696f, 6.73553688e-05f, -3.75060587e-05f, 1.3716038e-06f, 3.6094971e-06f, -5.97989948e-07f,
+    0.099403139f, -0.0300930382f, 0.234230778f, 0.115275626f, -0.113299168f, -0.0247475971f, 0.0149268677f, 0.00173909213f, -0.000960868744f, 2.66127249e-05f, 3.63028311e-05f, -1.63717949e-05f, -2.60899908e-07f, 1.69393514e-06f, -2.0576813e-07f,
+    -0.129480884f, 0.131994155f, -0.308830861f, -0.504159464f, 0.149029658f, 0.109781791f, -0.0191732833f, -0.00865227013f, 0.00107195753f, 0.000164758632f, -1.2744926e-05f, 2.87280655e-05f, -2.89537238e-06f, -3.08147536e-06f, 3.11956906e-07f,
+    0.218589089f, 0.0686054713f, 0.51337987f, -0.261598339f, -0.247177754f, 0.0574130623f, 0.0310701186f, -0.00478983034f, -0.00147422764f, 0.000162171169f, -3.40335755e-05f, 4.97600216e-06f, 9.86237514e-06f, -1.0150444e-06f, -5.91648418e-07f,
+    0.106451188f, 0.0224708454f, 0.250312867f, -0.0856374145f, -0.120538886f, 0.0188500892f, 0.0151794908f, -0.00160473512f, -0.000730513693f, 6.24546011e-05f, -1.44898474e-05f, 4.16467143e-07f, 4.61620286e-06f, -2.61013168e-07f, -2.85685584e-07f,
+    -0.271645684f, 0.029724153f, -0.635439734f, -0.112371438f, 0.306172635f, 0.0256568275f, -0.038782128f, -0.00272299558f, 0.00194685402f, 0.00024063919f, 2.18591651e-05f, -2.04867289e-05f, -1.09325803e-05f, 1.02310583e-06f, 8.83781912e-07f,
+    0.0389664062f, 0.135248495f, 0.100845836f, -0.516270038f, -0.0492830471f, 0.112741666f, 0.0071479531f, -0.00907387424f, -0.00069141775f, 0.000221259601f, 6.61705214e-05f, 2.35478491e-05f, -4.97912747e-06f, -3.07068309e-06f, 5.28994158e-08f,
+    0.034724399f, 0.0589047426f, 0.0855871613f, -0.224920003f, -0.0415481775f, 0.0490466247f, 0.00566960677f, -0.00390576625f, -0.000434088676f, 8.42001925e-05f, 2.83549791e-05f, 1.18815413e-05f, -1.54525671e-06f, -1.44493833e-06f, -3.22124902e-08f,
+    -0.214007809f, -0.0940579608f, -0.503362407f, 0.359462232f, 0.244150072f, -0.0780539263f, -0.0330408546f, 0.0060121273f, 0.00244267839f, -6.65044134e-05f, -0.000151299244f, -3.21690376e-05f, 9.18229943e-06f, 4.34163129e-06f, -2.41553626e-07f,
+    -0.171652392f, 0.10498553f, -0.383206798f, -0.398636755f, 0.184414114f, 0.0892307387f, -0.0230629343f, -0.0084694432f, 0.00104011497f, 0.0005533805f, 4.34258386e-05f, -3.5455318e-05f, -1.16017859e-05f, 1.90400907e-06f, 1.30991364e-06f,
+    -0.0635888705f, 0.0531468084f, -0.140336469f, -0.201940188f, 0.0674151518f, 0.0450493258f, -0.00827219987f, -0.00418741128f, 0.000312721957f, 0.00025292416f, 2.91026704e-05f, -1.3896985e-05f, -5.79606233e-06f, 5.80680899e-07f, 6.04032327e-07f,
+    0.00023856675f, -0.150521891f, -0.0109185569f, 0.571687989f, 0.00614059891f, -0.127825684f, -0.00193179023f, 0.0120587961f, 0.000538059288f, -0.00077859751f, -0.000103006f, 5.23550427e-05f, 1.39537543e-05f, -3.84311834e-06f, -1.69893554e-06f,
+    -0.261551806f, -0.000911933707f, -0.590238394f, 0.00455066268f, 0.286271857f, 0.000124337853f, -0.038721482f, -0.0006811024f, 0.00286423958f, 0.000207751069f, -0.000183025589f, -3.46080307e-05f, 1.33556069e-05f, 4.1645642e-06f, -1.00321201e-06f,
+    -0.117565614f, 0.00913014f, -0.264582193f, -0.0341772191f, 0.128271355f, 0.00815455376f, -0.0172803449f, -0.00107009216f, 0.00125319415f, 0.000142697389f, -7.573161e-05f, -1.88709335e-05f, 5.11839741e-06f, 2.11517394e-06f, -3.4323953e-07f,
+    0.217018634f, -0.0985810163f, 0.487794713f, 0.374268041f, -0.23692353f, -0.0838410516f, 0.0324877237f, 0.0080034775f, -0.00256491399f, -0.000541820202f, 0.000194175968f, 4.04816465e-05f, -1.77281475e-05f, -3.49739608e-06f, 1.85478735e-06f,
+    -0.167792065f, -0.106355427f, -0.374669991f, 0.403484565f, 0.181795617f, -0.0906984002f, -0.0246897332f, 0.00884159669f, 0.00186416615f, -0.000643510068f, -0.000126978028f, 5.36622309e-05f, 1.04229954e-05f, -5.04708734e-06f, -9.93567624e-07f,
+    -0.0891607716f, -0.0415510856f, -0.199295375f, 0.157621766f, 0.0967149999f, -0.035450026f, -0.0131545027f, 0.00346655537f, 0.00100030296f, -0.000254881563f, -6.93692057e-05f, 2.15523356e-05f, 5.80754466e-06f, -2.04669971e-06f, -5.64046789e-07f,
+    0.28235978f, 0.0243826693f, 0.637872326f, -0.0912009035f, -0.30897179f, 0.0218595722f, 0.0412663728f, -0.00292036059f, -0.00286267412f, 0.00039611869f, 0.000149212945f, -5.17382252e-05f, -7.49362981e-06f, 5.52708531e-06f, 1.76650124e-07f,
+    0.0424747555f, -0.135120644f, 0.109019874f, 0.513718445f, -0.0537693628f, -0.114314427f, 0.00843760278f, 0.0104609893f, -0.00103954832f, -0.000595444289f, 0.000136971583f, 2.95747762e-05f, -1.60883613e-05f, -1.26429521e-06f, 1.70710605e-06f,
+    0.00119745848f, -0.0622713098f, 0.0085757056f, 0.236651967f, -0.00458778228f, -0.0527596512f, 0.00117739597f, 0.00488635187f, -0.000285819252f, -0.000292699007f, 5.21035806e-05f, 1.65694207e-05f, -6.755584e-06f, -9.18380414e-07f, 7.56008262e-07f,
+    0.14880857f, 0.12952333f, 0.3305075f, -0.492602261f, -0.15862444f, 0.109435472f, 0.0192757551f, -0.00990600276f, -0.000659615731f, 0.000534007529f, -8.09187735e-05f, -2.12450987e-05f, 1.4246609e-05f, 1.41384121e-07f, -1.24604703e-06f,
+    0.219735745f, -0.0666690996f, 0.516296886f, 0.255365816f, -0.249914801f, -0.054865296f, 0.0331587848f, 0.0038790972f, -0.00221815317f, 5.39393256e-05f, 9.91091742e-05f, -3.64325101e-05f, -2.70058451e-06f, 3.99789346e-06f, -3.17982562e-07f,
+    0.0893213107f, -0.0381714727f, 0.211083778f, 0.145976781f, -0.102262199f, -0.0315907807f, 0.0136804205f, 0.00237091819f, -0.000955060686f, -9.59211662e-06f, 4.96675967e-05f, -1.50269845e-05f, -2.11633105e-06f, 1.78772238e-06f, -6.395549e-08f,
+    -0.0893042953f, 0.141504111f, -0.216576649f, -0.540414274f, 0.104801608f, 0.117746082f, -0.0138620274f, -0.00932038555f, 0.000911422362f, 0.000187617249f, -3.76198991e-05f, 2.96934745e-05f, 6.00404947e-07f, -3.32811002e-06f, 1.79386505e-07f,
+    0.235842207f, 0.0493867531f, 0.553012835f, -0.187935912f, -0.266298762f, 0.0416334728f, 0.0335244364f, -0.00369975358f, -0.00160868135f, 0.00018256758f, -3.34321706e-05f, -4.98766025e-06f, 1.04939814e-05f, -2.24575191e-07f, -6.83083979e-07f,
+    0.111645621f, 0.0132251394f, 0.26224677f, -0.0502135236f, -0.126314397f, 0.0112491484f, 0.0159440548f, -0.0010721154f, -0.00078067952f, 7.01599715e-05f, -1.26409263e-05f, -4.12298457e-06f, 4.67791888e-06f, 1.09948377e-07f, -3.18341382e-07f,
+    -0.259781886f, 0.0521501543f, -0.608156445f, -0.198269708f, 0.292869056f, 0.0441141499f, -0.0368909405f, -0.00403116739f, 0.00177756288f, 0.000225428595f, 3.56410201e-05f, -9.57839966e-06f, -1.15759856e-05f, 3.39351175e-08f, 7.92003174e-07f,
+    0.0778984062f, 0.12994382f, 0.190245922f, -0.496236475f, -0.0921795137f, 0.108146897f, 0.0123474152f, -0.00857561837f, -0.000866230742f, 0.000176169751f, 4.49286038e-05f, 2.69877625e-05f, -1.64976214e-06f, -3.10222123e-06f, -1.32143621e-07f,
+    0.0514684733f, 0.0550899939f, 0.124033603f, -0.21043828f, -0.0599822848f, 0.0458044533f, 0.00788627938f, -0.0035983357f, -0.000501894908f, 6.48844351e-05f, 1.79312279e-05f, 1.27348259e-05f, -7.87146618e-09f, -1.39624116e-06f, -1.09565118e-07f,
+    -0.238871977f, -0.0747266443f, -0.560451594f, 0.286132059f, 0.271413555f, -0.0615681478f, -0.0361747354f, 0.00440784011f, 0.00247849752f, 4.54648919e-05f, -0.000121277882f, -3.92212264e-05f, 4.53635225e-06f, 4.48747912e-06f, 2.20897105e-07f,
+    -0.139336401f, 0.117439398f, -0.308902709f, -0.446483432f, 0.148313285f, 0.0993587627f, -0.0180991755f, -0.00909263081f, 0.000647844545f, 0.000514428556f, 7.04697067e-05f, -2.37873487e-05f, -1.30196209e-05f, 5.57872479e-07f, 1.22055282e-06f,
+    -0.0474773853f, 0.0575119669f, -0.103296948f, -0.218771749f, 0.0494496957f, 0.0485508622f, -0.00584113239f, -0.00436530163f, 0.000134080845f, 0.000228289025f, 3.93518548e-05f, -8.20411111e-06f, -6.13813378e-06f, -3.36542385e-08f, 5.34487878e-07f,
+    -0.0431534107f, -0.148227725f, -0.110723867f, 0.563388435f, 0.0546380797f, -0.125535212f, -0.00860970297f, 0.0115870929f, 0.00107277f, -0.000684838648f, -0.000143226196f, 3.77500215e-05f, 1.71194769e-05f, -2.04639714e-06f, -1.88378848e-06f,
+    -0.258906605f, 0.0204349596f, -0.584113321f, -0.0763920905f, 0.283034689f, 0.0183604602f, -0.0379363157f, -0.00248104871f, 0.00268069973f, 0.000342155046f, -0.000148994212f, -4.53746976e-05f, 8.61779207e-06f, 4.95890684e-06f, -3.87569656e-07f,
+    -0.113609674f, 0.0185790951f, -0.255465189f, -0.0700308043f, 0.123724237f, 0.0162054927f, -0.0165017535f, -0.00184912127f, 0.00113663827f, 0.000197147209f, -5.78771285e-05f, -2.2781883e-05f, 2.78774053e-06f, 2.35803551e-06f, -5.47920922e-08f,
+    0.186060627f, -0.115052402f, 0.416564258f, 0.436567946f, -0.202215342f, -0.0980435742f, 0.0275835062f, 0.00950405787f, -0.00212613907f, -0.000678949137f, 0.000152426134f, 5.51744996e-05f, -1.32249264e-05f, -5.10177738e-06f, 1.32948619e-06f,
+    -0.196451941f, -0.0915153141f, -0.440622557f, 0.347323865f, 0.213953514f, -0.0779275569f, -0.0292615441f, 0.00751095055f, 0.00228301457f, -0.000526167409f, -0.000168362036f, 4.1534337e-05f, 1.50173515e-05f, -3.75761228e-06f, -1.54541025e-06f,
+    -0.100068562f, -0.0338301835f, -0.22439772f, 0.128406392f, 0.108956327f, -0.0288043835f, -0.0148968089f, 0.00277285518f, 0.00116061468f, -0.000193414451f, -8.53134287e-05f, 1.51674979e-05f, 7.58618688e-06f, -1.36522316e-06f, -7.78687697e-07f,
+    0.285836065f, 0.00105557119f, 0.645922736f, -0.00270610271f, -0.31318852f, 0.00196812568f, 0.0422437146f, -0.000984205995f, -0.00308155601f, 0.000258259977f, 0.000188985089f, -4.16092067e-05f, -1.29126629e-05f, 4.89260557e-06f, 8.53499323e-07f,
+    0.00285793369f, -0.137512245f, 0.0178989852f, 0.522396783f, -0.0095208208f, -0.116679222f, 0.00238258044f, 0.0109332847f, -0.00056840631f, -0.000687300631f, 0.000103976283f, 4.36437088e-05f, -1.37848117e-05f, -2.95052017e-06f, 1.6276808e-06f,
+    -0.0168304978f, -0.0618584419f, -0.0328937711f, 0.234909946f, 0.0155693734f, -0.0525543291f, -0.00160635877f, 0.00497521841f, -6.0141597e-05f, -0.000325203179f, 3.47460692e-05f, 2.22479934e-05f, -5.37592963e-06f, -1.63585223e-06f, 6.77311237e-07f,
+    0.184533035f, 0.116161065f, 0.412646374f, -0.441230681f, -0.198494671f, 0.0985957673f, 0.0247095465f, -0.00925963271f, -0.0010721549f, 0.000581297594f, -5.5218254e-05f, -3.4318864e-05f, 1.32038265e-05f, 1.56922621e-06f, -1.39179531e-06f,
+    0.19745922f, -0.0844953272f, 0.465148386f, 0.323034801f, -0.22550905f, -0.0700278578f, 0.0303807254f, 0.00532532883f, -0.00219711489f, -4.01499925e-05f, 0.000127754747f, -3.13491255e-05f, -6.9333129e-06f, 4.00911044e-06f, 6.62030193e-08f,
+    0.0770312452f, -0.0453314116f, 0.182856838f, 0.173115645f, -0.0887506133f, -0.0377144823f, 0.0120853654f, 0.00297965442f, -0.00091931009f, -5.48765999e-05f, 6.09048149e-05f, -1.19116468e-05f, -3.95215576e-06f, 1.70201122e-06f, 1.17945495e-07f,
+    -0.0468552855f, 0.147611829f, -0.119097398f, -0.563544027f, 0.0580399496f, 0.12298491f, -0.008208993f, -0.00985160375f, 0.000726699809f, 0.000228526899f, -6.15970702e-05f, 2.71193365e-05f, 4.22172663e-06f, -3.35970811e-06f, 1.47619687e-09f,
+    0.247234096f, 0.0289736091f, 0.579197464f, -0.109732702f, -0.279026632f, 0.0248440289f, 0.0352821928f, -0.00251812498f, -0.00174928959f, 0.000198503045f, -2.40603724e-05f, -1.50520777e-05f, 1.02029705e-05f, 6.46272054e-07f, -7.66988661e-07f,
+    0.114059234f, 0.00366079435f, 0.267799471f, -0.0135902294f, -0.129053203f, 0.00336911264f, 0.0163735315f, -0.000507164981f, -0.000832056611f, 7.47136456e-05f, -6.90764535e-06f, -8.48208498e-06f, 4.3169601e-06f, 5.03299251e-07f, -3.44724945e-07f,
+    -0.24147231f, 0.0733142924f, -0.566083211f, -0.279388538f, 0.272532943f, 0.0614904918f, -0.0342314064f, -0.00523104964f, 0.00161431198f, 0.000202621887f, 3.980926e-05f, 1.53300869e-06f, -1.11743924e-05f, -8.70156874e-07f, 6.82768969e-07f,
+    0.114841258f, 0.121514313f, 0.275069835f, -0.464150782f, -0.132845783f, 0.101046886f, 0.0172314827f, -0.00795005392f, -0.00101384533f, 0.000147373837f, 2.19167992e-05f, 2.71567392e-05f, 1.62575399e-06f, -2.91994693e-06f, -2.68224115e-07f,
+    0.0669047915f, 0.0499514078f, 0.159473914f, -0.190845036f, -0.0769625936f, 0.0415053529f, 0.00991181038f, -0.00324060426f, -0.000557836495f, 5.33776181e-05f, 7.32405604e-06f, 1.21048531e-05f, 1.43866203e-06f, -1.25684084e-06f, -1.63785365e-07f,
+    -0.257864347f, -0.0536047007f, -0.604035327f, 0.205822895f, 0.292108748f, -0.0437073041f, -0.0383970938f, 0.00278168446f, 0.00244052194f, 0.000133340078f, -8.66117745e-05f, -4.1832724e-05f, -7.93829178e-08f, 4.18160082e-06f, 5.78049429e-07f,
+    -0.103724995f, 0.127052308f, -0.227046552f, -0.483570525f, 0.108663941f, 0.107051362f, -0.0128042312f, -0.00947017482f, 0.000283597166f, 0.000457270402f, 8.71566151e-05f, -1.12508875e-05f, -1.3067748e-05f, -6.83461379e-07f, 1.01353168e-06f,
+    -0.0302611804f, 0.0604850323f, -0.0637289281f, -0.230318601f, 0.0303103875f, 0.0508692812f, -0.00331962538f, -0.00443131875f, -2.72407949e-05f, 0.000197003542f, 4.46489379e-05f, -2.40386109e-06f, -5.86640954e-06f, -5.72095331e-07f, 4.18753257e-07f,
+    -0.0854305453f, -0.142346138f, -0.207943336f, 0.541515017f, 0.101779701f, -0.12015734f, -0.0149715591f, 0.0107943004f, 0.0015358808f, -0.000563962692f, -0.000170118402f, 2.0918837e-05f, 1.83744568e-05f, -1.50015656e-07f, -1.80877287e-06f,
+    -0.250148595f, 0.0412779174f, -0.563925139f, -0.155549952f, 0.272942553f, 0.0360613557f, -0.0361795374f, -0.00415019316f, 0.00241029421f, 0.000447953199f, -0.00010739874f, -5.14608259e-05f, 3.33586979e-06f, 5.14560683e-06f, 2.22138949e-07f,
+    -0.106977323f, 0.0275712781f, -0.240192179f, -0.104211088f, 0.1161825f, 0.0238177892f, -0.0153066094f, -0.00254878048f, 0.000985604646f, 0.00023700584f, -3.7472496e-05f, -2.44470257e-05f, 3.34280809e-07f, 2.32142268e-06f, 2.14441088e-07f,
+    0.15075954f, -0.128733565f, 0.335334447f, 0.488378764f, -0.162597854f, -0.109786507f, 0.0219376034f, 0.010705047f, -0.00160419305f, -0.000779635383f, 0.000100165829f, 6.50111148e-05f, -7.37412475e-06f, -6.10049684e-06f, 6.22367689e-07f,
+    -0.22052204f, -0.0744556421f, -0.496006448f, 0.282812433f, 0.240916555f, -0.0632060616f, -0.0330407437f, 0.00594698126f, 0.00261037273f, -0.000381327435f, -0.000197825874f, 2.58282178e-05f, 1.80493971e-05f, -2.03072518e-06f, -1.88087945e-06f,
+    -0.108634421f, -0.0252905807f, -0.244107463f, 0.0961101137f, 0.118547441f, -0.0214396236f, -0.0162352775f, 0.00199345861f, 0.00127448393f, -0.00012191551f, -9.52294498e-05f, 7.48408834e-06f, 8.57677761e-06f, -5.25745786e-07f, -8.84505541e-07f,
+    0.282562149f, -0.0223075896f, 0.638439275f, 0.0858013898f, -0.309813368f, -0.0180575316f, 0.0421190106f, 0.00104237164f, -0.00319269849f, 9.4773334e-05f, 0.000217793668f, -2.69346854e-05f, -1.73096003e-05f, 3.62822923e-06f, 1.47037754e-06f,
+    -0.0369105688f, -0.13657366f, -0.0735888837f, 0.518500095f, 0.0349883584f, -0.116156585f, -0.00381558242f, 0.0110893743f, -4.71787649e-05f, -0.00074864019f, 6.0436059e-05f, 5.46625571e-05f, -9.86806158e-06f, -4.40078826e-06f, 1.31006653e-06f,
+    -0.0344935126f, -0.05994626f, -0.0735314484f, 0.227514322f, 0.0353566005f, -0.0510424862f, -0.00438378638f, 0.00491618344f, 0.000181151733f, -0.000342357124f, 1.33493495e-05f, 2.62660209e-05f, -3.33646587e-06f, -2.20715057e-06f, 4.95397177e-07f,
+    0.215874258f, 0.0999848183f, 0.484732359f, -0.37924006f, -0.233605627f, 0.0853125236f, 0.0296513134f, -0.00834390008f, -0.00150234418f, 0.000603471817f, -1.92694719e-05f, -4.54885778e-05f, 1.06587916e-05f, 3.00741022e-06f, -1.38014933e-06f,
+    0.170319605f, -0.100293262f, 0.402809101f, 0.38284839f, -0.195636248f, -0.0835925591f, 0.0268122013f, 0.00671343903f, -0.00210116887f, -0.000152779564f, 0.000149906591f, -2.23836284e-05f, -1.08911661e-05f, 3.57535098e-06f, 5.18871615e-07f,
+    0.0628363791f, -0.0513989912f, 0.150244503f, 0.196042031f, -0.0730869077f, -0.0429631689f, 0.0101666165f, 0.00354499846f, -0.000848780562f, -0.000106887266f, 6.85706245e-05f, -7.17326278e-06f, -5.56868266e-06f, 1.41569624e-06f, 3.20589983e-07f,
+    -0.00317521519f, 0.150168636f, -0.0187786344f, -0.57299505f, 0.00986147076f, 0.125363725f, -0.0023130244f, -0.0102274232f, 0.000507373666f, 0.000285378808f, -8.15507053e-05f, 2.10569334e-05f, 7.6989494e-06f, -3.1329443e-06f, -2.30841499e-07f,
+    0.25249237f, 0.00785462649f, 0.591306179f, -0.0288976687f, -0.285051381f, 0.00741694388f, 0.036294258f, -0.00124882392f, -0.00189034702f, 0.000203398526f, -6.33465864e-06f, -2.42556732e-05f, 8.93677603e-06f, 1.55880291e-06f, -8.1966591e-07f,
+    0.11363677f, -0.00599290639f, 0.266842779f, 0.0233384098f, -0.128688032f, -0.00461397708f, 0.0164522429f, 8.71778004e-05f, -0.000881419471f, 7.32938816e-05f, 2.32297431e-06f, -1.22319493e-05f, 3.52698172e-06f, 8.98886218e-07f, -3.53615486e-07f,
+    -0.217159514f, 0.0927103255f, -0.510237108f, -0.35374602f, 0.245655155f, 0.0774032392f, -0.0308667009f, -0.00632107109f, 0.0014603405f, 0.00017957206f, 3.45707583e-05f, 1.18282e-05f, -9.8261771e-06f, -1.66003275e-06f, 5.75808519e-07f,
+    0.148887567f, 0.110163509f, 0.353239464f, -0.420787295f, -0.170311371f, 0.0916130294f, 0.0217174496f, -0.00721209095f, -0.00114453145f, 0.000135284167f, 2.72092413e-09f, 2.41924367e-05f, 4.62268231e-06f, -2.5643398e-06f, -3.69467464e-07f,
+    0.0806539481f, 0.0436131927f, 0.191039411f, -0.166616354f, -0.0920844461f, 0.0362511145f, 0.0117130869f, -0.00283939884f, -0.00060673821f, 4.93958534e-05f, -2.19070271e-06f, 1.01187238e-05f, 2.69959248e-06f, -1.04681509e-06f, -2.02478943e-07f,
+    -0.270509857f, -0.0312032738f, -0.633029794f, 0.120470746f, 0.305748512f, -0.024908766f, -0.0396921422f, 0.00117685369f, 0.00234509347f, 0.000194581647f, -5.10870312e-05f, -4.01657602e-05f, -4.23368089e-06f, 3.52532701e-06f, 8.07304262e-07f,
+    -0.0656751721f, 0.133596164f, -0.139609697f, -0.508981671f, 0.0664257606f, 0.11215558f, -0.00731237526f, -0.00961775142f, -4.18641779e-05f, 0.000389924055f, 9.31261828e-05f, 8.93846766e-07f, -1.18932338e-05f, -1.7108224e-06f, 7.41451274e-07f,
+    -0.0123562246f, 0.0619964575f, -0.0225886985f, -0.236293737f, 0.0104601616f, 0.0519640371f, -0.000769096913f, -0.00439529162f, -0.000167446928f, 0.00016283515f, 4.50739446e-05f, 2.94758803e-06f, -5.07456796e-06f, -9.92028313e-07f, 2.81918499e-07f,
+    -0.125577015f, -0.133023389f, -0.300239208f, 0.506575383f, 0.146422617f, -0.11185613f, -0.0208511498f, 0.00972580075f, 0.00191149753f, -0.000426489522f, -0.000182403257f, 3.63880775e-06f, 1.7721858e-05f, 1.60779329e-06f, -1.51280961e-06f,
+    -0.23547498f, 0.0611118572f, -0.53013412f, -0.231018188f, 0.256249734f, 0.0527875702f, -0.0335260636f, -0.00563955619f, 0.00207340678f, 0.000520594659f, -6.23029646e-05f, -5.25855453e-05f, -1.8792637e-06f, 4.7541428e-06f, 7.39183493e-07f,
+    -0.0978228117f, 0.0358890462f, -0.219121047f, -0.1358945f, 0.105834247f, 0.0308044335f, -0.013739309f, -0.00314995926f, 0.000810277624f, 0.000260900605f, -1.64263471e-05f, -2.3853716e-05f, -1.96757711e-06f, 2.03379824e-06f, 4.27957932e-07f,
+    0.111954045f, -0.139291911f, 0.246040164f, 0.528459784f, -0.119039005f, -0.118768662f, 0.0157194806f, 0.0115639615f, -0.00102589637f, -0.000837557438f, 4.18770087e-05f, 6.90558949e-05f, -8.59254415e-07f, -6.37067243e-06f, -1.55771675e-07f,
+    -0.23942813f, -0.0555917876f, -0.539497919f, 0.211490898f, 0.262027341f, -0.046917688f, -0.0359183473f, 0.00420927996f, 0.00283082614f, -0.000218921076f, -0.000213011712f, 8.13825282e-06f, 1.91865546e-05f, -9.49387553e-08f, -1.9514624e-06f,
+    -0.114654342f, -0.0161405034f, -0.257954411f, 0.0615056915f, 0.125255269f, -0.0135477112f, -0.0171318278f, 0.00115788505f, 0.00133670201f, -4.52533768e-05f, -9.83442447e-05f, -7.21476639e-07f, 8.67351346e-06f, 3.61182225e-07f, -8.667682e-07f,
+    0.272627415f, -0.0451389539f, 0.615622296f, 0.172200967f, -0.298919909f, -0.0377055453f, 0.0408713427f, 0.00308909872f, -0.00318290563f, -8.45491346e-05f, 0.00023241511f, -8.97613845e-06f, -2.01088026e-05f, 1.85773103e-06f, 1.92350584e-06f,
+    -0.0758813423f, -0.132324864f, -0.163255699f, 0.502134798f, 0.0786743039f, -0.112737634f, -0.0099807907f, 0.010908825f, 0.000500667958f, -0.000772896177f, 9.57055772e-06f, 6.13308977e-05f, -4.69968404e-06f, -5.4060495e-06f, 7.83595295e-07f,
+    -0.0513705146f, -0.0565804154f, -0.112366554f, 0.214649865f, 0.0542913747f, -0.0482531565f, -0.0070743919f, 0.00470458358f, 0.000426669235f, -0.00034183699f, -1.0433444e-05f, 2.81197668e-05f, -8.364645e-07f, -2.54624035e-06f, 2.30070953e-07f,
+    0.242086154f, 0.0813819084f, 0.545045037f, -0.308144405f, -0.263100872f, 0.0698790375f, 0.0339566761f, -0.00715978969f, -0.00193011656f, 0.000593895914f, 2.45458802e-05f, -5.3401995e-05f, 6.71845989e-06f, 4.27696865e-06f, -1.17710068e-06f,
+    0.138983896f, -0.113678329f, 0.330806383f, 0.433374562f, -0.161008627f, -0.0952103379f, 0.0225123066f, 0.00799422786f, -0.00192115994f, -0.000277476423f, 0.000162539555f, -1.00919402e-05f, -1.41047389e-05f, 2.68033834e-06f, 9.8186495e-07f,
+    0.0470847495f, -0.0562263367f, 0.114044519f, 0.214209888f, -0.0556465672f, -0.0471988754f, 0.00796004661f, 0.00404491476f, -0.000740646142f, -0.000162291308f, 7.14580684e-05f, -1.14811941e-06f, -6.76183892e-06f, 9.32900041e-07f, 5.15678156e-07f,
+    0.0406666868f, 0.149110113f, 0.081929073f, -0.568550673f, -0.0385812625f, 0.124806306f, 0.00371674014f, -0.0104251416f, 0.000245402021f, 0.000353711436f, -9.45804727e-05f, 1.18543098e-05f, 1.07273914e-05f, -2.6104393e-06f, -5.11600981e-07f,
+    0.251497243f, -0.0134639558f, 0.589059876f, 0.0525987316f, -0.284221473f, -0.0102564489f, 0.0365191752f, 9.95766283e-05f, -0.00202209344f, 0.000191420741f, 1.84607817e-05f, -3.16362853e-05f, 6.70342236e-06f, 2.45002648e-06f, -8.10857447e-07f,
+    0.110393403f, -0.0155042186f, 0.25940943f, 0.0596725653f, -0.125225187f, -0.0125192831f, 0.0161686272f, 0.000705600144f, -0.000923872786f, 6.35649398e-05f, 1.42884059e-05f, -1.49625026e-05f, 2.33110327e-06f, 1.26602751e-06f, -3.31803703e-07f,
+    -0.187436267f, 0.109874361f, -0.441977875f, -0.419524656f, 0.212880692f, 0.0915030104f, -0.0268651916f, -0.00730069523f, 0.00131414406f, 0.000163158908f, 2.10283903e-05f, 2.03959365e-05f, -7.66323257e-06f, -2.32078143e-06f, 4.77007762e-07f,
+    0.17920051f, 0.0961640715f, 0.422838522f, -0.36719941f, -0.203682398f, 0.0800626528f, 0.025730483f, -0.00637169288f, -0.00126820709f, 0.000138110835f, -1.81530545e-05f, 1.84582514e-05f, 7.1530987e-06f, -2.06632106e-06f, -4.54161638e-07f,
+    0.0923780251f, 0.0362278923f, 0.21795643f, -0.138343123f, -0.104987649f, 0.0301620238f, 0.0132608864f, -0.00239925485f, -0.00065296337f, 5.16956249e-05f, -9.48779266e-06f, 6.99809372e-06f, 3.69889406e-06f, -7.81036663e-07f, -2.3424074e-07f,
+    -0.276486686f, -0.00806301715f, -0.646703417f, 0.0321408317f, 0.312016173f, -0.00562117898f, -0.0400665525f, -0.0003725168f, 0.00220965024f, 0.00022949467f, -1.8250705e-05f, -3.47620714e-05f, -7.60314939e-06f, 2.63917262e-06f, 9.11953869e-07f,
+    -0.0261077471f, 0.136917045f, -0.0487078341f, -0.522082173f, 0.0226175424f, 0.114581389f, -0.00175174493f, -0.00955666537f, -0.00032308505f, 0.00032041435f, 8.90623817e-05f, 1.15464368e-05f, -9.73854435e-06f, -2.46246578e-06f, 4.5452934e-07f,
+    0.00580277446f, 0.0620119692f, 0.0191254424f, -0.236545191f, -0.00962253651f, 0.0518236258f, 0.00175325054f, -0.00426900076f, -0.000285199087f, 0.000129371963f, 4.11611008e-05f, 7.39024262e-06f, -3.89228107e-06f, -1.27339116e-06f, 1.46348521e-07f,
+    -0.162623292f, -0.120489226f, -0.385382604f, 0.45939179f, 0.187487983f, -0.100868478f, -0.0261055083f, 0.00843504885f, 0.00219080969f, -0.000283488223f, -0.000180263816f, -1.23902025e-05f, 1.5387915e-05f, 3.03194996e-06f, -1.06546994e-06f,
+    -0.215225024f, 0.0794571114f, -0.483527544f, -0.300974599f, 0.233370914f, 0.0681331212f, -0.0300747479f, -0.0069122249f, 0.00169272187f, 0.000558596898f, -1.78364706e-05f, -4.90069225e-05f, -6.4780264e-06f, 3.88809909e-06f, 1.10229018e-06f,
+    -0.0863612561f, 0.0433316093f, -0.192749633f, -0.164315022f, 0.0929355477f, 0.0369981931f, -0.0118535137f, -0.00363949393f, 0.000621421012f, 0.000268873513f, 3.41688272e-06f, -2.12266214e-05f, -3.88527524e-06f, 1.55417721e-06f, 5.62658677e-07f,
+    0.0705660595f, -0.146471384f, 0.150808512f, 0.555847166f, -0.072603675f, -0.124765934f, 0.00911654325f, 0.0120547072f, -0.0004211535f, -0.000849917038f, -1.74412639e-05f, 6.70253202e-05f, 5.56410494e-06f, -5.89550396e-06f, -8.84687785e-07f,
+    -0.252716374f, -0.0353833385f, -0.570052048f, 0.135062796f, 0.276773042f, -0.0294880029f, -0.0378171011f, 0.00236455127f, 0.00293591926f, -5.01394289e-05f, -0.000212961664f, -9.7450302e-06f, 1.83406533e-05f, 1.79587285e-06f, -1.75454525e-06f,
+    -0.117983859f, -0.0066030845f, -0.265606235f, 0.025421141f, 0.128918035f, -0.00533440511f, -0.0175638053f, 0.000297795648f, 0.00134538669f, 3.13630731e-05f, -9.45471941e-05f, -8.6264092e-06f, 7.88505567e-06f, 1.18040108e-06f, -7.31976131e-07f,
+    0.256277967f, -0.0668826572f, 0.578034545f, 0.254425491f, -0.280766955f, -0.0564675033f, 0.0385171532f, 0.00508078721f, -0.00304620295f, -0.000268060494f, 0.000230885798f, 1.05731332e-05f, -2.09068579e-05f, -2.11862541e-07f, 2.12957772e-06f,
+    -0.11312622f, -0.12486689f, -0.248961048f, 0.473703522f, 0.120470737f, -0.106492273f, -0.0159320785f, 0.0103860204f, 0.00104843782f, -0.000756292208f, -4.45269962e-05f, 6.27764572e-05f, 1.17549352e-06f, -5.80852608e-06f, 1.1720576e-07f,
+    -0.06706017f, -0.0518422273f, -0.14847328f, 0.196631061f, 0.0719111124f, -0.0442505671f, -0.00959790782f, 0.00434273035f, 0.00066403239f, -0.000322692011f, -3.46374213e-05f, 2.75255793e-05f, 1.85348635e-06f, -2.59545502e-06f, -8.23747394e-08f,
+    0.262549608f, 0.060799715f, 0.592154166f, -0.229673145f, -0.286256842f, 0.0526495428f, 0.037488962f, -0.00572124893f, -0.00233207794f, 0.000548257779f, 7.28286933e-05f, -5.69263045e-05f, 1.67540688e-06f, 5.19007184e-06f, -7.78217237e-07f,
+    0.104217326f, -0.124323323f, 0.250895222f, 0.473409279f, -0.122456494f, -0.104572245f, 0.0175660304f, 0.00911575676f, -0.00165311245f, -0.000405832523f, 0.000163339816f, 4.55375677e-06f, -1.61297498e-05f, 1.37258878e-06f, 1.38116888e-06f,
+    0.0301603192f, -0.0596952689f, 0.0751381343f, 0.227189671f, -0.0368495295f, -0.0503056235f, 0.0055126608f, 0.00445697289f, -0.000594621472f, -0.00021703549f, 6.87450948e-05f, 5.65454097e-06f, -7.35073514e-06f, 2.87420296e-07f, 6.69678082e-07f,
+};
+
+static const float MARS_COEFFICIENTS[1122] = {
+    -0.209921589f, 1.35450115f, 0.747565812f, -0.426358946f, -0.137266942f, 0.0119222119f, 0.0119888274f, 0.00359411769f, -0.000127327055f, -0.000440590557f, -0.000142141348f, -5.7044776e-08f, 1.78901038e-05f, 6.65597503e-06f, 2.17768233e-07f, -8.09733878e-07f, -3.7077757e-07f,
+    0.0256661297f, -0.800526461f, 0.946939439f, 0.32889252f, -0.100018597f, -0.0396588531f, -0.00408902058f, 0.00228112687f, 0.00133797654f, 0.000189576268f, -8.1409086e-05f, -5.36392904e-05f, -9.7402691e-06f, 3.15392362e-06f, 2.44014372e-06f, 5.16490357e-07f, -9.73595096e-08f,
+    0.0174593298f, -0.403757984f, 0.413895738f, 0.16235031f, -0.0421364217f, -0.0185060438f, -0.0021997291f, 0.000948429857f, 0.000616892132f, 9.88609014e-05f, -3.34715956e-05f, -2.45912056e-05f, -4.95071963e-06f, 1.26559399e-06f, 1.11286374e-06f, 2.58752896e-07f, -3.45867433e-08f,
+    -0.24965585f, -0.989825568f, 1.0123847f, 0.292862429f, -0.111319748f, -0.00577329046f, -0.000503309667f, -0.00130017901f, 0.000386122004f, -1.35335889e-05f, 6.9714393e-06f, 8.34369076e-06f, -2.10434738e-06f, 3.9366637e-07f, -6.57643223e-08f, -5.37455955e-08f, 1.41273984e-08f,
+    0.116670233f, -1.21088815f, -0.663455639f, 0.383204486f, 0.061372516f, -0.0154393436f, 0.00236887241f, -0.00110131656f, -0.00022599225f, 5.10740197e-05f, -2.33014601e-05f, 6.32018952e-06f, 7.95258785e-07f, -2.43962538e-07f, 2.09016939e-07f, -4.64640386e-08f, 2.17576137e-09f,
+    0.0602643854f, -0.528329432f, -0.331629657f, 0.167751475f, 0.0311553619f, -0.00692213777f, 0.00109977673f, -0.000469683294f, -0.00011407888f, 2.37836111e-05f, -1.08724341e-05f, 2.67149622e-06f, 4.21646392e-07f, -1.22526527e-07f, 9.76137893e-08f, -1.98460169e-08f, 6.14649045e-10f,
+    -0.154360976f, -1.23890016f, -0.779365793f, 0.494367553f, 0.0781269456f, -0.0582270795f, 0.00615266605f, 0.00430242165f, -0.00202603492f, 3.10535169e-05f, 0.000249526568f, -7.85539649e-05f, -1.06365139e-05f, 1.42815916e-05f, -2.85328137e-06f, -1.23735379e-06f, 8.91572996e-07f,
+    0.0970803593f, 0.9163497f, -0.936664133f, -0.284573115f, 0.166186618f, 0.00435919632f, -0.0153089856f, 0.00402699857f, 0.000685966807f, -0.000698606456f, 0.000113760014f, 5.89471798e-05f, -3.34682564e-05f, 1.87410013e-06f, 4.19836064e-06f, -1.554939e-06f, -6.48789898e-08f,
+    0.0486937449f, 0.453720602f, -0.408298609f, -0.143872762f, 0.0740732692f, 0.00357717804f, -0.00718554734f, 0.00172961613f, 0.00036942763f, -0.000321133148f, 4.5390355e-05f, 2.91554501e-05f, -1.50558586e-05f, 4.72002264e-07f, 2.0021913e-06f, -6.79346777e-07f, -5.39187252e-08f,
+    -0.167433288f, 1.00230331f, -0.993343424f, -0.410931505f, 0.16710579f, 0.0571806196f, -0.0156949765f, -0.0078568272f, 0.00149463027f, 0.00119885695f, -0.000133072221f, -0.000189278433f, 6.75130721e-06f, 3.03155305e-05f, 1.19434323e-06f, -4.74911137e-06f, -7.11106971e-07f,
+    0.0594136609f, 1.11537133f, 0.749140829f, -0.429100483f, -0.143297021f, 0.0478043125f, 0.0187419939f, -0.00444260965f, -0.00275584009f, 0.000426970626f, 0.000430389209f, -3.33147748e-05f, -6.8731785e-05f, 2.25342604e-07f, 1.11058435e-05f, 7.23009583e-07f, -2.05543666e-06f,
+    0.0317764836f, 0.48416853f, 0.37039263f, -0.185580916f, -0.0702273319f, 0.0203656632f, 0.00901802601f, -0.00182368747f, -0.00130396932f, 0.000163237006f, 0.000200924259f, -1.01404521e-05f, -3.16937544e-05f, -7.1881193e-07f, 5.05917926e-06f, 4.60260782e-07f, -9.23048054e-07f,
+    -0.218129941f, 1.24339563f, 0.861444259f, -0.376482178f, -0.143701357f, 0.00545724508f, 0.00974960741f, 0.00367412832f, 0.000218272565f, -0.000314428353f, -0.000139067989f, -1.76559033e-05f, 1.02702452e-05f, 6.08830432e-06f, 1.11727586e-06f, -3.44733777e-07f, -2.8680538e-07f,
+    0.0256506196f, -0.94302438f, 0.860394081f, 0.367145469f, -0.0820316f, -0.0376545615f, -0.00550406193f, 0.0013268358f, 0.0011821441f, 0.000256154007f, -3.05251532e-05f, -4.25172948e-05f, -1.26672659e-05f, 3.09576623e-07f, 1.69304638e-06f, 6.40191614e-07f, 6.64747913e-08f,
+    0.0176778342f, -0.466063959f, 0.371081173f, 0.178528887f, -0.0337097255f, -0.0174104985f, -0.00278775055f, 0.000508621366f, 0.000536027843f, 0.000125961045f, -1.02219472e-05f, -1.90129427e-05f, -6.08582331e-06f, -2.32186401e-08f, 7.45863516e-07f, 3.02843701e-07f, 3.82545705e-08f,
+    -0.241714094f, -1.13993484f, 0.922044323f, 0.336222365f, -0.107442527f, -0.00604995821f, 0.000527098464f, -0.00161159469f, 0.000388159803f, -1.25011909e-05f, -4.23805773e-06f, 1.11478547e-05f, -2.52705026e-06f, 3.84371611e-07f, 4.50256134e-08f, -8.46731783e-08f, 2.31503221e-08f,
+    0.122978339f, -1.09556372f, -0.765573778f, 0.355666304f, 0.0700089505f, -0.0168620793f, 0.00300950901f, -0.00087124582f, -0.00028867302f, 7.61182225e-05f, -2.89422228e-05f, 4.71960051e-06f, 1.38387784e-06f, -5.76766717e-07f, 2.68387873e-07f, -3.90170922e-08f, -3.48729344e-09f,
+    0.0629403378f, -0.471323927f, -0.375985203f, 0.153931126f, 0.0350089807f, -0.00756621197f, 0.00136543593f, -0.000355698578f, -0.000142867675f, 3.52353574e-05f, -1.31535485e-05f, 1.86128062e-06f, 7.02968806e-07f, -2.74844238e-07f, 1.21819923e-07f, -1.55904893e-08f, -2.22664312e-09f,
+    -0.154116163f, -1.10916004f, -0.895950971f, 0.456548278f, 0.104390746f, -0.0596663252f, 0.00279211501f, 0.00563614091f, -0.00188365409f, -0.000227452231f, 0.000307371111f, -5.380932e-05f, -2.81355116e-05f, 1.56543881e-05f, -3.42826938e-07f, -2.25441957e-06f, 8.40845432e-07f,
+    0.0915843634f, 1.03864613f, -0.849236757f, -0.34095476f, 0.159865416f, 0.0133840252f, -0.0173092843f, 0.00320070408f, 0.00126509989f, -0.000742611468f, 3.28030697e-05f, 9.18611252e-05f, -3.02856843e-05f, -4.67657684e-06f, 5.7411864e-06f, -9.03842459e-07f, -5.92893488e-07f,
+    0.046165947f, 0.506249897f, -0.36500678f, -0.168691038f, 0.0704552126f, 0.00775430115f, -0.00801089189f, 0.00131440522f, 0.000631065706f, -0.00033426684f, 6.69916613e-06f, 4.35719971e-05f, -1.31206457e-05f, -2.56859809e-06f, 2.64125006e-06f, -3.53188893e-07f, -2.94614088e-07f,
+    -0.168056224f, 1.13584354f, -0.88736723f, -0.465540902f, 0.141416123f, 0.0644056314f, -0.0107953135f, -0.00863117422f, 0.000548871701f, 0.00125064905f, 4.40361037e-05f, -0.000182007674f, -2.53424989e-05f, 2.59158452e-05f, 6.80185517e-06f, -3.4625676e-06f, -1.77770143e-06f,
+    0.0569969135f, 1.00660061f, 0.851058444f, -0.377809769f, -0.162533083f, 0.0377280682f, 0.0209756644f, -0.00248867372f, -0.00297052067f, 5.41138867e-05f, 0.000434482606f, 3.55662318e-05f, -6.29290998e-05f, -1.20491418e-05f, 8.81251834e-06f, 2.76769383e-06f, -1.27570914e-06f,
+    0.0306861038f, 0.430621466f, 0.414225526f, -0.160562971f, -0.0783456791f, 0.015547674f, 0.00990856835f, -0.000906650761f, -0.00137663804f, -9.1296979e-06f, 0.000197980418f, 2.12431031e-05f, -2.81602606e-05f, -6.22680394e-06f, 3.85526081e-06f, 1.36272452e-06f, -5.36571337e-07f,
+    -0.226604441f, 1.11386056f, 0.962759421f, -0.32351773f, -0.147241474f, 0.000133352679f, 0.00744710198f, 0.0035110377f, 0.000465699978f, -0.000192276314f, -0.000120006239f, -2.73579412e-05f, 3.52440259e-06f, 4.5675272e-06f, 1.43758603e-06f, 2.12108155e-08f, -1.60494494e-07f,
+    0.0268923845f, -1.07340159f, 0.762708411f, 0.399085363f, -0.0646878249f, -0.0348734463f, -0.00633116677f, 0.000478264167f, 0.000975356639f, 0.000279180198f, 9.27881349e-06f, -2.88449534e-05f, -1.25478737e-05f, -1.57542495e-06f, 8.6058669e-07f, 5.58427762e-07f, 1.421021e-07f,
+    0.0184801745f, -0.522298695f, 0.323503647f, 0.191725102f, -0.0256576154f, -0.0159897626f, -0.00310435616f, 0.000123944439f, 0.000434470506f, 0.000133196359f, 7.5105871e-06f, -1.24801882e-05f, -5.84768361e-06f, -8.46153247e-07f, 3.55480659e-07f, 2.55411344e-07f, 6.94965898e-08f,
+    -0.232762796f, -1.27305098f, 0.81955139f, 0.377301917f, -0.103070226f, -0.00699979609f, 0.00176346926f, -0.00190892129f, 0.000380541566f, 1.64507793e-06f, -1.85383247e-05f, 1.41847064e-05f, -2.76382968e-06f, 1.75082839e-07f, 2.06525206e-07f, -1.24316419e-07f, 3.00972775e-08f,
+    0.127819135f, -0.96457414f, -0.858301254f, 0.324309019f, 0.0792408215f, -0.0185529525f, 0.00344541658f, -0.000578651265f, -0.00037326952f, 0.000104577502f, -3.18432955e-05f, 2.09047316e-06f, 2.41901069e-06f, -9.58868551e-07f, 2.97551435e-07f, -1.4203009e-08f, -1.68242782e-08f,
+    0.0649154548f, -0.407602695f, -0.415695298f, 0.138422664f, 0.039121328f, -0.00831480919f, 0.00153157289f, -0.000213442258f, -0.00018143601f, 4.78946708e-05f, -1.40940849e-05f, 5.73287874e-07f, 1.18389865e-06f, -4.44306085e-07f, 1.30794278e-07f, -3.13669634e-09f, -8.52923135e-09f,
+    -0.154607028f, -0.965772703f, -1.00034464f, 0.410261354f, 0.130242213f, -0.0590964102f, -0.00122681689f, 0.00674551086f, -0.00152809065f, -0.000510992743f, 0.000329736826f, -1.22197735e-05f, -4.40464332e-05f, 1.31429937e-05f, 3.12657504e-06f, -2.79657571e-06f, 3.97739158e-07f,
+    0.0865226407f, 1.14616286f, -0.749454973f, -0.393394713f, 0.14953309f, 0.0230446436f, -0.0186146154f, 0.00199639127f, 0.00182286141f, -0.000701175191f, -7.23640333e-05f, 0.000115413462f, -1.9155727e-05f, -1.1971134e-05f, 5.96393961e-06f, 3.11278368e-07f, -1.0792862e-06f,
+    0.0438576259f, 0.551619949f, -0.316385638f, -0.191466987f, 0.0650092883f, 0.0121676752f, -0.00849952815f, 0.000732022774f, 0.00087707049f, -0.000307543126f, -4.21223522e-05f, 5.3236585e-05f, -7.58517204e-06f, -5.84428475e-06f, 2.64895992e-06f, 2.18605707e-07f, -5.05535897e-07f,
+    -0.168779729f, 1.25535441f, -0.76894083f, -0.511726307f, 0.113036116f, 0.0691835949f, -0.00556964198f, -0.00877872069f, -0.000395848912f, 0.00115977779f, 0.000203493997f, -0.000145244525f, -4.99929686e-05f, 1.59863553e-05f, 1.01082669e-05f, -1.26877522e-06f, -2.10910922e-06f,
+    0.0542743685f, 0.88460354f, 0.940834264f, -0.320566764f, -0.177593914f, 0.0267238404f, 0.0220690464f, -0.000457214083f, -0.00290996749f, -0.000302770283f, 0.00037877674f, 9.36467543e-05f, -4.5298846e-05f, -2.05618538e-05f, 4.41268614e-06f, 3.80994827e-06f, -1.35155512e-07f,
+    0.0294585326f, 0.371396604f, 0.452143368f, -0.133047484f, -0.0844747907f, 0.0103712958f, 0.0102672366f, 2.87770456e-05f, -0.00132312492f, -0.00017027414f, 0.000168098764f, 4.68695647e-05f, -1.94067171e-05f, -9.85922724e-06f, 1.74823028e-06f, 1.78085832e-06f, -4.68562816e-09f,
+    -0.235065882f, 0.967514743f, 1.05030487f, -0.268483435f, -0.148329747f, -0.00399400594f, 0.00523265289f, 0.003170449f, 0.000617868047f, -8.75494412e-05f, -9.23324111e-05f, -3.02056023e-05f, -1.40277391e-06f, 2.7692532e-06f, 1.32821084e-06f, 2.30815154e-07f, -4.80487328e-08f,
+    0.0294956217f, -1.18954524f, 0.655407696f, 0.424750941f, -0.0483556853f, -0.0316189844f, -0.00662634778f, -0.000227870309f, 0.000750923804f, 0.000268220513f, 3.5847251e-05f, -1.56255811e-05f, -1.04773477e-05f, -2.45699252e-06f, 1.73337731e-07f, 3.77462717e-07f, 1.46239509e-07f,
+    0.0199063895f, -0.571538165f, 0.271896981f, 0.20198493f, -0.0181370144f, -0.0143845938f, -0.00317939547f, -0.000190552461f, 0.000327419917f, 0.000125321019f, 1.89387785e-05f, -6.3419455e-06f, -4.76438272e-06f, -1.20141299e-06f, 4.33809204e-08f, 1.66748367e-07f, 6.83364109e-08f,
+    -0.223168467f, -1.38721312f, 0.70597286f, 0.415738283f, -0.0978635146f, -0.00872463774f, 0.00317846195f, -0.00217677851f, 0.000350385901f, 3.14844983e-05f, -3.56633223e-05f, 1.69878872e-05f, -2.5090957e-06f, -2.97499886e-07f, 4.18578285e-07f, -1.61604902e-07f, 2.89140964e-08f,
+    0.131065395f, -0.820019867f, -0.94042975f, 0.289027465f, 0.0891183723f, -0.0203597281f, 0.0036273569f, -0.000209336671f, -0.000479850585f, 0.000132552624f, -3.06075594e-05f, -2.03788845e-06f, 3.88718586e-06f, -1.31442909e-06f, 2.62271588e-07f, 3.90514985e-08f, -3.84306729e-08f,
+    0.066141499f, -0.338184445f, -0.450235552f, 0.121188294f, 0.0435061225f, -0.00909531985f, 0.00157637432f, -3.68328485e-05f, -0.000229462552f, 5.99031782e-05f, -1.30610343e-05f, -1.39546093e-06f, 1.84990057e-06f, -5.94415195e-07f, 1.088493e-07f, 2.22887677e-08f, -1.84006539e-08f,
+    -0.155661266f, -0.810797993f, -1.09094245f, 0.356046828f, 0.154815547f, -0.0563103981f, -0.00570328763f, 0.00749581526f, -0.000964603333f, -0.00078234606f, 0.000304812463f, 4.11884444e-05f, -5.38277843e-05f, 6.38353201e-06f, 6.64288396e-06f, -2.49210553e-06f, -3.80226928e-07f,
+    0.081962899f, 1.23776984f, -0.638718635f, -0.440689443f, 0.135151013f, 0.0329203541f, -0.0190444017f, 0.000469485257f, 0.00228970543f, -0.00056368379f, -0.000187883861f, 0.000122196098f, -8.51212361e-07f, -1.80096833e-05f, 4.36962193e-06f, 1.78807917e-06f, -1.27577188e-06f,
+    0.0417951259f, 0.589369786f, -0.263122437f, -0.211663667f, 0.0577417961f, 0.016618676f, -0.00857419099f, 1.15876235e-05f, 0.00107569992f, -0.000237116842f, -9.43971541e-05f, 5.48904491e-05f, 1.07196794e-06f, -8.42823366e-06f, 1.82239855e-06f, 8.87269528e-07f, -5.74428898e-07f,
+    -0.169729635f, 1.35929834f, -0.639793835f, -0.548706666f, 0.0828903352f, 0.0714008549f, -0.000358737168f, -0.0083195877f, -0.0012415438f, 0.000947377416f, 0.000321848008f, -8.81419006e-05f, -6.25283273e-05f, 3.52099389e-06f, 1.04064546e-05f, 1.04118912e-06f, -1.67088794e-06f,
+    0.0512293184f, 0.750720759f, 1.01717953f, -0.258589614f, -0.188162004f, 0.0153196079f, 0.0220057835f, 0.00148129054f, -0.00259665716f, -0.000598967999f, 0.000276313783f, 0.000131077803f, -2.06828432e-05f, -2.35390191e-05f, -6.16770671e-07f, 3.61750057e-06f, 8.94655251e-07f,
+    0.0280895702f, 0.307152438f, 0.483603242f, -0.103615115f, -0.0884946089f, 0.00508184169f, 0.0100959085f, 0.000904964681f, -0.00115642619f, -0.000300270975f, 0.000117902108f, 6.24731797e-05f, -7.78100755e-06f, -1.08845887e-05f, -5.65423022e-07f, 1.62976582e-06f, 4.55454597e-07f,
+    -0.243200136f, 0.80630026f, 1.12312197f, -0.212289863f, -0.147451398f, -0.00695077408f, 0.00322132872f, 0.00271722975f, 0.000688056439f, -7.50304977e-06f, -6.24166509e-05f, -2.81255713e-05f, -4.28819668e-06f, 1.1747711e-06f, 9.89462992e-07f, 2.96858585e-07f, 2.44907726e-08f,
+    0.0335071953f, -1.28951439f, 0.540105813f, 0.444323646f, -0.0332796458f, -0.0281748457f, -0.00647037911f, -0.000777254555f, 0.000535135527f, 0.00023467476f, 4.97472648e-05f, -4.74422309e-06f, -7.55930258e-06f, -2.54122103e-06f, -2.69070893e-07f, 1.87299281e-07f, 1.10778959e-07f,
+    0.021969257f, -0.612946366f, 0.217028719f, 0.209416901f, -0.011246787f, -0.0127244163f, -0.00305308264f, -0.000430079663f, 0.000226571458f, 0.000107761871f, 2.44967603e-05f, -1.41011886e-06f, -3.34811946e-06f, -1.19663877e-06f, -1.50211365e-07f, 7.77777541e-08f, 5.01077042e-08f,
+    -0.213310351f, -1.480801f, 0.58252953f, 0.451055715f, -0.0914544244f, -0.0112955571f, 0.00472919208f, -0.00238979132f, 0.000283616539f, 7.86001125e-05f, -5.45775822e-05f, 1.87153053e-05f, -1.41276538e-06f, -1.06959559e-06f, 6.55117384e-07f, -1.7484207e-07f, 1.12767192e-08f,
+    0.132671365f, -0.664212384f, -1.01080909f, 0.24974138f, 0.0996033235f, -0.0221018741f, 0.00350135465f, 0.00024778789f, -0.000603982927f, 0.000154700504f, -2.35214957e-05f, -7.98813054e-06f, 5.63143962e-06f, -1.51541281e-06f, 1.18586422e-07f, 1.27601311e-07f, -6.50418469e-08f,
+    0.066607965f, -0.264175149f, -0.47911266f, 0.102204743f, 0.0481357024f, -0.00982301781f, 0.00147628764f, 0.000178512586f, -0.000284529184f, 6.87682479e-05f, -9.29751536e-06f, -4.16977468e-06f, 2.61944529e-06f, -6.65494855e-07f, 3.65492363e-08f, 6.32346756e-08f, -3.01170677e-08f,
+    -0.157108101f, -0.646363005f, -1.16635241f, 0.294677849f, 0.177229556f, -0.0512211253f, -0.0103765863f, 0.00777277307f, -0.000227595656f, -0.00099970907f, 0.000228034741f, 9.74172028e-05f, -5.35681228e-05f, -3.68145812e-06f, 9.00780195e-06f, -1.22146823e-06f, -1.24375622e-06f,
+    0.0779337507f, 1.3125643f, -0.518607023f, -0.481706223f, 0.116853968f, 0.0425380391f, -0.0184707253f, -0.00128255209f, 0.00259752367f, -0.000333783144f, -0.000295032605f, 0.000107210022f, 2.16299319e-05f, -2.06732e-05f, 1.00275088e-06f, 3.0226016e-06f, -9.91405394e-07f,
+    0.0399868926f, 0.619144741f, -0.205980784f, -0.228783146f, 0.0487389944f, 0.0208879612f, -0.00818341845f, -0.000799070304f, 0.0011966741f, -0.000125806927f, -0.000141416213f, 4.64883864e-05f, 1.13693216e-05f, -9.37481242e-06f, 2.14747546e-07f, 1.41850824e-06f, -4.20572592e-07f,
+    -0.171039512f, 1.44626529f, -0.501818952f, -0.575935659f, 0.0519403985f, 0.0710896686f, 0.00451331925f, -0.00733044046f, -0.00190821765f, 0.000650660371f, 0.000384639597f, -2.31958577e-05f, -6.15907129e-05f, -8.10376154e-06f, 7.99973615e-06f, 2.72233722e-06f, -7.41470971e-07f,
+    0.04787442f, 0.60644168f, 1.07900499f, -0.193186267f, -0.194101061f, 0.00404494076f, 0.0208559278f, 0.00317451217f, -0.00208162778f, -0.00080177055f, 0.000147193456f, 0.00014308371f, 4.88994532e-06f, -2.08905055e-05f, -4.7744425e-06f, 2.40626924e-06f, 1.45034723e-06f,
+    0.0265886952f, 0.23861207f, 0.50815842f, -0.0728811647f, -0.0903692456f, -7.86871641e-05f, 0.00943563455f, 0.00165416437f, -0.000902141801f, -0.000385142306f, 5.70027723e-05f, 6.62063376e-05f, 3.91544148e-06f, -9.35388856e-06f, -2.40562015e-06f, 1.02879388e-06f, 6.84856661e-07f,
+    -0.250673983f, 0.632458448f, 1.18049909f, -0.15571547f, -0.145098409f, -0.00882897509f, 0.00149069165f, 0.0022082088f, 0.000695378788f, 4.59953573e-05f, -3.48312387e-05f, -2.32212899e-05f, -5.41178463e-06f, 2.62458901e-08f, 5.94451341e-07f, 2.67401642e-07f, 5.59027408e-08f,
+    0.0389069042f, -1.37158826f, 0.418466681f, 0.458092784f, -0.019581523f, -0.024789725f, -0.00595592635f, -0.00117378465f, 0.000345669403f, 0.000189516493f, 5.32544202e-05f, 3.02241902e-06f, -4.65069022e-06f, -2.13227641e-06f, -4.71293056e-07f, 4.03238985e-08f, 6.47179329e-08f,
+    0.0246502716f, -0.645796753f, 0.159682437f, 0.214175417f, -0.00502933475f, -0.0111207832f, -0.00277005689f, -0.000597980537f, 0.000139509973f, 8.56026263e-05f, 2.5353087e-05f, 2.01655784e-06f, -1.98421584e-06f, -9.77914497e-07f, -2.32153069e-07f, 1.1209125e-08f, 2.81395456e-08f,
+    -0.203557308f, -1.55256306f, 0.450607444f, 0.482668828f, -0.0834697875f, -0.0147423394f, 0.00635188313f, -0.00251314581f, 0.000166604286f, 0.000142656984f, -7.31412691e-05f, 1.81792102e-05f, 8.421762e-07f, -2.10598238e-06f, 8.51927203e-07f, -1.32007742e-07f, -3.01242194e-08f,
+    0.132671103f, -0.499626187f, -1.06836892f, 0.206431004f, 0.110559579f, -0.0235729185f, 0.00301327348f, 0.000796672166f, -0.000735734165f, 0.000164266064f, -8.88360621e-06f, -1.57257853e-05f, 7.29780401e-06f, -1.38383862e-06f, -1.74016814e-07f, 2.44077057e-07f, -8.83073935e-08f,
+    0.0663406738f, -0.186745209f, -0.501874661f, 0.08147949f, 0.0529374176f, -0.0104024346f, 0.00120826571f, 0.000433444627f, -0.000341709519f, 7.14030184e-05f, -2.08251929e-06f, -7.70129524e-06f, 3.32161848e-06f, -5.76938681e-07f, -1.02915105e-07f, 1.15447746e-07f, -3.96514029e-08f,
+};
+
+static const float JUPITER_COEFFICIENTS[231] = {
+    -2.3911374f, -3.14843929f, 0.343223753f, 0.0671868157f, -0.00543488101f, -0.00022246773f, 4.30600474e-05f,
+    3.57147114f, -1.57845874f, -0.528450217f, 0.0450262405f, 0.00476139188f, -0.000482038543f, 8.89722443e-06f,
+    1.58833292f, -0.599791676f, -0.234755063f, 0.0176613222f, 0.00217200734f, -0.000201153154f, 2.76738816e-06f,
+    -4.50778352f, 1.23681855f, 0.590293664f, -0.0248787023f, -0.00528594627f, 6.80074609e-05f, 4.52978971e-07f,
+    -1.59664609f, -2.96436369f, 0.209801307f, 0.0621567368f, -0.00171289879f, -0.00023036683f, -2.31313143e-06f,
+    -0.574472415f, -1.30007991f, 0.075554585f, 0.0272342191f, -0.000605732994f, -0.000100347319f, -1.00075322e-06f,
+    0.833794727f, 3.49291096f, -0.135778463f, -0.0852521703f, -0.000568887178f, 0.000598619582f, 4.38601918e-05f,
+    -4.07491849f, 0.833343557f, 0.6150479f, -0.00940269055f, -0.0074467703f, -0.000234788977f, 2.93964812e-05f,
+    -1.76599507f, 0.272176368f, 0.266792201f, -0.00195989812f, -0.00317650884f, -0.000115094839f, 1.15299534e-05f,
+    4.11720118f, -0.727942302f, -0.731723689f, 0.0189245422f, 0.0111869988f, -0.00018008767f, -0.000116367161f,
+    0.769650664f, 3.36860756f, -0.137646282f, -0.0921560346f, 0.00191760534f, 0.00104302744f, -1.53960044e-05f,
+    0.229667016f, 1.46076275f, -0.0412071771f, -0.0399386783f, 0.000550192747f, 0.000451201885f, -3.77400514e-06f,
+    -0.937989355f, -3.57768075f, 0.135153111f, 0.084265577f, -0.00378811637f, -0.000504889273f, 5.83413634e-05f,
+    4.01479168f, -0.53527108f, -0.622576306f, 0.0235120936f, 0.00697178258f, -0.000466373678f, -1.61298216e-05f,
+    1.74259161f, -0.142435496f, -0.26997698f, 0.00802845208f, 0.00307849709f, -0.000187557285f, -8.32484985e-06f,
+    -4.80270818f, 0.128327484f, 0.631272835f, -0.00494676983f, -0.00560168366f, 7.03385636e-05f, -5.7544296e-07f,
+    -0.263985987f, -3.1847378f, 0.0331055725f, 0.0664997366f, -0.000652586917f, -0.000238518789f, 5.37187422e-06f,
+    0.00356553019f, -1.36730234f, -0.00113270582f, 0.0286058407f, -0.000143851536f, -0.000103881379f, 2.31632228e-06f,
+    -0.680859255f, 3.53836158f, 0.0897790836f, -0.0789705761f, -0.00278058842f, 0.000370414452f, 3.76979023e-05f,
+    -4.20815564f, -0.272766393f, 0.606702328f, 0.0155213915f, -0.00612596275f, -0.000326178179f, 4.91081225e-06f,
+    -1.78593319f, -0.202700072f, 0.257693692f, 0.0085625437f, -0.00255659541f, -0.000148676471f, 1.19036995e-06f,
+    4.15107702f, 0.588240344f, -0.728384507f, -0.0213710998f, 0.0106193397f, 0.00041572487f, -9.56041585e-05f,
+    -0.673604579f, 3.39184575f, 0.113274732f, -0.0906348068f, -0.0027167488f, 0.000941689455f, 5.06104863e-05f,
+    -0.389284415f, 1.43849012f, 0.0661801499f, -0.0383023356f, -0.00142093279f, 0.000393269391f, 2.39931512e-05f,
+    0.603196612f, -3.59796292f, -0.108010962f, 0.092764608f, -0.000750253878f, -0.000815673504f, 5.18481919e-05f,
+    3.9853719f, 0.613067393f, -0.647444462f, -0.00536138108f, 0.00871586135f, -0.00027113453f, -5.53680379e-05f,
+    1.69223562f, 0.349845661f, -0.274678539f, -0.00454423752f, 0.00375124699f, -9.63743347e-05f, -2.49713252e-05f,
+    -4.60839191f, -1.00306666f, 0.615911616f, 0.0161446546f, -0.00591205036f, 6.08213466e-05f, 4.80514538e-06f,
+    1.09204739f, -3.07778101f, -0.149907231f, 0.0667406856f, 0.000544908981f, -0.000289873324f, 1.30739868e-05f,
+    0.57950995f, -1.29379522f, -0.0791293369f, 0.028192668f, 0.000376485788f, -0.000125629431f, 5.48412963e-06f,
+    -2.13892861f, 3.19771914f, 0.289331355f, -0.0663137533f, -0.00406782719f, 0.000200833213f, 2.36483744e-05f,
+    -3.87630536f, -1.31017857f, 0.537040488f, 0.0352236184f, -0.00463337929f, -0.000317511516f, -6.87470752e-06f,
+    -1.60811706f, -0.63861238f, 0.222977876f, 0.0166905667f, -0.0018858216f, -0.000140826199f, -3.51579527e-06f,
+};
+
+static const float SATURN_COEFFICIENTS[198] = {
+    9.18086782f, -0.500425887f, -0.213192324f, 0.000214376126f, 0.000421951661f, 7.75067481e-06f,
+    1.18011238f, 2.57864254f, -0.0279135086f, -0.0101102293f, -6.63446653e-05f, 1.18846453e-05f,
+    0.0930490751f, 1.0858869f, -0.00238927006f, -0.00418273334f, -4.54297971e-05f, 4.57443621e-06f,
+    6.56928718f, -2.07251864f, -0.166745697f, 0.00763194884f, 0.000459676845f, -6.35969976e-06f,
+    5.73121745f, 1.87345624f, -0.146093547f, -0.00877168563f, 0.000256425639f, 1.86595426e-05f,
+    2.08360239f, 0.862143755f, -0.0531610141f, -0.00394741203f, 8.61884336e-05f, 7.97399127e-06f,
+    1.45753775f, -2.93215262f, -0.0388866554f, 0.012853866f, 0.000133451036f, -2.43968568e-05f,
+    8.0427969f, 0.379833159f, -0.215476614f, -0.00206151304f, 0.000541907222f, 6.18923913e-06f,
+    3.25684522f, 0.282456127f, -0.087272193f, -0.00140096421f, 0.000217974625f, 3.59787807e-06f,
+    -4.22884898f, -2.62794836f, 0.111729317f, 0.0110482076f, -0.00033820175f, -1.80781564e-05f,
+    7.10528965f, -1.29449144f, -0.188270283f, 0.00632126047f, 0.00043468734f, -1.54744699e-05f,
+    3.11364998f, -0.421624195f, -0.082487635f, 0.00213636129f, 0.000193884176f, -5.61445244e-06f,
+    -8.24949398f, -1.31590628f, 0.203586841f, 0.00388172029f, -0.000491225122f, 2.16081872e-06f,
+    3.31628428f, -2.40567688f, -0.0823852967f, 0.0103943316f, 6.85603315e-05f, -1.75028802e-05f,
+    1.72224924f, -0.936395581f, -0.0427150189f, 0.00412397413f, 4.92990809e-05f, -7.3171677e-06f,
+    -9.19445499f, 0.373194545f, 0.20657812f, -0.00300610388f, -0.000344892111f, 1.0005771e-05f,
+    -1.76141341f, -2.57039768f, 0.0390830845f, 0.00922648748f, -0.000180600869f, -7.17601714e-06f,
+    -0.332658766f, -1.0766672f, 0.00728887974f, 0.00393635285f, -5.98046317e-05f, -3.38976621e-06f,
+    -6.96603794f, 1.80263863f, 0.143834819f, -0.00698673102f, -0.000160392169f, 7.7469151e-06f,
+    -6.27891315f, -1.87190569f, 0.12919332f, 0.00562717671f, -0.000248394498f, -6.51165843e-07f,
+    -2.29219213f, -0.849585265f, 0.0471589314f, 0.00262082789f, -9.56706997e-05f, -5.99522479e-07f,
+    -2.49938612f, 2.58487486f, 0.049102373f, -0.00849746541f, -3.79914329e-05f, 4.81159978e-06f,
+    -8.82316318f, -0.635981392f, 0.172840939f, 0.00166239926f, -0.000243436499f, 5.77198484e-07f,
+    -3.53321877f, -0.373054045f, 0.0692187493f, 0.00104900267f, -9.88435482e-05f, 3.34373765e-08f,
+    2.73755421f, 2.56640276f, -0.0535236605f, -0.00838586387f, 5.13128731e-05f, 4.61520484e-06f,
+    -8.69548984f, 0.761042056f, 0.169718084f, -0.00216678413f, -0.000237009075f, 6.05527018e-08f,
+    -3.70469011f, 0.204163585f, 0.0723137121f, -0.000535927991f, -9.99867816e-05f, -1.71072458e-07f,
+    7.13839954f, 1.75732916f, -0.145841809f, -0.00671628787f, 0.000165575459f, 7.1315869e-06f,
+    -5.94341176f, 1.95046341f, 0.121041489f, -0.0059315751f, -0.000230302562f, 1.13288212e-06f,
+    -2.75759184f, 0.729487339f, 0.0561719816f, -0.00216050137f, -0.000102078615f, 1.6383347e-07f,
+    9.27072834f, 0.325176805f, -0.205300342f, -0.00276599753f, 0.000335522943f, 9.28334059e-06f,
+    -1.34172286f, 2.57462149f, 0.0292507164f, -0.00919108355f, -0.000158238383f, 7.02999921e-06f,
+    -0.950428074f, 1.04819942f, 0.0208408539f, -0.00367370468f, -7.95892686e-05f, 2.50435084e-06f,
+};
+
+static const float EARTH_COEFFICIENTS[1320] = {
+    -0.33308697f, -0.0441347012f, -0.493408516f, -0.0981069205f, 0.67091882f, 0.0427666975f, -0.15027533f, -0.0112830689f, 0.0134469351f, 0.00341572964f, -7.10896779e-05f, -0.000773147522f, -0.000174337498f, 9.96802257e-05f, 4.04460323e-05f, -2.87419953e-06f, -6.94611417e-06f, -1.78810147e-06f, 8.53987965e-07f, 5.76391639e-07f,
+    0.0148712899f, -0.373393841f, 0.0552444553f, -0.784904318f, -0.0694555631f, 0.33184824f, 0.0198469899f, -0.0461147875f, -0.00572963052f, 0.00234788843f, 0.00158103941f, 0.000229389285f, -0.000277253127f, -8.15507205e-05f, 2.31919444e-05f, 1.58428656e-05f, 1.66801082e-06f, -2.34496304e-06f, -9.23099741e-07f, 1.71814132e-07f,
+    0.00644488508f, -0.161860512f, 0.0239457929f, -0.340243643f, -0.0301035509f, 0.143851085f, 0.00860221031f, -0.0199900907f, -0.00248358243f, 0.00101779566f, 0.000685351939f, 9.94307736e-05f, -0.000120185866f, -3.53500919e-05f, 1.0053629e-05f, 6.86758421e-06f, 7.23002099e-07f, -1.01651439e-06f, -4.00141672e-07f, 7.448286e-08f,
+    0.259370501f, 0.272909412f, 0.370742981f, 0.57612914f, -0.495685315f, -0.244191498f, 0.117540358f, 0.0363945803f, -0.0164971251f, -0.00317380399f, 0.00256460351f, 0.00022324495f, -0.000454980056f, -4.33418422e-06f, 7.64130433e-05f, -5.49185388e-06f, -1.24227304e-05f, 2.10720982e-06f, 1.96439117e-06f, -6.7098393e-07f,
+    -0.232505261f, 0.27355138f, -0.306449906f, 0.581846468f, 0.414101392f, -0.247740322f, -0.0947364072f, 0.0412020606f, 0.0103015354f, -0.00578075247f, -0.000787077269f, 0.000992045099f, 4.61057749e-05f, -0.000172485849f, 5.00662435e-06f, 2.82906649e-05f, -3.33849045e-06f, -4.61135175e-06f, 9.47809166e-07f, 8.44261761e-07f,
+    -0.100784986f, 0.11858145f, -0.132838318f, 0.252222076f, 0.179501275f, -0.107392238f, -0.0410654239f, 0.0178605693f, 0.00446537624f, -0.0025058687f, -0.000341162202f, 0.000430033717f, 1.99823982e-05f, -7.47692329e-05f, 2.17087043e-06f, 1.22634013e-05f, -1.44726628e-06f, -1.99891351e-06f, 4.10871726e-07f, 3.65965584e-07f,
+    -0.0681991137f, -0.402388418f, -0.107639484f, -0.842828234f, 0.147063321f, 0.355660502f, -0.032425026f, -0.0463357768f, 0.00242362106f, 0.00076337792f, 0.000159221647f, 0.000620757061f, -5.80213982e-05f, -9.48193198e-05f, 5.03828065e-06f, 1.32489579e-06f, 3.76466886e-07f, 1.70562562e-06f, -1.52643613e-07f, -2.75550537e-07f,
+    0.283113469f, -0.0820035181f, 0.444152977f, -0.171846047f, -0.607268636f, 0.0725354613f, 0.133564661f, -0.00953393627f, -0.00967533207f, 0.000203902239f, -0.000773018529f, 0.000115343141f, 0.000256995572f, -1.84495896e-05f, -2.06321077e-05f, 4.54401505e-07f, -2.13229418e-06f, 2.86733786e-07f, 7.33108749e-07f, -5.15133384e-08f,
+    0.122722508f, -0.0355501063f, 0.192529115f, -0.0744963844f, -0.263235396f, 0.0314451164f, 0.0578968356f, -0.0041331485f, -0.00419400379f, 8.840165e-05f, -0.000335084166f, 5.00029563e-05f, 0.000111400997f, -7.99828864e-06f, -8.94348224e-06f, 1.97002476e-07f, -9.2429644e-07f, 1.24304482e-07f, 3.17783979e-07f, -2.23322638e-08f,
+    -0.126826624f, 0.373636958f, -0.19435198f, 0.790636742f, 0.257723592f, -0.335590505f, -0.062791994f, 0.0518465109f, 0.0102671115f, -0.00545621342f, -0.00198972002f, 0.000632940642f, 0.000396872125f, -7.7010053e-05f, -7.22237731e-05f, 6.61489226e-06f, 1.27971589e-05f, 9.85735281e-08f, -2.19192949e-06f, -2.94028035e-07f,
+    -0.311262841f, -0.141642715f, -0.421661365f, -0.303053903f, 0.567877319f, 0.129489774f, -0.131406319f, -0.023259645f, 0.0156265491f, 0.00405225773f, -0.00166241622f, -0.000825048279f, 0.000206128092f, 0.000156591922f, -2.23029476e-05f, -2.79081822e-05f, 1.1739433e-06f, 4.96574489e-06f, 2.21930682e-07f, -1.00130656e-06f,
+    -0.134924498f, -0.061394729f, -0.182779302f, -0.131360275f, 0.246160999f, 0.0561275731f, -0.0569615394f, -0.0100819575f, 0.00677376639f, 0.00175649216f, -0.00072062812f, -0.000357630044f, 8.93541523e-05f, 6.78775896e-05f, -9.66832152e-06f, -1.20973632e-05f, 5.08980037e-07f, 2.15251287e-06f, 9.61823086e-08f, -4.3404098e-07f,
+    0.295622374f, -0.212287092f, 0.421467763f, -0.451209973f, -0.575578601f, 0.191967825f, 0.127038559f, -0.0316484046f, -0.00963354211f, 0.0042580779f, -0.000631846039f, -0.000617303148f, 0.00028177207f, 5.70768151e-05f, -4.79620771e-05f, 4.0544453e-06f, 5.89847077e-06f, -2.65206298e-06f, -4.33768592e-07f, 6.18330386e-07f,
+    0.143110081f, 0.320996903f, 0.24186898f, 0.672789224f, -0.323611544f, -0.283969901f, 0.0764789448f, 0.0374902963f, -0.0105248464f, -0.000858435977f, 0.00150160509f, -0.000495445398f, -0.000192966796f, 0.000112282806f, 6.91351122e-06f, -1.60184518e-05f, 4.0131795e-06f, 1.60671942e-06f, -1.16523475e-06f, 3.28951913e-08f,
+    0.0620354768f, 0.139140135f, 0.104844567f, 0.291629822f, -0.140279853f, -0.123090458f, 0.0331523532f, 0.0162505869f, -0.00456229391f, -0.000372067293f, 0.000650895621f, -0.000214765582f, -8.36427273e-05f, 4.86716556e-05f, 2.9963658e-06f, -6.94347936e-06f, 1.73964212e-06f, 6.96441331e-07f, -5.0509732e-07f, 1.42644467e-08f,
+    -0.334813425f, -0.0208514574f, -0.496120691f, -0.0492683356f, 0.673920578f, 0.0221478768f, -0.151465436f, -0.00851920751f, 0.0140309297f, 0.00333254591f, -0.000259445195f, -0.000809382281f, -0.000141562813f, 0.000111109347f, 3.83586673e-05f, -5.3829051e-06f, -7.42788082e-06f, -1.39394793e-06f, 1.03955685e-06f, 5.56670677e-07f,
+    -0.0028363977f, -0.374889883f, 0.0294598095f, -0.788589518f, -0.0342907287f, 0.333535755f, 0.0120541283f, -0.0468926516f, -0.00510819712f, 0.00267538094f, 0.00161270078f, 0.000151098165f, -0.00029740903f, -7.2212865e-05f, 2.82615056e-05f, 1.59878988e-05f, 6.98976771e-07f, -2.66630903e-06f, -8.03383825e-07f, 2.69748753e-07f,
+    -0.001231594f, -0.162501815f, 0.0127672222f, -0.341826096f, -0.0148584321f, 0.144576216f, 0.00522365556f, -0.0203263914f, -0.00221407884f, 0.00115971225f, 0.00069904456f, 6.54884964e-05f, -0.000128917501f, -3.13006677e-05f, 1.22507101e-05f, 6.93012605e-06f, 3.02914007e-07f, -1.15576164e-06f, -3.48228719e-07f, 1.16931512e-07f,
+    0.272026275f, 0.255768728f, 0.389127286f, 0.539366385f, -0.520513926f, -0.228460395f, 0.123227847f, 0.0334830599f, -0.0171226843f, -0.00262997203f, 0.00261125324f, 0.000107314713f, -0.000454695331f, 1.82677375e-05f, 7.43579933e-05f, -9.61599991e-06f, -1.16054868e-05f, 2.84506291e-06f, 1.74402553e-06f, -8.14208956e-07f,
+    -0.218917459f, 0.287329477f, -0.286548001f, 0.610940542f, 0.387798808f, -0.260071219f, -0.0882571701f, 0.0430488285f, 0.00918245628f, -0.00594416694f, -0.000556003345f, 0.0010008993f, -1.50242458e-06f, -0.000170386347f, 1.38950508e-05f, 2.70170643e-05f, -4.94184019e-06f, -4.19378861e-06f, 1.22122604e-06f, 7.10205691e-07f,
+    -0.0948903354f, 0.124548839f, -0.124205167f, 0.264822927f, 0.168091346f, -0.112732795f, -0.038254904f, 0.0186603277f, 0.0039800725f, -0.00257659392f, -0.00024098124f, 0.000433852315f, -6.55508035e-07f, -7.3855735e-05f, 6.02366937e-06f, 1.17107659e-05f, -2.1422061e-06f, -1.81781915e-06f, 5.29370683e-07f, 3.0783919e-07f,
+    -0.0869247307f, -0.396590462f, -0.134876075f, -0.830767239f, 0.184653071f, 0.350590208f, -0.0404324049f, -0.0457597925f, 0.00275849293f, 0.000801047009f, 0.000298887883f, 0.000600639354f, -8.77934816e-05f, -9.26228919e-05f, 6.19139727e-06f, 1.50753022e-06f, 9.65059123e-07f, 1.61753608e-06f, -2.79624644e-07f, -2.67219368e-07f,
+    0.278784798f, -0.103062836f, 0.437853336f, -0.215685084f, -0.598564774f, 0.0909719364f, 0.131717596f, -0.0116606188f, -0.00960494861f, 8.5326545e-05f, -0.000738260377f, 0.000184488608f, 0.000249799215f, -2.63003737e-05f, -2.04001482e-05f, -7.55549165e-08f, -1.9768183e-06f, 5.75053774e-07f, 7.01095332e-07f, -8.13096135e-08f,
+    0.120840653f, -0.0446774667f, 0.189789812f, -0.0934967547f, -0.259450667f, 0.0394357006f, 0.0570935693f, -0.00505486367f, -0.00416330499f, 3.70017876e-05f, -0.00032000204f, 7.99732052e-05f, 0.000108276463f, -1.14010507e-05f, -8.84252451e-06f, -3.2716148e-08f, -8.56858661e-07f, 2.49275418e-07f, 3.0389224e-07f, -3.52470603e-08f,
+    -0.108660205f, 0.381609695f, -0.16787246f, 0.807962871f, 0.222274931f, -0.343063586f, -0.0544248718f, 0.0534454725f, 0.00912585371f, -0.00584501737f, -0.00182420779f, 0.000728953982f, 0.000371077977f, -9.77627621e-05f, -6.90657437e-05f, 1.08886935e-05f, 1.25962983e-05f, -7.72528174e-07f, -2.22458351e-06f, -9.42038664e-08f,
+    -0.317711181f, -0.122065396f, -0.43118066f, -0.261453983f, 0.580236643f, 0.111789826f, -0.13462972f, -0.0203546063f, 0.0163321175f, 0.0036641632f, -0.00184274733f, -0.000764302914f, 0.000247595195f, 0.000147932257f, -3.09559102e-05f, -2.70640052e-05f, 2.94259326e-06f, 4.97141978e-06f, -1.18347712e-07f, -1.04627656e-06f,
+    -0.137713771f, -0.0529055188f, -0.186897692f, -0.113321541f, 0.251507612f, 0.0484524244f, -0.0583562808f, -0.0088222219f, 0.00707930839f, 0.00158818252f, -0.000798763543f, -0.000331282291f, 0.000107324715f, 6.41207554e-05f, -1.34186423e-05f, -1.17308743e-05f, 1.27560373e-06f, 2.15487086e-06f, -5.13205118e-08f, -4.53513051e-07f,
+    0.284944936f, -0.232019006f, 0.405751081f, -0.49230616f, -0.554742854f, 0.209247688f, 0.121970766f, -0.033668924f, -0.00880968292f, 0.00415608981f, -0.000776762724f, -0.000543809615f, 0.000299138145f, 4.22728687e-05f, -4.69933534e-05f, 6.08974099e-06f, 4.95384486e-06f, -2.80519685e-06f, -2.10493645e-07f, 5.80022264e-07f,
+    0.157954117f, 0.309539879f, 0.263385537f, 0.648287619f, -0.353270464f, -0.273512971f, 0.0828149333f, 0.0356151344f, -0.0108094584f, -0.00054119236f, 0.0013890457f, -0.000546490634f, -0.000160755529f, 0.000115107569f, 1.66432291e-06f, -1.47375741e-05f, 4.60473682e-06f, 1.15049894e-06f, -1.17877206e-06f, 1.24038955e-07f,
+    0.0684673207f, 0.134167496f, 0.114166934f, 0.28099589f, -0.153130152f, -0.118552087f, 0.0358974011f, 0.0154370196f, -0.00468546807f, -0.000234535635f, 0.000602076041f, -0.0002368821f, -6.96764838e-05f, 4.9893877e-05f, 7.20903329e-07f, -6.38795374e-06f, 1.9959777e-06f, 4.9865632e-07f, -5.10941596e-07f, 5.37707565e-08f,
+    -0.335439874f, 0.00246116981f, -0.497234338f, -0.000301641293f, 0.674732376f, 0.00145918081f, -0.15217859f, -0.00567879927f, 0.0145844801f, 0.00321021479f, -0.000453702583f, -0.000836181203f, -0.000106001352f, 0.000121551561f, 3.54682099e-05f, -7.9854789e-06f, -7.74296075e-06f, -9.34326316e-07f, 1.20530619e-06f, 5.16668124e-07f,
+    -0.0206103596f, -0.375161858f, 0.00356553769f, -0.789716011f, 0.000951941328f, 0.334145835f, 0.00419029277f, -0.0475345f, -0.0044310067f, 0.00300397623f, 0.00162512011f, 6.86178437e-05f, -0.000314346757f, -6.14536633e-05f, 3.32225293e-05f, 1.57801877e-05f, -3.61882941e-07f, -2.93096903e-06f, -6.52257617e-07f, 3.66878158e-07f,
+    -0.00893613371f, -0.162612422f, 0.00154210137f, -0.342299195f, 0.000419097266f, 0.144834207f, 0.00181463033f, -0.0206036981f, -0.00192042938f, 0.00130209389f, 0.000704394952f, 2.97333467e-05f, -0.000136253342f, -2.6635492e-05f, 1.44005409e-05f, 6.83975805e-06f, -1.56938959e-07f, -1.27042459e-06f, -2.82705229e-07f, 1.59027195e-07f,
+    0.283819304f, 0.237802373f, 0.406239709f, 0.50086121f, -0.543698299f, -0.211991548f, 0.128480733f, 0.0304617532f, -0.0176485743f, -0.00207720622f, 0.00263164883f, -8.25728211e-06f, -0.000448335794f, 4.02061772e-05f, 7.10442254e-05f, -1.34488355e-05f, -1.05386528e-05f, 3.48955845e-06f, 1.47864713e-06f, -9.26176418e-07f,
+    -0.204693838f, 0.300216516f, -0.265719052f, 0.638091994f, 0.36024395f, -0.271562669f, -0.0814918461f, 0.0447101805f, 0.00803251991f, -0.00606043395f, -0.000323423567f, 0.000997927016f, -4.84213801e-05f, -0.000165731351f, 2.23555226e-05f, 2.52261215e-05f, -6.39184623e-06f, -3.67639082e-06f, 1.45292026e-06f, 5.5628081e-07f,
+    -0.0887205692f, 0.130129426f, -0.115170893f, 0.276580544f, 0.15613955f, -0.117708982f, -0.0353206111f, 0.0193796395f, 0.00348143492f, -0.0026268755f, -0.000140156368f, 0.000432544115f, -2.09928154e-05f, -7.18345914e-05f, 9.69062112e-06f, 1.09339301e-05f, -2.77061481e-06f, -1.59346653e-06f, 6.29773814e-07f, 2.41105715e-07f,
+    -0.105351835f, -0.389472477f, -0.161682247f, -0.815990354f, 0.221633943f, 0.344384997f, -0.0483208484f, -0.0450859639f, 0.00309890495f, 0.000864820715f, 0.000432641918f, 0.00057219902f, -0.000116676133f, -8.98235295e-05f, 7.4032138e-06f, 1.86594762e-06f, 1.51010722e-06f, 1.47804498e-06f, -4.00516239e-07f, -2.56579671e-07f,
+    0.273486449f, -0.123777818f, 0.430153379f, -0.258818437f, -0.5878925f, 0.109114125f, 0.129477287f, -0.0137648738f, -0.00954354551f, -2.48310975e-05f, -0.000687254899f, 0.000251162594f, 0.000239948678f, -3.40139613e-05f, -2.02486893e-05f, -5.38655504e-07f, -1.7169327e-06f, 8.46280785e-07f, 6.52519815e-07f, -1.10852035e-07f,
+    0.118538608f, -0.0536547568f, 0.186443711f, -0.112189551f, -0.254812966f, 0.0472980115f, 0.0561199015f, -0.00596677522f, -0.00413650016f, -1.0744536e-05f, -0.000297878618f, 0.000108869468f, 0.00010400169f, -1.4744037e-05f, -8.77646347e-06f, -2.33434689e-07f, -7.44170105e-07f, 3.66825917e-07f, 2.82822718e-07f, -4.8050645e-08f,
+    -0.0901217092f, 0.388374155f, -0.140839217f, 0.822698871f, 0.186137294f, -0.349428969f, -0.0458531105f, 0.0548404668f, 0.0079202478f, -0.00619642916f, -0.00163830694f, 0.00081748638f, 0.000339947231f, -0.000117299733f, -6.46179179e-05f, 1.50219663e-05f, 1.2092879e-05f, -1.64137046e-06f, -2.19239207e-06f, 1.13676617e-07f,
+    -0.323203435f, -0.102122666f, -0.439298348f, -0.219033086f, 0.59074278f, 0.0937286189f, -0.137397626f, -0.0173473889f, 0.016959806f, 0.00324202003f, -0.00200754884f, -0.000693807771f, 0.000286197104f, 0.000136856624f, -3.92079374e-05f, -2.56431047e-05f, 4.67763932e-06f, 4.84348581e-06f, -4.61953698e-07f, -1.05647261e-06f,
+    -0.140088342f, -0.0442586488f, -0.190408134f, -0.0949284932f, 0.256050407f, 0.0406213446f, -0.059553446f, -0.00751830451f, 0.00735106382f, 0.00140512874f, -0.000870160379f, -0.000300710702f, 0.000124051706f, 5.93170293e-05f, -1.69948344e-05f, -1.1114433e-05f, 2.02759188e-06f, 2.09931519e-06f, -2.00252224e-07f, -4.57910468e-07f,
+    0.27336828f, -0.251023574f, 0.38873608f, -0.531829886f, -0.532082701f, 0.225853083f, 0.116539581f, -0.0355513382f, -0.00799485963f, 0.00402421187f, -0.00090472876f, -0.000465516903f, 0.000312308077f, 2.7618548e-05f, -4.5367857e-05f, 7.81901496e-06f, 3.9514753e-06f, -2.87210018e-06f, 5.28055684e-09f, 5.27256038e-07f,
+    0.172213902f, 0.297051407f, 0.284042644f, 0.621665184f, -0.381808621f, -0.262171262f, 0.0888646415f, 0.0336641731f, -0.0110357596f, -0.000245520556f, 0.0012644345f, -0.000589175603f, -0.000127511677f, 0.000116337139f, -3.22497031e-06f, -1.32547942e-05f, 5.03333632e-06f, 6.91237267e-07f, -1.15843922e-06f, 2.03930288e-07f,
+    0.0746453348f, 0.12874817f, 0.123115925f, 0.269443527f, -0.165493482f, -0.113630568f, 0.0385181087f, 0.0145906639f, -0.00478335532f, -0.000106366431f, 0.000548036781f, -0.000255372812f, -5.52638876e-05f, 5.04245398e-05f, -1.39836147e-06f, -5.7449623e-06f, 2.1816563e-06f, 2.99570796e-07f, -5.02104342e-07f, 8.83961909e-08f,
+    -0.334963733f, 0.0257265488f, -0.496744088f, 0.0486338219f, 0.673355749f, -0.0192326211f, -0.152408522f, -0.00276951477f, 0.0151009191f, 0.0030481249f, -0.000651515018f, -0.00085297994f, -6.80216581e-05f, 0.000130783356f, 3.17704644e-05f, -1.0620673e-05f, -7.87229121e-06f, -4.18954654e-07f, 1.34479917e-06f, 4.56017354e-07f,
+    -0.038393142f, -0.374212839f, -0.0223550151f, -0.788283361f, 0.0361575643f, 0.33367668f, -0.00372016111f, -0.0480331216f, -0.00369901602f, 0.00332965503f, 0.0016176102f, -1.70983476e-05f, -0.000327726011f, -4.93537969e-05f, 3.7961883e-05f, 1.51989444e-05f, -1.48986677e-06f, -3.12781673e-06f, -4.72432094e-07f, 4.59544397e-07f,
+    -0.0166438232f, -0.162193734f, -0.00969343189f, -0.341662895f, 0.0156792293f, 0.144624341f, -0.00161430274f, -0.0208188925f, -0.00160305206f, 0.0014431983f, 0.000701106347f, -7.42118991e-06f, -0.000142046068f, -2.13896215e-05f, 1.6454089e-05f, 6.58749037e-06f, -6.45844299e-07f, -1.35568382e-06f, -2.04748147e-07f, 1.991844e-07f,
+    0.294711592f, 0.219063895f, 0.422024895f, 0.46073426f, -0.565163447f, -0.194838113f, 0.133282157f, 0.0273460108f, -0.0180732064f, -0.00152069191f, 0.00262591289f, -0.000122002843f, -0.000436085908f, 6.11302128e-05f, 6.65640988e-05f, -1.69121351e-05f, -9.25504065e-06f, 4.02482769e-06f, 1.17749383e-06f, -1.00383132e-06f,
+    -0.189880551f, 0.31217069f, -0.244031801f, 0.663212898f, 0.331522018f, -0.282177596f, -0.0744660039f, 0.0461808382f, 0.00685994851f, -0.00612931683f, -9.19453393e-05f, 0.000983313559f, -9.39843186e-05f, -0.000158647824f, 3.02347833e-05f, 2.29700391e-05f, -7.65562694e-06f, -3.07631574e-06f, 1.63678085e-06f, 3.8856809e-07f,
+    -0.0822957319f, 0.135305138f, -0.105765347f, 0.287456918f, 0.143682894f, -0.122304774f, -0.0322736455f, 0.0200162268f, 0.0029730294f, -0.0026566135f, -3.98179038e-05f, 0.00042619012f, -4.07405408e-05f, -6.87609813e-05f, 1.31053198e-05f, 9.95555116e-06f, -3.31824853e-06f, -1.33329828e-06f, 7.09434729e-07f, 1.68402103e-07f,
+    -0.123421135f, -0.381059119f, -0.187973163f, -0.798546652f, 0.257882316f, 0.337065031f, -0.0560687348f, -0.0443142663f, 0.00344856593f, 0.00095325686f, 0.000558452786f, 0.000535755209f, -0.000144424367f, -8.64111765e-05f, 8.71749811e-06f, 2.38233567e-06f, 1.99235298e-06f, 1.29019705e-06f, -5.13514831e-07f, -2.43586124e-07f,
+    0.267235404f, -0.144077672f, 0.421077279f, -0.301103584f, -0.575287768f, 0.12690315f, 0.126849558f, -0.0158449667f, -0.00948956515f, -0.00012334325f, -0.000620733844f, 0.000314576596f, 0.00022751467f, -4.1580607e-05f, -2.01544344e-05f, -9.01553237e-07f, -1.3608599e-06f, 1.09345022e-06f, 5.88052134e-07f, -1.40404144e-07f,
+    0.115823788f, -0.0624513072f, 0.18250137f, -0.130513029f, -0.24933799f, 0.0550065423f, 0.0549783783f, -0.00686813219f, -0.00411291363f, -5.34388507e-05f, -0.000269032019f, 0.000136350097f, 9.86074824e-05f, -1.80230284e-05f, -8.73519654e-06f, -3.9070302e-07f, -5.89800894e-07f, 4.7393814e-07f, 2.5486676e-07f, -6.08572443e-08f,
+    -0.0712710096f, 0.393911972f, -0.113340572f, 0.834799981f, 0.149424539f, -0.354666116f, -0.0371070509f, 0.0560228493f, 0.00665744548f, -0.00650673163f, -0.00143388603f, 0.000897326493f, 0.000303874715f, -0.000135272323f, -5.8945259e-05f, 1.89185525e-05f, 1.1294295e-05f, -2.48279913e-06f, -2.09517753e-06f, 3.22188355e-07f,
+    -0.327721607f, -0.0818761851f, -0.445987065f, -0.175925844f, 0.599364618f, 0.0753643725f, -0.139698329f, -0.0142511126f, 0.0175042301f, 0.00278922426f, -0.00215481929f, -0.00061437748f, 0.000321333794f, 0.000123516386f, -4.68900238e-05f, -2.36670343e-05f, 6.33397675e-06f, 4.58303752e-06f, -7.9817928e-07f, -1.03072135e-06f,
+    -0.142040463f, -0.03548087f, -0.193298843f, -0.0762395425f, 0.259776003f, 0.032659592f, -0.0605479847f, -0.00617589839f, 0.00758670303f, 0.00120880485f, -0.000933951971f, -0.000266268948f, 0.000139275205f, 5.35321608e-05f, -2.03236656e-05f, -1.02574155e-05f, 2.74539594e-06f, 1.98632806e-06f, -3.45971311e-07f, -4.46726694e-07f,
+    0.260930087f, -0.269235691f, 0.370478524f, -0.569650523f, -0.507668839f, 0.241730409f, 0.110764621f, -0.0372945384f, -0.00719434689f, 0.00386580478f, -0.00101456507f, -0.000383505162f, 0.000321274056f, 1.3310741e-05f, -4.31743348e-05f, 9.22232396e-06f, 2.92228978e-06f, -2.85590955e-06f, 2.0785235e-07f, 4.63134828e-07f,
+    0.185843774f, 0.283569665f, 0.303775014f, 0.59300593f, -0.409130672f, -0.249981112f, 0.0946118433f, 0.0316465079f, -0.0112069972f, 2.60997943e-05f, 0.00112970158f, -0.000623168487f, -9.36816534e-05f, 0.000116056813f, -7.68975033e-06f, -1.1623166e-05f, 5.29712558e-06f, 2.41806774e-07f, -1.10700728e-06f, 2.70966092e-07f,
+    0.0805497574f, 0.122898767f, 0.131663285f, 0.257009272f, -0.177328575f, -0.108341706f, 0.041007458f, 0.0137154667f, -0.0048573664f, 1.13667224e-05f, 0.000489615138f, -0.000270094363f, -4.05984983e-05f, 5.03007055e-05f, -3.33344051e-06f, -5.03751241e-06f, 2.29588437e-06f, 1.04764354e-07f, -4.79788574e-07f, 1.17446551e-07f,
+    -0.333385924f, 0.0488690468f, -0.494649591f, 0.0973799406f, 0.669799364f, -0.0398610884f, -0.15215044f, 0.00020016217f, 0.0155735996f, 0.00284615507f, -0.000850450982f, -0.000859328246f, -2.80442098e-05f, 0.000138588108f, 2.72808732e-05f, -1.32227812e-05f, -7.80121789e-06f, 1.401827e-07f, 1.45203108e-06f, 3.75162654e-07f,
+    -0.0561274807f, -0.372049995f, -0.048218607f, -0.784299402f, 0.0712123392f, 0.332129972f, -0.0116524355f, -0.0483816703f, -0.00291385546f, 0.00364832845f, 0.00158972447f, -0.000105032043f, -0.000337241573f, -3.60250591e-05f, 4.23637049e-05f, 1.42325458e-05f, -2.65705367e-06f, -3.24712443e-06f, -2.67760249e-07f, 5.43934327e-07f,
+    -0.0243298379f, -0.161248925f, -0.0209032909f, -0.339920736f, 0.0308726336f, 0.143947406f, -0.00505239113f, -0.0209690154f, -0.00126265684f, 0.00158125326f, 0.000688986323f, -4.55335095e-05f, -0.000146163586f, -1.56115922e-05f, 1.83611478e-05f, 6.16830713e-06f, -1.15169595e-06f, -1.40732693e-06f, -1.16029214e-07f, 2.35750638e-07f,
+    0.304668246f, 0.199609016f, 0.43643214f, 0.419110588f, -0.584839904f, -0.177055095f, 0.137617272f, 0.0241513878f, -0.0183958698f, -0.000965575643f, 0.00259448242f, -0.000232499794f, -0.000418218448f, 8.07153405e-05f, 6.10323696e-05f, -1.99384958e-05f, -7.79253241e-06f, 4.43871663e-06f, 8.50735047e-07f, -1.04551787e-06f,
+    -0.17452533f, 0.323153036f, -0.22155725f, 0.686221943f, 0.301721405f, -0.291881978f, -0.0672058816f, 0.0474567357f, 0.00567297937f, -0.00615108045f, 0.000135869548f, 0.000957400084f, -0.000137558177f, -0.000149303938f, 3.73955738e-05f, 2.0310975e-05f, -8.70611804e-06f, -2.41275845e-06f, 1.76840836e-06f, 2.13478756e-07f,
+    -0.0756365483f, 0.140059138f, -0.0960193568f, 0.297416917f, 0.130759761f, -0.12650547f, -0.0291253956f, 0.0205683381f, 0.00245842778f, -0.00266592544f, 5.89238041e-05f, 0.000414938868f, -5.96243633e-05f, -6.47079371e-05f, 1.62083054e-05f, 8.80259742e-06f, -3.77338744e-06f, -1.04563901e-06f, 7.66449334e-07f, 9.25079728e-08f,
+};
+
+static const PlanetEphemeris::Series PLANET_SERIES[6] = {
+    {64, 20, 172, MERCURY_COEFFICIENTS}, // Mercury
+    {256, 15, 43, VENUS_COEFFICIENTS}, // Venus
+    {512, 17, 22, MARS_COEFFICIENTS}, // Mars
+    {1024, 7, 11, JUPITER_COEFFICIENTS}, // Jupiter
+    {1024, 6, 11, SATURN_COEFFICIENTS}, // Saturn
+    {512, 20, 22, EARTH_COEFFICIENTS}, // Earth
+};
+
+#endif
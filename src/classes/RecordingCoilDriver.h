@@ -0,0 +1,87 @@
+#ifndef RECORDING_COIL_DRIVER_H
+#define RECORDING_COIL_DRIVER_H
+
+#include "CoilDriver.h"
+#include "MotionProfile.h"
+
+// Host-side CoilDriver that records every pattern written, so a run can be
+// checked against the expected phase order of a step mode.
+class RecordingCoilDriver : public CoilDriver {
+public:
+    static const int CAPACITY = 4096;
+
+    RecordingCoilDriver() : count(0), dropped(0) {}
+
+    void begin(const uint8_t pins[4]) override {
+        for (int i = 0; i < 4; i++) {
+            this->pins[i] = pins[i];
+        }
+        clear();
+    }
+
+    void write(uint8_t pattern) override {
+        if (count < CAPACITY) {
+            history[count++] = pattern;
+        } else {
+            dropped++;
+        }
+    }
+
+    void clear() {
+        count = 0;
+        dropped = 0;
+    }
+
+    int getCount() {
+        return count;
+    }
+
+    int getDropped() {
+        return dropped;
+    }
+
+    uint8_t getPattern(int index) {
+        return history[index];
+    }
+
+    // True if every energized pattern is in the sequence and each one is the
+    // next (direction +1) or previous (-1) phase of the one before it.
+    // Releases (pattern 0) are skipped, the rotor holds position across them.
+    bool followsSequence(const CoilSequence& sequence, int8_t direction) {
+        int previous = -1;
+        for (int i = 0; i < count; i++) {
+            if (history[i] == 0) {
+                continue;
+            }
+            int phase = phaseOf(sequence, history[i]);
+            if (phase < 0) {
+                return false;
+            }
+            if (previous >= 0) {
+                int expected = (previous + direction) & (sequence.phaseCount - 1);
+                if (phase != expected) {
+                    return false;
+                }
+            }
+            previous = phase;
+        }
+        return true;
+    }
+
+private:
+    uint8_t pins[4];
+    uint8_t history[CAPACITY];
+    int count;
+    int dropped;
+
+    static int phaseOf(const CoilSequence& sequence, uint8_t pattern) {
+        for (int i = 0; i < sequence.phaseCount; i++) {
+            if (sequence.patterns[i] == pattern) {
+                return i;
+            }
+        }
+        return -1;
+    }
+};
+
+#endif
@@ -0,0 +1,290 @@
+#include "RiseSetSolver.h"
+
+static const float TWO_PI_F = (float)(2 * M_PI);
+static const float DEGREES = (float)(180.0 / M_PI);
+// Refraction at the horizon plus the sun's semi-diameter
+static const float SUN_HORIZON = -0.833f / DEGREES;
+static const float MOON_SEMI_DIAMETER = 0.2725f; // of the parallax
+static const float REFRACTION = 0.5667f / DEGREES;
+// A parabola vertex this close to the horizon is checked for a crossing
+static const float GRAZING_MARGIN = 1.0f / DEGREES;
+static const float GOLDEN = 0.381966f;
+
+RiseSetSolver::RiseSetSolver(Body body, float latitude, float longitude) {
+    this->body = body;
+    this->latitude = latitude / DEGREES;
+    this->longitude = longitude / DEGREES;
+    evaluations = 0;
+}
+
+uint32_t RiseSetSolver::getEvaluations() {
+    return evaluations;
+}
+
+void RiseSetSolver::resetEvaluations() {
+    evaluations = 0;
+}
+
+void RiseSetSolver::solve(int64_t start, int64_t end, Events* events) {
+    events->riseCount = 0;
+    events->setCount = 0;
+    events->transitCount = 0;
+    events->alwaysUp = false;
+    events->alwaysDown = false;
+    if (body >= MERCURY) {
+        start = start > PlanetEphemeris::getFirstTime() ? start : PlanetEphemeris::getFirstTime();
+        end = end < PlanetEphemeris::getLastTime() ? end : PlanetEphemeris::getLastTime();
+    }
+    if (end <= start) {
+        return;
+    }
+
+    Sample previous = evaluate(start);
+    Sample before = previous; // the sample ahead of previous, for the parabola
+    bool havePreviousStep = false;
+    bool anyAbove = previous.altitude >= 0;
+    bool anyBelow = previous.altitude < 0;
+
+    for (int64_t time = start + SAMPLE_STEP; ; time += SAMPLE_STEP) {
+        bool last = time >= end;
+        Sample current = evaluate(last ? end : time);
+        anyAbove = anyAbove || current.altitude >= 0;
+        anyBelow = anyBelow || current.altitude < 0;
+
+        if ((previous.altitude < 0) != (current.altitude < 0)) {
+            addCrossing(events, previous, current);
+        } else if (havePreviousStep && current.time - previous.time == SAMPLE_STEP) {
+            // Parabola through before, previous, current: a vertex on the
+            // other side of the horizon hides two crossings. Each step is
+            // looked at as the second half of a pair, the first step also
+            // as the first half.
+            float a = (before.altitude + current.altitude) * 0.5f - previous.altitude;
+            float b = (current.altitude - before.altitude) * 0.5f;
+            float vertex = a != 0 ? -b / (2 * a) : 2; // in steps from previous
+            bool firstStep = before.time == start;
+            bool inSecond = vertex > 0 && vertex < 1;
+            bool inFirst = firstStep && vertex > -1 && vertex <= 0
+                && (before.altitude < 0) == (previous.altitude < 0);
+            float extremum = previous.altitude - b * b / (4 * a);
+            // The parabola is only a guide: look closer when it dips near
+            // or across the horizon
+            bool near = (extremum < 0) != (previous.altitude < 0) || fabsf(extremum) < GRAZING_MARGIN;
+            if ((inSecond || inFirst) && near) {
+                Sample low = inFirst ? before : previous;
+                Sample high = inFirst ? previous : current;
+                Sample middle;
+                if (findDip(low, high, &middle)) {
+                    anyAbove = anyAbove || middle.altitude >= 0;
+                    anyBelow = anyBelow || middle.altitude < 0;
+                    addCrossing(events, low, middle);
+                    addCrossing(events, middle, high);
+                }
+            }
+        }
+
+        // Upper transit: the hour angle passes zero going up
+        if (previous.hourAngle < 0 && current.hourAngle >= 0
+            && current.hourAngle - previous.hourAngle < (float)M_PI) {
+            addTransit(events, previous, current);
+        }
+
+        if (last) {
+            break;
+        }
+        before = previous;
+        previous = current;
+        havePreviousStep = true;
+    }
+
+    if (events->riseCount == 0 && events->setCount == 0) {
+        events->alwaysUp = anyAbove && !anyBelow;
+        events->alwaysDown = anyBelow && !anyAbove;
+    }
+}
+
+void RiseSetSolver::solveRiseSet(int64_t start, int64_t end, Events* events, Event* rise, Event* set) {
+    solve(start, end, events);
+    rise->time = 0;
+    rise->azimuth = 0;
+    set->time = 0;
+    set->azimuth = 0;
+    if (events->riseCount > 0) {
+        *rise = events->rises[0];
+    }
+    for (int i = 0; i < events->setCount; i++) {
+        if (events->riseCount == 0 || events->sets[i].time > rise->time) {
+            *set = events->sets[i];
+            return;
+        }
+    }
+    if (events->riseCount > 0) {
+        // Past the end, as for a moon that rises in the evening
+        Events next;
+        solve(end, end + 86400, &next);
+        if (next.setCount > 0) {
+            *set = next.sets[0];
+        }
+    }
+}
+
+RiseSetSolver::Sample RiseSetSolver::evaluate(int64_t time, float* azimuth, float* elevation) {
+    evaluations++;
+    AstroKernels::Arguments<float> arguments;
+    AstroKernels::Equatorial<float> position;
+    AstroKernels::argumentsFixed(AstroKernels::timeFromUnix(time), &arguments);
+    float horizon = SUN_HORIZON;
+    if (body == SUN) {
+        AstroKernels::sunPosition(arguments, &position);
+    } else if (body >= MERCURY) {
+        // solve() keeps the time within the table
+        PlanetEphemeris::position((PlanetEphemeris::Planet)(body - MERCURY), time, &position);
+        horizon = -REFRACTION;
+    } else {
+        AstroKernels::moonPosition(arguments, &position);
+        // Geocentric altitude at which the topocentric upper limb touches
+        float parallax = asinf(6378.14f / position.distance);
+        horizon = parallax * (1 - MOON_SEMI_DIAMETER) - REFRACTION;
+    }
+    AstroKernels::Horizontal<float> horizontal;
+    AstroKernels::horizontal(arguments, position, latitude, longitude, &horizontal);
+
+    Sample sample;
+    sample.time = time;
+    sample.altitude = horizontal.elevation - horizon;
+    float hourAngle = arguments.values[AstroKernels::SIDEREAL_TIME] + longitude - position.rightAscension;
+    sample.hourAngle = hourAngle - TWO_PI_F * floorf((hourAngle + (float)M_PI) / TWO_PI_F);
+    if (azimuth) {
+        *azimuth = horizontal.azimuth * DEGREES;
+    }
+    if (elevation) {
+        *elevation = horizontal.elevation * DEGREES;
+    }
+    return sample;
+}
+
+bool RiseSetSolver::findDip(Sample low, Sample high, Sample* dip) {
+    // Golden-section search for the altitude extremum between two samples
+    // on the same side, stopping as soon as it is across the horizon
+    bool above = low.altitude >= 0;
+    int64_t left = low.time;
+    int64_t right = high.time;
+    Sample inner = evaluate(left + (int64_t)((right - left) * GOLDEN));
+    while (right - left > DIP_RESOLUTION) {
+        if ((inner.altitude < 0) == above) {
+            *dip = inner;
+            return true;
+        }
+        // Probe the larger side of the inner point
+        bool probeRight = right - inner.time > inner.time - left;
+        int64_t time = probeRight ? inner.time + (int64_t)((right - inner.time) * GOLDEN)
+                                  : inner.time - (int64_t)((inner.time - left) * GOLDEN);
+        Sample probe = evaluate(time);
+        bool better = above ? probe.altitude < inner.altitude : probe.altitude > inner.altitude;
+        if (better) {
+            if (probeRight) {
+                left = inner.time;
+            } else {
+                right = inner.time;
+            }
+            inner = probe;
+        } else if (probeRight) {
+            right = probe.time;
+        } else {
+            left = probe.time;
+        }
+    }
+    if ((inner.altitude < 0) == above) {
+        *dip = inner;
+        return true;
+    }
+    return false;
+}
+
+int64_t RiseSetSolver::refineCrossing(Sample low, Sample high) {
+    // Illinois: false position, halving the weight of an end that stays put
+    float lowValue = low.altitude;
+    float highValue = high.altitude;
+    int side = 0;
+    while (high.time - low.time > PRECISION) {
+        int64_t width = high.time - low.time;
+        int64_t offset = (int64_t)(width * (lowValue / (lowValue - highValue)));
+        // Strictly inside, so the bracket always shrinks
+        if (offset < 1) {
+            offset = 1;
+        } else if (offset > width - 1) {
+            offset = width - 1;
+        }
+        Sample middle = evaluate(low.time + offset);
+        if ((middle.altitude < 0) == (low.altitude < 0)) {
+            low = middle;
+            lowValue = middle.altitude;
+            if (side == -1) {
+                highValue *= 0.5f;
+            }
+            side = -1;
+        } else {
+            high = middle;
+            highValue = middle.altitude;
+            if (side == 1) {
+                lowValue *= 0.5f;
+            }
+            side = 1;
+        }
+    }
+    return fabsf(low.altitude) < fabsf(high.altitude) ? low.time : high.time;
+}
+
+int64_t RiseSetSolver::refineTransit(Sample low, Sample high) {
+    float lowValue = low.hourAngle;
+    float highValue = high.hourAngle;
+    int side = 0;
+    while (high.time - low.time > PRECISION) {
+        int64_t width = high.time - low.time;
+        int64_t offset = (int64_t)(width * (lowValue / (lowValue - highValue)));
+        if (offset < 1) {
+            offset = 1;
+        } else if (offset > width - 1) {
+            offset = width - 1;
+        }
+        Sample middle = evaluate(low.time + offset);
+        if (middle.hourAngle < 0) {
+            low = middle;
+            lowValue = middle.hourAngle;
+            if (side == -1) {
+                highValue *= 0.5f;
+            }
+            side = -1;
+        } else {
+            high = middle;
+            highValue = middle.hourAngle;
+            if (side == 1) {
+                lowValue *= 0.5f;
+            }
+            side = 1;
+        }
+    }
+    return fabsf(low.hourAngle) < fabsf(high.hourAngle) ? low.time : high.time;
+}
+
+void RiseSetSolver::addCrossing(Events* events, Sample low, Sample high) {
+    bool rising = low.altitude < 0;
+    int64_t time = refineCrossing(low, high);
+    Event event;
+    event.time = time;
+    evaluate(time, &event.azimuth);
+    if (rising && events->riseCount < MAX_EVENTS) {
+        events->rises[events->riseCount++] = event;
+    } else if (!rising && events->setCount < MAX_EVENTS) {
+        events->sets[events->setCount++] = event;
+    }
+}
+
+void RiseSetSolver::addTransit(Events* events, Sample low, Sample high) {
+    if (events->transitCount >= MAX_EVENTS) {
+        return;
+    }
+    Event event;
+    event.time = refineTransit(low, high);
+    evaluate(event.time, nullptr, &event.azimuth);
+    events->transits[events->transitCount++] = event;
+}
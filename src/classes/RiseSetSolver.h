@@ -0,0 +1,91 @@
+#ifndef RISE_SET_SOLVER_H
+#define RISE_SET_SOLVER_H
+
+#include <stdint.h>
+#include "AstroKernels.h"
+#include "PlanetEphemeris.h"
+
+// Rise, set and transit times of the sun, the moon or a planet in a time
+// window.
+// The altitude above the rise/set horizon is sampled every SAMPLE_STEP;
+// a sign change brackets a crossing, and a parabola through three samples
+// whose vertex dips towards the horizon points at a bracket that would
+// hide a rise and set close together. Each bracket is then narrowed with the
+// Illinois variant of false position to within PRECISION seconds. Where
+// the vertex comes near the horizon a golden-section search looks for the
+// dip between the samples. Transit
+// is the zero of the hour angle, found the same way.
+//
+// Positions come from the fixed-point AstroKernels path, the planets' from
+// PlanetEphemeris, whose window is cut to the table. Sun crossings are
+// for the upper limb with standard refraction (-0.833 deg); the moon's also
+// allow for its parallax, so they are as seen from the ground. Planets are
+// points, refraction only (-0.567 deg).
+class RiseSetSolver {
+public:
+    enum Body {
+        SUN = 0,
+        MOON = 1,
+        // In PlanetEphemeris order
+        MERCURY = 2,
+        VENUS,
+        MARS,
+        JUPITER,
+        SATURN
+    };
+
+    static const uint8_t MAX_EVENTS = 4;
+    static const int32_t SAMPLE_STEP = 7200; // seconds
+    static const int32_t PRECISION = 1;      // seconds
+    // Rise and set closer together than this may be missed when grazing
+    static const int32_t DIP_RESOLUTION = 120; // seconds
+
+    struct Event {
+        int64_t time;  // UTC seconds
+        float azimuth; // degrees; elevation instead for a transit
+    };
+
+    struct Events {
+        uint8_t riseCount;
+        uint8_t setCount;
+        uint8_t transitCount;
+        Event rises[MAX_EVENTS];
+        Event sets[MAX_EVENTS];
+        Event transits[MAX_EVENTS];
+        // No crossing in the window: above or below the horizon throughout
+        bool alwaysUp;
+        bool alwaysDown;
+    };
+
+    RiseSetSolver(Body body, float latitude, float longitude);
+
+    void solve(int64_t start, int64_t end, Events* events);
+    // The first rise in the window and the set that follows it, looked for
+    // up to a day past end if need be; without a rise, the window's first
+    // set. A time of 0 is none. events is left with the window's solution.
+    void solveRiseSet(int64_t start, int64_t end, Events* events, Event* rise, Event* set);
+    // Position evaluations, to compare strategies
+    uint32_t getEvaluations();
+    void resetEvaluations();
+
+private:
+    struct Sample {
+        int64_t time;
+        float altitude; // radians above the rise/set horizon
+        float hourAngle; // radians, [-pi, pi)
+    };
+
+    Body body;
+    float latitude;  // radians
+    float longitude;
+    uint32_t evaluations;
+
+    Sample evaluate(int64_t time, float* azimuth = nullptr, float* elevation = nullptr);
+    bool findDip(Sample low, Sample high, Sample* dip);
+    int64_t refineCrossing(Sample low, Sample high);
+    int64_t refineTransit(Sample low, Sample high);
+    void addCrossing(Events* events, Sample low, Sample high);
+    void addTransit(Events* events, Sample low, Sample high);
+};
+
+#endif
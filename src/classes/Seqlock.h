@@ -0,0 +1,79 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// Latest-value snapshot for one writer and any number of readers. The
+// writer never waits; a reader retries while a publish is in progress, so
+// it always gets one whole snapshot rather than fields from two different
+// updates. The value is kept as atomic words so a torn read is only ever
+// discarded, never undefined behaviour.
+//
+// A reader must not preempt the writer on the writer's own core (a higher
+// priority reader would spin forever on a half-written value). Readers on
+// the other core, or at lower priority, are always safe.
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock values are copied word by word");
+
+public:
+    Seqlock() : sequence(0) {
+        for (uint32_t i = 0; i < WORDS; i++) {
+            words[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Writer side
+    void publish(const T& value) {
+        uint32_t buffer[WORDS] = {};
+        memcpy(buffer, &value, sizeof(T));
+        uint32_t s = sequence.load(std::memory_order_relaxed);
+        sequence.store(s + 1, std::memory_order_relaxed); // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        for (uint32_t i = 0; i < WORDS; i++) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence.store(s + 2, std::memory_order_release);
+    }
+
+    // One attempt; false if a publish overlapped it
+    bool tryRead(T& value) const {
+        uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        uint32_t buffer[WORDS];
+        for (uint32_t i = 0; i < WORDS; i++) {
+            buffer[i] = words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        memcpy(&value, buffer, sizeof(T));
+        return true;
+    }
+
+    T read() const {
+        T value;
+        while (!tryRead(value)) {
+        }
+        return value;
+    }
+
+    // Even and increasing by two per publish; 0 until the first publish
+    uint32_t getVersion() const {
+        return sequence.load(std::memory_order_acquire) & ~1u;
+    }
+
+private:
+    static constexpr uint32_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> words[WORDS];
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// The producer's and the consumer's indices sit on separate cache lines so
+// the two cores never write the same line. The ESP32 has 32-byte lines for
+// external RAM; 64 also covers host builds.
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+// Lock-free ring for one producer task and one consumer task. Nothing is
+// allocated after construction and neither side ever blocks: push() fails
+// when the ring is full and pop() fails when it is empty. Capacity must be
+// a power of two; the indices run freely and wrap with uint32_t.
+template <typename T, uint32_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : head(0), tailCache(0), tail(0), headCache(0) {}
+
+    // Producer side
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tailCache == Capacity) {
+            // Looks full; only now read the consumer's line
+            tailCache = tail.load(std::memory_order_acquire);
+            if (h - tailCache == Capacity) {
+                return false;
+            }
+        }
+        slots[h & (Capacity - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == headCache) {
+            headCache = head.load(std::memory_order_acquire);
+            if (t == headCache) {
+                return false;
+            }
+        }
+        item = slots[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Either side; exact only when called by the consumer with the producer idle
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    static constexpr uint32_t capacity() {
+        return Capacity;
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> head; // written by the producer
+    uint32_t tailCache;                                  // producer's copy of tail
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> tail; // written by the consumer
+    uint32_t headCache;                                  // consumer's copy of head
+    alignas(CACHE_LINE_SIZE) T slots[Capacity];
+};
+
+#endif
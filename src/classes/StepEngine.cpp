@@ -0,0 +1,298 @@
+#include "StepEngine.h"
+
+// Fastest the engine will ever step (28BYJ-48 loses steps much above
+// ~500 steps/s)
+static const uint32_t MIN_STEP_INTERVAL_MICROS = 2000;
+
+StepEngine::StepEngine(StepTimer* timer, StepOutput* output) {
+    this->timer = timer;
+    this->output = output;
+    position = 0;
+    stepCount = 0;
+    running = false;
+    holdTime = 50000; // 50ms for the motor to physically move before releasing
+    lastFiredAt = 0;
+    phaseError = 0;
+    maxPhaseError = 0;
+    releaseAt = 0;
+    energized = false;
+    droppedStepRecords = 0;
+    move = nullptr;
+    moveStepsDone = 0;
+    moveDueAt = 0;
+    moveFinished = false;
+    moveCompleted = false;
+}
+
+StepEngine::~StepEngine() {
+    if (timer) {
+        timer->cancel();
+    }
+}
+
+void StepEngine::begin() {
+    timer->begin(&StepEngine::onTimer, this);
+}
+
+void StepEngine::setStepPeriod(uint64_t periodNumerator, uint64_t periodDenominator, uint64_t stepsPerPeriod) {
+    if (stepsPerPeriod == 0 || periodDenominator == 0) {
+        return;
+    }
+    uint64_t denominator = periodDenominator * stepsPerPeriod;
+    if (periodNumerator < MIN_STEP_INTERVAL_MICROS * denominator) {
+        periodNumerator = MIN_STEP_INTERVAL_MICROS * denominator;
+    }
+    timer->lock();
+    if (running) {
+        // Keep the phase of the last step, only the spacing changes
+        schedule.retime(periodNumerator, denominator);
+        armNextEvent();
+    } else {
+        schedule.setInterval(periodNumerator, denominator);
+    }
+    timer->unlock();
+}
+
+void StepEngine::setHoldTime(uint32_t holdMicros) {
+    timer->lock();
+    holdTime = holdMicros;
+    timer->unlock();
+}
+
+void StepEngine::start() {
+    timer->lock();
+    if (!running) {
+        running = true;
+        uint64_t now = timer->nowMicros();
+        schedule.anchor(now);
+        lastFiredAt = now - MIN_STEP_INTERVAL_MICROS;
+        armNextEvent();
+    }
+    timer->unlock();
+}
+
+void StepEngine::startAt(uint64_t firstStepMicros) {
+    timer->lock();
+    running = true;
+    schedule.anchor(firstStepMicros);
+    lastFiredAt = firstStepMicros - MIN_STEP_INTERVAL_MICROS;
+    armNextEvent();
+    timer->unlock();
+}
+
+void StepEngine::stop() {
+    timer->lock();
+    running = false;
+    if (energized && !move) {
+        output->release();
+        energized = false;
+    }
+    armNextEvent();
+    timer->unlock();
+}
+
+bool StepEngine::isRunning() {
+    return running;
+}
+
+uint64_t StepEngine::getTimeMicros() {
+    return timer->nowMicros();
+}
+
+int32_t StepEngine::getPosition() {
+    return position;
+}
+
+void StepEngine::setPosition(int32_t steps) {
+    timer->lock();
+    position = steps;
+    timer->unlock();
+}
+
+void StepEngine::adjustPosition(int32_t delta) {
+    timer->lock();
+    position += delta;
+    timer->unlock();
+}
+
+bool StepEngine::startMove(MovePlanner* plan) {
+    timer->lock();
+    if (move) {
+        timer->unlock();
+        return false;
+    }
+    moveStepsDone = 0;
+    moveFinished = false;
+    if (plan->getTotalSteps() == 0) {
+        moveFinished = true;
+        moveCompleted = true;
+        timer->unlock();
+        return true;
+    }
+    move = plan;
+    moveDueAt = timer->nowMicros();
+    armNextEvent();
+    timer->unlock();
+    return true;
+}
+
+void StepEngine::cancelMove() {
+    timer->lock();
+    if (move) {
+        finishMove(timer->nowMicros(), false);
+        armNextEvent();
+    }
+    timer->unlock();
+}
+
+bool StepEngine::isMoving() {
+    return move != nullptr;
+}
+
+int32_t StepEngine::getMoveStepsDone() {
+    return moveStepsDone;
+}
+
+bool StepEngine::takeMoveFinished(bool* completed) {
+    timer->lock();
+    bool result = moveFinished;
+    if (result) {
+        moveFinished = false;
+        if (completed) {
+            *completed = moveCompleted;
+        }
+    }
+    timer->unlock();
+    return result;
+}
+
+uint32_t StepEngine::getStepCount() {
+    return stepCount;
+}
+
+int32_t StepEngine::getPhaseError() {
+    return phaseError;
+}
+
+uint32_t StepEngine::getMaxPhaseError() {
+    return maxPhaseError;
+}
+
+void StepEngine::resetPhaseError() {
+    timer->lock();
+    phaseError = 0;
+    maxPhaseError = 0;
+    timer->unlock();
+}
+
+bool StepEngine::takeStepRecord(StepRecord* record) {
+    return stepRecords.pop(*record);
+}
+
+uint32_t StepEngine::getDroppedStepRecords() {
+    return droppedStepRecords;
+}
+
+void StepEngine::onTimer(void* arg) {
+    static_cast<StepEngine*>(arg)->handleTimer();
+}
+
+void StepEngine::handleTimer() {
+    timer->lock();
+    uint64_t now = timer->nowMicros();
+
+    if (move) {
+        if (now >= moveDueAt) {
+            stepMove(now);
+        } else if (energized && now >= releaseAt) {
+            output->release();
+            energized = false;
+        }
+    } else if (running && now >= stepDueAt()) {
+        output->step(1);
+        position = position + 1;
+        stepCount = stepCount + 1;
+        energized = true;
+        lastFiredAt = now;
+        releaseAt = now + holdTime;
+
+        int64_t error = (int64_t)(now - schedule.nextAt());
+        uint32_t magnitude = (uint32_t)(error < 0 ? -error : error);
+        phaseError = (int32_t)error;
+        if (magnitude > maxPhaseError) {
+            maxPhaseError = magnitude;
+        }
+        StepRecord record = {(uint32_t)now, position, phaseError};
+        if (!stepRecords.push(record)) {
+            droppedStepRecords = droppedStepRecords + 1;
+        }
+        schedule.advance();
+    } else if (energized && now >= releaseAt) {
+        output->release();
+        energized = false;
+    }
+
+    armNextEvent();
+    timer->unlock();
+}
+
+void StepEngine::stepMove(uint64_t now) {
+    // Called with the timer lock held
+    output->step(move->getDirection());
+    position = position + move->getDirection();
+    stepCount = stepCount + 1;
+    energized = true;
+    lastFiredAt = now;
+    releaseAt = now + holdTime;
+
+    int32_t done = moveStepsDone + 1;
+    moveStepsDone = done;
+    if (done >= move->getTotalSteps()) {
+        finishMove(now, true);
+    } else {
+        // Time from the ideal step time so callback latency does not stretch
+        // the profile, but never step faster than the motor can follow
+        moveDueAt += move->intervalAfter(done - 1);
+        if (moveDueAt < now + MIN_STEP_INTERVAL_MICROS) {
+            moveDueAt = now + MIN_STEP_INTERVAL_MICROS;
+        }
+    }
+}
+
+void StepEngine::finishMove(uint64_t now, bool completed) {
+    // Called with the timer lock held
+    move = nullptr;
+    moveFinished = true;
+    moveCompleted = completed;
+    if (running) {
+        // Rotation resumes one interval after the move
+        schedule.anchor(now);
+        schedule.advance();
+        lastFiredAt = now;
+    }
+}
+
+uint64_t StepEngine::stepDueAt() {
+    // Steps are scheduled on an absolute timeline so a late callback does not
+    // push later steps back. When behind, catch up no faster than the motor
+    // can follow.
+    uint64_t earliest = lastFiredAt + MIN_STEP_INTERVAL_MICROS;
+    uint64_t ideal = schedule.nextAt();
+    return ideal > earliest ? ideal : earliest;
+}
+
+void StepEngine::armNextEvent() {
+    // Called with the timer lock held
+    bool stepping = running || move;
+    uint64_t stepAt = move ? moveDueAt : stepDueAt();
+    bool releasePending = energized && (!stepping || releaseAt < stepAt);
+    if (stepping && releasePending) {
+        timer->fireAt(releaseAt);
+    } else if (stepping) {
+        timer->fireAt(stepAt);
+    } else if (releasePending) {
+        timer->fireAt(releaseAt);
+    } else {
+        timer->cancel();
+    }
+}
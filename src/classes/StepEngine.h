@@ -0,0 +1,98 @@
+#ifndef STEP_ENGINE_H
+#define STEP_ENGINE_H
+
+#include <stdint.h>
+#include "StepTimer.h"
+#include "StepSchedule.h"
+#include "MovePlanner.h"
+#include "SpscRing.h"
+#include "Telemetry.h"
+
+// Coil driver the engine calls from timer context. step() energizes the next
+// phase in the given direction, release() de-energizes all coils.
+class StepOutput {
+public:
+    virtual ~StepOutput() {}
+    virtual void step(int8_t direction) = 0;
+    virtual void release() = 0;
+};
+
+// Timer-driven step scheduler. Steps and coil releases are separate events
+// on a single one-shot StepTimer, so nothing ever blocks the main loop; the
+// loop only reads back the position. Step times come from a StepSchedule,
+// so the rate is exact and the phase error (actual minus ideal step time) is
+// tracked for drift checks; each rotation step is also pushed to a lock-free
+// ring for the control task to fold into jitter statistics. A planned move
+// (rewind, goto) runs on the same timer and suspends the rotation until it
+// finishes.
+class StepEngine {
+public:
+    StepEngine(StepTimer* timer, StepOutput* output);
+    ~StepEngine();
+
+    void begin();
+    // A period of periodNumerator / periodDenominator microseconds split into
+    // stepsPerPeriod steps, kept as an exact rational
+    void setStepPeriod(uint64_t periodNumerator, uint64_t periodDenominator, uint64_t stepsPerPeriod);
+    void setHoldTime(uint32_t holdMicros);
+    void start();
+    // Start (or re-phase) the rotation with its first step at a given time
+    void startAt(uint64_t firstStepMicros);
+    void stop();
+    bool isRunning();
+    uint64_t getTimeMicros();
+
+    int32_t getPosition();
+    void setPosition(int32_t steps);
+    // Shift the position without losing steps taken meanwhile
+    void adjustPosition(int32_t delta);
+    uint32_t getStepCount();
+
+    // The planner must stay untouched until the move finishes
+    bool startMove(MovePlanner* plan);
+    void cancelMove();
+    bool isMoving();
+    int32_t getMoveStepsDone();
+    // True once after each move ends, for dispatching completion in loop()
+    bool takeMoveFinished(bool* completed);
+
+    int32_t getPhaseError();
+    uint32_t getMaxPhaseError();
+    void resetPhaseError();
+    // Consumer side of the step record ring; one task only
+    bool takeStepRecord(StepRecord* record);
+    uint32_t getDroppedStepRecords();
+
+private:
+    StepTimer* timer;
+    StepOutput* output;
+
+    volatile int32_t position;
+    volatile uint32_t stepCount;
+    volatile bool running;
+
+    StepSchedule schedule;
+    uint32_t holdTime;     // microseconds coils stay energized after a step
+    uint64_t lastFiredAt; // actual time of the last step
+    volatile int32_t phaseError;     // microseconds late (+) of the last step
+    volatile uint32_t maxPhaseError; // largest |phaseError| since reset
+    uint64_t releaseAt;
+    bool energized;
+    SpscRing<StepRecord, 64> stepRecords; // ~1s of the fastest rotation
+    volatile uint32_t droppedStepRecords;
+
+    MovePlanner* volatile move;
+    volatile int32_t moveStepsDone;
+    uint64_t moveDueAt;
+    volatile bool moveFinished;
+    volatile bool moveCompleted;
+
+    static void onTimer(void* arg);
+    void handleTimer();
+    uint64_t stepDueAt();
+    void stepMove(uint64_t now);
+    void finishMove(uint64_t now, bool completed);
+    void armNextEvent();
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include "StepSchedule.h"
+
+StepSchedule::StepSchedule() {
+    numerator = 1000000;
+    denominator = 1;
+    quotient = 1000000;
+    remainder = 0;
+    accumulator = 0;
+    anchorAt = 0;
+    index = 0;
+    next = 0;
+    last = 0;
+}
+
+void StepSchedule::setInterval(uint64_t numerator, uint64_t denominator) {
+    if (denominator == 0) {
+        denominator = 1;
+    }
+    this->numerator = numerator;
+    this->denominator = denominator;
+    quotient = numerator / denominator;
+    remainder = numerator % denominator;
+}
+
+uint64_t StepSchedule::getNumerator() {
+    return numerator;
+}
+
+uint64_t StepSchedule::getDenominator() {
+    return denominator;
+}
+
+void StepSchedule::anchor(uint64_t startMicros) {
+    anchorAt = startMicros;
+    index = 0;
+    accumulator = 0;
+    next = startMicros;
+    last = startMicros;
+}
+
+void StepSchedule::retime(uint64_t numerator, uint64_t denominator) {
+    uint64_t lastStep = last;
+    setInterval(numerator, denominator);
+    anchor(lastStep);
+    advance();
+}
+
+uint64_t StepSchedule::nextAt() {
+    return next;
+}
+
+uint64_t StepSchedule::lastAt() {
+    return last;
+}
+
+uint64_t StepSchedule::getIndex() {
+    return index;
+}
+
+void StepSchedule::advance() {
+    last = next;
+    index++;
+    next += quotient;
+    accumulator += remainder;
+    if (accumulator >= denominator) {
+        accumulator -= denominator;
+        next++;
+    }
+}
+
+uint64_t StepSchedule::idealAt(uint64_t n) {
+    // n * remainder stays inside 64 bits for any realistic run (remainder <
+    // denominator, which is at most period denominator x steps per
+    // revolution numerator, ~2e10, so up to ~9e8 steps from the anchor)
+    return anchorAt + n * quotient + (n * remainder) / denominator;
+}
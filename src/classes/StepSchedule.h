@@ -0,0 +1,45 @@
+#ifndef STEP_SCHEDULE_H
+#define STEP_SCHEDULE_H
+
+#include <stdint.h>
+
+// Absolute step timetable with an exact rational step interval of
+// numerator/denominator microseconds. Step N is due at
+//   anchor + floor(N * numerator / denominator)
+// which is tracked with a Bresenham-style remainder accumulator, so the
+// fractional microseconds are carried instead of dropped and the Nth step is
+// on time however long the controller has been running.
+class StepSchedule {
+public:
+    StepSchedule();
+
+    void setInterval(uint64_t numerator, uint64_t denominator);
+    uint64_t getNumerator();
+    uint64_t getDenominator();
+
+    // Step 0 is due at startMicros
+    void anchor(uint64_t startMicros);
+    // Keep the last step where it was and apply a new interval from there
+    void retime(uint64_t numerator, uint64_t denominator);
+
+    uint64_t nextAt();
+    uint64_t lastAt();
+    uint64_t getIndex();
+    void advance();
+
+    // Ideal time of step n since the anchor, computed directly
+    uint64_t idealAt(uint64_t n);
+
+private:
+    uint64_t numerator;
+    uint64_t denominator;
+    uint64_t quotient;    // whole microseconds per step
+    uint64_t remainder;   // fractional part, in 1/denominator microseconds
+    uint64_t accumulator; // carried fraction, always < denominator
+    uint64_t anchorAt;
+    uint64_t index;
+    uint64_t next;
+    uint64_t last;
+};
+
+#endif
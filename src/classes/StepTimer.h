@@ -0,0 +1,28 @@
+#ifndef STEP_TIMER_H
+#define STEP_TIMER_H
+
+#include <stdint.h>
+
+// One-shot microsecond timer used by StepEngine. The ESP32 build uses
+// EspStepTimer (esp_timer); host builds use VirtualStepTimer so the engine
+// can be driven from a virtual clock.
+class StepTimer {
+public:
+    typedef void (*Callback)(void* arg);
+
+    virtual ~StepTimer() {}
+
+    virtual void begin(Callback callback, void* arg) = 0;
+    virtual uint64_t nowMicros() = 0;
+
+    // Arm the timer to fire at an absolute time, replacing any pending shot.
+    // A time in the past fires as soon as possible.
+    virtual void fireAt(uint64_t whenMicros) = 0;
+    virtual void cancel() = 0;
+
+    // Guards state shared between the timer callback and the main loop
+    virtual void lock() {}
+    virtual void unlock() {}
+};
+
+#endif
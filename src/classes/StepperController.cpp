@@ -1,59 +1,258 @@
 #include "StepperController.h"
+#include "EspStepTimer.h"
+#include "EspGpioCoilDriver.h"
 
-StepperController::StepperController(uint8_t pin1, uint8_t pin2, uint8_t pin3, uint8_t pin4) {
+// Time-locked mode re-checks alignment once the dial is this many steps off
+// or the engine clock has slipped a quarter step against UTC
+static const long TIME_LOCK_TOLERANCE_STEPS = 2;
+
+// Custom periods up to 10 days with sub-microsecond resolution down to 1ns
+static const uint64_t MAX_PERIOD_MICROS = 864000000000ULL;
+static const uint64_t MAX_PERIOD_DENOMINATOR = 1000;
+
+// Motor telemetry is republished ten times a second
+static const uint64_t TELEMETRY_INTERVAL_MICROS = 100000;
+
+// Calibrated gear ratios within a quarter of nominal, to the 1/1000 step
+static const uint64_t MAX_GEAR_DENOMINATOR = 1000;
+
+static uint64_t greatestCommonDivisor(uint64_t a, uint64_t b) {
+    while (b != 0) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// a * b / c and its remainder, exact even when a * b needs more than 64
+// bits (the quotient itself must fit). The ESP32 compiler has no 128-bit
+// type, so the product is formed in two halves and divided bit by bit.
+static uint64_t mulDiv(uint64_t a, uint64_t b, uint64_t c, uint64_t* remainder) {
+    uint64_t aLow = (uint32_t)a;
+    uint64_t aHigh = a >> 32;
+    uint64_t bLow = (uint32_t)b;
+    uint64_t bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow;
+    uint64_t lowHigh = aLow * bHigh;
+    uint64_t highLow = aHigh * bLow;
+    uint64_t middle = (lowLow >> 32) + (uint32_t)lowHigh + (uint32_t)highLow;
+    uint64_t low = (middle << 32) | (uint32_t)lowLow;
+    uint64_t high = aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+    if (high == 0) {
+        *remainder = low % c;
+        return low / c;
+    }
+    uint64_t quotient = 0;
+    uint64_t rest = 0;
+    for (int i = 127; i >= 0; i--) {
+        bool carry = (rest >> 63) != 0;
+        uint64_t bit = i >= 64 ? (high >> (i - 64)) & 1 : (low >> i) & 1;
+        rest = (rest << 1) | bit;
+        quotient <<= 1;
+        if (carry || rest >= c) {
+            rest -= c;
+            quotient |= 1;
+        }
+    }
+    *remainder = rest;
+    return quotient;
+}
+
+StepperController::StepperController(uint8_t pin1, uint8_t pin2, uint8_t pin3, uint8_t pin4, StepTimer* timer, CoilDriver* driver) {
     Serial.println("StepperController::StepperController()");
-    stepper = nullptr;
+    coilDriver = driver;
+    stepOutput = nullptr;
+    stepTimer = timer;
+    engine = nullptr;
+    onMoveProgress = nullptr;
+    onMoveComplete = nullptr;
+    lastMoveProgress = 0;
     currentSpeed = ONCE_PER_DAY;
-    lastStepTime = 0;
-    stepsPerRevolution = 2048; // 28BYJ-48 with ULN2003
-    currentSteps = 0;
+    stepMode = STEPPER_STEP_MODE;
+    stepsPerRevolution = getStepsPerRevolution(stepMode); // 28BYJ-48 with ULN2003
+    gearNumerator = getStepsPerRevolution(FULL_STEP);
+    gearDenominator = 1;
+    revolutionNumerator = stepsPerRevolution;
+    revolutionDenominator = 1;
+    backlashFullSteps = 0;
+    backlashSteps = 0;
+    gearDirection = 1;
+    moveDirection = 1;
+    moveTakeup = 0;
+    takeupMove = false;
+    indexSensor = nullptr;
+    calibrationRevolutions = 0;
+    calibrating = false;
+    onCalibrationComplete = nullptr;
+    lastRevolution = 0;
     rotating = false;
-    stepInterval = 0;
+    periodNumerator = 0;
+    periodDenominator = 1;
+    customNumerator = 86400000000ULL;
+    customDenominator = 1;
     this->pin1 = pin1;
     this->pin2 = pin2;
     this->pin3 = pin3;
     this->pin4 = pin4;
+    timeLocked = false;
+    timeLockAligned = false;
+    timeSource = nullptr;
+    timeLockOffset = 0;
+    angleError = 0;
+    lastTelemetryAt = 0;
+    jitterSumSquares = 0;
+    jitterCount = 0;
 }
 
 StepperController::~StepperController() {
     Serial.println("StepperController::~StepperController()");
-    if (stepper) {
-        delete stepper;
+    if (engine) {
+        engine->stop();
+        delete engine;
+    }
+    if (stepOutput) {
+        delete stepOutput;
     }
 }
 
 void StepperController::begin() {
     Serial.println("StepperController::begin()");
-    // ULN2003 connected to configurable pins
-    stepper = new AccelStepper(AccelStepper::FULL4WIRE, pin1, pin2, pin3, pin4);
-    stepper->setMaxSpeed(1000);
-    stepper->setAcceleration(500);
+    // ULN2003 connected to configurable pins, driven through the GPIO
+    // registers unless another backend was supplied
+    if (!coilDriver) {
+        coilDriver = new EspGpioCoilDriver();
+    }
+    stepOutput = new CoilSequencer(coilDriver, stepMode);
+    stepOutput->begin(pin1, pin2, pin3, pin4);
+    planner.setLimits(500, 500); // steps/s, steps/s^2
+
+    // Steps are timed by the engine's timer, update() only reports progress
+    if (!stepTimer) {
+        stepTimer = new EspStepTimer();
+    }
+    if (indexSensor) {
+        // The sensor samples its pin after every step on the way through
+        indexSensor->begin(stepOutput);
+        engine = new StepEngine(stepTimer, indexSensor);
+    } else {
+        engine = new StepEngine(stepTimer, stepOutput);
+    }
+    engine->begin();
     calculateStepInterval();
 }
 
 void StepperController::update() {
-    
-    if (rotating && stepper) {
-        //Serial.println("StepperController::update()"); // Commented out - called frequently
-        unsigned long currentTime = millis();
-        if (currentTime - lastStepTime >= stepInterval) {
-            
-            stepper->move(1);
-            stepper->run();
-            currentSteps++;
-            lastStepTime = currentTime;
-            
-            // Allow time for motor to complete step before releasing coils
-            delay(50); // 50ms delay for motor to physically move
-            releaseCoils();
-            
-            // Reset step count after full revolution
-            if (currentSteps >= stepsPerRevolution) {
-                Serial.println("StepperController::update() Completed 1 rotation");
-                currentSteps = 0;
+    //Serial.println("StepperController::update()"); // Commented out - called frequently
+    if (!engine) {
+        return;
+    }
+
+    // Move progress and completion are reported here, in loop() context,
+    // never from the timer callback
+    if (calibrating && engine->isMoving() && indexSensor->getHitCount() > calibrationRevolutions) {
+        engine->cancelMove();
+    }
+
+    if (engine->isMoving() && !takeupMove && !calibrating) {
+        long done = engine->getMoveStepsDone();
+        if (done != lastMoveProgress) {
+            lastMoveProgress = done;
+            if (onMoveProgress) {
+                onMoveProgress(done, planner.getTotalSteps());
+            }
+        }
+    }
+    bool completed = false;
+    if (engine->takeMoveFinished(&completed)) {
+        // Steps spent taking up backlash turned the motor, not the dial
+        long takenUp = engine->getMoveStepsDone();
+        if (takenUp > moveTakeup) {
+            takenUp = moveTakeup;
+        }
+        if (takenUp > 0) {
+            engine->adjustPosition(-moveDirection * takenUp);
+        }
+
+        if (calibrating) {
+            finishCalibration();
+        } else if (takeupMove) {
+            takeupMove = false;
+        } else {
+            Serial.print("StepperController::update() Move ");
+            Serial.println(completed ? "completed" : "cancelled");
+            if (completed && onMoveProgress) {
+                onMoveProgress(planner.getTotalSteps(), planner.getTotalSteps());
             }
+            if (onMoveComplete) {
+                onMoveComplete(completed);
+            }
+        }
+
+        // The rotation always turns forward
+        if (rotating && gearDirection < 0 && !engine->isMoving()) {
+            takeUpBacklash();
         }
     }
+
+    if (timeLocked) {
+        updateTimeLock();
+    }
+
+    int64_t ticks = (int64_t)engine->getPosition() * (int64_t)revolutionDenominator;
+    long revolution = (long)(ticks / (int64_t)revolutionNumerator);
+    if (ticks < 0 && ticks % (int64_t)revolutionNumerator != 0) {
+        revolution--;
+    }
+    if (revolution != lastRevolution) {
+        lastRevolution = revolution;
+        Serial.println("StepperController::update() Completed 1 rotation");
+    }
+
+    publishTelemetry();
+}
+
+void StepperController::publishTelemetry() {
+    // Serial.println("StepperController::publishTelemetry()"); // Commented out - called frequently
+    // Drain what the motor task pushed since the last call
+    StepRecord record;
+    while (engine->takeStepRecord(&record)) {
+        int64_t error = record.phaseError;
+        jitterSumSquares += (uint64_t)(error * error);
+        jitterCount++;
+    }
+
+    uint64_t now = engine->getTimeMicros();
+    if (lastTelemetryAt != 0 && now - lastTelemetryAt < TELEMETRY_INTERVAL_MICROS) {
+        return;
+    }
+    lastTelemetryAt = now;
+
+    MotorTelemetry state = telemetry.read();
+    state.degrees = getCurrentDegrees();
+    state.steps = (int32_t)getCurrentSteps();
+    state.angleError = angleError;
+    state.phaseError = engine->getPhaseError();
+    state.maxPhaseError = engine->getMaxPhaseError();
+    if (jitterCount > 0) {
+        // Windows without a step keep the previous figure
+        state.jitterRms = (uint32_t)sqrt((double)jitterSumSquares / (double)jitterCount);
+        jitterSumSquares = 0;
+        jitterCount = 0;
+    }
+    state.droppedRecords = engine->getDroppedStepRecords();
+    state.speed = (uint8_t)currentSpeed;
+    state.rotating = rotating;
+    state.moving = engine->isMoving();
+    state.timeLocked = timeLocked;
+    state.calibrating = calibrating;
+    telemetry.publish(state);
+}
+
+MotorTelemetry StepperController::getTelemetry() {
+    // Serial.println("StepperController::getTelemetry()"); // Commented out - called frequently
+    return telemetry.read();
 }
 
 void StepperController::setRotationSpeed(RotationSpeed speed) {
@@ -64,37 +263,423 @@ void StepperController::setRotationSpeed(RotationSpeed speed) {
     calculateStepInterval();
 }
 
+void StepperController::setCustomPeriod(uint64_t numerator, uint64_t denominator) {
+    Serial.print("StepperController::setCustomPeriod(");
+    Serial.print((double)numerator);
+    Serial.print(", ");
+    Serial.print((double)denominator);
+    Serial.println(")");
+    // Bounded so the time-lock arithmetic stays inside 64 bits
+    if (numerator == 0 || denominator == 0 || denominator > MAX_PERIOD_DENOMINATOR
+        || numerator / denominator > MAX_PERIOD_MICROS) {
+        Serial.println("StepperController::setCustomPeriod() period out of range");
+        return;
+    }
+    customNumerator = numerator;
+    customDenominator = denominator;
+    currentSpeed = CUSTOM_PERIOD;
+    calculateStepInterval();
+}
+
+void StepperController::setStepMode(StepMode mode) {
+    Serial.print("StepperController::setStepMode(");
+    Serial.print(mode);
+    Serial.println(")");
+    if (mode == stepMode || isMoving()) {
+        return;
+    }
+    long newStepsPerRevolution = getStepsPerRevolution(mode);
+    if (stepOutput && stepTimer) {
+        stepTimer->lock();
+        stepOutput->setMode(mode);
+        stepTimer->unlock();
+    }
+    if (engine) {
+        long position = (long)engine->getPosition() * newStepsPerRevolution / (long)getStepsPerRevolution(stepMode);
+        engine->setPosition(position);
+    }
+    stepMode = mode;
+    calculateStepInterval();
+    if (engine) {
+        int64_t ticks = (int64_t)engine->getPosition() * (int64_t)revolutionDenominator;
+        lastRevolution = (long)(ticks / (int64_t)revolutionNumerator);
+    }
+}
+
+StepMode StepperController::getStepMode() {
+    // Serial.println("StepperController::getStepMode()");
+    return stepMode;
+}
+
+bool StepperController::setStepsPerRevolution(uint64_t numerator, uint64_t denominator) {
+    Serial.print("StepperController::setStepsPerRevolution(");
+    Serial.print((double)numerator);
+    Serial.print(", ");
+    Serial.print((double)denominator);
+    Serial.println(")");
+    uint64_t nominal = getStepsPerRevolution(FULL_STEP);
+    if (numerator == 0 || denominator == 0) {
+        Serial.println("StepperController::setStepsPerRevolution() ratio out of range");
+        return false;
+    }
+    uint64_t divisor = greatestCommonDivisor(numerator, denominator);
+    numerator /= divisor;
+    denominator /= divisor;
+    if (denominator > MAX_GEAR_DENOMINATOR || numerator < nominal * 3 / 4 * denominator
+        || numerator > nominal * 5 / 4 * denominator) {
+        Serial.println("StepperController::setStepsPerRevolution() ratio out of range");
+        return false;
+    }
+    gearNumerator = numerator;
+    gearDenominator = denominator;
+    calculateStepInterval();
+    return true;
+}
+
+void StepperController::setBacklash(long fullSteps) {
+    Serial.print("StepperController::setBacklash(");
+    Serial.print(fullSteps);
+    Serial.println(")");
+    if (fullSteps < 0) {
+        fullSteps = 0;
+    }
+    backlashFullSteps = fullSteps;
+    calculateRevolution();
+}
+
+void StepperController::setIndexSensor(IndexSensor* sensor) {
+    Serial.println("StepperController::setIndexSensor()");
+    indexSensor = sensor;
+}
+
+bool StepperController::startCalibration(uint8_t revolutions) {
+    Serial.print("StepperController::startCalibration(");
+    Serial.print(revolutions);
+    Serial.println(")");
+    if (!engine || !indexSensor || revolutions == 0 || revolutions >= IndexSensor::MAX_HITS || engine->isMoving()) {
+        Serial.println("StepperController::startCalibration() returning: false");
+        return false;
+    }
+    stepTimer->lock();
+    indexSensor->arm(stepsPerRevolution / 2);
+    stepTimer->unlock();
+
+    // Always measured turning forward, after taking up any backlash, with
+    // travel for one more hit than needed even if the gear is 10% off
+    long steps = stepsPerRevolution * (revolutions + 1) * 11 / 10;
+    long takeup = gearDirection < 0 ? backlashSteps : 0;
+    if (!startMove(1, steps + takeup, takeup)) {
+        indexSensor->disarm();
+        Serial.println("StepperController::startCalibration() returning: false");
+        return false;
+    }
+    calibrationRevolutions = revolutions;
+    calibrating = true;
+    Serial.println("StepperController::startCalibration() returning: true");
+    return true;
+}
+
+bool StepperController::isCalibrating() {
+    // Serial.println("StepperController::isCalibrating()"); // Commented out - called frequently
+    return calibrating;
+}
+
+void StepperController::setCalibrationCallback(CalibrationCompleteCallback complete) {
+    Serial.println("StepperController::setCalibrationCallback()");
+    onCalibrationComplete = complete;
+}
+
+void StepperController::finishCalibration() {
+    Serial.println("StepperController::finishCalibration()");
+    calibrating = false;
+    indexSensor->disarm();
+
+    bool success = indexSensor->getHitCount() > calibrationRevolutions;
+    uint64_t numerator = 0;
+    uint64_t denominator = 1;
+    if (success) {
+        int32_t counted = indexSensor->getHitPosition(calibrationRevolutions) - indexSensor->getHitPosition(0);
+        // Steps of the current mode over whole revolutions, as full steps
+        numerator = (uint64_t)counted * getStepsPerRevolution(FULL_STEP);
+        denominator = (uint64_t)calibrationRevolutions * getStepsPerRevolution(stepMode);
+        uint64_t divisor = greatestCommonDivisor(numerator, denominator);
+        numerator /= divisor;
+        denominator /= divisor;
+        success = setStepsPerRevolution(numerator, denominator);
+    } else {
+        Serial.println("StepperController::finishCalibration() index sensor not seen");
+    }
+    if (onCalibrationComplete) {
+        onCalibrationComplete(success, numerator, denominator);
+    }
+}
+
 void StepperController::startRotation() {
     Serial.println("StepperController::startRotation()");
     rotating = true;
+    if (engine) {
+        engine->start();
+        if (gearDirection < 0 && !engine->isMoving()) {
+            takeUpBacklash();
+        }
+    }
 }
 
 void StepperController::stopRotation() {
     Serial.println("StepperController::stopRotation()");
     rotating = false;
-    releaseCoils();
+    if (engine) {
+        engine->cancelMove();
+        engine->stop();
+    }
+}
+
+bool StepperController::move(long steps) {
+    Serial.print("StepperController::move(");
+    Serial.print(steps);
+    Serial.println(")");
+    if (calibrating) {
+        Serial.println("StepperController::move() returning: false");
+        return false;
+    }
+    // Reversing first takes up the slack in the gear train
+    int8_t direction = steps < 0 ? -1 : 1;
+    long takeup = (steps != 0 && direction != gearDirection) ? backlashSteps : 0;
+    bool result = startMove(direction, labs(steps) + takeup, takeup);
+    Serial.print("StepperController::move() returning: ");
+    Serial.println(result);
+    return result;
+}
+
+bool StepperController::startMove(int8_t direction, long steps, long takeup) {
+    // Serial.println("StepperController::startMove()");
+    if (!engine || engine->isMoving()) {
+        return false;
+    }
+    if (!planner.plan(direction * steps)) {
+        Serial.println("StepperController::startMove() failed to plan move");
+        return false;
+    }
+    lastMoveProgress = 0;
+    if (!engine->startMove(&planner)) {
+        return false;
+    }
+    moveDirection = direction;
+    moveTakeup = takeup;
+    if (steps > 0) {
+        gearDirection = direction;
+    }
+    return true;
+}
+
+void StepperController::takeUpBacklash() {
+    Serial.println("StepperController::takeUpBacklash()");
+    if (backlashSteps == 0) {
+        gearDirection = 1;
+        return;
+    }
+    takeupMove = startMove(1, backlashSteps, backlashSteps);
 }
 
-void StepperController::rewind() {
+bool StepperController::rewind() {
     Serial.println("StepperController::rewind()");
-    if (stepper) {
-        stepper->move(-currentSteps);
-        while (stepper->distanceToGo() != 0) {
-            stepper->run();
-            yield(); // Allow other tasks to run
+    // Runs in the background on the step timer, loop() keeps going
+    return move(-getCurrentSteps());
+}
+
+bool StepperController::gotoAngle(float degrees) {
+    Serial.print("StepperController::gotoAngle(");
+    Serial.print(degrees);
+    Serial.println(")");
+    // Work in 1/revolutionDenominator step ticks so the target lands on the
+    // calibrated revolution, not the nominal one
+    int64_t revolutionTicks = (int64_t)revolutionNumerator;
+    int64_t target = llround(degrees / 360.0 * (double)revolutionNumerator) % revolutionTicks;
+    if (target < 0) {
+        target += revolutionTicks;
+    }
+    // Take the shorter way round
+    int64_t delta = target - getPositionTicks();
+    if (delta > revolutionTicks / 2) {
+        delta -= revolutionTicks;
+    } else if (delta < -revolutionTicks / 2) {
+        delta += revolutionTicks;
+    }
+    int64_t half = (int64_t)revolutionDenominator / 2;
+    int64_t steps = (delta + (delta < 0 ? -half : half)) / (int64_t)revolutionDenominator;
+    return move((long)steps);
+}
+
+void StepperController::cancelMove() {
+    Serial.println("StepperController::cancelMove()");
+    if (engine) {
+        engine->cancelMove();
+    }
+}
+
+bool StepperController::isMoving() {
+    // Serial.println("StepperController::isMoving()"); // Commented out - called frequently
+    return engine && engine->isMoving();
+}
+
+void StepperController::setMoveCallbacks(MoveProgressCallback progress, MoveCompleteCallback complete) {
+    Serial.println("StepperController::setMoveCallbacks()");
+    onMoveProgress = progress;
+    onMoveComplete = complete;
+}
+
+void StepperController::setTimeLocked(bool locked) {
+    Serial.print("StepperController::setTimeLocked(");
+    Serial.print(locked);
+    Serial.println(")");
+    timeLocked = locked;
+    timeLockAligned = false;
+    angleError = 0;
+}
+
+bool StepperController::isTimeLocked() {
+    // Serial.println("StepperController::isTimeLocked()");
+    return timeLocked;
+}
+
+void StepperController::setTimeSource(TimeSourceCallback source) {
+    Serial.println("StepperController::setTimeSource()");
+    timeSource = source;
+    timeLockAligned = false;
+}
+
+float StepperController::getAngleError() {
+    // Serial.println("StepperController::getAngleError()"); // Commented out - called frequently
+    return angleError;
+}
+
+void StepperController::updateTimeLock() {
+    // Serial.println("StepperController::updateTimeLock()"); // Commented out - called frequently
+    uint64_t utc = timeSource ? timeSource() : 0;
+    if (utc == 0 || !rotating || periodNumerator == 0) {
+        return;
+    }
+
+    // Where the dial should be: the fraction of the current period. Periods
+    // are rational, so time is in 1/periodDenominator us ticks: (utc * den)
+    // mod num, without forming utc * den. Steps per revolution are rational
+    // too, so the angle is in 1/revolutionDenominator step ticks.
+    uint64_t period = periodNumerator;
+    uint64_t intoPeriod = ((utc % period) * periodDenominator) % period;
+    uint64_t remainder = 0;
+    int64_t revolutionTicks = (int64_t)revolutionNumerator;
+    int64_t targetTicks = (int64_t)mulDiv(intoPeriod, revolutionNumerator, period, &remainder);
+
+    int64_t errorTicks = targetTicks - getPositionTicks();
+    if (errorTicks > revolutionTicks / 2) {
+        errorTicks -= revolutionTicks;
+    } else if (errorTicks <= -revolutionTicks / 2) {
+        errorTicks += revolutionTicks;
+    }
+    long error = (long)(errorTicks / (int64_t)revolutionDenominator);
+    double exact = (double)errorTicks + (double)remainder / (double)period;
+    angleError = (float)(exact * 360.0 / (double)revolutionNumerator);
+
+    if (engine->isMoving()) {
+        return; // Slew in progress
+    }
+
+    int64_t offset = (int64_t)(utc - engine->getTimeMicros());
+    if (timeLockAligned) {
+        int64_t slip = offset - timeLockOffset;
+        if (slip < 0) {
+            slip = -slip;
+        }
+        uint64_t quarterStep = period / periodDenominator * revolutionDenominator / revolutionNumerator / 4;
+        if (error > TIME_LOCK_TOLERANCE_STEPS || error < -TIME_LOCK_TOLERANCE_STEPS || (uint64_t)slip > quarterStep) {
+            timeLockAligned = false;
+        } else {
+            return;
         }
-        currentSteps = 0;
     }
+
+    if (error > TIME_LOCK_TOLERANCE_STEPS) {
+        // Behind: catch up at the planner's bounded slew speed, aiming where
+        // the time will be when the move ends since rotation pauses meanwhile
+        float stepsPerMicro = (float)revolutionNumerator * (float)periodDenominator
+            / ((float)revolutionDenominator * (float)period);
+        // Iterated to its fixed point: from a small error the first few
+        // passes fall well short and the move would land behind again
+        long steps = error;
+        for (int i = 0; i < 16; i++) {
+            long next = error + (long)(planner.estimateDurationMicros(steps) * stepsPerMicro);
+            if (next == steps) {
+                break;
+            }
+            steps = next;
+        }
+        if (steps > stepsPerRevolution / 2) {
+            steps = stepsPerRevolution / 2;
+        }
+        move(steps);
+        return;
+    }
+    if (error < -TIME_LOCK_TOLERANCE_STEPS) {
+        // Ahead: hold still until the time catches up with the dial
+        if (engine->isRunning()) {
+            engine->stop();
+        }
+        return;
+    }
+
+    // Close enough: schedule the dial's next step on its step boundary in
+    // UTC. A boundary already passed makes the engine catch up the last step
+    // or two; one still ahead makes it wait.
+    int64_t untilTicks = (int64_t)revolutionDenominator - errorTicks;
+    int64_t scaled = untilTicks * (int64_t)period - (int64_t)remainder;
+    int64_t boundary = scaled > 0 ? (scaled + revolutionTicks - 1) / revolutionTicks : scaled / revolutionTicks;
+    int64_t untilBoundary = boundary / (int64_t)periodDenominator;
+    engine->startAt(engine->getTimeMicros() + untilBoundary);
+    timeLockOffset = offset;
+    timeLockAligned = true;
 }
 
 float StepperController::getCurrentDegrees() {
     // Serial.println("StepperController::getCurrentDegrees()");
-    float result = (float)currentSteps * 360.0 / (float)stepsPerRevolution;
+    float result = (float)((double)getPositionTicks() * 360.0 / (double)revolutionNumerator);
     // Serial.print("StepperController::getCurrentDegrees() returning: ");
     // Serial.println(result);
     return result;
 }
 
+long StepperController::getCurrentSteps() {
+    // Serial.println("StepperController::getCurrentSteps()"); // Commented out - called frequently
+    if (!engine) {
+        return 0;
+    }
+    // Whole steps into the current revolution
+    return (long)(getPositionTicks() / (int64_t)revolutionDenominator);
+}
+
+int64_t StepperController::getPositionTicks() {
+    // Serial.println("StepperController::getPositionTicks()"); // Commented out - called frequently
+    if (!engine) {
+        return 0;
+    }
+    // Position into the current revolution in 1/revolutionDenominator steps
+    int64_t revolutionTicks = (int64_t)revolutionNumerator;
+    int64_t result = ((int64_t)engine->getPosition() * (int64_t)revolutionDenominator) % revolutionTicks;
+    if (result < 0) {
+        result += revolutionTicks;
+    }
+    return result;
+}
+
+int32_t StepperController::getPhaseError() {
+    // Serial.println("StepperController::getPhaseError()"); // Commented out - called frequently
+    return engine ? engine->getPhaseError() : 0;
+}
+
+uint32_t StepperController::getMaxPhaseError() {
+    // Serial.println("StepperController::getMaxPhaseError()"); // Commented out - called frequently
+    return engine ? engine->getMaxPhaseError() : 0;
+}
+
 bool StepperController::isRotating() {
     // Serial.println("StepperController::isRotating()");
     Serial.print("StepperController::isRotating() returning: ");
@@ -104,24 +689,48 @@ bool StepperController::isRotating() {
 
 void StepperController::calculateStepInterval() {
     // Serial.println("StepperController::calculateStepInterval()");
-    switch (currentSpeed) {
-        case ONCE_PER_MINUTE:
-            stepInterval = 60000.0 / stepsPerRevolution; // 1 minute in ms / steps
-            break;
-        case ONCE_PER_HOUR:
-            stepInterval = 3600000.0 / stepsPerRevolution; // 1 hour in ms / steps
-            break;
-        case ONCE_PER_DAY:
-            stepInterval = 86400000.0 / stepsPerRevolution; // 1 day in ms / steps
-            break;
+    timeLockAligned = false;
+    calculateRevolution();
+    if (currentSpeed == CUSTOM_PERIOD) {
+        periodNumerator = customNumerator;
+        periodDenominator = customDenominator;
+    } else {
+        const MotionProfileEntry& profile = getMotionProfile(stepMode, currentSpeed);
+        periodNumerator = profile.periodMicros;
+        periodDenominator = 1;
+    }
+    // The engine keeps period / steps as an exact fraction, so the
+    // 60000000 / 2048 = 29296.875us remainder is carried rather than dropped,
+    // and a fractional steps-per-revolution spreads its remainder evenly
+    // over the revolution
+    if (engine) {
+        engine->setStepPeriod(periodNumerator * revolutionDenominator, periodDenominator, revolutionNumerator);
     }
     Serial.print("StepperController::calculateStepInterval() set to: ");
-    Serial.println(stepInterval);
+    Serial.print((double)periodNumerator * (double)revolutionDenominator
+        / ((double)periodDenominator * (double)revolutionNumerator), 3);
+    Serial.println("us");
+}
+
+void StepperController::calculateRevolution() {
+    // Serial.println("StepperController::calculateRevolution()");
+    // Scale the calibrated full-step count to the step mode
+    uint64_t modeSteps = getStepsPerRevolution(stepMode);
+    uint64_t fullSteps = getStepsPerRevolution(FULL_STEP);
+    uint64_t numerator = gearNumerator * modeSteps;
+    uint64_t denominator = gearDenominator * fullSteps;
+    uint64_t divisor = greatestCommonDivisor(numerator, denominator);
+    revolutionNumerator = numerator / divisor;
+    revolutionDenominator = denominator / divisor;
+    stepsPerRevolution = (long)((revolutionNumerator + revolutionDenominator / 2) / revolutionDenominator);
+    backlashSteps = backlashFullSteps * (long)modeSteps / (long)fullSteps;
 }
 
 void StepperController::releaseCoils() {
-    if (stepper) {
-        stepper->disableOutputs();
+    if (stepOutput && stepTimer) {
+        stepTimer->lock();
+        stepOutput->release();
+        stepTimer->unlock();
     }
 }
 
@@ -2,41 +2,130 @@
 #define STEPPER_CONTROLLER_H
 
 #include <Arduino.h>
-#include <AccelStepper.h>
+#include "StepEngine.h"
+#include "StepTimer.h"
+#include "MovePlanner.h"
+#include "MotionProfile.h"
+#include "CoilSequencer.h"
+#include "CoilDriver.h"
+#include "IndexSensor.h"
+#include "Seqlock.h"
+#include "Telemetry.h"
 
-enum RotationSpeed {
-    ONCE_PER_MINUTE = 0,
-    ONCE_PER_HOUR = 1,
-    ONCE_PER_DAY = 2
-};
+// Step mode is fixed at build time unless changed with setStepMode()
+#ifndef STEPPER_STEP_MODE
+#define STEPPER_STEP_MODE HALF_STEP
+#endif
+
+typedef void (*MoveProgressCallback)(long stepsDone, long stepsTotal);
+typedef void (*MoveCompleteCallback)(bool completed);
+// UTC in microseconds since the Unix epoch, or 0 while the time is unknown
+typedef uint64_t (*TimeSourceCallback)();
+// Measured full steps per revolution as numerator / denominator
+typedef void (*CalibrationCompleteCallback)(bool success, uint64_t numerator, uint64_t denominator);
 
 class StepperController {
 public:
-    StepperController(uint8_t pin1 = 25, uint8_t pin2 = 26, uint8_t pin3 = 27, uint8_t pin4 = 14);
+    StepperController(uint8_t pin1 = 25, uint8_t pin2 = 26, uint8_t pin3 = 27, uint8_t pin4 = 14, StepTimer* timer = nullptr, CoilDriver* driver = nullptr);
     ~StepperController();
     
     void begin();
     void update();
     void setRotationSpeed(RotationSpeed speed);
+    // Any period as numerator / denominator microseconds, e.g. 86164090500 / 1
+    // for a sidereal day; selects CUSTOM_PERIOD
+    void setCustomPeriod(uint64_t numerator, uint64_t denominator);
+    void setStepMode(StepMode mode);
+    StepMode getStepMode();
+    // Gear calibration. Full steps per output revolution as an exact
+    // fraction (the 28BYJ-48 gearbox is 63.684:1, ~2037.886 rather than
+    // 2048) and the gear backlash in full steps, taken up whenever the
+    // drive direction reverses.
+    bool setStepsPerRevolution(uint64_t numerator, uint64_t denominator);
+    void setBacklash(long fullSteps);
+    // Index sensor for measuring the ratio; set before begin()
+    void setIndexSensor(IndexSensor* sensor);
+    // Count steps between index hits over the given number of revolutions;
+    // the result arrives through the calibration callback from update()
+    bool startCalibration(uint8_t revolutions);
+    bool isCalibrating();
+    void setCalibrationCallback(CalibrationCompleteCallback complete);
     void startRotation();
     void stopRotation();
-    void rewind();
+    bool move(long steps);
+    bool rewind();
+    bool gotoAngle(float degrees);
+    void cancelMove();
+    bool isMoving();
+    void setMoveCallbacks(MoveProgressCallback progress, MoveCompleteCallback complete);
+    // Time-locked mode: the dial angle follows the fraction of the current
+    // minute/hour/day in UTC instead of counting steps from boot
+    void setTimeLocked(bool locked);
+    bool isTimeLocked();
+    void setTimeSource(TimeSourceCallback source);
+    float getAngleError();
     float getCurrentDegrees();
+    long getCurrentSteps();
+    int32_t getPhaseError();
+    uint32_t getMaxPhaseError();
+    // Latest state published by update(); safe from any task, never blocks
+    // the control task
+    MotorTelemetry getTelemetry();
     bool isRotating();
     void releaseCoils();
     String getPins();
 
 private:
-    AccelStepper* stepper;
+    CoilDriver* coilDriver;
+    CoilSequencer* stepOutput;
+    StepTimer* stepTimer;
+    StepEngine* engine;
+    MovePlanner planner;
+    MoveProgressCallback onMoveProgress;
+    MoveCompleteCallback onMoveComplete;
+    long lastMoveProgress;
     RotationSpeed currentSpeed;
-    unsigned long lastStepTime;
-    long stepsPerRevolution;
-    long currentSteps;
+    StepMode stepMode;
+    long stepsPerRevolution; // nearest whole number, for display and limits
+    uint64_t gearNumerator;   // full steps per revolution is
+    uint64_t gearDenominator; // gearNumerator / gearDenominator
+    uint64_t revolutionNumerator;   // steps per revolution in the current
+    uint64_t revolutionDenominator; // step mode, reduced
+    long backlashFullSteps;
+    long backlashSteps; // in the current step mode
+    int8_t gearDirection; // direction the gear train was last driven
+    int8_t moveDirection;
+    long moveTakeup; // backlash steps at the start of the current move
+    bool takeupMove; // internal move restoring forward drive for the rotation
+    IndexSensor* indexSensor;
+    uint8_t calibrationRevolutions;
+    bool calibrating;
+    CalibrationCompleteCallback onCalibrationComplete;
+    long lastRevolution;
     bool rotating;
-    float stepInterval; // milliseconds between steps
+    uint64_t periodNumerator;   // one revolution is periodNumerator /
+    uint64_t periodDenominator; // periodDenominator microseconds
+    uint64_t customNumerator;
+    uint64_t customDenominator;
     uint8_t pin1, pin2, pin3, pin4; // GPIO pins for stepper motor
+    bool timeLocked;
+    bool timeLockAligned;
+    TimeSourceCallback timeSource;
+    int64_t timeLockOffset; // UTC minus engine time when the schedule was aligned
+    float angleError; // degrees, positive when the dial is behind
+    Seqlock<MotorTelemetry> telemetry;
+    uint64_t lastTelemetryAt;
+    uint64_t jitterSumSquares; // step records since the last publish
+    uint32_t jitterCount;
     
     void calculateStepInterval();
+    void calculateRevolution();
+    int64_t getPositionTicks();
+    bool startMove(int8_t direction, long steps, long takeup);
+    void takeUpBacklash();
+    void finishCalibration();
+    void updateTimeLock();
+    void publishTelemetry();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "TaskManager.h"
+#include "GPSManager.h"
+#include "TimeService.h"
+#include "BluetoothManager.h"
+#include "DisplayManager.h"
+#include "LogManager.h"
+#include "Ephemeris.h"
+#include "WarmStart.h"
+
+extern GPSManager* gpsManager;
+extern TimeService* timeService;
+extern BluetoothManager* bluetoothManager;
+extern DisplayManager* displayManager;
+extern LogManager* logManager;
+extern Ephemeris* ephemeris;
+extern WarmStart* warmStart;
+
+static const int8_t IO_TASK_CORE = 0;
+
+// The UART driver wakes the GPS task as bytes arrive; the timeout only
+// covers a missed event, the driver buffers half a second
+static const TickType_t GPS_WAIT_TICKS = pdMS_TO_TICKS(100);
+static const TickType_t BLUETOOTH_POLL_TICKS = pdMS_TO_TICKS(20);
+// One table day per tick while building, otherwise a look once a second
+static const TickType_t ALMANAC_IDLE_TICKS = pdMS_TO_TICKS(1000);
+
+static const char* TASK_NAMES[TASK_COUNT] = {"motor", "control", "gps", "bluetooth", "display", "log", "almanac"};
+
+TaskManager::TaskManager() {
+    Serial.println("TaskManager::TaskManager()");
+    motorTimer = nullptr;
+    lastSampleAt = 0;
+    for (int i = 0; i < TASK_COUNT; i++) {
+        handles[i] = nullptr;
+        busyMicros[i] = 0;
+        lastBusyMicros[i] = 0;
+        metrics[i].name = TASK_NAMES[i];
+        metrics[i].core = -1;
+        metrics[i].cpuPercent = 0;
+        metrics[i].stackFree = 0;
+    }
+}
+
+TaskManager::~TaskManager() {
+    Serial.println("TaskManager::~TaskManager()");
+    for (int i = GPS_TASK; i < TASK_COUNT; i++) {
+        if (handles[i]) {
+            vTaskDelete(handles[i]);
+        }
+    }
+}
+
+void TaskManager::begin(EspStepTimer* motorTimer) {
+    Serial.println("TaskManager::begin()");
+    this->motorTimer = motorTimer;
+    if (motorTimer) {
+        handles[MOTOR_TASK] = motorTimer->getTaskHandle();
+        metrics[MOTOR_TASK].core = MOTOR_TASK_CORE;
+    }
+    handles[CONTROL_TASK] = xTaskGetCurrentTaskHandle();
+    metrics[CONTROL_TASK].core = xPortGetCoreID();
+    lastSampleAt = (uint32_t)esp_timer_get_time();
+
+#ifdef BENCHMARK
+    // The benchmark suite calls into the managers from loop(), so their
+    // work stays inline there rather than racing a task on core 0
+    return;
+#endif
+
+    // Each manager switches to queued hand-off only once its task exists,
+    // until then (or if the task cannot start) it keeps working inline
+    startTask(GPS_TASK, &TaskManager::gpsTask, 4096, 3);
+    if (bluetoothManager->beginTaskQueue()) {
+        startTask(BLUETOOTH_TASK, &TaskManager::bluetoothTask, 4096, 2);
+    }
+    if (displayManager->beginTaskQueue()) {
+        startTask(DISPLAY_TASK, &TaskManager::displayTask, 4096, 1);
+    }
+    if (logManager->beginTaskQueue()) {
+        startTask(LOG_TASK, &TaskManager::logTask, 6144, 1);
+    }
+    // Idle priority: the table is only ever built in spare time
+    startTask(ALMANAC_TASK, &TaskManager::almanacTask, 4096, 0);
+}
+
+bool TaskManager::startTask(TaskId id, TaskFunction_t function, uint32_t stackSize, UBaseType_t priority) {
+    Serial.print("TaskManager::startTask(");
+    Serial.print(TASK_NAMES[id]);
+    Serial.println(")");
+    if (xTaskCreatePinnedToCore(function, TASK_NAMES[id], stackSize, this, priority, &handles[id], IO_TASK_CORE) != pdPASS) {
+        Serial.print("Failed to create task: ");
+        Serial.println(TASK_NAMES[id]);
+        handles[id] = nullptr;
+        return false;
+    }
+    metrics[id].core = IO_TASK_CORE;
+    return true;
+}
+
+bool TaskManager::isTaskRunning(TaskId id) {
+    // Serial.println("TaskManager::isTaskRunning()"); // Commented out - called frequently
+    return handles[id] != nullptr;
+}
+
+void TaskManager::addBusyTime(TaskId id, uint32_t micros) {
+    // Serial.println("TaskManager::addBusyTime()"); // Commented out - called frequently
+    // Each counter has a single writer, its own task
+    busyMicros[id] = busyMicros[id] + micros;
+}
+
+void TaskManager::sampleMetrics() {
+    Serial.println("TaskManager::sampleMetrics()");
+    uint32_t now = (uint32_t)esp_timer_get_time();
+    uint32_t window = now - lastSampleAt;
+    lastSampleAt = now;
+    if (motorTimer) {
+        busyMicros[MOTOR_TASK] = motorTimer->getBusyMicros();
+    }
+
+    for (int i = 0; i < TASK_COUNT; i++) {
+        uint32_t busy = busyMicros[i];
+        uint32_t delta = busy - lastBusyMicros[i];
+        lastBusyMicros[i] = busy;
+        metrics[i].cpuPercent = window > 0 ? 100.0f * (float)delta / (float)window : 0;
+        // On the ESP32 the high-water mark is in bytes, not words
+        metrics[i].stackFree = handles[i] ? uxTaskGetStackHighWaterMark(handles[i]) : 0;
+    }
+}
+
+TaskMetrics TaskManager::getMetrics(TaskId id) {
+    // Serial.println("TaskManager::getMetrics()");
+    return metrics[id];
+}
+
+String TaskManager::getMetricsText() {
+    Serial.println("TaskManager::getMetricsText()");
+    String result = "Tasks";
+    for (int i = 0; i < TASK_COUNT; i++) {
+        if (!handles[i]) {
+            continue;
+        }
+        result += " | " + String(metrics[i].name) + "@" + String(metrics[i].core)
+            + " " + String(metrics[i].cpuPercent, 1) + "% " + String(metrics[i].stackFree) + "B";
+    }
+    uint32_t dropped = logManager->getDroppedCount();
+    if (dropped > 0) {
+        result += " | log dropped " + String(dropped);
+    }
+    return result;
+}
+
+void TaskManager::gpsTask(void* arg) {
+    TaskManager* manager = static_cast<TaskManager*>(arg);
+    for (;;) {
+        gpsManager->waitForData(GPS_WAIT_TICKS);
+        uint32_t start = (uint32_t)esp_timer_get_time();
+        gpsManager->update();
+        timeService->update();
+        manager->addBusyTime(GPS_TASK, (uint32_t)esp_timer_get_time() - start);
+    }
+}
+
+void TaskManager::bluetoothTask(void* arg) {
+    TaskManager* manager = static_cast<TaskManager*>(arg);
+    for (;;) {
+        uint32_t start = (uint32_t)esp_timer_get_time();
+        bluetoothManager->pollLink();
+        manager->addBusyTime(BLUETOOTH_TASK, (uint32_t)esp_timer_get_time() - start);
+        vTaskDelay(BLUETOOTH_POLL_TICKS);
+    }
+}
+
+void TaskManager::displayTask(void* arg) {
+    TaskManager* manager = static_cast<TaskManager*>(arg);
+    for (;;) {
+        // Blocks until the control task posts new text
+        displayManager->waitForUpdate(portMAX_DELAY);
+        uint32_t start = (uint32_t)esp_timer_get_time();
+        displayManager->renderPending();
+        manager->addBusyTime(DISPLAY_TASK, (uint32_t)esp_timer_get_time() - start);
+    }
+}
+
+void TaskManager::logTask(void* arg) {
+    TaskManager* manager = static_cast<TaskManager*>(arg);
+    for (;;) {
+        logManager->waitForEntry(portMAX_DELAY);
+        uint32_t start = (uint32_t)esp_timer_get_time();
+        logManager->writePending();
+        manager->addBusyTime(LOG_TASK, (uint32_t)esp_timer_get_time() - start);
+    }
+}
+
+void TaskManager::almanacTask(void* arg) {
+    TaskManager* manager = static_cast<TaskManager*>(arg);
+    for (;;) {
+        uint32_t start = (uint32_t)esp_timer_get_time();
+        bool worked = ephemeris->buildAlmanacStep();
+        warmStart->writePending();
+        manager->addBusyTime(ALMANAC_TASK, (uint32_t)esp_timer_get_time() - start);
+        vTaskDelay(worked ? 1 : ALMANAC_IDLE_TICKS);
+    }
+}
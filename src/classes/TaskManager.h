@@ -0,0 +1,65 @@
+#ifndef TASK_MANAGER_H
+#define TASK_MANAGER_H
+
+#include <Arduino.h>
+#include "EspStepTimer.h"
+
+// Core 1 runs motion: the motor task (woken by the step timer) above the
+// Arduino loop, which is the control task (stepper update, menu, schedule).
+// Core 0 runs the I/O that used to stall the loop: GPS parsing, the
+// Bluetooth link, the blocking I2C display refresh and log flash writes.
+// Text and log lines cross cores through FreeRTOS queues; the GPS fix and
+// the motor state are published through Seqlock snapshots and the step
+// events through an SpscRing.
+enum TaskId {
+    MOTOR_TASK = 0,
+    CONTROL_TASK,
+    GPS_TASK,
+    BLUETOOTH_TASK,
+    DISPLAY_TASK,
+    LOG_TASK,
+    ALMANAC_TASK,
+    TASK_COUNT
+};
+
+static const int8_t MOTOR_TASK_CORE = 1;
+static const UBaseType_t MOTOR_TASK_PRIORITY = 20;
+
+struct TaskMetrics {
+    const char* name;
+    int8_t core;
+    float cpuPercent;   // busy time over the last sample window
+    uint32_t stackFree; // bytes of stack never touched (high-water mark)
+};
+
+class TaskManager {
+public:
+    TaskManager();
+    ~TaskManager();
+
+    // Call from setup(): registers the motor task and the calling (loop)
+    // task, then starts the core 0 I/O tasks
+    void begin(EspStepTimer* motorTimer);
+    bool isTaskRunning(TaskId id);
+    void addBusyTime(TaskId id, uint32_t micros);
+    void sampleMetrics();
+    TaskMetrics getMetrics(TaskId id);
+    String getMetricsText();
+
+private:
+    EspStepTimer* motorTimer;
+    TaskHandle_t handles[TASK_COUNT];
+    volatile uint32_t busyMicros[TASK_COUNT]; // wraps, read as differences
+    uint32_t lastBusyMicros[TASK_COUNT];
+    uint32_t lastSampleAt;
+    TaskMetrics metrics[TASK_COUNT];
+
+    bool startTask(TaskId id, TaskFunction_t function, uint32_t stackSize, UBaseType_t priority);
+    static void gpsTask(void* arg);
+    static void bluetoothTask(void* arg);
+    static void displayTask(void* arg);
+    static void logTask(void* arg);
+    static void almanacTask(void* arg);
+};
+
+#endif
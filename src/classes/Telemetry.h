@@ -0,0 +1,74 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+// State published by the producer tasks for lock-free readers on either
+// core (see Seqlock.h and SpscRing.h). Plain data only.
+
+// One rotation step, pushed by the motor task
+struct StepRecord {
+    uint32_t atMicros;  // low 32 bits of the step time
+    int32_t position;   // engine position after the step
+    int32_t phaseError; // microseconds late (+) against the ideal time
+};
+
+// Published by the control task from StepperController::update()
+struct MotorTelemetry {
+    float degrees;
+    int32_t steps;           // within the current revolution
+    float angleError;        // time-locked mode, degrees behind
+    int32_t phaseError;      // last step, microseconds
+    uint32_t maxPhaseError;  // since the last reset, microseconds
+    uint32_t jitterRms;      // over the last publish window, microseconds
+    uint32_t droppedRecords; // step records lost to a full ring
+    uint8_t speed;           // RotationSpeed
+    bool rotating;
+    bool moving;
+    bool timeLocked;
+    bool calibrating;
+};
+
+// Published by the GPS task after each complete NMEA sentence or UBX
+// navigation epoch. Built once per update, so every field comes from the
+// same parser state.
+struct GpsFix {
+    uint32_t sequence;  // 1 for the first update, then one more per update
+    uint32_t updatedAt; // millis() of the update
+    uint32_t unixTime;  // UTC seconds, 0 until the date and time are valid
+    bool locationValid;
+    bool dateValid;
+    bool timeValid;
+    uint8_t satellites; // in use, 0 when unknown
+    float latitude;
+    float longitude;
+    float altitude;
+    float hdop;          // 0 when unknown
+    uint32_t positionAge; // ms the position predates the update
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint16_t millisecond; // of the epoch, 0 when the receiver sends none
+    bool clockDriftValid;
+    int32_t clockDrift;   // receiver oscillator, ns/s from NAV-CLOCK (UBX only)
+};
+
+// Published by the GPS task from TimeService::update(). UTC at a local
+// esp_timer instant t is utcMicros + (t - localMicros), less driftPpb
+// parts per billion of that.
+struct TimeStatus {
+    uint8_t state;        // TimeService::State
+    bool driftValid;
+    int64_t localMicros;  // esp_timer_get_time() at the anchor, a PPS edge when locked
+    uint64_t utcMicros;   // since 1970
+    int32_t driftPpb;     // the crystal runs fast by this much
+    int32_t lastOffset;   // us the clock was off at the last edge, before it was corrected
+    uint32_t pulses;      // PPS edges taken
+    uint32_t rejected;    // edges not a whole number of seconds after the last
+    uint32_t realigned;   // times a fix moved the edge to another second
+};
+
+#endif
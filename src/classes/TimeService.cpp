@@ -0,0 +1,294 @@
+#include "TimeService.h"
+#include <TimeLib.h>
+#include <sys/time.h>
+
+// Two edges missed: the receiver has stopped pulsing
+static const int64_t PPS_TIMEOUT_US = 2500000;
+// Crystal error measured between edges this many seconds apart
+static const uint64_t DRIFT_SPAN_SECONDS = 16;
+// Beyond this an old edge is no use as the start of a measurement
+static const uint64_t MAX_DRIFT_SPAN_SECONDS = 3600;
+// An edge must be a whole number of seconds after the last, within the
+// crystal's tolerance (ESP32 modules are specified to 10 ppm) plus
+// interrupt latency
+static const int64_t MAX_DRIFT_PPM = 200;
+static const int64_t EDGE_JITTER_US = 50;
+// Edges that do not fit in a row before the lock is thought wrong
+static const uint8_t MAX_REJECTED_IN_ROW = 3;
+// A fix is taken to belong to the second of the edge before it if it
+// arrives less than this late
+static const int64_t FIX_LATENCY_LIMIT_MS = 900;
+// Message latency varies by tens of ms; only a larger step moves a
+// clock set from fixes alone
+static const int64_t COARSE_TOLERANCE_US = 250000;
+// Holdover keeps its own time unless a fix disagrees by more than this
+static const int64_t HOLDOVER_LIMIT_US = 1000000;
+// The RTC is put back on a locked clock this often; it is what the next
+// boot starts from, and the warm start's AID-INI time
+static const uint64_t RTC_SET_INTERVAL_US = 60000000;
+
+TimeService::TimeService(GPSManager* gpsManager, uint8_t ppsPin) {
+    Serial.println("TimeService::TimeService()");
+    this->gpsManager = gpsManager;
+    this->ppsPin = ppsPin;
+    mux = portMUX_INITIALIZER_UNLOCKED;
+    pulseAt = 0;
+    pulseCount = 0;
+    memset(&status, 0, sizeof(status));
+    lastPulseCount = 0;
+    lastEdge = 0;
+    lastSecond = 0;
+    edgeLabelled = false;
+    edgeChecked = false;
+    baseEdge = 0;
+    baseSecond = 0;
+    rejectedInRow = 0;
+    lastFixSequence = 0;
+    timezoneSeconds = 0;
+    rtcSetAt = 0;
+}
+
+TimeService::~TimeService() {
+    Serial.println("TimeService::~TimeService()");
+    detachInterrupt(digitalPinToInterrupt(ppsPin));
+}
+
+void TimeService::setDrift(int32_t driftPpb) {
+    Serial.println("TimeService::setDrift()");
+    status.driftPpb = driftPpb;
+    status.driftValid = true;
+}
+
+void TimeService::begin() {
+    Serial.println("TimeService::begin()");
+    // GPIO35 is input only; the NEO-6M drives PPS push-pull
+    pinMode(ppsPin, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(ppsPin), &TimeService::onPulse, this, RISING);
+#ifndef SIMULATOR
+    // The RTC keeps counting through a warm reset, so there is a clock
+    // before the GPS is back
+    struct timeval rtc;
+    gettimeofday(&rtc, nullptr);
+    if (rtc.tv_sec > 1577836800) { // set, not just counting from 1970
+        anchor(esp_timer_get_time(), (uint64_t)rtc.tv_sec * 1000000ULL + rtc.tv_usec, COARSE);
+    }
+#endif
+}
+
+void IRAM_ATTR TimeService::onPulse(void* arg) {
+    TimeService* service = static_cast<TimeService*>(arg);
+    int64_t at = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&service->mux);
+    service->pulseAt = at;
+    service->pulseCount = service->pulseCount + 1;
+    portEXIT_CRITICAL_ISR(&service->mux);
+}
+
+void TimeService::update() {
+    // Serial.println("TimeService::update()"); // Commented out - called frequently
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&mux);
+    uint32_t count = pulseCount;
+    int64_t at = pulseAt;
+    portEXIT_CRITICAL(&mux);
+    // Only the latest edge is kept; one missed in between changes nothing
+    if (count != lastPulseCount) {
+        lastPulseCount = count;
+        takeEdge(at);
+    }
+
+    uint32_t sequence = gpsManager->getFixSequence();
+    if (sequence != lastFixSequence) {
+        lastFixSequence = sequence;
+        checkFix(gpsManager->getFix(), now);
+    }
+
+    if (status.state == LOCKED && now - lastEdge > PPS_TIMEOUT_US) {
+        Serial.println("TimeService::update() - PPS lost, holdover");
+        status.state = HOLDOVER;
+        published.publish(status);
+    }
+}
+
+void TimeService::takeEdge(int64_t edge) {
+    // Serial.println("TimeService::takeEdge()"); // Commented out - called frequently
+    if (status.state == LOCKED || status.state == HOLDOVER) {
+        // The clock is good to far better than half a second: the nearest
+        // whole second; the next fix confirms it
+        uint64_t predicted = predict(status, edge);
+        acceptEdge(edge, (predicted + 500000) / 1000000);
+        return;
+    }
+    // Held for the next fix to say which second it began
+    lastEdge = edge;
+    edgeLabelled = false;
+    edgeChecked = false;
+}
+
+void TimeService::acceptEdge(int64_t edge, uint64_t second) {
+    // Serial.println("TimeService::acceptEdge()"); // Commented out - called frequently
+    if (baseEdge != 0 && (second <= baseSecond || second - baseSecond > MAX_DRIFT_SPAN_SECONDS)) {
+        baseEdge = 0;
+    }
+    if (baseEdge != 0) {
+        int64_t span = (int64_t)(second - baseSecond);
+        int64_t error = edge - baseEdge - span * 1000000; // us the crystal gained
+        int64_t tolerance = span * MAX_DRIFT_PPM + EDGE_JITTER_US;
+        if (error > tolerance || error < -tolerance) {
+            // Noise on the line, or the lock was on a wrong edge
+            status.rejected++;
+            if (++rejectedInRow >= MAX_REJECTED_IN_ROW) {
+                Serial.println("TimeService::acceptEdge() - edges do not fit, relocking");
+                baseEdge = 0;
+                status.state = COARSE;
+                lastEdge = edge;
+                edgeLabelled = false;
+                edgeChecked = false;
+            }
+            published.publish(status);
+            return;
+        }
+        if (span >= (int64_t)DRIFT_SPAN_SECONDS) {
+            // us per s is ppm; smoothed over four spans
+            int32_t measured = (int32_t)(error * 1000 / span);
+            status.driftPpb = status.driftValid ? status.driftPpb + (measured - status.driftPpb) / 4 : measured;
+            status.driftValid = true;
+            baseEdge = 0;
+        }
+    }
+    if (baseEdge == 0) {
+        baseEdge = edge;
+        baseSecond = second;
+    }
+    rejectedInRow = 0;
+
+    uint64_t utc = second * 1000000ULL;
+    if (status.state != UNSET) {
+        int64_t offset = (int64_t)(predict(status, edge) - utc);
+        status.lastOffset = (int32_t)constrain(offset, (int64_t)INT32_MIN, (int64_t)INT32_MAX);
+    }
+    if (status.state != LOCKED) {
+        Serial.println("TimeService::acceptEdge() - PPS locked");
+    }
+    status.pulses++;
+    lastEdge = edge;
+    lastSecond = second;
+    edgeLabelled = true;
+    edgeChecked = false;
+    anchor(edge, utc, LOCKED);
+}
+
+void TimeService::checkFix(const GpsFix& fix, int64_t now) {
+    // Serial.println("TimeService::checkFix()"); // Commented out - called frequently
+    if (!fix.dateValid || !fix.timeValid || fix.unixTime == 0) {
+        return;
+    }
+    int64_t epochMs = (int64_t)fix.unixTime * 1000 + fix.millisecond;
+    int64_t received = now - (int64_t)(uint32_t)(millis() - fix.updatedAt) * 1000;
+    bool pulsing = lastEdge != 0 && now - lastEdge < PPS_TIMEOUT_US;
+
+    if (pulsing) {
+        if (edgeChecked || received < lastEdge || received - lastEdge >= 1000000) {
+            return;
+        }
+        // Received sinceEdge after the edge, the fix's epoch is that much
+        // after the edge's second less the message latency; whichever
+        // epoch of a 5 Hz stream it is, the edge's second is the epoch
+        // less sinceEdge, rounded up over the latency
+        int64_t sinceEdge = (received - lastEdge) / 1000;
+        uint64_t second = (uint64_t)((epochMs - sinceEdge + FIX_LATENCY_LIMIT_MS) / 1000);
+        if (!edgeLabelled) {
+            acceptEdge(lastEdge, second);
+        } else if (second != lastSecond) {
+            Serial.println("TimeService::checkFix() - edge was labelled with the wrong second, realigned");
+            status.realigned++;
+            baseEdge = 0;
+            lastSecond = second;
+            anchor(lastEdge, second * 1000000ULL, LOCKED);
+        }
+        edgeChecked = edgeLabelled;
+        return;
+    }
+
+    // No pulses: the fix itself, late by the message latency
+    uint64_t utc = (uint64_t)epochMs * 1000;
+    int64_t error = status.state == UNSET ? 0 : (int64_t)(predict(status, received) - utc);
+    if (error < 0) {
+        error = -error;
+    }
+    if (status.state == UNSET || (status.state == COARSE && error > COARSE_TOLERANCE_US)) {
+        anchor(received, utc, COARSE);
+    } else if (status.state == HOLDOVER && error > HOLDOVER_LIMIT_US) {
+        Serial.println("TimeService::checkFix() - holdover drifted too far, back to GPS messages");
+        anchor(received, utc, COARSE);
+    }
+}
+
+void TimeService::anchor(int64_t local, uint64_t utcMicros, State state) {
+    status.localMicros = local;
+    status.utcMicros = utcMicros;
+    status.state = state;
+    published.publish(status);
+}
+
+uint64_t TimeService::predict(const TimeStatus& status, int64_t local) {
+    int64_t elapsed = local - status.localMicros;
+    int64_t correction = status.driftValid ? elapsed * status.driftPpb / 1000000000 : 0;
+    return status.utcMicros + elapsed - correction;
+}
+
+void TimeService::syncClock(int timezoneOffset) {
+    // Serial.println("TimeService::syncClock()"); // Commented out - called frequently
+    timezoneSeconds = timezoneOffset * 3600;
+    TimeStatus current = published.read();
+    if (current.state == UNSET) {
+        return;
+    }
+    uint64_t utc = predict(current, esp_timer_get_time());
+    // setTime() starts TimeLib's second now, so called every loop pass it
+    // follows this clock's seconds to within a pass
+    time_t local = (time_t)(utc / 1000000) + timezoneOffset * 3600;
+    if (local != now()) {
+        setTime(local);
+    }
+#ifndef SIMULATOR
+    // Set once at the first fix, the RTC would carry the crystal's error
+    // into the next boot; on the PPS clock it is kept within a minute's
+    // corrected drift
+    bool disciplined = current.state == LOCKED || current.state == HOLDOVER;
+    if (disciplined && (rtcSetAt == 0 || utc - rtcSetAt >= RTC_SET_INTERVAL_US)) {
+        struct timeval rtc = {(time_t)(utc / 1000000), (suseconds_t)(utc % 1000000)};
+        settimeofday(&rtc, nullptr);
+        rtcSetAt = utc;
+    }
+#endif
+}
+
+uint64_t TimeService::getUtcMicros() {
+    // Serial.println("TimeService::getUtcMicros()"); // Commented out - called frequently
+    TimeStatus current = published.read();
+    if (current.state == UNSET) {
+        return 0;
+    }
+    return predict(current, esp_timer_get_time());
+}
+
+uint64_t TimeService::getLocalMicros() {
+    // Serial.println("TimeService::getLocalMicros()"); // Commented out - called frequently
+    uint64_t utc = getUtcMicros();
+    return utc == 0 ? 0 : utc + (int64_t)timezoneSeconds * 1000000;
+}
+
+TimeStatus TimeService::getStatus() {
+    return published.read();
+}
+
+const char* TimeService::getStateName(uint8_t state) {
+    switch (state) {
+        case COARSE: return "GPS messages";
+        case LOCKED: return "PPS locked";
+        case HOLDOVER: return "holdover";
+        default: return "not set";
+    }
+}
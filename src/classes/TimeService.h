@@ -0,0 +1,85 @@
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "GPSManager.h"
+#include "Seqlock.h"
+#include "Telemetry.h"
+
+// UTC for the firmware, disciplined by the NEO-6M's PPS output. The rising
+// edge marks the start of each UTC second to within a microsecond; an
+// interrupt takes esp_timer_get_time() there, and the fix that follows
+// says which second it was. Between edges time runs on the ESP32 crystal,
+// corrected by its frequency error as measured over 16 s of edges.
+//
+// Without pulses (no fix yet, PPS not wired) time comes from the fixes
+// themselves, late by however long the message took (COARSE). When pulses
+// stop after a lock it keeps the last edge and the measured error
+// (HOLDOVER), so a GPS outage costs microseconds per minute, not the
+// crystal's raw tens of ppm.
+class TimeService {
+public:
+    enum State {
+        UNSET = 0,
+        COARSE,
+        LOCKED,
+        HOLDOVER
+    };
+
+    TimeService(GPSManager* gpsManager, uint8_t ppsPin = 35);
+    ~TimeService();
+
+    // Before begin(): the crystal error measured before a reset, used
+    // until edges measure it again
+    void setDrift(int32_t driftPpb);
+    void begin();
+    // GPS task, after GPSManager::update(): takes the latest edge and fix
+    void update();
+    // Control task: keeps TimeLib (display, schedule, almanac) on this
+    // clock, in local time at timezoneOffset hours, and the RTC on it
+    // once PPS has locked
+    void syncClock(int timezoneOffset);
+
+    // Microseconds since 1970, 0 until set; lock-free, any task below the
+    // GPS task's priority on core 0
+    uint64_t getUtcMicros();
+    // The same with the offset last given to syncClock()
+    uint64_t getLocalMicros();
+    TimeStatus getStatus();
+    static const char* getStateName(uint8_t state);
+
+private:
+    GPSManager* gpsManager;
+    uint8_t ppsPin;
+
+    // Written by the interrupt
+    portMUX_TYPE mux;
+    volatile int64_t pulseAt;
+    volatile uint32_t pulseCount;
+
+    // GPS task only
+    TimeStatus status;
+    uint32_t lastPulseCount;
+    int64_t lastEdge;       // local us of the last edge taken, 0 before one
+    uint64_t lastSecond;    // its UTC second, when labelled
+    bool edgeLabelled;      // lastSecond holds
+    bool edgeChecked;       // a fix after the edge has confirmed lastSecond
+    int64_t baseEdge;       // start of the drift measurement, 0 when none
+    uint64_t baseSecond;
+    uint8_t rejectedInRow;
+    uint32_t lastFixSequence;
+
+    Seqlock<TimeStatus> published;
+    std::atomic<int32_t> timezoneSeconds;
+    uint64_t rtcSetAt;      // control task: UTC us the RTC was last set, 0 before
+
+    static void onPulse(void* arg);
+    void takeEdge(int64_t edge);
+    void acceptEdge(int64_t edge, uint64_t second);
+    void checkFix(const GpsFix& fix, int64_t now);
+    void anchor(int64_t local, uint64_t utcMicros, State state);
+    static uint64_t predict(const TimeStatus& status, int64_t local);
+};
+
+#endif
@@ -0,0 +1,91 @@
+#include "Ubx.h"
+#include <string.h>
+
+void Ubx::checksum(const uint8_t* data, size_t length, uint8_t* a, uint8_t* b) {
+    uint8_t sumA = 0;
+    uint8_t sumB = 0;
+    for (size_t i = 0; i < length; i++) {
+        sumA += data[i];
+        sumB += sumA;
+    }
+    *a = sumA;
+    *b = sumB;
+}
+
+size_t Ubx::encode(uint8_t messageClass, uint8_t id, const uint8_t* payload, uint16_t length,
+                   uint8_t* out, size_t size) {
+    size_t total = FRAME_OVERHEAD + length;
+    if (size < total) {
+        return 0;
+    }
+    out[0] = SYNC_1;
+    out[1] = SYNC_2;
+    out[2] = messageClass;
+    out[3] = id;
+    putU16(out + 4, length);
+    if (length > 0) {
+        memcpy(out + 6, payload, length);
+    }
+    checksum(out + 2, 4 + length, &out[6 + length], &out[7 + length]);
+    return total;
+}
+
+size_t Ubx::encodeConfigPort(uint32_t baud, uint8_t* out, size_t size) {
+    uint8_t payload[20] = {};
+    payload[0] = 1;                  // port: UART1
+    putU32(payload + 4, 0x000008D0); // mode: 8 data bits, no parity, 1 stop bit
+    putU32(payload + 8, baud);
+    putU16(payload + 12, 0x0003);    // in: UBX, NMEA
+    putU16(payload + 14, 0x0003);    // out: UBX, NMEA
+    return encode(CLASS_CFG, CFG_PRT, payload, sizeof(payload), out, size);
+}
+
+size_t Ubx::encodeConfigRate(uint16_t periodMs, uint8_t* out, size_t size) {
+    uint8_t payload[6];
+    putU16(payload, periodMs);
+    putU16(payload + 2, 1); // navigation rate, in measurements
+    putU16(payload + 4, 1); // time reference: GPS time
+    return encode(CLASS_CFG, CFG_RATE, payload, sizeof(payload), out, size);
+}
+
+size_t Ubx::encodeConfigMessage(uint8_t messageClass, uint8_t id, uint8_t rate, uint8_t* out, size_t size) {
+    uint8_t payload[3] = {messageClass, id, rate};
+    return encode(CLASS_CFG, CFG_MSG, payload, sizeof(payload), out, size);
+}
+
+size_t Ubx::encodeAidInit(const AidInit& aid, uint8_t* out, size_t size) {
+    uint8_t payload[48] = {};
+    uint32_t flags = 0;
+    if (aid.positionValid) {
+        putU32(payload, (uint32_t)aid.latitude);
+        putU32(payload + 4, (uint32_t)aid.longitude);
+        putU32(payload + 8, (uint32_t)aid.altitude);
+        putU32(payload + 12, aid.positionAccuracy);
+        flags |= 0x01 | 0x20; // position valid, as latitude, longitude, altitude
+    }
+    if (aid.timeValid) {
+        putU16(payload + 18, aid.week);
+        putU32(payload + 20, aid.timeOfWeek);
+        putU32(payload + 28, aid.timeAccuracy);
+        flags |= 0x02; // time valid, GPS week and time of week
+    }
+    if (aid.clockDriftValid) {
+        putU32(payload + 36, (uint32_t)aid.clockDrift);
+        putU32(payload + 40, aid.clockDriftAccuracy);
+        flags |= 0x04; // clock drift valid
+    }
+    putU32(payload + 44, flags);
+    return encode(CLASS_AID, AID_INI, payload, sizeof(payload), out, size);
+}
+
+void Ubx::putU16(uint8_t* out, uint16_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+}
+
+void Ubx::putU32(uint8_t* out, uint32_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)(value >> 16);
+    out[3] = (uint8_t)(value >> 24);
+}
@@ -0,0 +1,83 @@
+#ifndef UBX_H
+#define UBX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Messages of the u-blox binary protocol (u-blox 6 Receiver Description,
+// GPS.G6-SW-10018). A frame is 0xB5 0x62, class, id, payload length
+// (little-endian), the payload and two checksum bytes: the 8-bit Fletcher
+// sum over class, id, length and payload.
+class Ubx {
+public:
+    static const uint8_t SYNC_1 = 0xB5;
+    static const uint8_t SYNC_2 = 0x62;
+    static const size_t FRAME_OVERHEAD = 8; // sync, class, id, length, checksum
+
+    static const uint8_t CLASS_NAV = 0x01;
+    static const uint8_t CLASS_ACK = 0x05;
+    static const uint8_t CLASS_CFG = 0x06;
+    static const uint8_t CLASS_AID = 0x0B;
+    static const uint8_t CLASS_NMEA = 0xF0;
+
+    static const uint8_t NAV_POSLLH = 0x02;
+    static const uint8_t NAV_DOP = 0x04;
+    static const uint8_t NAV_SOL = 0x06;
+    static const uint8_t NAV_TIMEUTC = 0x21;
+    static const uint8_t NAV_CLOCK = 0x22;
+    static const uint8_t ACK_NAK = 0x00;
+    static const uint8_t ACK_ACK = 0x01;
+    static const uint8_t CFG_PRT = 0x00;
+    static const uint8_t CFG_MSG = 0x01;
+    static const uint8_t CFG_RATE = 0x08;
+    static const uint8_t AID_INI = 0x01;
+
+    // Standard NMEA sentences, as message ids in CLASS_NMEA
+    static const uint8_t NMEA_GGA = 0x00;
+    static const uint8_t NMEA_GLL = 0x01;
+    static const uint8_t NMEA_GSA = 0x02;
+    static const uint8_t NMEA_GSV = 0x03;
+    static const uint8_t NMEA_RMC = 0x04;
+    static const uint8_t NMEA_VTG = 0x05;
+
+    // Largest frame the encoders below produce (AID-INI)
+    static const size_t MAX_CONFIG_FRAME = FRAME_OVERHEAD + 48;
+
+    // What the receiver is told at startup to search less for its first
+    // fix; each part is sent only if valid
+    struct AidInit {
+        bool positionValid;
+        int32_t latitude;           // 1e-7 degrees
+        int32_t longitude;
+        int32_t altitude;           // cm above mean sea level
+        uint32_t positionAccuracy;  // cm
+        bool timeValid;
+        uint16_t week;              // GPS time
+        uint32_t timeOfWeek;        // ms
+        uint32_t timeAccuracy;      // ms
+        bool clockDriftValid;
+        int32_t clockDrift;         // receiver oscillator, ns/s
+        uint32_t clockDriftAccuracy;
+    };
+
+    static void checksum(const uint8_t* data, size_t length, uint8_t* a, uint8_t* b);
+
+    // Whole frame into out; bytes written, 0 if it does not fit
+    static size_t encode(uint8_t messageClass, uint8_t id, const uint8_t* payload, uint16_t length,
+                         uint8_t* out, size_t size);
+    // UART1 at baud, 8N1, UBX and NMEA in both directions
+    static size_t encodeConfigPort(uint32_t baud, uint8_t* out, size_t size);
+    // One measurement per periodMs, navigation solution every measurement
+    static size_t encodeConfigRate(uint16_t periodMs, uint8_t* out, size_t size);
+    // Output rate of a message on the port that receives this, per
+    // navigation solution; 0 turns it off
+    static size_t encodeConfigMessage(uint8_t messageClass, uint8_t id, uint8_t rate, uint8_t* out, size_t size);
+    // Position as latitude, longitude and altitude; not acknowledged
+    static size_t encodeAidInit(const AidInit& aid, uint8_t* out, size_t size);
+
+private:
+    static void putU16(uint8_t* out, uint16_t value);
+    static void putU32(uint8_t* out, uint32_t value);
+};
+
+#endif
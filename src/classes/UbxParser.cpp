@@ -0,0 +1,137 @@
+#include "UbxParser.h"
+#include <string.h>
+
+UbxParser::UbxParser() {
+    reset();
+}
+
+void UbxParser::reset() {
+    partialLength = 0;
+    frames = 0;
+    checksumErrors = 0;
+    skippedBytes = 0;
+}
+
+uint32_t UbxParser::getFrames() {
+    return frames;
+}
+
+uint32_t UbxParser::getChecksumErrors() {
+    return checksumErrors;
+}
+
+uint32_t UbxParser::getSkippedBytes() {
+    return skippedBytes;
+}
+
+size_t UbxParser::frameSize(const uint8_t* data, size_t available) {
+    if (available >= 2 && data[1] != Ubx::SYNC_2) {
+        return 0;
+    }
+    if (available < 6) {
+        return SIZE_MAX;
+    }
+    uint16_t length = readU16(data + 4);
+    return length <= MAX_PAYLOAD ? Ubx::FRAME_OVERHEAD + length : 0;
+}
+
+void UbxParser::skipPartial() {
+    const uint8_t* next = (const uint8_t*)memchr(partial + 1, Ubx::SYNC_1, partialLength - 1);
+    size_t drop = next ? (size_t)(next - partial) : partialLength;
+    skippedBytes += drop;
+    partialLength -= drop;
+    memmove(partial, partial + drop, partialLength);
+}
+
+bool UbxParser::deliver(const uint8_t* frame, size_t size, Handler handler, void* context) {
+    uint8_t a, b;
+    Ubx::checksum(frame + 2, size - 4, &a, &b);
+    if (a != frame[size - 2] || b != frame[size - 1]) {
+        checksumErrors++;
+        return false;
+    }
+    frames++;
+    Message message;
+    message.messageClass = frame[2];
+    message.id = frame[3];
+    message.length = (uint16_t)(size - Ubx::FRAME_OVERHEAD);
+    message.payload = frame + 6;
+    handler(message, context);
+    return true;
+}
+
+size_t UbxParser::parse(const uint8_t* data, size_t length, Handler handler, void* context) {
+    size_t delivered = 0;
+    size_t offset = 0;
+
+    // Complete the frame cut off by the last read; partial starts with a
+    // sync byte, and its last taken bytes are from this read
+    size_t taken = 0;
+    while (partialLength > 0) {
+        size_t size = frameSize(partial, partialLength);
+        if (size == 0) {
+            // Not a frame after all: give back this read's bytes and
+            // resume at the next sync byte in the rest
+            partialLength -= taken;
+            offset -= taken;
+            taken = 0;
+            skipPartial();
+            continue;
+        }
+        if (size == SIZE_MAX || size > partialLength) {
+            if (offset == length) {
+                break;
+            }
+            size_t wanted = (size == SIZE_MAX ? 6 : size) - partialLength;
+            size_t take = wanted < length - offset ? wanted : length - offset;
+            memcpy(partial + partialLength, data + offset, take);
+            partialLength += take;
+            offset += take;
+            taken += take;
+            continue;
+        }
+        if (deliver(partial, size, handler, context)) {
+            delivered++;
+            partialLength -= size;
+            memmove(partial, partial + size, partialLength);
+        } else {
+            // A sync pair inside other data, maybe with a real frame after
+            // it: give back this read's bytes and look again from the next
+            partialLength -= taken;
+            offset -= taken;
+            skipPartial();
+        }
+        taken = 0;
+    }
+
+    while (offset < length) {
+        const uint8_t* start = (const uint8_t*)memchr(data + offset, Ubx::SYNC_1, length - offset);
+        if (!start) {
+            skippedBytes += length - offset;
+            break;
+        }
+        skippedBytes += (size_t)(start - (data + offset));
+        offset = (size_t)(start - data);
+        size_t available = length - offset;
+        size_t size = frameSize(start, available);
+        if (size == 0) {
+            skippedBytes++;
+            offset++;
+            continue;
+        }
+        if (size == SIZE_MAX || size > available) {
+            memcpy(partial, start, available);
+            partialLength = available;
+            break;
+        }
+        if (deliver(start, size, handler, context)) {
+            delivered++;
+            offset += size;
+        } else {
+            // A sync pair inside other data; look again from the next byte
+            skippedBytes++;
+            offset++;
+        }
+    }
+    return delivered;
+}
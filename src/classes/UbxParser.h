@@ -0,0 +1,65 @@
+#ifndef UBX_PARSER_H
+#define UBX_PARSER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Ubx.h"
+
+// Finds UBX frames in received bytes and hands each one with a valid
+// checksum to a handler, payload in place: a frame that lies wholly within
+// the buffer is never copied. Only a frame cut off at the end of a read is
+// kept (at most MAX_PAYLOAD bytes of payload) and completed from the next.
+// Anything between frames, such as NMEA text, is skipped.
+//
+// Fields are read from the payload with the little-endian readers below;
+// nothing is converted from text.
+class UbxParser {
+public:
+    // NAV-SOL, the largest message the firmware decodes, is 52 bytes
+    static const uint16_t MAX_PAYLOAD = 64;
+
+    struct Message {
+        uint8_t messageClass;
+        uint8_t id;
+        uint16_t length;
+        const uint8_t* payload; // valid during the handler call only
+    };
+
+    typedef void (*Handler)(const Message& message, void* context);
+
+    UbxParser();
+
+    // Messages handed to handler
+    size_t parse(const uint8_t* data, size_t length, Handler handler, void* context);
+    void reset();
+
+    uint32_t getFrames();
+    uint32_t getChecksumErrors();
+    uint32_t getSkippedBytes(); // not part of a frame that fits MAX_PAYLOAD
+
+    static uint16_t readU16(const uint8_t* data) {
+        return (uint16_t)(data[0] | (data[1] << 8));
+    }
+    static uint32_t readU32(const uint8_t* data) {
+        return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+    }
+    static int32_t readI32(const uint8_t* data) {
+        return (int32_t)readU32(data);
+    }
+
+private:
+    uint8_t partial[Ubx::FRAME_OVERHEAD + MAX_PAYLOAD];
+    size_t partialLength;
+    uint32_t frames;
+    uint32_t checksumErrors;
+    uint32_t skippedBytes;
+
+    // Frame size if data starts with a plausible header, 0 if not, or
+    // SIZE_MAX while fewer than the 6 header bytes are there
+    static size_t frameSize(const uint8_t* data, size_t available);
+    bool deliver(const uint8_t* frame, size_t size, Handler handler, void* context);
+    // Drops the partial frame up to its next sync byte after the first
+    void skipPartial();
+};
+
+#endif
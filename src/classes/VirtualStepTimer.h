@@ -0,0 +1,65 @@
+#ifndef VIRTUAL_STEP_TIMER_H
+#define VIRTUAL_STEP_TIMER_H
+
+#include "StepTimer.h"
+
+// Host-side StepTimer driven by a virtual clock. Nothing fires until
+// advanceTo() is called, so a StepEngine can be run for days of simulated
+// time in a tight loop.
+class VirtualStepTimer : public StepTimer {
+public:
+    VirtualStepTimer() : callback(nullptr), arg(nullptr), now(0), pendingAt(0), armed(false) {}
+
+    void begin(Callback callback, void* arg) override {
+        this->callback = callback;
+        this->arg = arg;
+    }
+
+    uint64_t nowMicros() override {
+        return now;
+    }
+
+    void fireAt(uint64_t whenMicros) override {
+        pendingAt = whenMicros > now ? whenMicros : now;
+        armed = true;
+    }
+
+    void cancel() override {
+        armed = false;
+    }
+
+    bool isArmed() {
+        return armed;
+    }
+
+    uint64_t getPendingAt() {
+        return pendingAt;
+    }
+
+    // Run every shot due up to and including whenMicros, in time order
+    void advanceTo(uint64_t whenMicros) {
+        while (armed && pendingAt <= whenMicros) {
+            now = pendingAt;
+            armed = false;
+            if (callback) {
+                callback(arg);
+            }
+        }
+        if (whenMicros > now) {
+            now = whenMicros;
+        }
+    }
+
+    void advanceBy(uint64_t micros) {
+        advanceTo(now + micros);
+    }
+
+private:
+    Callback callback;
+    void* arg;
+    uint64_t now;
+    uint64_t pendingAt;
+    bool armed;
+};
+
+#endif
@@ -0,0 +1,228 @@
+#include "WarmStart.h"
+#include "AlmanacTable.h"
+
+// Kept through a reset; checked, not cleared, at power-on
+RTC_NOINIT_ATTR static WarmStartRecord rtcRecord;
+
+static const uint16_t VERSION = 1;
+// The clock may have been carried to another town since
+static const uint32_t POSITION_ACCURACY_CM = 500000;
+// TimeService keeps the RTC on the PPS clock while locked; through a
+// reset it runs on its own oscillator
+static const uint32_t TIME_ACCURACY_MS = 2000;
+// The NEO-6M's crystal moves with temperature
+static const uint32_t RECEIVER_DRIFT_ACCURACY = 1000; // ns/s
+// GPS time started 1980-01-06 and is ahead of UTC by the leap seconds
+// since, 18 from 2017
+static const uint64_t GPS_EPOCH = 315964800;
+static const uint64_t GPS_LEAP_SECONDS = 18;
+static const uint64_t WEEK_MICROS = 604800ULL * 1000000ULL;
+// The file is rewritten on a move or a drift change this large, or after
+// a day; SPIFFS pages wear out
+static const float SAVE_DISTANCE_M = 100.0f;
+static const int32_t SAVE_DRIFT_CHANGE = 1000; // ppb, or ns/s
+static const uint32_t SAVE_INTERVAL_S = 86400;
+
+WarmStart::WarmStart(const char* path) {
+    Serial.println("WarmStart::WarmStart()");
+    this->path = path;
+    source = NONE;
+    memset(&current, 0, sizeof(current));
+    mutex = xSemaphoreCreateMutex();
+    memset(&saved, 0, sizeof(saved));
+    memset(&pending, 0, sizeof(pending));
+    savePending = false;
+}
+
+WarmStart::~WarmStart() {
+    Serial.println("WarmStart::~WarmStart()");
+    if (mutex) {
+        vSemaphoreDelete(mutex);
+    }
+}
+
+bool WarmStart::begin() {
+    Serial.println("WarmStart::begin()");
+    if (load(&saved)) {
+        current = saved;
+        source = FLASH;
+    }
+    // Written more often than the file, so newer when it is there
+    if (isValid(rtcRecord)) {
+        current = rtcRecord;
+        source = RTC_MEMORY;
+    }
+    if (source != NONE) {
+        Serial.print("WarmStart::begin() - last fix from ");
+        Serial.println(getSourceName(source));
+    }
+    return source != NONE;
+}
+
+WarmStart::Source WarmStart::getSource() {
+    return source;
+}
+
+const char* WarmStart::getSourceName(uint8_t source) {
+    switch (source) {
+        case RTC_MEMORY: return "RTC memory";
+        case FLASH: return "flash";
+        default: return "none";
+    }
+}
+
+WarmStartRecord WarmStart::getRecord() {
+    return current;
+}
+
+Ubx::AidInit WarmStart::getAiding(uint64_t utcMicros) {
+    Serial.println("WarmStart::getAiding()");
+    Ubx::AidInit aid;
+    memset(&aid, 0, sizeof(aid));
+    if (source == NONE) {
+        return aid;
+    }
+    aid.positionValid = true;
+    aid.latitude = current.latitudeE7;
+    aid.longitude = current.longitudeE7;
+    aid.altitude = current.altitudeCm;
+    aid.positionAccuracy = POSITION_ACCURACY_CM;
+    if (utcMicros != 0) {
+        uint64_t gpsMicros = utcMicros - (GPS_EPOCH - GPS_LEAP_SECONDS) * 1000000ULL;
+        aid.timeValid = true;
+        aid.week = (uint16_t)(gpsMicros / WEEK_MICROS);
+        aid.timeOfWeek = (uint32_t)(gpsMicros % WEEK_MICROS / 1000);
+        aid.timeAccuracy = TIME_ACCURACY_MS;
+    }
+    if (current.flags & WarmStartRecord::RECEIVER_DRIFT) {
+        aid.clockDriftValid = true;
+        aid.clockDrift = current.receiverDrift;
+        aid.clockDriftAccuracy = RECEIVER_DRIFT_ACCURACY;
+    }
+    return aid;
+}
+
+void WarmStart::record(const GpsFix& fix, const TimeStatus& time) {
+    // Serial.println("WarmStart::record()"); // Commented out - called frequently
+    if (!fix.locationValid || fix.unixTime == 0) {
+        return;
+    }
+    WarmStartRecord next;
+    memset(&next, 0, sizeof(next));
+    next.magic = MAGIC;
+    next.version = VERSION;
+    next.unixTime = fix.unixTime;
+    next.latitudeE7 = (int32_t)lround(fix.latitude * 1e7);
+    next.longitudeE7 = (int32_t)lround(fix.longitude * 1e7);
+    next.altitudeCm = (int32_t)lround(fix.altitude * 100.0);
+    // A drift not measured yet this boot is still the one from before
+    if (time.driftValid) {
+        next.flags |= WarmStartRecord::CRYSTAL_DRIFT;
+        next.crystalPpb = time.driftPpb;
+    } else if (current.flags & WarmStartRecord::CRYSTAL_DRIFT) {
+        next.flags |= WarmStartRecord::CRYSTAL_DRIFT;
+        next.crystalPpb = current.crystalPpb;
+    }
+    if (fix.clockDriftValid) {
+        next.flags |= WarmStartRecord::RECEIVER_DRIFT;
+        next.receiverDrift = fix.clockDrift;
+    } else if (current.flags & WarmStartRecord::RECEIVER_DRIFT) {
+        next.flags |= WarmStartRecord::RECEIVER_DRIFT;
+        next.receiverDrift = current.receiverDrift;
+    }
+    seal(&next);
+    rtcRecord = next;
+    current = next;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (!savePending && needsSaving(next)) {
+        pending = next;
+        savePending = true;
+    }
+    xSemaphoreGive(mutex);
+}
+
+bool WarmStart::writePending() {
+    // Serial.println("WarmStart::writePending()"); // Commented out - called frequently
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool work = savePending;
+    WarmStartRecord record = pending;
+    xSemaphoreGive(mutex);
+    if (!work) {
+        return false;
+    }
+
+    // On a failure the next record() asks again
+    bool ok = save(record);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (ok) {
+        saved = record;
+    }
+    savePending = false;
+    xSemaphoreGive(mutex);
+    return true;
+}
+
+bool WarmStart::needsSaving(const WarmStartRecord& record) {
+    if (!isValid(saved) || record.unixTime - saved.unixTime >= SAVE_INTERVAL_S) {
+        return true;
+    }
+    if ((record.flags & ~saved.flags) != 0) {
+        return true;
+    }
+    // Flat earth is close enough at this distance
+    float north = (record.latitudeE7 - saved.latitudeE7) * 1e-7f * 111195.0f;
+    float east = (record.longitudeE7 - saved.longitudeE7) * 1e-7f * 111195.0f *
+                 cosf(saved.latitudeE7 * 1e-7f * (float)DEG_TO_RAD);
+    if (north * north + east * east > SAVE_DISTANCE_M * SAVE_DISTANCE_M) {
+        return true;
+    }
+    return abs(record.crystalPpb - saved.crystalPpb) > SAVE_DRIFT_CHANGE ||
+           abs(record.receiverDrift - saved.receiverDrift) > SAVE_DRIFT_CHANGE;
+}
+
+bool WarmStart::load(WarmStartRecord* record) {
+    Serial.println("WarmStart::load()");
+    // A save interrupted between remove and rename leaves only the new file
+    String tempPath = path + ".tmp";
+    File file = SPIFFS.exists(path) ? SPIFFS.open(path, "r") : SPIFFS.open(tempPath, "r");
+    if (!file) {
+        return false;
+    }
+    bool ok = file.read((uint8_t*)record, sizeof(*record)) == sizeof(*record) && isValid(*record);
+    file.close();
+    if (!ok) {
+        Serial.println("Warm start file invalid, ignored");
+        memset(record, 0, sizeof(*record));
+    }
+    return ok;
+}
+
+bool WarmStart::save(const WarmStartRecord& record) {
+    Serial.println("WarmStart::save()");
+    String tempPath = path + ".tmp";
+    File file = SPIFFS.open(tempPath, "w");
+    if (!file) {
+        Serial.println("Failed to open warm start file for writing");
+        return false;
+    }
+    bool ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+    file.close();
+    if (!ok) {
+        Serial.println("Failed to write warm start file");
+        SPIFFS.remove(tempPath);
+        return false;
+    }
+    // SPIFFS will not rename over an existing file
+    SPIFFS.remove(path);
+    return SPIFFS.rename(tempPath, path);
+}
+
+void WarmStart::seal(WarmStartRecord* record) {
+    record->crc = AlmanacTable::crc32((const uint8_t*)record, offsetof(WarmStartRecord, crc));
+}
+
+bool WarmStart::isValid(const WarmStartRecord& record) {
+    return record.magic == MAGIC && record.version == VERSION &&
+           record.crc == AlmanacTable::crc32((const uint8_t*)&record, offsetof(WarmStartRecord, crc));
+}
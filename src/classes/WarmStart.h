@@ -0,0 +1,78 @@
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include "Telemetry.h"
+#include "Ubx.h"
+
+// The last good fix with the two oscillator errors. Drifts are 0 unless
+// flagged valid.
+struct WarmStartRecord {
+    static const uint8_t CRYSTAL_DRIFT = 0x01;
+    static const uint8_t RECEIVER_DRIFT = 0x02;
+
+    uint32_t magic;
+    uint16_t version;
+    uint8_t flags;
+    uint8_t reserved;
+    uint32_t unixTime;      // UTC of the fix
+    int32_t latitudeE7;     // degrees * 1e7
+    int32_t longitudeE7;
+    int32_t altitudeCm;     // above mean sea level
+    int32_t crystalPpb;     // ESP32 crystal against GPS (TimeStatus::driftPpb)
+    int32_t receiverDrift;  // NEO-6M oscillator, ns/s (GpsFix::clockDrift)
+    uint32_t crc;           // CRC-32 of the bytes before it
+};
+
+// What a boot knows before the GPS is back. Each fix is kept in RTC slow
+// memory, which survives a software or watchdog reset and deep sleep but
+// not a power cycle, and in a SPIFFS file, rewritten only when the place
+// or an oscillator has moved enough to matter, or once a day. begin()
+// takes the RTC copy when it checks out, else the file. The file is
+// written by writePending() on core 0 (the almanac task), not by record()
+// on the control task, since a SPIFFS write can stall for tens of ms.
+//
+// File layout, little-endian: one WarmStartRecord (36 bytes).
+class WarmStart {
+public:
+    enum Source {
+        NONE = 0,
+        RTC_MEMORY,
+        FLASH
+    };
+
+    static const uint32_t MAGIC = 0x31535757; // "WWS1"
+
+    WarmStart(const char* path = "/warmstart.bin");
+    ~WarmStart();
+
+    bool begin();
+    Source getSource();
+    static const char* getSourceName(uint8_t source);
+    WarmStartRecord getRecord();
+    // AID-INI from the record, with the time if utcMicros is not 0
+    Ubx::AidInit getAiding(uint64_t utcMicros);
+
+    // Control task, with a fix
+    void record(const GpsFix& fix, const TimeStatus& time);
+    // Almanac task: writes the file if record() asked for it, true if it did
+    bool writePending();
+
+private:
+    String path;
+    Source source;
+    WarmStartRecord current; // loaded or last recorded
+    SemaphoreHandle_t mutex; // record() on the control task, writePending() on the almanac task
+    WarmStartRecord saved;   // as in the file, magic 0 when there is none
+    WarmStartRecord pending; // to be written when savePending
+    bool savePending;
+
+    bool load(WarmStartRecord* record);
+    bool save(const WarmStartRecord& record);
+    bool needsSaving(const WarmStartRecord& record);
+    static void seal(WarmStartRecord* record);
+    static bool isValid(const WarmStartRecord& record);
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include <SPIFFS.h>
 #include <TimeLib.h>
 #include <Time.h>
+#include <sys/time.h>
 #include "classes/GPSManager.h"
 #include "classes/StepperController.h"
 #include "classes/DisplayManager.h"
@@ -9,6 +10,14 @@
 #include "classes/ConfigurationManager.h"
 #include "classes/LogManager.h"
 #include "classes/Ephemeris.h"
+#include "classes/EspStepTimer.h"
+#include "classes/TaskManager.h"
+#include "classes/TimeService.h"
+#include "classes/WarmStart.h"
+#ifdef BENCHMARK
+#include "classes/Benchmark.h"
+#include "classes/GpsRecording.h"
+#endif
 
 const String PROMPT_VERSION = "Prompt Document Version 1.0.2";
 
@@ -17,6 +26,12 @@ void setup();
 void loop();
 String buildStatusText();
 String buildActivityText();
+void onMoveComplete(bool completed);
+void onCalibrationComplete(bool success, uint64_t numerator, uint64_t denominator);
+uint64_t utcMicros();
+#ifdef BENCHMARK
+void runBenchmarks();
+#endif
 
 GPSManager* gpsManager;
 StepperController* stepperController;
@@ -24,13 +39,20 @@ DisplayManager* displayManager;
 BluetoothManager* bluetoothManager;
 ConfigurationManager* configManager;
 LogManager* logManager;
+IndexSensor* indexSensor;
+EspStepTimer* motorTimer;
+TaskManager* taskManager;
 Ephemeris* ephemeris;
+TimeService* timeService;
+WarmStart* warmStart;
 
 unsigned long lastStatusUpdate = 0;
 unsigned long lastSerialOutput = 0;
 unsigned long lastLogEntry = 0;
+unsigned long lastWarmStartSave = 0;
 unsigned long gpsStartTime = 0;
-bool gpsFixObtained = false;
+bool gpsFixObtained = false; // running on a location, fixed or not
+bool awaitingFix = true;     // no fix yet this boot
 
 
 
@@ -59,14 +81,45 @@ void setup() {
     logManager->logInfo("System startup initiated");
     
     configManager = new ConfigurationManager();
-    configManager->setConfiguration({ONCE_PER_MINUTE, "00:00", 0, false});
     configManager->begin();
+    // Every boot starts at 1 rotation per minute; calibration and the other
+    // settings carry over
+    Configuration config = configManager->getConfiguration();
+    config.rotationSpeed = ONCE_PER_MINUTE;
+    config.startTime = "00:00";
+    config.durationHours = 0;
+    config.rewindAfterComplete = false;
+    configManager->setConfiguration(config);
     
+    // The last fix from before the reset, until the GPS is back
+    warmStart = new WarmStart();
+    bool warm = warmStart->begin();
+    WarmStartRecord last = warmStart->getRecord();
+
     gpsManager = new GPSManager();
+    // PPS on GPIO35. It starts from the RTC after a warm reset, so with the
+    // stored almanac the display has the day's events before the GPS is back
+    timeService = new TimeService(gpsManager, 35);
+    if (last.flags & WarmStartRecord::CRYSTAL_DRIFT) {
+        timeService->setDrift(last.crystalPpb);
+    }
+    timeService->begin();
+    if (warm) {
+        gpsManager->setFallback(last.latitudeE7 * 1e-7f, last.longitudeE7 * 1e-7f, last.altitudeCm * 0.01f, last.unixTime);
+        gpsManager->setAiding(warmStart->getAiding(timeService->getUtcMicros()));
+    }
     gpsManager->begin();
     
-    stepperController = new StepperController();
+    indexSensor = new IndexSensor(34);
+    // Steps run in the motor task on core 1, off the loop
+    motorTimer = new EspStepTimer(MOTOR_TASK_CORE, MOTOR_TASK_PRIORITY);
+    stepperController = new StepperController(25, 26, 27, 14, motorTimer);
+    stepperController->setIndexSensor(indexSensor);
     stepperController->begin();
+    stepperController->setMoveCallbacks(nullptr, onMoveComplete);
+    stepperController->setCalibrationCallback(onCalibrationComplete);
+    stepperController->setStepsPerRevolution(config.gearStepsNumerator, config.gearStepsDenominator);
+    stepperController->setBacklash(config.backlashSteps);
     
     displayManager = new DisplayManager();
     displayManager->begin();
@@ -75,10 +128,17 @@ void setup() {
     bluetoothManager->begin();
     
     ephemeris = new Ephemeris(gpsManager);
+    timeService->syncClock(ephemeris->getTimezoneOffset());
+
+    // GPS, Bluetooth link, display and log writes move to core 0
+    taskManager = new TaskManager();
+    taskManager->begin(motorTimer);
 
     gpsStartTime = millis();
     
     stepperController->setRotationSpeed(ONCE_PER_MINUTE);
+    stepperController->setTimeSource(utcMicros);
+    stepperController->setTimeLocked(config.timeLocked);
     stepperController->startRotation();
     
     logManager->logInfo("System startup completed");
@@ -87,40 +147,56 @@ void setup() {
 
 
 void loop() {
+    uint32_t loopStart = (uint32_t)esp_timer_get_time();
     unsigned long currentTime = millis();
     
-    // Poll Bluetooth for user interaction
+    // Act on Bluetooth input received by the link task
     bluetoothManager->handleUserInteraction();
     
-    // Update GPS data
-    gpsManager->update();
+    // Update GPS data and the clock, unless the GPS task does
+    if (!taskManager->isTaskRunning(GPS_TASK)) {
+        gpsManager->update();
+        timeService->update();
+    }
+    // TimeLib follows the disciplined clock
+    timeService->syncClock(ephemeris->getTimezoneOffset());
     
-    // Check for GPS fix or timeout
-    if (!gpsFixObtained) {
-        if (gpsManager->hasValidFix()) {
+    // Check for GPS fix or timeout; with a warm start there is no wait
+    if (awaitingFix) {
+        if (gpsManager->hasValidFix() && timeService->getUtcMicros() != 0) {
+            awaitingFix = false;
             gpsFixObtained = true;
-            // Set system time from GPS (convert UTC to local time)
+            // System time (local) follows the time service from here
             int timezoneOffset = gpsManager->getTimezoneOffset();
-            time_t utcTime = makeTime({gpsManager->getSecond(), gpsManager->getMinute(), gpsManager->getHour(),
-                                      0, gpsManager->getDay(), gpsManager->getMonth(), gpsManager->getYear()});
-            time_t localTime = utcTime + (timezoneOffset * 3600);
-            setTime(localTime);
+            GpsFix fix = gpsManager->getFix();
+            timeService->syncClock(timezoneOffset);
+#ifndef SIMULATOR
+            uint64_t utc = timeService->getUtcMicros();
+            struct timeval rtc = {(time_t)(utc / 1000000), (suseconds_t)(utc % 1000000)};
+            settimeofday(&rtc, nullptr);
+#endif
             String tzMsg = "GPS fix obtained, system time set, timezone: UTC";
             if (timezoneOffset >= 0) tzMsg += "+";
             tzMsg += String(timezoneOffset);
             if (gpsManager->isDST()) tzMsg += " (DST)";
             logManager->logInfo(tzMsg);
             Serial.println(tzMsg);
-            ephemeris->setCurrentTime(gpsManager->getUnixTimestamp());
-            ephemeris->setLatitude(gpsManager->getLatitude());
-            ephemeris->setLongitude(gpsManager->getLongitude());
+            ephemeris->setCurrentTime(fix.unixTime);
+            ephemeris->setLatitude(fix.latitude);
+            ephemeris->setLongitude(fix.longitude);
             ephemeris->getAlmanacSummary();
-        } else if ((currentTime - gpsStartTime) > 60 * 1000) { // 1 minutes timeout
+        } else if (!gpsFixObtained && (warmStart->getSource() != WarmStart::NONE ||
+                                       (currentTime - gpsStartTime) > 60 * 1000)) { // 1 minutes timeout
             gpsFixObtained = true;
-            // Use default values
+            // The last fix, or the default location, until a fix arrives
             gpsManager->setDefaultLocation();
+            ephemeris->setLatitude(gpsManager->getLatitude());
+            ephemeris->setLongitude(gpsManager->getLongitude());
             int timezoneOffset = gpsManager->getTimezoneOffset();
-            String tzMsg = "GPS timeout, using default location, timezone: UTC";
+            String tzMsg = warmStart->getSource() != WarmStart::NONE
+                ? "Using the last fix from " + String(WarmStart::getSourceName(warmStart->getSource()))
+                    + (gpsManager->isAided() ? ", receiver aided" : "") + ", timezone: UTC"
+                : String("GPS timeout, using default location, timezone: UTC");
             if (timezoneOffset >= 0) tzMsg += "+";
             tzMsg += String(timezoneOffset);
             if (gpsManager->isDST()) tzMsg += " (DST)";
@@ -129,6 +205,29 @@ void loop() {
         }
     }
     
+    // The last fix for the next boot; RTC memory each time, flash (from the
+    // almanac task) when it matters
+    if (!awaitingFix && currentTime - lastWarmStartSave > 10000) {
+        warmStart->record(gpsManager->getFix(), timeService->getStatus());
+        lastWarmStartSave = currentTime;
+    }
+
+#ifdef BENCHMARK
+    // Once, when time and location are in place
+    static bool benchmarked = false;
+    if (gpsFixObtained && !benchmarked) {
+        benchmarked = true;
+        runBenchmarks();
+    }
+#endif
+
+    // Fill the stored almanac table a day at a time and write the warm
+    // start file, unless the almanac task does
+    if (!taskManager->isTaskRunning(ALMANAC_TASK)) {
+        ephemeris->buildAlmanacStep();
+        warmStart->writePending();
+    }
+
     // Update stepper motor position
     stepperController->update();
 
@@ -136,7 +235,7 @@ void loop() {
     if (currentTime - lastStatusUpdate > 1000) {
         String statusText = buildStatusText();
         String activityText = buildActivityText();
-        displayManager->updateDisplay(statusText, activityText);
+        displayManager->show(statusText, activityText);
         lastStatusUpdate = currentTime;
     }
     
@@ -148,10 +247,33 @@ void loop() {
     
     // Log entry every 1 minute
     if (currentTime - lastLogEntry > 60000) {
-        String logEntry = buildStatusText() + " | " + buildActivityText();
+        MotorTelemetry motor = stepperController->getTelemetry();
+        String logEntry = buildStatusText() + " | " + buildActivityText()
+            + " | Phase err max " + String(motor.maxPhaseError) + "us"
+            + " rms " + String(motor.jitterRms) + "us";
+        if (motor.timeLocked) {
+            logEntry += " | Angle err " + String(motor.angleError, 2);
+        }
+        if (motor.droppedRecords > 0) {
+            logEntry += " | Step records dropped " + String(motor.droppedRecords);
+        }
+        TimeStatus time = timeService->getStatus();
+        logEntry += " | Time " + String(TimeService::getStateName(time.state));
+        if (time.state == TimeService::LOCKED) {
+            logEntry += " offset " + String(time.lastOffset) + "us";
+        }
+        if (time.driftValid) {
+            logEntry += " drift " + String(time.driftPpb / 1000.0, 3) + "ppm";
+        }
         logManager->logInfo(logEntry);
+        taskManager->sampleMetrics();
+        logManager->logInfo(taskManager->getMetricsText());
         lastLogEntry = currentTime;
     }
+
+    taskManager->addBusyTime(CONTROL_TASK, (uint32_t)esp_timer_get_time() - loopStart);
+    // Stepping no longer depends on loop() speed; leave core 1 idle time
+    vTaskDelay(1);
 }
 
 String buildStatusText() {
@@ -166,9 +288,11 @@ String buildStatusText() {
     char timeStr[9];
     sprintf(timeStr, "%02d:%02d:%02d", hour(), minute(), second());
     
-    float degrees = stepperController->getCurrentDegrees();
-    float lat = gpsManager->getLatitude();
-    float lng = gpsManager->getLongitude();
+    // Snapshots, so the text never mixes two updates
+    GpsFix fix = gpsManager->getFix();
+    float degrees = stepperController->getTelemetry().degrees;
+    float lat = fix.latitude;
+    float lng = fix.longitude;
     
     int latDeg = (int)lat;
     int latMin = (int)((lat - latDeg) * 60);
@@ -181,6 +305,9 @@ String buildStatusText() {
         case ONCE_PER_MINUTE: mode = "Min"; break;
         case ONCE_PER_HOUR: mode = "Hour"; break;
         case ONCE_PER_DAY: mode = "Day"; break;
+        case ONCE_PER_SIDEREAL_DAY: mode = "Sid"; break;
+        case ONCE_PER_LUNAR_DAY: mode = "Lun"; break;
+        case CUSTOM_PERIOD: mode = "Cus"; break;
     }
    return String(timeStr) + " " + "1x" + mode + " " + String(latDeg) + "' " + String(latMin);
 }
@@ -206,4 +333,99 @@ String buildActivityText() {
     }
     
     return result;
-}
\ No newline at end of file
+}
+
+void onMoveComplete(bool completed) {
+    logManager->logInfo(completed ? "Stepper move completed" : "Stepper move cancelled");
+}
+
+void onCalibrationComplete(bool success, uint64_t numerator, uint64_t denominator) {
+    if (!success) {
+        logManager->logError("Gear calibration failed, index sensor not seen");
+        return;
+    }
+    Configuration config = configManager->getConfiguration();
+    config.gearStepsNumerator = numerator;
+    config.gearStepsDenominator = denominator;
+    configManager->setConfiguration(config);
+    logManager->logInfo("Gear calibrated: " + String((double)numerator / (double)denominator, 3) + " steps/rev");
+}
+
+uint64_t utcMicros() {
+    // PPS-disciplined, 0 until the first fix or the RTC sets it
+    return timeService->getUtcMicros();
+}
+
+#ifdef BENCHMARK
+// Two texts to alternate between, unchanged text is not redrawn
+static String benchmarkStatus[2];
+// Decoders fed the recorded second, apart from the running one
+static GPSManager* benchmarkNmea;
+static GPSManager* benchmarkUbx;
+
+void runBenchmarks() {
+    Serial.println("runBenchmarks()");
+    Benchmark benchmark(&Serial, PROMPT_VERSION);
+    benchmarkStatus[0] = buildStatusText();
+    benchmarkStatus[1] = benchmarkStatus[0] + "*";
+    benchmarkNmea = new GPSManager();
+    benchmarkNmea->setProtocol(GPSManager::NMEA);
+    benchmarkUbx = new GPSManager();
+    benchmarkUbx->setProtocol(GPSManager::UBX);
+
+    benchmark.report(benchmark.run("Ephemeris::getAlmanacSummary", []() {
+        ephemeris->getAlmanacSummary();
+    }, 200));
+    benchmark.report(benchmark.run("GPSManager::getUnixTimestamp", []() {
+        gpsManager->getUnixTimestamp();
+    }, 1000));
+    // Inline in benchmark builds: formatting plus the flash write
+    benchmark.report(benchmark.run("LogManager::writeLogEntry", []() {
+        logManager->logInfo("Benchmark entry");
+    }, 100));
+    benchmark.report(benchmark.run("DisplayManager::updateDisplay", []() {
+        static uint8_t next = 0;
+        displayManager->updateDisplay(benchmarkStatus[next], "Benchmark");
+        next ^= 1;
+    }, 100));
+    benchmark.report(benchmark.run("buildStatusText", []() {
+        buildStatusText();
+    }, 1000));
+    // Sun and moon position plus phase, double against fixed-point/float
+    benchmark.report(benchmark.run("AstroKernels::double", []() {
+        AstroKernels::Arguments<double> arguments;
+        AstroKernels::Equatorial<double> sun, moon;
+        AstroKernels::Phase<double> phase;
+        AstroKernels::argumentsDouble(gpsManager->getUnixTimestamp(), &arguments);
+        AstroKernels::sunPosition(arguments, &sun);
+        AstroKernels::moonPosition(arguments, &moon);
+        AstroKernels::moonPhase(sun, moon, &phase);
+    }, 200));
+    benchmark.report(benchmark.run("AstroKernels::fixed", []() {
+        AstroKernels::Arguments<float> arguments;
+        AstroKernels::Equatorial<float> sun, moon;
+        AstroKernels::Phase<float> phase;
+        AstroKernels::argumentsFixed(AstroKernels::timeFromUnix(gpsManager->getUnixTimestamp()), &arguments);
+        AstroKernels::sunPosition(arguments, &sun);
+        AstroKernels::moonPosition(arguments, &moon);
+        AstroKernels::moonPhase(sun, moon, &phase);
+    }, 200));
+    // One planet's azimuth/elevation from the Chebyshev table, all five in turn
+    benchmark.report(benchmark.run("Ephemeris::getPlanetPosition", []() {
+        static uint8_t planet = 0;
+        float azimuth, elevation;
+        ephemeris->getPlanetPosition((PlanetEphemeris::Planet)planet, gpsManager->getUnixTimestamp(), &azimuth, &elevation);
+        planet = (planet + 1) % PlanetEphemeris::PLANET_COUNT;
+    }, 500));
+    // One second of receiver output, five fixes: TinyGPS++ on the text
+    // against the UBX frames decoded in place
+    benchmark.report(benchmark.run("GPSManager::decode NMEA", []() {
+        benchmarkNmea->decode(GPS_RECORDING_NMEA, sizeof(GPS_RECORDING_NMEA));
+    }, 200));
+    benchmark.report(benchmark.run("GPSManager::decode UBX", []() {
+        benchmarkUbx->decode(GPS_RECORDING_UBX, sizeof(GPS_RECORDING_UBX));
+    }, 200));
+    delete benchmarkNmea;
+    delete benchmarkUbx;
+}
+#endif
@@ -0,0 +1,112 @@
+// CoilSequencer (src/classes) through RecordingCoilDriver: every energized
+// pattern must be the next phase of the mode's coil table in the stepping
+// direction, and a mode change must keep the rotor where it is.
+//
+//   pio test -e native_sim -f test_coil_sequence
+
+#include <unity.h>
+#include "CoilSequencer.h"
+#include "RecordingCoilDriver.h"
+
+static const StepMode MODES[STEP_MODE_COUNT] = {FULL_STEP, WAVE_DRIVE, HALF_STEP};
+static const int8_t DIRECTIONS[2] = {1, -1};
+
+static RecordingCoilDriver driver;
+
+void setUp() {
+    driver.clear();
+}
+
+void tearDown() {}
+
+// Position of a pattern on the common half-step grid
+static int halfStepOf(uint8_t pattern) {
+    for (int i = 0; i < 8; i++) {
+        if (HALF_STEP_SEQUENCE[i] == pattern) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Half steps from one grid position to the other, -3..4
+static int halfStepsBetween(int from, int to) {
+    int difference = (to - from) & 7;
+    return difference > 4 ? difference - 8 : difference;
+}
+
+static void runSteps(CoilSequencer& sequencer, int8_t direction, int steps) {
+    for (int n = 0; n < steps; n++) {
+        sequencer.step(direction);
+        // Coils released between steps, as StepEngine does after the hold
+        if (n % 3 == 2) {
+            sequencer.release();
+        }
+    }
+}
+
+void test_each_mode_both_directions() {
+    for (StepMode mode : MODES) {
+        const CoilSequence& sequence = getCoilSequence(mode);
+        uint8_t mask = sequence.phaseCount - 1;
+        for (int8_t direction : DIRECTIONS) {
+            CoilSequencer sequencer(&driver, mode);
+            sequencer.begin(25, 26, 27, 14);
+            // Two turns of the table, so the phase wraps
+            runSteps(sequencer, direction, 2 * sequence.phaseCount + 1);
+            TEST_ASSERT_EQUAL_INT(0, driver.getDropped());
+            TEST_ASSERT_TRUE(driver.getCount() > 2 * sequence.phaseCount);
+            TEST_ASSERT_TRUE(driver.followsSequence(sequence, direction));
+            TEST_ASSERT_FALSE(driver.followsSequence(sequence, (int8_t)-direction));
+
+            // Reversing goes back through the phase it came from
+            uint8_t phase = sequencer.getPhase();
+            driver.clear();
+            runSteps(sequencer, (int8_t)-direction, sequence.phaseCount + 1);
+            TEST_ASSERT_EQUAL_UINT8(sequence.patterns[(phase - direction) & mask], driver.getPattern(0));
+            TEST_ASSERT_TRUE(driver.followsSequence(sequence, (int8_t)-direction));
+            driver.clear();
+        }
+    }
+}
+
+void test_mode_change_keeps_rotor() {
+    for (StepMode from : MODES) {
+        for (StepMode to : MODES) {
+            for (int8_t direction : DIRECTIONS) {
+                // An even and an odd number of steps, so half-step mode
+                // leaves the rotor both on and between the other grids
+                for (int lead = 6; lead <= 7; lead++) {
+                    CoilSequencer sequencer(&driver, from);
+                    sequencer.begin(25, 26, 27, 14);
+                    runSteps(sequencer, direction, lead);
+                    TEST_ASSERT_TRUE(driver.followsSequence(getCoilSequence(from), direction));
+                    int last = driver.getCount() - 1;
+                    if (driver.getPattern(last) == 0) {
+                        last--;
+                    }
+                    int before = halfStepOf(driver.getPattern(last));
+
+                    driver.clear();
+                    sequencer.setMode(to);
+                    TEST_ASSERT_EQUAL_INT(to, sequencer.getMode());
+                    runSteps(sequencer, direction, 7);
+                    TEST_ASSERT_TRUE(driver.followsSequence(getCoilSequence(to), direction));
+                    // The first step in the new mode moves the rotor at most
+                    // one of its own steps, in the stepping direction
+                    int moved = halfStepsBetween(before, halfStepOf(driver.getPattern(0))) * direction;
+                    int stride = to == HALF_STEP ? 1 : 2;
+                    TEST_ASSERT_TRUE(moved > 0 && moved <= stride);
+                    driver.clear();
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_each_mode_both_directions);
+    RUN_TEST(test_mode_change_keeps_rotor);
+    return UNITY_END();
+}
@@ -0,0 +1,96 @@
+// A month of the firmware on the simulated board (sim/) with a crystal
+// 40 ppm fast: the dial must still step on its timeline, the clock stay
+// locked to PPS with the crystal error measured, and the logs rotate
+// within their limits without filling the flash.
+//
+//   pio test -e native_sim -f test_sim_month
+
+#include <unity.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "SimFlash.h"
+#include "SimMotor.h"
+#include "SimNmeaFeed.h"
+#include "SimRunner.h"
+#include "StepperController.h"
+#include "TimeService.h"
+
+extern StepperController* stepperController;
+extern TimeService* timeService;
+
+static const uint64_t DAY = 86400000000ULL;
+static const uint64_t RUN_DAYS = 30;
+static const double CRYSTAL_PPM = 40;
+// LogManager's maxLogSize, maxLogFiles, startingLogNumber and LOG_LINE_LENGTH
+static const size_t MAX_LOG_SIZE = 131072;
+static const int MAX_LOG_FILES = 6;
+static const int FIRST_LOG_NUMBER = 1000;
+static const size_t LOG_LINE_LENGTH = 320;
+
+void setUp() {}
+
+void tearDown() {}
+
+static int logNumber(const std::string& path) {
+    return atoi(path.c_str() + path.rfind('/') + 1);
+}
+
+void test_dial_on_time() {
+    MotorTelemetry motor = stepperController->getTelemetry();
+    TEST_ASSERT_EQUAL_UINT32(0, simMotor.getFaults());
+    // Every step since boot within 50 us of its place on the timeline
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(50, motor.maxPhaseError);
+    TEST_ASSERT_EQUAL_UINT32(0, motor.droppedRecords);
+    // No step lost between the controller and the shaft, and the default
+    // once-a-minute turn kept up for the month
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, simMotor.getOutputDegrees(), motor.degrees);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, RUN_DAYS * 1440.0, simMotor.getOutputRevolutions());
+}
+
+void test_clock_locked() {
+    TimeStatus time = timeService->getStatus();
+    TEST_ASSERT_EQUAL_INT(TimeService::LOCKED, time.state);
+    TEST_ASSERT_EQUAL_UINT32(0, time.rejected);
+    int64_t offset = (int64_t)(timeService->getUtcMicros() - simNmeaFeed.getUtcMicros());
+    TEST_ASSERT_LESS_OR_EQUAL(10, llabs(offset));
+    TEST_ASSERT_TRUE(time.driftValid);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, CRYSTAL_PPM, time.driftPpb / 1000.0);
+}
+
+void test_logs_rotated() {
+    std::vector<std::string> logs = simFlash.list("/logs");
+    TEST_ASSERT_EQUAL_UINT32(0, simFlash.getWriteFailures());
+    TEST_ASSERT_GREATER_OR_EQUAL(2, (int)logs.size());
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_LOG_FILES, (int)logs.size());
+
+    // The newest files are kept, numbered without gaps, so the oldest ones
+    // were removed as new ones opened
+    int newest = 0;
+    for (const std::string& path : logs) {
+        newest = logNumber(path) > newest ? logNumber(path) : newest;
+    }
+    TEST_ASSERT_GREATER_THAN(FIRST_LOG_NUMBER + MAX_LOG_FILES, newest);
+    for (const std::string& path : logs) {
+        int number = logNumber(path);
+        TEST_ASSERT_GREATER_THAN(newest - (int)logs.size(), number);
+        size_t size = simFlash.open(path, false)->size();
+        TEST_ASSERT_LESS_OR_EQUAL(MAX_LOG_SIZE + LOG_LINE_LENGTH, size);
+        // Each one was rotated out only once full
+        if (number != newest) {
+            TEST_ASSERT_GREATER_OR_EQUAL(MAX_LOG_SIZE, size);
+        }
+    }
+}
+
+int main() {
+    simNmeaFeed.setCrystalPpm(CRYSTAL_PPM);
+    simRunner.begin(20);
+    simRunner.runUntil(RUN_DAYS * DAY);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_dial_on_time);
+    RUN_TEST(test_clock_locked);
+    RUN_TEST(test_logs_rotated);
+    return UNITY_END();
+}
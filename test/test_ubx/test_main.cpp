@@ -0,0 +1,114 @@
+// Ubx (src/classes): the frames the firmware sends to configure the NEO-6M
+// against reference bytes worked out separately from the u-blox 6 Receiver
+// Description, plus checksum and size edge cases.
+//
+//   pio test -e native_sim -f test_ubx
+
+#include <unity.h>
+#include <string.h>
+#include "Ubx.h"
+
+static uint8_t frame[64];
+
+void setUp() {
+    memset(frame, 0xEE, sizeof(frame));
+}
+
+void tearDown() {}
+
+static void assertFrame(const uint8_t* expected, size_t expectedLength, size_t length) {
+    TEST_ASSERT_EQUAL_UINT32(expectedLength, length);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, frame, expectedLength);
+}
+
+void test_config_rate() {
+    static const uint8_t RATE_200MS[] = {0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0xC8, 0x00, 0x01, 0x00, 0x01, 0x00, 0xDE, 0x6A};
+    assertFrame(RATE_200MS, sizeof(RATE_200MS), Ubx::encodeConfigRate(200, frame, sizeof(frame)));
+}
+
+void test_config_port() {
+    static const uint8_t PORT_38400[] = {0xB5, 0x62, 0x06, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00,
+                                         0x00, 0x96, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x70};
+    assertFrame(PORT_38400, sizeof(PORT_38400), Ubx::encodeConfigPort(38400, frame, sizeof(frame)));
+}
+
+void test_config_message() {
+    static const uint8_t GSV_OFF[] = {0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0xF0, 0x03, 0x00, 0xFD, 0x15};
+    assertFrame(GSV_OFF, sizeof(GSV_OFF),
+                Ubx::encodeConfigMessage(Ubx::CLASS_NMEA, Ubx::NMEA_GSV, 0, frame, sizeof(frame)));
+
+    static const uint8_t RMC_ON[] = {0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0xF0, 0x04, 0x01, 0xFF, 0x18};
+    assertFrame(RMC_ON, sizeof(RMC_ON),
+                Ubx::encodeConfigMessage(Ubx::CLASS_NMEA, Ubx::NMEA_RMC, 1, frame, sizeof(frame)));
+}
+
+void test_aid_init() {
+    // Warm start: position to 5 km, GPS week 2347, 2 s and 1.5 ppm known
+    Ubx::AidInit aid = {};
+    aid.positionValid = true;
+    aid.latitude = 405169000;
+    aid.longitude = -744063000;
+    aid.altitude = 1200;
+    aid.positionAccuracy = 500000;
+    aid.timeValid = true;
+    aid.week = 2347;
+    aid.timeOfWeek = 302400123;
+    aid.timeAccuracy = 2000;
+    aid.clockDriftValid = true;
+    aid.clockDrift = 1500;
+    aid.clockDriftAccuracy = 500;
+    static const uint8_t AID_FULL[] = {0xB5, 0x62, 0x0B, 0x01, 0x30, 0x00, 0x68, 0x63, 0x26, 0x18, 0xE8, 0x7F, 0xA6, 0xD3,
+                                       0xB0, 0x04, 0x00, 0x00, 0x20, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x2B, 0x09, 0x7B, 0x42,
+                                       0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0xDC, 0x05, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x7E, 0xB7};
+    assertFrame(AID_FULL, sizeof(AID_FULL), Ubx::encodeAidInit(aid, frame, sizeof(frame)));
+
+    // After a power cycle the RTC has no time: position alone
+    aid.timeValid = false;
+    aid.clockDriftValid = false;
+    static const uint8_t AID_POSITION[] = {0xB5, 0x62, 0x0B, 0x01, 0x30, 0x00, 0x68, 0x63, 0x26, 0x18, 0xE8, 0x7F, 0xA6, 0xD3,
+                                           0xB0, 0x04, 0x00, 0x00, 0x20, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xC2, 0xD5};
+    assertFrame(AID_POSITION, sizeof(AID_POSITION), Ubx::encodeAidInit(aid, frame, sizeof(frame)));
+}
+
+void test_poll() {
+    // Empty payload
+    static const uint8_t MON_VER_POLL[] = {0xB5, 0x62, 0x0A, 0x04, 0x00, 0x00, 0x0E, 0x34};
+    assertFrame(MON_VER_POLL, sizeof(MON_VER_POLL), Ubx::encode(0x0A, 0x04, nullptr, 0, frame, sizeof(frame)));
+}
+
+void test_checksum() {
+    // The acknowledgement the firmware waits for, checksum alone
+    static const uint8_t ACK_MSG[] = {0xB5, 0x62, 0x05, 0x01, 0x02, 0x00, 0x06, 0x01, 0x0F, 0x38};
+    uint8_t a, b;
+    Ubx::checksum(ACK_MSG + 2, sizeof(ACK_MSG) - 4, &a, &b);
+    TEST_ASSERT_EQUAL_HEX8(ACK_MSG[8], a);
+    TEST_ASSERT_EQUAL_HEX8(ACK_MSG[9], b);
+
+    // Both sums wrap modulo 256: A = 300 * 255, B = 255 * (1 + ... + 300)
+    uint8_t ones[300];
+    memset(ones, 0xFF, sizeof(ones));
+    Ubx::checksum(ones, sizeof(ones), &a, &b);
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)(300u * 255u), a);
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)(255u * 45150u), b);
+}
+
+void test_short_buffer_refused() {
+    // One byte short of the 14-byte frame: nothing written
+    TEST_ASSERT_EQUAL_UINT32(0, Ubx::encodeConfigRate(200, frame, 13));
+    TEST_ASSERT_EQUAL_HEX8(0xEE, frame[0]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_config_rate);
+    RUN_TEST(test_config_port);
+    RUN_TEST(test_config_message);
+    RUN_TEST(test_aid_init);
+    RUN_TEST(test_poll);
+    RUN_TEST(test_checksum);
+    RUN_TEST(test_short_buffer_refused);
+    return UNITY_END();
+}
@@ -0,0 +1,160 @@
+// UbxParser (src/classes) on the recorded receiver output in
+// src/classes/GpsRecording.h: the same frames must come out however the
+// bytes are split between reads, with NMEA text mixed in, and a frame with
+// a damaged checksum must be dropped without losing the ones after it.
+//
+//   pio test -e native_sim -f test_ubx_parser
+
+#include <unity.h>
+#include <vector>
+#include "UbxParser.h"
+#include "GpsRecording.h"
+
+// Five epochs of NAV-POSLLH, NAV-SOL, NAV-DOP and NAV-TIMEUTC
+static const size_t RECORDED_FRAMES = 20;
+
+static const uint8_t* recording = GPS_RECORDING_UBX;
+static const size_t recordingSize = sizeof(GPS_RECORDING_UBX);
+
+struct Collected {
+    std::vector<uint8_t> bytes; // class, id, length and payload of each message
+    size_t messages = 0;
+};
+
+// Every message of the recording parsed in one read
+static Collected whole;
+
+static void collect(const UbxParser::Message& message, void* context) {
+    Collected* collected = static_cast<Collected*>(context);
+    collected->bytes.push_back(message.messageClass);
+    collected->bytes.push_back(message.id);
+    collected->bytes.push_back((uint8_t)message.length);
+    collected->bytes.push_back((uint8_t)(message.length >> 8));
+    collected->bytes.insert(collected->bytes.end(), message.payload, message.payload + message.length);
+    collected->messages++;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_whole_recording() {
+    UbxParser parser;
+    whole = Collected();
+    TEST_ASSERT_EQUAL_UINT32(RECORDED_FRAMES, parser.parse(recording, recordingSize, collect, &whole));
+    TEST_ASSERT_EQUAL_UINT32(RECORDED_FRAMES, whole.messages);
+    TEST_ASSERT_EQUAL_UINT32(0, parser.getChecksumErrors());
+    TEST_ASSERT_EQUAL_UINT32(0, parser.getSkippedBytes());
+
+    // The first NAV-POSLLH: the simulator's default location, 1e-7 degrees
+    TEST_ASSERT_TRUE(whole.bytes.size() > 4 + 12);
+    TEST_ASSERT_EQUAL_HEX8(Ubx::CLASS_NAV, whole.bytes[0]);
+    TEST_ASSERT_EQUAL_HEX8(Ubx::NAV_POSLLH, whole.bytes[1]);
+    TEST_ASSERT_EQUAL_INT32(405169000, UbxParser::readI32(&whole.bytes[4 + 8]));
+    TEST_ASSERT_EQUAL_INT32(-744063000, UbxParser::readI32(&whole.bytes[4 + 4]));
+}
+
+void test_two_reads_every_cut() {
+    for (size_t cut = 1; cut < recordingSize; cut++) {
+        UbxParser split;
+        Collected collected;
+        split.parse(recording, cut, collect, &collected);
+        split.parse(recording + cut, recordingSize - cut, collect, &collected);
+        TEST_ASSERT_TRUE(collected.bytes == whole.bytes);
+        TEST_ASSERT_EQUAL_UINT32(0, split.getSkippedBytes());
+    }
+}
+
+void test_one_byte_per_read() {
+    // Every frame goes through the partial buffer
+    UbxParser single;
+    Collected bytewise;
+    for (size_t i = 0; i < recordingSize; i++) {
+        single.parse(recording + i, 1, collect, &bytewise);
+    }
+    TEST_ASSERT_TRUE(bytewise.bytes == whole.bytes);
+}
+
+void test_nmea_interleaved() {
+    // NMEA text before, between and after the frames, as on a receiver
+    // with both enabled; the text's '$' and digits never start a frame
+    std::vector<uint8_t> mixed(GPS_RECORDING_NMEA, GPS_RECORDING_NMEA + sizeof(GPS_RECORDING_NMEA));
+    size_t half = 0;
+    for (size_t i = 0; i < RECORDED_FRAMES / 2; i++) {
+        half += UbxParser::readU16(recording + half + 4) + Ubx::FRAME_OVERHEAD;
+    }
+    mixed.insert(mixed.end(), recording, recording + half);
+    mixed.insert(mixed.end(), GPS_RECORDING_NMEA, GPS_RECORDING_NMEA + sizeof(GPS_RECORDING_NMEA));
+    mixed.insert(mixed.end(), recording + half, recording + recordingSize);
+    mixed.insert(mixed.end(), GPS_RECORDING_NMEA, GPS_RECORDING_NMEA + sizeof(GPS_RECORDING_NMEA));
+
+    // 128-byte reads
+    UbxParser interleaved;
+    Collected withText;
+    for (size_t offset = 0; offset < mixed.size(); offset += 128) {
+        size_t chunk = mixed.size() - offset < 128 ? mixed.size() - offset : 128;
+        interleaved.parse(mixed.data() + offset, chunk, collect, &withText);
+    }
+    TEST_ASSERT_TRUE(withText.bytes == whole.bytes);
+    TEST_ASSERT_EQUAL_UINT32(3 * sizeof(GPS_RECORDING_NMEA), interleaved.getSkippedBytes());
+}
+
+void test_damaged_checksum_dropped() {
+    // Damaged checksum on the second frame: it alone is dropped
+    std::vector<uint8_t> damaged(recording, recording + recordingSize);
+    size_t first = UbxParser::readU16(recording + 4) + Ubx::FRAME_OVERHEAD;
+    size_t second = UbxParser::readU16(recording + first + 4) + Ubx::FRAME_OVERHEAD;
+    damaged[first + second - 1] ^= 0x5A;
+    UbxParser corrupt;
+    Collected kept;
+    TEST_ASSERT_EQUAL_UINT32(RECORDED_FRAMES - 1, corrupt.parse(damaged.data(), damaged.size(), collect, &kept));
+    TEST_ASSERT_EQUAL_UINT32(1, corrupt.getChecksumErrors());
+}
+
+void test_stray_header_recovered() {
+    // A stray sync pair whose length runs into the first real frame: when
+    // it is assembled across reads and fails its checksum, the frame
+    // inside it must still be found
+    std::vector<uint8_t> stray = {Ubx::SYNC_1, Ubx::SYNC_2, Ubx::CLASS_NAV, Ubx::NAV_SOL, 0x08, 0x00};
+    stray.insert(stray.end(), recording, recording + recordingSize);
+    for (size_t cut = 1; cut < 6 + 16; cut++) {
+        UbxParser resync;
+        Collected collected;
+        resync.parse(stray.data(), cut, collect, &collected);
+        resync.parse(stray.data() + cut, stray.size() - cut, collect, &collected);
+        TEST_ASSERT_TRUE(collected.bytes == whole.bytes);
+        TEST_ASSERT_EQUAL_UINT32(1, resync.getChecksumErrors());
+        TEST_ASSERT_EQUAL_UINT32(6, resync.getSkippedBytes());
+    }
+
+    UbxParser bytewise;
+    Collected collected;
+    for (size_t i = 0; i < stray.size(); i++) {
+        bytewise.parse(stray.data() + i, 1, collect, &collected);
+    }
+    TEST_ASSERT_TRUE(collected.bytes == whole.bytes);
+}
+
+void test_oversized_length_skipped() {
+    // A header claiming more than MAX_PAYLOAD is not buffered
+    std::vector<uint8_t> oversized = {Ubx::SYNC_1, Ubx::SYNC_2, Ubx::CLASS_NAV, Ubx::NAV_SOL, 0xFF, 0x01};
+    oversized.insert(oversized.end(), recording, recording + recordingSize);
+    UbxParser large;
+    Collected afterLarge;
+    large.parse(oversized.data(), oversized.size(), collect, &afterLarge);
+    TEST_ASSERT_TRUE(afterLarge.bytes == whole.bytes);
+    TEST_ASSERT_EQUAL_UINT32(6, large.getSkippedBytes());
+}
+
+int main() {
+    UNITY_BEGIN();
+    // The reference the other cases compare with
+    RUN_TEST(test_whole_recording);
+    RUN_TEST(test_two_reads_every_cut);
+    RUN_TEST(test_one_byte_per_read);
+    RUN_TEST(test_nmea_interleaved);
+    RUN_TEST(test_damaged_checksum_dropped);
+    RUN_TEST(test_stray_header_recovered);
+    RUN_TEST(test_oversized_length_skipped);
+    return UNITY_END();
+}
@@ -0,0 +1,377 @@
+// Host harness for the almanac behind Ephemeris::getAlmanacSummary(): sun
+// and moon rise/set from RiseSetSolver and the moon phase from LunarPhase,
+// the calculations Ephemeris::computeDay is made of, over a grid of dates,
+// latitudes and longitudes. Reports max/mean errors, missed and extra events and
+// the throughput.
+//
+//   g++ -std=gnu++17 -O2 -Isrc/classes -o almanac_validation tools/almanac_validation.cpp
+//       src/classes/RiseSetSolver.cpp src/classes/AstroKernels.cpp
+//       src/classes/PlanetEphemeris.cpp src/classes/LunarPhase.cpp
+//   ./almanac_validation                        # checked-in reference, then the double series
+//   ./almanac_validation usno_reference.csv     # against published times only
+//
+// Run from the repository root. Without arguments it compares against the
+// published times in PUBLISHED_REFERENCE, then against the same Almanac
+// series evaluated in double, scanned for horizon crossings every
+// SCAN_STEP seconds and bisected. The second run measures what the solver
+// and the fixed-point kernels add, not the series' own error. Exit status
+// is 1 if PUBLISHED_REFERENCE is missing or either run fails: a missed or
+// extra event, or a time off by more than SELF_LIMIT_SECONDS against the
+// double series.
+//
+// In a reference file, lines starting with '#' are provenance comments and
+// each other line is one published event (see
+// tools/fetch_usno_reference.py, which writes these from the USNO API):
+//
+//   event,<sun|moon>,<rise|set>,<latitude>,<longitude>,<YYYY-MM-DDTHH:MM> UTC
+//   phase,<new|full>,<YYYY-MM-DDTHH:MM> UTC
+//
+// and is matched to the nearest computed event of its kind, which must be
+// within an hour. The published times are to the minute, so errors under
+// 30 s are rounding. Exit status is 1 if any event has no match.
+
+#include "RiseSetSolver.h"
+#include "LunarPhase.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+
+// Published times checked in by tools/fetch_usno_reference.py
+static const char* PUBLISHED_REFERENCE = "tools/usno_reference.csv";
+static const int64_t SCAN_STEP = 60;
+static const double SELF_LIMIT_SECONDS = 60.0;
+static const int64_t MATCH_WINDOW = 43200;
+// A computed event further than this from the published one is a miss
+static const int64_t MATCH_LIMIT = 3600;
+
+// The grid: every GRID_DAY_STEP days over 2025-2035, and the latitudes and
+// longitudes below
+static const int64_t GRID_FIRST = 1735689600; // 2025-01-01
+static const int64_t GRID_LAST = 2051222400;  // 2035-01-01
+static const int64_t GRID_DAY_STEP = 37;
+static const float GRID_LATITUDES[] = {-60, -45, -30, -10, 0, 10, 30, 45, 55, 60, 65};
+static const float GRID_LONGITUDES[] = {-150, -74.4f, 0, 100};
+
+static const double DEGREES = 180.0 / M_PI;
+
+struct Error {
+    double max;
+    double sum;
+    int count;
+
+    void add(double value) {
+        value = fabs(value);
+        if (value > max) {
+            max = value;
+        }
+        sum += value;
+        count++;
+    }
+    double mean() const {
+        return count > 0 ? sum / count : 0;
+    }
+};
+
+enum Quantity {
+    SUN_RISE, SUN_SET, MOON_RISE, MOON_SET, QUANTITY_COUNT
+};
+
+static const char* QUANTITY_NAMES[QUANTITY_COUNT] = {"sunrise", "sunset", "moonrise", "moonset"};
+
+struct Tally {
+    Error time[QUANTITY_COUNT];
+    Error azimuth[QUANTITY_COUNT];
+    int missed[QUANTITY_COUNT];
+    int extra[QUANTITY_COUNT];
+};
+
+// Altitude above the body's rise/set horizon, in double, with the
+// solver's horizon definitions
+static double referenceAltitude(RiseSetSolver::Body body, int64_t time, double latitude, double longitude,
+                                double* azimuth) {
+    AstroKernels::Arguments<double> arguments;
+    AstroKernels::Equatorial<double> position;
+    AstroKernels::Horizontal<double> horizontal;
+    AstroKernels::argumentsDouble(time, &arguments);
+    double horizon = -0.833 / DEGREES;
+    if (body == RiseSetSolver::SUN) {
+        AstroKernels::sunPosition(arguments, &position);
+    } else {
+        AstroKernels::moonPosition(arguments, &position);
+        double parallax = asin(6378.14 / position.distance);
+        horizon = parallax * (1 - 0.2725) - 0.5667 / DEGREES;
+    }
+    AstroKernels::horizontal(arguments, position, latitude, longitude, &horizontal);
+    if (azimuth) {
+        *azimuth = horizontal.azimuth * DEGREES;
+    }
+    return horizontal.elevation - horizon;
+}
+
+struct Crossing {
+    int64_t time; // UTC seconds, to the second
+    double azimuth;
+    bool rising;
+};
+
+static void referenceCrossings(RiseSetSolver::Body body, int64_t start, int64_t end, double latitude,
+                               double longitude, std::vector<Crossing>* crossings) {
+    double previous = referenceAltitude(body, start, latitude, longitude, nullptr);
+    for (int64_t time = start + SCAN_STEP; time <= end; time += SCAN_STEP) {
+        double current = referenceAltitude(body, time, latitude, longitude, nullptr);
+        if ((previous < 0) != (current < 0)) {
+            int64_t low = time - SCAN_STEP;
+            int64_t high = time;
+            while (high - low > 1) {
+                int64_t middle = (low + high) / 2;
+                double value = referenceAltitude(body, middle, latitude, longitude, nullptr);
+                if ((value < 0) == (previous < 0)) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+            Crossing crossing;
+            crossing.time = low;
+            crossing.rising = previous < 0;
+            referenceAltitude(body, low, latitude, longitude, &crossing.azimuth);
+            crossings->push_back(crossing);
+        }
+        previous = current;
+    }
+}
+
+static double azimuthDifference(double a, double b) {
+    return remainder(a - b, 360.0);
+}
+
+// Pairs computed and reference events of one kind, nearest first
+static void compareEvents(const RiseSetSolver::Event* events, int count, const std::vector<Crossing>& reference,
+                          bool rising, Quantity quantity, Tally* tally) {
+    std::vector<bool> used(count, false);
+    for (const Crossing& crossing : reference) {
+        if (crossing.rising != rising) {
+            continue;
+        }
+        int best = -1;
+        for (int i = 0; i < count; i++) {
+            if (!used[i] && llabs(events[i].time - crossing.time) < MATCH_LIMIT
+                && (best < 0 || llabs(events[i].time - crossing.time) < llabs(events[best].time - crossing.time))) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            tally->missed[quantity]++;
+            continue;
+        }
+        used[best] = true;
+        tally->time[quantity].add((double)(events[best].time - crossing.time));
+        tally->azimuth[quantity].add(azimuthDifference(events[best].azimuth, crossing.azimuth));
+    }
+    for (int i = 0; i < count; i++) {
+        if (!used[i]) {
+            tally->extra[quantity]++;
+        }
+    }
+}
+
+static void printTally(const Tally& tally, bool withAzimuth) {
+    printf("%-9s %8s %10s %10s %7s %6s", "", "events", "max s", "mean s", "missed", "extra");
+    printf(withAzimuth ? " %10s %10s\n" : "\n", "max az", "mean az");
+    for (int q = 0; q < QUANTITY_COUNT; q++) {
+        printf("%-9s %8d %10.1f %10.2f %7d %6d", QUANTITY_NAMES[q], tally.time[q].count, tally.time[q].max,
+               tally.time[q].mean(), tally.missed[q], tally.extra[q]);
+        if (withAzimuth) {
+            printf(" %10.3f %10.4f", tally.azimuth[q].max, tally.azimuth[q].mean());
+        }
+        printf("\n");
+    }
+}
+
+static int selfReference() {
+    Tally tally = {};
+    Error illumination = {};
+    int cases = 0;
+    uint64_t evaluations = 0;
+    double solverSeconds = 0;
+
+    for (int64_t dayStart = GRID_FIRST; dayStart < GRID_LAST; dayStart += GRID_DAY_STEP * 86400) {
+        for (float latitude : GRID_LATITUDES) {
+            for (float longitude : GRID_LONGITUDES) {
+                cases++;
+                // The UTC date; Ephemeris uses the local one, which only shifts the window
+                int64_t dayEnd = dayStart + 86400;
+                RiseSetSolver::Events sunEvents, moonEvents;
+                RiseSetSolver sun(RiseSetSolver::SUN, latitude, longitude);
+                RiseSetSolver moon(RiseSetSolver::MOON, latitude, longitude);
+                auto start = std::chrono::steady_clock::now();
+                sun.solve(dayStart, dayEnd, &sunEvents);
+                moon.solve(dayStart, dayEnd, &moonEvents);
+                solverSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                evaluations += sun.getEvaluations() + moon.getEvaluations();
+
+                double lat = latitude / DEGREES;
+                double lon = longitude / DEGREES;
+                std::vector<Crossing> sunReference, moonReference;
+                referenceCrossings(RiseSetSolver::SUN, dayStart, dayEnd, lat, lon, &sunReference);
+                referenceCrossings(RiseSetSolver::MOON, dayStart, dayEnd, lat, lon, &moonReference);
+                compareEvents(sunEvents.rises, sunEvents.riseCount, sunReference, true, SUN_RISE, &tally);
+                compareEvents(sunEvents.sets, sunEvents.setCount, sunReference, false, SUN_SET, &tally);
+                compareEvents(moonEvents.rises, moonEvents.riseCount, moonReference, true, MOON_RISE, &tally);
+                compareEvents(moonEvents.sets, moonEvents.setCount, moonReference, false, MOON_SET, &tally);
+            }
+        }
+        // Phase: the table and Meeus 48.4 against the double series
+        AstroKernels::Arguments<double> arguments;
+        AstroKernels::Equatorial<double> sunPosition, moonPosition;
+        AstroKernels::Phase<double> phase;
+        AstroKernels::argumentsDouble(dayStart + 43200, &arguments);
+        AstroKernels::sunPosition(arguments, &sunPosition);
+        AstroKernels::moonPosition(arguments, &moonPosition);
+        AstroKernels::moonPhase(sunPosition, moonPosition, &phase);
+        illumination.add(100.0 * (LunarPhase::getIllumination(dayStart + 43200) - phase.illumination));
+    }
+
+    printf("%d cases (dates 2025-2035 every %lld days x %d latitudes x %d longitudes)\n",
+           cases, (long long)GRID_DAY_STEP, (int)(sizeof(GRID_LATITUDES) / sizeof(GRID_LATITUDES[0])),
+           (int)(sizeof(GRID_LONGITUDES) / sizeof(GRID_LONGITUDES[0])));
+    printf("Reference: the Almanac series in double, scanned every %lld s; azimuths in degrees\n\n",
+           (long long)SCAN_STEP);
+    printTally(tally, true);
+    printf("\nIllumination against the double series: max %.2f %%, mean %.3f %%\n", illumination.max,
+           illumination.mean());
+    printf("Solver: %.0f body-days/s, %.1f evaluations per body-day, %.0f evaluations/s\n",
+           2 * cases / solverSeconds, (double)evaluations / (2 * cases), evaluations / solverSeconds);
+
+    bool failed = false;
+    for (int q = 0; q < QUANTITY_COUNT; q++) {
+        failed = failed || tally.missed[q] > 0 || tally.extra[q] > 0 || tally.time[q].max > SELF_LIMIT_SECONDS;
+    }
+    if (failed) {
+        printf("\nMissed or extra events, or a time off by more than %.0f s\n", SELF_LIMIT_SECONDS);
+        return 1;
+    }
+    return 0;
+}
+
+static int64_t parseTime(const char* text) {
+    struct tm tm = {};
+    if (sscanf(text, "%d-%d-%dT%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min) != 5) {
+        return -1;
+    }
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    return (int64_t)timegm(&tm);
+}
+
+static int publishedReference(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        printf("Cannot open %s\n", path);
+        return 1;
+    }
+    Tally tally = {};
+    Error newMoon = {}, fullMoon = {};
+    int phaseMissed = 0;
+    int lines = 0;
+    char line[256];
+    auto start = std::chrono::steady_clock::now();
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#') {
+            continue;
+        }
+        char* fields[7] = {};
+        int count = 0;
+        for (char* field = strtok(line, ",\r\n"); field && count < 7; field = strtok(nullptr, ",\r\n")) {
+            fields[count++] = field;
+        }
+        if (count == 6 && strcmp(fields[0], "event") == 0) {
+            bool isSun = strcmp(fields[1], "sun") == 0;
+            bool rising = strcmp(fields[2], "rise") == 0;
+            float latitude = strtof(fields[3], nullptr);
+            float longitude = strtof(fields[4], nullptr);
+            int64_t time = parseTime(fields[5]);
+            if (time < 0) {
+                continue;
+            }
+            lines++;
+            RiseSetSolver solver(isSun ? RiseSetSolver::SUN : RiseSetSolver::MOON, latitude, longitude);
+            RiseSetSolver::Events events;
+            solver.solve(time - MATCH_WINDOW, time + MATCH_WINDOW, &events);
+            Quantity quantity = isSun ? (rising ? SUN_RISE : SUN_SET) : (rising ? MOON_RISE : MOON_SET);
+            const RiseSetSolver::Event* found = rising ? events.rises : events.sets;
+            int foundCount = rising ? events.riseCount : events.setCount;
+            int best = -1;
+            for (int i = 0; i < foundCount; i++) {
+                if (best < 0 || llabs(found[i].time - time) < llabs(found[best].time - time)) {
+                    best = i;
+                }
+            }
+            if (best < 0 || llabs(found[best].time - time) > MATCH_LIMIT) {
+                tally.missed[quantity]++;
+            } else {
+                tally.time[quantity].add((double)(found[best].time - time));
+            }
+        } else if (count == 3 && strcmp(fields[0], "phase") == 0) {
+            int64_t time = parseTime(fields[2]);
+            if (time < 0) {
+                continue;
+            }
+            lines++;
+            bool isNew = strcmp(fields[1], "new") == 0;
+            if (strcmp(fields[1], "new") != 0 && strcmp(fields[1], "full") != 0) {
+                continue;
+            }
+            time_t computed = isNew ? LunarPhase::getNextNewMoon(time - MATCH_WINDOW)
+                                    : LunarPhase::getNextFullMoon(time - MATCH_WINDOW);
+            if (llabs((int64_t)computed - time) > MATCH_LIMIT) {
+                phaseMissed++;
+            } else {
+                (isNew ? newMoon : fullMoon).add((double)((int64_t)computed - time));
+            }
+        }
+    }
+    fclose(file);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (lines == 0) {
+        printf("No reference lines in %s\n", path);
+        return 1;
+    }
+
+    printf("%d reference lines from %s; times in seconds, published to the minute\n\n", lines, path);
+    printTally(tally, false);
+    printf("%-9s %8d %10.1f %10.2f %7d\n", "new moon", newMoon.count, newMoon.max, newMoon.mean(), phaseMissed);
+    printf("%-9s %8d %10.1f %10.2f\n", "full moon", fullMoon.count, fullMoon.max, fullMoon.mean());
+    printf("\n%.0f reference lines/s, each a one-day solve\n", lines / seconds);
+
+    bool failed = phaseMissed > 0;
+    for (int q = 0; q < QUANTITY_COUNT; q++) {
+        failed = failed || tally.missed[q] > 0;
+    }
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        return publishedReference(argv[1]);
+    }
+    FILE* checkedIn = fopen(PUBLISHED_REFERENCE, "r");
+    if (!checkedIn) {
+        // The series' own run cannot stand in for the sky
+        printf("No published reference at %s; fetch it with tools/fetch_usno_reference.py\n\n",
+               PUBLISHED_REFERENCE);
+        selfReference();
+        printf("FAILED: no published reference\n");
+        return 1;
+    }
+    fclose(checkedIn);
+    int published = publishedReference(PUBLISHED_REFERENCE);
+    printf("\n");
+    int self = selfReference();
+    return published || self ? 1 : 0;
+}
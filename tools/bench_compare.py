@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Compare two benchmark runs.
+
+Each input is a captured serial log (or simulator output); only the
+"BENCH {json}" lines are read. Prints median, p99 and allocations per
+benchmark side by side, and exits 1 if any median or p99 grew by more
+than the threshold, or allocations per call went up.
+
+    tools/bench_compare.py old.log new.log [--threshold 10]
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    results = {}
+    with open(path, encoding="utf-8", errors="replace") as log:
+        for line in log:
+            start = line.find("BENCH {")
+            if start < 0:
+                continue
+            result = json.loads(line[start + len("BENCH "):])
+            results[result["name"]] = result
+    return results
+
+
+def change(old, new):
+    return (new - old) * 100.0 / old if old else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("old")
+    parser.add_argument("new")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed slowdown in percent (default 10)")
+    args = parser.parse_args()
+
+    old = load(args.old)
+    new = load(args.new)
+    if not old or not new:
+        print("No BENCH lines found", file=sys.stderr)
+        return 2
+
+    regressed = False
+    print(f"{'benchmark':32} {'median ns':>21} {'p99 ns':>21} {'allocs':>13}")
+    for name in sorted(set(old) | set(new)):
+        if name not in old or name not in new:
+            print(f"{name:32} only in {'new' if name in new else 'old'}")
+            continue
+        a, b = old[name], new[name]
+        median = change(a["median_ns"], b["median_ns"])
+        p99 = change(a["p99_ns"], b["p99_ns"])
+        flag = ""
+        if median > args.threshold or p99 > args.threshold or b["allocs_per_call"] > a["allocs_per_call"]:
+            flag = "  REGRESSION"
+            regressed = True
+        print(f"{name:32} {b['median_ns']:>10} {median:+8.1f}% {b['p99_ns']:>10} {p99:+8.1f}% "
+              f"{a['allocs_per_call']:>5.1f}->{b['allocs_per_call']:<5.1f}{flag}")
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Write reference lines for tools/almanac_validation.cpp from the US Naval
+Observatory's astronomical applications API (aa.usno.navy.mil): sun and
+moon rise and set over a grid of dates and places, and the year's new and
+full moons. Times are UT, to the minute.
+
+    tools/fetch_usno_reference.py           # writes tools/usno_reference.csv
+    tools/fetch_usno_reference.py out.csv
+
+The file starts with '#' lines giving the source and the fetch date, and
+is only written once every request has succeeded, so a checked-in copy is
+always a whole, traceable set. The grid is kept small (about 1000 lines)
+for that. Needs network access; requests are spaced by REQUEST_INTERVAL
+seconds.
+"""
+
+import json
+import os
+import re
+import sys
+import time
+import urllib.request
+from datetime import date, datetime, timedelta, timezone
+
+API = "https://aa.usno.navy.mil/api"
+REQUEST_INTERVAL = 0.5
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "usno_reference.csv")
+
+FIRST_DATE = date(2025, 1, 1)
+LAST_DATE = date(2027, 12, 31)
+DAY_STEP = 37
+PLACES = [(-45.0, 170.5), (-33.87, 151.21), (0.0, -78.5), (19.43, -99.13), (40.52, -74.41),
+          (51.48, 0.0), (60.17, 24.94), (64.14, -21.94)]
+
+PHENOMENA = {"Rise": "rise", "Set": "set"}
+PHASES = {"New Moon": "new", "Full Moon": "full"}
+
+
+def fetch(path):
+    with urllib.request.urlopen(API + path, timeout=30) as response:
+        result = json.load(response)
+    time.sleep(REQUEST_INTERVAL)
+    return result
+
+
+def clock(text):
+    match = re.match(r"(\d{1,2}):(\d{2})", text)
+    return "%02d:%s" % (int(match.group(1)), match.group(2)) if match else None
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else OUTPUT
+    lines = [
+        "# Published times from the USNO Astronomical Applications API, %s\n" % API,
+        "# fetched %s by tools/fetch_usno_reference.py\n" % datetime.now(timezone.utc).strftime("%Y-%m-%dT%H:%MZ"),
+        "# rise/set: %s to %s every %d days at %s; phases: %d to %d\n"
+        % (FIRST_DATE.isoformat(), LAST_DATE.isoformat(), DAY_STEP,
+           " ".join("%.2f,%.2f" % place for place in PLACES), FIRST_DATE.year, LAST_DATE.year),
+    ]
+    day = FIRST_DATE
+    while day <= LAST_DATE:
+        for latitude, longitude in PLACES:
+            data = fetch("/rstt/oneday?date=%s&coords=%.4f,%.4f&tz=0" % (day.isoformat(), latitude, longitude))
+            properties = data["properties"]["data"]
+            for body, key in (("sun", "sundata"), ("moon", "moondata")):
+                for entry in properties.get(key, []):
+                    kind = PHENOMENA.get(entry.get("phen"))
+                    at = clock(entry.get("time", ""))
+                    if kind and at:
+                        lines.append("event,%s,%s,%.4f,%.4f,%sT%s\n" % (body, kind, latitude, longitude, day.isoformat(), at))
+        day += timedelta(days=DAY_STEP)
+
+    for year in range(FIRST_DATE.year, LAST_DATE.year + 1):
+        data = fetch("/moon/phases/year?year=%d" % year)
+        for entry in data["phasedata"]:
+            kind = PHASES.get(entry["phase"])
+            at = clock(entry["time"])
+            if kind and at:
+                lines.append("phase,%s,%04d-%02d-%02dT%s\n" % (kind, entry["year"], entry["month"], entry["day"], at))
+
+    # Nothing is written unless every request succeeded
+    temp = path + ".tmp"
+    with open(temp, "w") as out:
+        out.writelines(lines)
+    os.replace(temp, path)
+    print("%d reference lines written to %s" % (len(lines) - 3, path), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
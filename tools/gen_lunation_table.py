@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Generate src/classes/LunationTable.h, the new and full moon times used by
+LunarPhase.
+
+Times are computed with the true-phase algorithm of Meeus, Astronomical
+Algorithms (2nd ed.), chapter 49: the mean phase plus the periodic terms
+and the 14 planetary arguments, accurate to well under a minute. They are
+converted from TT to UT with the Espenak & Meeus polynomials for delta T.
+Each time is stored as its offset from the mean phase in 2-second units,
+two int16 per lunation.
+
+    tools/gen_lunation_table.py > src/classes/LunationTable.h
+"""
+
+import math
+import sys
+
+FIRST_YEAR = 2000
+LAST_YEAR = 2100
+UNIT_SECONDS = 2
+
+# Mean new moon k = 0 (2000-01-06) and the synodic month, as in Meeus 49.1
+MEAN_EPOCH_JDE = 2451550.09766
+SYNODIC_DAYS = 29.530588861
+UNIX_EPOCH_JD = 2440587.5
+
+
+def sin_deg(x):
+    return math.sin(math.radians(x))
+
+
+def delta_t(year):
+    """TT - UT in seconds, Espenak & Meeus (2006)."""
+    t = year - 2000
+    if year < 2005:
+        return 63.86 + 0.3345 * t - 0.060374 * t**2 + 0.0017275 * t**3 \
+            + 0.000651814 * t**4 + 0.00002373599 * t**5
+    if year < 2050:
+        return 62.92 + 0.32217 * t + 0.005589 * t**2
+    if year < 2150:
+        u = (year - 1820) / 100
+        return -20 + 32 * u**2 - 0.5628 * (2150 - year)
+    raise ValueError(year)
+
+
+def mean_phase_jde(k):
+    t = k / 1236.85
+    return MEAN_EPOCH_JDE + SYNODIC_DAYS * k + 0.00015437 * t**2 \
+        - 0.000000150 * t**3 + 0.00000000073 * t**4
+
+
+def true_phase_jde(k):
+    """k integral for a new moon, k + 0.5 for a full moon."""
+    t = k / 1236.85
+    jde = mean_phase_jde(k)
+    e = 1 - 0.002516 * t - 0.0000074 * t**2
+    m = 2.5534 + 29.10535670 * k - 0.0000014 * t**2 - 0.00000011 * t**3
+    mp = 201.5643 + 385.81693528 * k + 0.0107582 * t**2 + 0.00001238 * t**3 \
+        - 0.000000058 * t**4
+    f = 160.7108 + 390.67050284 * k - 0.0016118 * t**2 - 0.00000227 * t**3 \
+        + 0.000000011 * t**4
+    omega = 124.7746 - 1.56375588 * k + 0.0020672 * t**2 + 0.00000215 * t**3
+
+    if k == math.floor(k):
+        c = [-0.40720, 0.17241, 0.01608, 0.01039, 0.00739, -0.00514, 0.00208]
+    else:
+        c = [-0.40614, 0.17302, 0.01614, 0.01043, 0.00734, -0.00515, 0.00209]
+    correction = (c[0] * sin_deg(mp)
+                  + c[1] * e * sin_deg(m)
+                  + c[2] * sin_deg(2 * mp)
+                  + c[3] * sin_deg(2 * f)
+                  + c[4] * e * sin_deg(mp - m)
+                  + c[5] * e * sin_deg(mp + m)
+                  + c[6] * e * e * sin_deg(2 * m)
+                  - 0.00111 * sin_deg(mp - 2 * f)
+                  - 0.00057 * sin_deg(mp + 2 * f)
+                  + 0.00056 * e * sin_deg(2 * mp + m)
+                  - 0.00042 * sin_deg(3 * mp)
+                  + 0.00042 * e * sin_deg(m + 2 * f)
+                  + 0.00038 * e * sin_deg(m - 2 * f)
+                  - 0.00024 * e * sin_deg(2 * mp - m)
+                  - 0.00017 * sin_deg(omega)
+                  - 0.00007 * sin_deg(mp + 2 * m)
+                  + 0.00004 * sin_deg(2 * mp - 2 * f)
+                  + 0.00004 * sin_deg(3 * m)
+                  + 0.00003 * sin_deg(mp + m - 2 * f)
+                  + 0.00003 * sin_deg(2 * mp + 2 * f)
+                  - 0.00003 * sin_deg(mp + m + 2 * f)
+                  + 0.00003 * sin_deg(mp - m + 2 * f)
+                  - 0.00002 * sin_deg(mp - m - 2 * f)
+                  - 0.00002 * sin_deg(3 * mp + m)
+                  + 0.00002 * sin_deg(4 * mp))
+
+    planetary = [
+        (0.000325, 299.77 + 0.107408 * k - 0.009173 * t**2),
+        (0.000165, 251.88 + 0.016321 * k),
+        (0.000164, 251.83 + 26.651886 * k),
+        (0.000126, 349.42 + 36.412478 * k),
+        (0.000110, 84.66 + 18.206239 * k),
+        (0.000062, 141.74 + 53.303771 * k),
+        (0.000060, 207.14 + 2.453732 * k),
+        (0.000056, 154.84 + 7.306860 * k),
+        (0.000047, 34.52 + 27.261239 * k),
+        (0.000042, 207.19 + 0.121824 * k),
+        (0.000040, 291.34 + 1.844379 * k),
+        (0.000037, 161.72 + 24.198154 * k),
+        (0.000035, 239.56 + 25.513099 * k),
+        (0.000023, 331.55 + 3.592518 * k),
+    ]
+    correction += sum(a * sin_deg(x) for a, x in planetary)
+    return jde + correction
+
+
+def jde_to_unix(jde):
+    seconds = (jde - UNIX_EPOCH_JD) * 86400
+    year = 1970 + seconds / (365.2425 * 86400)
+    return seconds - delta_t(year)
+
+
+def mean_unix(k):
+    """The linear mean the table offsets are taken from, as LunarPhase has it."""
+    return (MEAN_EPOCH_JDE - UNIX_EPOCH_JD + SYNODIC_DAYS * k) * 86400
+
+
+def main():
+    first_k = math.ceil((FIRST_YEAR - 2000.0) * 12.3685) - 1
+    last_k = math.floor((LAST_YEAR - 2000.0) * 12.3685) + 1
+    rows = []
+    for k in range(first_k, last_k + 1):
+        offsets = []
+        for phase in (0.0, 0.5):
+            unix = jde_to_unix(true_phase_jde(k + phase))
+            offset = round((unix - mean_unix(k + phase)) / UNIT_SECONDS)
+            if not -32768 <= offset <= 32767:
+                raise ValueError("offset out of range at k=%s" % (k + phase))
+            offsets.append(offset)
+        rows.append(offsets)
+
+    out = sys.stdout
+    out.write("#ifndef LUNATION_TABLE_H\n#define LUNATION_TABLE_H\n\n")
+    out.write("// Generated by tools/gen_lunation_table.py, do not edit.\n")
+    out.write("// New and full moon of lunations %d..%d (%d-%d): UT offsets from the\n"
+              % (first_k, last_k, FIRST_YEAR, LAST_YEAR))
+    out.write("// mean phase (k = 0 at JDE %.5f, %.9f days apart) in %d s units.\n\n"
+              % (MEAN_EPOCH_JDE, SYNODIC_DAYS, UNIT_SECONDS))
+    out.write("#include <stdint.h>\n\n")
+    out.write("static const int32_t LUNATION_TABLE_FIRST = %d;\n" % first_k)
+    out.write("static const int32_t LUNATION_TABLE_COUNT = %d;\n" % len(rows))
+    out.write("static const int32_t LUNATION_TABLE_UNIT = %d;\n\n" % UNIT_SECONDS)
+    out.write("static const int16_t LUNATION_TABLE[%d][2] = {\n" % len(rows))
+    for i in range(0, len(rows), 6):
+        chunk = rows[i:i + 6]
+        out.write("    " + " ".join("{%d, %d}," % (a, b) for a, b in chunk) + "\n")
+    out.write("};\n\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Generate src/classes/PlanetTable.h, Chebyshev coefficient blocks for the
+heliocentric positions of Mercury to Saturn and the Earth-Moon barycentre,
+used by PlanetEphemeris.
+
+The positions come from the Keplerian elements and rates of E. M. Standish,
+"Keplerian Elements for Approximate Positions of the Major Planets" (JPL,
+table 1, 1800-2050), rotated to the mean equator and equinox of date (IAU
+1976 precession) so they share the frame of the sun and moon kernels. That
+model is good to 15" (Mercury) .. 10' (Saturn) against the JPL DE
+ephemerides; the Chebyshev fit adds less than FIT_TOLERANCE_ARCSEC on top,
+as seen from the Earth at the body's closest approach.
+
+For each body the block length and degree with the fewest coefficients
+that meet the tolerance are chosen. Coefficients are stored as float, in
+AU, per block and coordinate (x, y, z).
+
+    tools/gen_planet_table.py > src/classes/PlanetTable.h
+    tools/gen_planet_table.py --check 2000 > vectors.txt   # for planet_accuracy
+"""
+
+import math
+import sys
+
+from gen_lunation_table import delta_t
+
+FIRST_YEAR = 2025
+LAST_YEAR = 2055
+FIT_TOLERANCE_ARCSEC = 1.0
+
+J2000_UNIX = 946728000
+DAY = 86400.0
+ARCSEC = math.pi / 180 / 3600
+
+# name, elements at J2000 (a au, e, I deg, L deg, long. perihelion deg,
+# long. node deg), rates per Julian century, least distance from Earth (au)
+BODIES = [
+    ("MERCURY", (0.38709927, 0.20563593, 7.00497902, 252.25032350, 77.45779628, 48.33076593),
+     (0.00000037, 0.00001906, -0.00594749, 149472.67411175, 0.16047689, -0.12534081), 0.55),
+    ("VENUS", (0.72333566, 0.00677672, 3.39467605, 181.97909950, 131.60246718, 76.67984255),
+     (0.00000390, -0.00004107, -0.00078890, 58517.81538729, 0.00268329, -0.27769418), 0.26),
+    ("MARS", (1.52371034, 0.09339410, 1.84969142, -4.55343205, -23.94362959, 49.55953891),
+     (0.00001847, 0.00007882, -0.00813131, 19140.30268499, 0.44441088, -0.29257343), 0.37),
+    ("JUPITER", (5.20288700, 0.04838624, 1.30439695, 34.39644051, 14.72847983, 100.47390909),
+     (-0.00011607, -0.00013253, -0.00183714, 3034.74612775, 0.21252668, 0.20469106), 3.9),
+    ("SATURN", (9.53667594, 0.05386179, 2.48599187, 49.95424423, 92.59887831, 113.66242448),
+     (-0.00125060, -0.00050991, 0.00193609, 1222.49362201, -0.41897216, -0.28867794), 8.0),
+    # The Earth's error shows on every body; the nearest is Venus
+    ("EARTH", (1.00000261, 0.01671123, -0.00001531, 100.46457166, 102.93768193, 0.0),
+     (0.00000562, -0.00004392, -0.01294668, 35999.37244981, 0.32327364, 0.0), 0.26),
+]
+
+BLOCK_DAYS = [16, 32, 64, 128, 256, 512, 1024]
+DEGREES = range(5, 25)
+
+OBLIQUITY_J2000 = math.radians(23.43928)
+
+
+def unix_time(year):
+    days = 0
+    for y in range(1970, year):
+        days += 366 if (y % 4 == 0 and y % 100 != 0) or y % 400 == 0 else 365
+    return days * 86400
+
+
+def heliocentric(body, unix):
+    """Equatorial of date, au, at a UTC time."""
+    _, base, rate, _ = body
+    year = 1970 + unix / (365.2425 * DAY)
+    t = (unix + delta_t(year) - J2000_UNIX) / DAY / 36525
+    a, e, incl, mean_long, peri, node = (b + r * t for b, r in zip(base, rate))
+    incl, peri, node = math.radians(incl), math.radians(peri), math.radians(node)
+    anomaly = math.radians((mean_long - math.degrees(peri) + 180) % 360 - 180)
+
+    ecc = anomaly + e * math.sin(anomaly)
+    for _ in range(20):
+        step = (ecc - e * math.sin(ecc) - anomaly) / (1 - e * math.cos(ecc))
+        ecc -= step
+        if abs(step) < 1e-14:
+            break
+    xp = a * (math.cos(ecc) - e)
+    yp = a * math.sqrt(1 - e * e) * math.sin(ecc)
+
+    w = peri - node
+    cw, sw, cn, sn, ci, si = (math.cos(w), math.sin(w), math.cos(node), math.sin(node),
+                              math.cos(incl), math.sin(incl))
+    x = (cw * cn - sw * sn * ci) * xp + (-sw * cn - cw * sn * ci) * yp
+    y = (cw * sn + sw * cn * ci) * xp + (-sw * sn + cw * cn * ci) * yp
+    z = (sw * si) * xp + (cw * si) * yp
+
+    # Ecliptic J2000 to equator J2000, then precession to the date
+    ce, se = math.cos(OBLIQUITY_J2000), math.sin(OBLIQUITY_J2000)
+    x, y, z = x, y * ce - z * se, y * se + z * ce
+    zeta = (2306.2181 * t + 0.30188 * t * t + 0.017998 * t ** 3) * ARCSEC
+    zed = (2306.2181 * t + 1.09468 * t * t + 0.018203 * t ** 3) * ARCSEC
+    theta = (2004.3109 * t - 0.42665 * t * t - 0.041833 * t ** 3) * ARCSEC
+    cz, sz, cZ, sZ, ct, st = (math.cos(zeta), math.sin(zeta), math.cos(zed), math.sin(zed),
+                              math.cos(theta), math.sin(theta))
+    return (
+        (cz * cZ * ct - sz * sZ) * x + (-sz * cZ * ct - cz * sZ) * y - cZ * st * z,
+        (cz * sZ * ct + sz * cZ) * x + (-sz * sZ * ct + cz * cZ) * y - sZ * st * z,
+        cz * st * x - sz * st * y + ct * z,
+    )
+
+
+def fit_block(body, start, block_days, degree):
+    """Chebyshev coefficients of x, y, z over [start, start + block_days)."""
+    count = degree + 1
+    nodes = [math.cos(math.pi * (k + 0.5) / count) for k in range(count)]
+    values = [heliocentric(body, start + (x + 1) / 2 * block_days * DAY) for x in nodes]
+    coefficients = []
+    for axis in range(3):
+        row = []
+        for j in range(count):
+            total = sum(values[k][axis] * math.cos(math.pi * j * (k + 0.5) / count) for k in range(count))
+            row.append(total * 2 / count)
+        row[0] /= 2
+        coefficients.append(row)
+    return coefficients
+
+
+def evaluate(coefficients, x):
+    result = []
+    for row in coefficients:
+        b1 = b2 = 0.0
+        for c in reversed(row[1:]):
+            b1, b2 = 2 * x * b1 - b2 + c, b1
+        result.append(x * b1 - b2 + row[0])
+    return result
+
+
+def block_error(body, start, block_days, coefficients, samples=12):
+    worst = 0.0
+    for i in range(samples):
+        x = -1 + 2 * (i + 0.37) / samples
+        fitted = evaluate(coefficients, x)
+        exact = heliocentric(body, start + (x + 1) / 2 * block_days * DAY)
+        worst = max(worst, math.dist(fitted, exact))
+    return worst
+
+
+def choose(body, start, end):
+    """The cheapest block length and degree meeting the tolerance."""
+    limit = FIT_TOLERANCE_ARCSEC * ARCSEC * body[3]
+    best = None
+    for block_days in BLOCK_DAYS:
+        blocks = math.ceil((end - start) / (block_days * DAY))
+        for degree in DEGREES:
+            size = blocks * 3 * (degree + 1)
+            if best and size >= best[0]:
+                break
+            # Try a spread of blocks first, the full range only for the winner
+            trial = [start + i * (blocks // 7) * block_days * DAY for i in range(7)]
+            if all(block_error(body, s, block_days, fit_block(body, s, block_days, degree)) < limit * 0.8
+                   for s in trial):
+                best = (size, block_days, degree)
+                break
+    return best
+
+
+def generate(out, err):
+    start = unix_time(FIRST_YEAR)
+    end = unix_time(LAST_YEAR)
+    out.write("#ifndef PLANET_TABLE_H\n#define PLANET_TABLE_H\n\n")
+    out.write("// Generated by tools/gen_planet_table.py, do not edit.\n")
+    out.write("// Chebyshev blocks of heliocentric x, y, z (au, equator and equinox of\n")
+    out.write("// date) from %d-01-01 to %d-01-01 UTC, fitted to the Standish elements\n"
+              "// within %.1f\" as seen from the Earth.\n\n" % (FIRST_YEAR, LAST_YEAR, FIT_TOLERANCE_ARCSEC))
+    out.write("#include \"PlanetEphemeris.h\"\n\n")
+    out.write("static const int64_t PLANET_TABLE_START = %d;\n" % start)
+    out.write("static const int64_t PLANET_TABLE_END = %d;\n\n" % end)
+    series = []
+    total = 0
+    for body in BODIES:
+        name = body[0]
+        size, block_days, degree = choose(body, start, end)
+        blocks = math.ceil((end - start) / (block_days * DAY))
+        worst = 0.0
+        out.write("static const float %s_COEFFICIENTS[%d] = {\n" % (name, blocks * 3 * (degree + 1)))
+        for b in range(blocks):
+            block_start = start + b * block_days * DAY
+            coefficients = fit_block(body, block_start, block_days, degree)
+            worst = max(worst, block_error(body, block_start, block_days, coefficients, 6))
+            for row in coefficients:
+                out.write("    " + ", ".join("%.9gf" % c for c in row) + ",\n")
+        out.write("};\n\n")
+        series.append((name, block_days, degree + 1, blocks))
+        total += size * 4
+        err.write("%-8s %3d-day blocks, degree %2d, %5d bytes, max fit error %.3f\" at %.2f au\n"
+                  % (name, block_days, degree, size * 4, worst / ARCSEC / body[3], body[3]))
+        if worst > FIT_TOLERANCE_ARCSEC * ARCSEC * body[3]:
+            raise SystemExit("%s fit over tolerance" % name)
+    out.write("static const PlanetEphemeris::Series PLANET_SERIES[%d] = {\n" % len(series))
+    for name, block_days, count, blocks in series:
+        out.write("    {%d, %d, %d, %s_COEFFICIENTS}, // %s\n"
+                  % (block_days, count, blocks, name, name.capitalize()))
+    out.write("};\n\n#endif\n")
+    err.write("total %d bytes\n" % total)
+
+
+def geocentric(index, unix):
+    """Right ascension, declination (radians) and distance with light time."""
+    earth = heliocentric(BODIES[-1], unix)
+    distance = 0.0
+    for _ in range(3):
+        planet = heliocentric(BODIES[index], unix - distance * 499.004784)
+        vector = [p - e for p, e in zip(planet, earth)]
+        distance = math.sqrt(sum(c * c for c in vector))
+    ra = math.atan2(vector[1], vector[0]) % (2 * math.pi)
+    return ra, math.asin(vector[2] / distance), distance
+
+
+def check_vectors(count, out):
+    """Reference positions straight from the elements, for planet_accuracy."""
+    start = unix_time(FIRST_YEAR)
+    end = unix_time(LAST_YEAR)
+    state = 12345
+    for i in range(count):
+        state = (state * 6364136223846793005 + 1442695040888963407) % (1 << 64)
+        unix = start + (state >> 11) % (end - start)
+        index = i % (len(BODIES) - 1)
+        ra, dec, distance = geocentric(index, unix)
+        out.write("%d %d %.9f %.9f %.9f\n" % (unix, index, ra, dec, distance))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 3 and sys.argv[1] == "--check":
+        check_vectors(int(sys.argv[2]), sys.stdout)
+    else:
+        generate(sys.stdout, sys.stderr)
@@ -0,0 +1,211 @@
+// Host harness for src/classes/AstroKernels: runs the float and fixed-point
+// kernels against the double path over many dates and places and reports
+// the largest and RMS errors and the time per evaluation.
+//
+//   g++ -std=gnu++17 -O2 -Isrc/classes -o kernel_accuracy
+//       tools/kernel_accuracy.cpp src/classes/AstroKernels.cpp
+//
+// Exit status is 1 if the fixed-point path is off by more than
+// FIXED_LIMIT_ARCMIN anywhere, the bound the display relies on. Host
+// timings only show the relative cost; the benchmark build measures the
+// kernels on the ESP32 itself, where double is emulated in software.
+
+#include "AstroKernels.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <chrono>
+
+static const double FIXED_LIMIT_ARCMIN = 1.0;
+static const int SAMPLES = 200000;
+static const int TIMING_CALLS = 200000;
+
+// 1990-01-01 to 2060-01-01 UTC
+static const int64_t FIRST_TIME = 631152000;
+static const int64_t LAST_TIME = 2840140800;
+
+static const double ARCMIN = 180.0 * 60.0 / M_PI;
+
+struct Error {
+    double max;
+    double sumSquares;
+    int count;
+
+    void add(double value) {
+        value = fabs(value);
+        if (value > max) {
+            max = value;
+        }
+        sumSquares += value * value;
+        count++;
+    }
+    double rms() const {
+        return count > 0 ? sqrt(sumSquares / count) : 0;
+    }
+};
+
+enum Measure {
+    JULIAN_DATE, SUN_EQUATORIAL, SUN_HORIZONTAL, MOON_ECLIPTIC, MOON_EQUATORIAL,
+    MOON_HORIZONTAL, PHASE_ANGLE, ILLUMINATION, MEASURE_COUNT
+};
+
+static const char* MEASURE_NAMES[MEASURE_COUNT] = {
+    "julian date", "sun RA/dec", "sun az/el", "moon lon/lat", "moon RA/dec",
+    "moon az/el", "phase angle", "illumination"
+};
+static const char* MEASURE_UNITS[MEASURE_COUNT] = {
+    "s", "arcmin", "arcmin", "arcmin", "arcmin", "arcmin", "arcmin", "%"
+};
+// Sky positions, the ones the display limit applies to
+static const bool MEASURE_LIMITED[MEASURE_COUNT] = {
+    false, true, true, true, true, true, true, false
+};
+
+// Angle between two directions on the sphere, radians
+static double separation(double longitude1, double latitude1, double longitude2, double latitude2) {
+    double x = cos(latitude2) * sin(longitude2 - longitude1);
+    double y = cos(latitude1) * sin(latitude2) - sin(latitude1) * cos(latitude2) * cos(longitude2 - longitude1);
+    double z = sin(latitude1) * sin(latitude2) + cos(latitude1) * cos(latitude2) * cos(longitude2 - longitude1);
+    return atan2(sqrt(x * x + y * y), z);
+}
+
+static double wrapped(double difference) {
+    return remainder(difference, 2 * M_PI);
+}
+
+struct Result {
+    AstroKernels::Equatorial<double> sun;
+    AstroKernels::Equatorial<double> moon;
+    AstroKernels::Horizontal<double> sunHorizontal;
+    AstroKernels::Horizontal<double> moonHorizontal;
+    AstroKernels::Phase<double> phase;
+};
+
+template <typename T>
+static void evaluate(const AstroKernels::Arguments<T>& arguments, double latitude, double longitude, Result* result) {
+    AstroKernels::Equatorial<T> sun, moon;
+    AstroKernels::Horizontal<T> sunHorizontal, moonHorizontal;
+    AstroKernels::Phase<T> phase;
+    AstroKernels::sunPosition(arguments, &sun);
+    AstroKernels::moonPosition(arguments, &moon);
+    AstroKernels::horizontal(arguments, sun, (T)latitude, (T)longitude, &sunHorizontal);
+    AstroKernels::horizontal(arguments, moon, (T)latitude, (T)longitude, &moonHorizontal);
+    AstroKernels::moonPhase(sun, moon, &phase);
+
+    result->sun = {sun.longitude, sun.latitude, sun.rightAscension, sun.declination, sun.distance};
+    result->moon = {moon.longitude, moon.latitude, moon.rightAscension, moon.declination, moon.distance};
+    result->sunHorizontal = {sunHorizontal.azimuth, sunHorizontal.elevation};
+    result->moonHorizontal = {moonHorizontal.azimuth, moonHorizontal.elevation};
+    result->phase = {phase.elongation, phase.phaseAngle, phase.illumination};
+}
+
+static void compare(const Result& reference, const Result& result, Error* errors) {
+    errors[SUN_EQUATORIAL].add(ARCMIN * separation(reference.sun.rightAscension, reference.sun.declination,
+                                                   result.sun.rightAscension, result.sun.declination));
+    errors[SUN_HORIZONTAL].add(ARCMIN * separation(reference.sunHorizontal.azimuth, reference.sunHorizontal.elevation,
+                                                   result.sunHorizontal.azimuth, result.sunHorizontal.elevation));
+    errors[MOON_ECLIPTIC].add(ARCMIN * separation(reference.moon.longitude, reference.moon.latitude,
+                                                  result.moon.longitude, result.moon.latitude));
+    errors[MOON_EQUATORIAL].add(ARCMIN * separation(reference.moon.rightAscension, reference.moon.declination,
+                                                    result.moon.rightAscension, result.moon.declination));
+    errors[MOON_HORIZONTAL].add(ARCMIN * separation(reference.moonHorizontal.azimuth, reference.moonHorizontal.elevation,
+                                                    result.moonHorizontal.azimuth, result.moonHorizontal.elevation));
+    errors[PHASE_ANGLE].add(ARCMIN * wrapped(reference.phase.phaseAngle - result.phase.phaseAngle));
+    errors[ILLUMINATION].add(100.0 * (reference.phase.illumination - result.phase.illumination));
+}
+
+// Deterministic, so every run checks the same cases
+static uint64_t nextRandom(uint64_t* state) {
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state >> 11;
+}
+
+static double uniform(uint64_t* state, double low, double high) {
+    return low + (high - low) * (double)nextRandom(state) / 9007199254740992.0;
+}
+
+static volatile double sink;
+
+template <typename Function>
+static double nanosPerCall(Function function) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TIMING_CALLS; i++) {
+        function(i);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / TIMING_CALLS;
+}
+
+int main() {
+    Error floatErrors[MEASURE_COUNT] = {};
+    Error fixedErrors[MEASURE_COUNT] = {};
+    uint64_t state = 1;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        int64_t time = (int64_t)uniform(&state, (double)FIRST_TIME, (double)LAST_TIME);
+        double latitude = uniform(&state, -80, 80) * M_PI / 180.0;
+        double longitude = uniform(&state, -180, 180) * M_PI / 180.0;
+
+        AstroKernels::Time split = AstroKernels::timeFromUnix(time);
+        fixedErrors[JULIAN_DATE].add((AstroKernels::julianDate(split) - AstroKernels::julianDate(time)) * 86400.0);
+        // A float Julian date, for scale
+        floatErrors[JULIAN_DATE].add(((double)(float)AstroKernels::julianDate(time) - AstroKernels::julianDate(time)) * 86400.0);
+
+        AstroKernels::Arguments<double> doubleArguments;
+        AstroKernels::Arguments<float> floatArguments, fixedArguments;
+        AstroKernels::argumentsDouble(time, &doubleArguments);
+        AstroKernels::argumentsFloat(time, &floatArguments);
+        AstroKernels::argumentsFixed(split, &fixedArguments);
+
+        Result reference, floatResult, fixedResult;
+        evaluate(doubleArguments, latitude, longitude, &reference);
+        evaluate(floatArguments, latitude, longitude, &floatResult);
+        evaluate(fixedArguments, latitude, longitude, &fixedResult);
+        compare(reference, floatResult, floatErrors);
+        compare(reference, fixedResult, fixedErrors);
+    }
+
+    printf("%d samples, 1990-2060, latitudes -80..80\n\n", SAMPLES);
+    printf("%-14s %-7s %12s %12s %12s %12s\n", "", "", "float max", "float rms", "fixed max", "fixed rms");
+    bool failed = false;
+    for (int i = 0; i < MEASURE_COUNT; i++) {
+        printf("%-14s %-7s %12.4f %12.4f %12.4f %12.4f%s\n", MEASURE_NAMES[i], MEASURE_UNITS[i],
+               floatErrors[i].max, floatErrors[i].rms(), fixedErrors[i].max, fixedErrors[i].rms(),
+               MEASURE_LIMITED[i] && fixedErrors[i].max > FIXED_LIMIT_ARCMIN ? "  OVER LIMIT" : "");
+        if (MEASURE_LIMITED[i] && fixedErrors[i].max > FIXED_LIMIT_ARCMIN) {
+            failed = true;
+        }
+    }
+
+    // Sun and moon, positions, horizon and phase at one place
+    const double latitude = 40.5169 * M_PI / 180.0;
+    const double longitude = -74.4063 * M_PI / 180.0;
+    double doubleNanos = nanosPerCall([&](int i) {
+        Result result;
+        AstroKernels::Arguments<double> arguments;
+        AstroKernels::argumentsDouble(FIRST_TIME + (int64_t)i * 997, &arguments);
+        evaluate(arguments, latitude, longitude, &result);
+        sink = result.phase.illumination;
+    });
+    double floatNanos = nanosPerCall([&](int i) {
+        Result result;
+        AstroKernels::Arguments<float> arguments;
+        AstroKernels::argumentsFloat(FIRST_TIME + (int64_t)i * 997, &arguments);
+        evaluate(arguments, latitude, longitude, &result);
+        sink = result.phase.illumination;
+    });
+    double fixedNanos = nanosPerCall([&](int i) {
+        Result result;
+        AstroKernels::Arguments<float> arguments;
+        AstroKernels::argumentsFixed(AstroKernels::timeFromUnix(FIRST_TIME + (int64_t)i * 997), &arguments);
+        evaluate(arguments, latitude, longitude, &result);
+        sink = result.phase.illumination;
+    });
+    printf("\nHost time per evaluation: double %.0f ns, float %.0f ns (%.2fx), fixed %.0f ns (%.2fx)\n",
+           doubleNanos, floatNanos, doubleNanos / floatNanos, fixedNanos, doubleNanos / fixedNanos);
+
+    if (failed) {
+        printf("\nFixed-point error over %.1f arcmin\n", FIXED_LIMIT_ARCMIN);
+        return 1;
+    }
+    return 0;
+}
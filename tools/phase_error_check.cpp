@@ -0,0 +1,117 @@
+// Host check for the step timeline (src/classes/StepSchedule behind
+// src/classes/StepEngine) over 30 virtual days. The timer fires each shot
+// up to MAX_LATENCY_US late, as esp_timer dispatch does; every step is
+// compared with anchor + n * period / steps worked out in 128-bit integers,
+// so a remainder lost per step would show up as growing phase error. The
+// engine's own reported maximum must agree.
+//
+//   g++ -std=gnu++17 -O2 -Wall -Wextra -Isrc/classes -o phase_error_check tools/phase_error_check.cpp src/classes/StepEngine.cpp src/classes/StepSchedule.cpp src/classes/MovePlanner.cpp
+//   ./phase_error_check
+//
+// Exit status is 1 if the phase error of any step exceeds the latency
+// bound, or a step is lost, gained or taken backwards, on any run.
+
+#include "StepEngine.h"
+#include "VirtualStepTimer.h"
+#include <stdio.h>
+
+static const uint64_t DAY = 86400000000ULL;
+static const uint64_t RUN_DAYS = 30;
+static const uint32_t MAX_LATENCY_US = 150;
+static const uint64_t START = 5000;
+
+static int failures = 0;
+
+// Fires each shot a pseudo-random 0..MAX_LATENCY_US late
+class LateStepTimer : public VirtualStepTimer {
+public:
+    LateStepTimer() : seed(12345) {}
+
+    void fireAt(uint64_t whenMicros) override {
+        seed = seed * 1664525u + 1013904223u;
+        VirtualStepTimer::fireAt(whenMicros + (seed >> 8) % (MAX_LATENCY_US + 1));
+    }
+
+private:
+    uint32_t seed;
+};
+
+// Compares every step with the exact timeline as it happens
+class TimelineOutput : public StepOutput {
+public:
+    TimelineOutput(StepTimer* timer, uint64_t numerator, uint64_t denominator)
+        : timer(timer), numerator(numerator), denominator(denominator), steps(0), maxError(0), early(false),
+          backwards(false) {}
+
+    void step(int8_t direction) override {
+        // The rotation only ever steps forward
+        if (direction != 1) {
+            backwards = true;
+        }
+        uint64_t ideal = START + (uint64_t)((unsigned __int128)steps * numerator / denominator);
+        uint64_t now = timer->nowMicros();
+        if (now < ideal) {
+            early = true;
+        } else if (now - ideal > maxError) {
+            maxError = now - ideal;
+        }
+        steps++;
+    }
+
+    void release() override {}
+
+    StepTimer* timer;
+    uint64_t numerator;
+    uint64_t denominator;
+    uint64_t steps;
+    uint64_t maxError;
+    bool early;
+    bool backwards;
+};
+
+static void run(const char* name, uint64_t periodNumerator, uint64_t periodDenominator, uint64_t stepsPerPeriod) {
+    LateStepTimer timer;
+    uint64_t denominator = periodDenominator * stepsPerPeriod;
+    TimelineOutput output(&timer, periodNumerator, denominator);
+    StepEngine engine(&timer, &output);
+    engine.begin();
+    engine.setStepPeriod(periodNumerator, periodDenominator, stepsPerPeriod);
+    engine.setHoldTime(10000);
+    engine.startAt(START);
+
+    // A day at a time, as the firmware's log would see it
+    uint64_t worstDay = 0;
+    for (uint64_t day = 1; day <= RUN_DAYS; day++) {
+        engine.resetPhaseError();
+        timer.advanceTo(START + day * DAY);
+        if (engine.getMaxPhaseError() > worstDay) {
+            worstDay = engine.getMaxPhaseError();
+        }
+    }
+
+    // Steps due by the end: n with n * period / steps <= RUN_DAYS days
+    uint64_t due = (uint64_t)((unsigned __int128)(RUN_DAYS * DAY) * denominator / periodNumerator) + 1;
+    // The last due step may be waiting out its latency
+    bool counted = output.steps == due || output.steps + 1 == due;
+    bool bounded = !output.early && output.maxError <= MAX_LATENCY_US && worstDay == output.maxError;
+    bool passed = counted && bounded && !output.backwards && engine.getPosition() == (int32_t)output.steps;
+
+    printf("%-28s %10llu steps, max phase error %3llu us (engine %3llu us)  %s\n", name,
+           (unsigned long long)output.steps, (unsigned long long)output.maxError,
+           (unsigned long long)worstDay, passed ? "ok" : "FAILED");
+    failures += passed ? 0 : 1;
+}
+
+int main() {
+    printf("%llu days, up to %u us timer latency\n", (unsigned long long)RUN_DAYS, MAX_LATENCY_US);
+    // ONCE_PER_MINUTE: 29296.875 us a step
+    run("minute, 2048 steps", 60000000, 1, 2048);
+    // Sidereal day on a calibrated 2037.8864-step gear, as StepperController
+    // passes it: period * revolution denominator / revolution numerator
+    run("sidereal, 2037.8864 steps", 86164090530ULL * 10000, 1, 20378864);
+    // Lunar day, 4096 half steps
+    run("lunar, 4096 half steps", 89428328000ULL, 1, 4096);
+
+    printf("%s\n", failures ? "FAILED" : "all runs within bound");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+// Host check for src/classes/PlanetEphemeris: compares the Chebyshev table
+// evaluated in float against positions computed in double straight from
+// the elements by tools/gen_planet_table.py, and times an evaluation.
+//
+//   tools/gen_planet_table.py --check 20000 > /tmp/planet_vectors.txt
+//   g++ -std=gnu++17 -O2 -Isrc/classes -o planet_accuracy
+//       tools/planet_accuracy.cpp src/classes/PlanetEphemeris.cpp src/classes/AstroKernels.cpp
+//   ./planet_accuracy < /tmp/planet_vectors.txt
+//
+// Each input line is: unix seconds, planet, right ascension and declination
+// (radians), distance (au). Exit status is 1 if any position is off by
+// more than LIMIT_ARCSEC.
+
+#include "PlanetEphemeris.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <chrono>
+
+static const double LIMIT_ARCSEC = 2.0;
+static const int TIMING_CALLS = 200000;
+static const double ARCSEC = 180.0 * 3600.0 / M_PI;
+static const double AU_KM = 149597870.7;
+
+// Angle between two directions on the sphere, radians
+static double separation(double longitude1, double latitude1, double longitude2, double latitude2) {
+    double x = cos(latitude2) * sin(longitude2 - longitude1);
+    double y = cos(latitude1) * sin(latitude2) - sin(latitude1) * cos(latitude2) * cos(longitude2 - longitude1);
+    double z = sin(latitude1) * sin(latitude2) + cos(latitude1) * cos(latitude2) * cos(longitude2 - longitude1);
+    return atan2(sqrt(x * x + y * y), z);
+}
+
+static volatile float sink;
+
+int main() {
+    double maxError[PlanetEphemeris::PLANET_COUNT] = {};
+    double sumSquares[PlanetEphemeris::PLANET_COUNT] = {};
+    double maxDistance[PlanetEphemeris::PLANET_COUNT] = {};
+    int counts[PlanetEphemeris::PLANET_COUNT] = {};
+    int total = 0;
+
+    long long time;
+    int planet;
+    double rightAscension, declination, distance;
+    while (scanf("%lld %d %lf %lf %lf", &time, &planet, &rightAscension, &declination, &distance) == 5) {
+        if (planet < 0 || planet >= PlanetEphemeris::PLANET_COUNT) {
+            continue;
+        }
+        AstroKernels::Equatorial<float> position;
+        if (!PlanetEphemeris::position((PlanetEphemeris::Planet)planet, time, &position)) {
+            printf("%lld outside the table\n", time);
+            return 1;
+        }
+        double error = ARCSEC * separation(rightAscension, declination, position.rightAscension, position.declination);
+        maxError[planet] = fmax(maxError[planet], error);
+        sumSquares[planet] += error * error;
+        maxDistance[planet] = fmax(maxDistance[planet], fabs(position.distance / AU_KM - distance) / distance);
+        counts[planet]++;
+        total++;
+    }
+    if (total == 0) {
+        printf("No vectors; run tools/gen_planet_table.py --check N first\n");
+        return 1;
+    }
+
+    printf("%d positions, %lld..%lld\n\n", total, (long long)PlanetEphemeris::getFirstTime(),
+           (long long)PlanetEphemeris::getLastTime());
+    printf("%-8s %8s %12s %12s %14s\n", "", "samples", "max arcsec", "rms arcsec", "distance rel.");
+    bool failed = false;
+    for (int i = 0; i < PlanetEphemeris::PLANET_COUNT; i++) {
+        double rms = counts[i] > 0 ? sqrt(sumSquares[i] / counts[i]) : 0;
+        printf("%-8s %8d %12.3f %12.3f %14.2e%s\n", PlanetEphemeris::getName((PlanetEphemeris::Planet)i),
+               counts[i], maxError[i], rms, maxDistance[i], maxError[i] > LIMIT_ARCSEC ? "  OVER LIMIT" : "");
+        failed = failed || maxError[i] > LIMIT_ARCSEC;
+    }
+
+    // All five planets at times spread over the table
+    int64_t step = (PlanetEphemeris::getLastTime() - PlanetEphemeris::getFirstTime()) / TIMING_CALLS;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TIMING_CALLS; i++) {
+        AstroKernels::Equatorial<float> position;
+        PlanetEphemeris::position((PlanetEphemeris::Planet)(i % PlanetEphemeris::PLANET_COUNT),
+                                  PlanetEphemeris::getFirstTime() + i * step, &position);
+        sink = position.rightAscension;
+    }
+    double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / TIMING_CALLS;
+    printf("\nHost time per position: %.0f ns\n", nanos);
+
+    if (failed) {
+        printf("\nTable error over %.1f arcsec\n", LIMIT_ARCSEC);
+        return 1;
+    }
+    return 0;
+}
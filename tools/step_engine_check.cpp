@@ -0,0 +1,188 @@
+// Host check for src/classes/StepEngine on src/classes/VirtualStepTimer.h:
+// rotation steps must fire at anchor + floor(n * period / steps), each coil
+// release must come its hold time after a step and before the next one,
+// and a planned move must suspend the rotation, never step faster than the
+// motor can follow and hand back to it one interval later.
+//
+//   g++ -std=gnu++17 -O2 -Isrc/classes -o step_engine_check tools/step_engine_check.cpp src/classes/StepEngine.cpp src/classes/StepSchedule.cpp src/classes/MovePlanner.cpp
+//   ./step_engine_check
+//
+// Exit status is 1 if any case fails.
+
+#include "StepEngine.h"
+#include "VirtualStepTimer.h"
+#include <stdio.h>
+#include <vector>
+
+static const uint64_t MINUTE = 60000000;
+static const uint64_t STEPS = 2048;      // 28BYJ-48 full steps per revolution
+static const uint32_t MIN_INTERVAL = 2000; // StepEngine's MIN_STEP_INTERVAL_MICROS
+
+static int failures = 0;
+
+struct Event {
+    uint64_t at;
+    int8_t direction; // 0 for a release
+};
+
+// Logs what the engine drives, with the virtual time it happened at
+class RecordingOutput : public StepOutput {
+public:
+    RecordingOutput(VirtualStepTimer* timer) : timer(timer) {}
+
+    void step(int8_t direction) override {
+        events.push_back({timer->nowMicros(), direction});
+    }
+
+    void release() override {
+        events.push_back({timer->nowMicros(), 0});
+    }
+
+    std::vector<Event> events;
+
+private:
+    VirtualStepTimer* timer;
+};
+
+static void check(const char* name, bool passed) {
+    printf("%-40s %s\n", name, passed ? "ok" : "FAILED");
+    failures += passed ? 0 : 1;
+}
+
+// Each release follows a step by exactly the hold time and comes before
+// the next step; no two events share a time
+static bool releasesBetweenSteps(const std::vector<Event>& events, uint32_t hold) {
+    for (size_t i = 0; i < events.size(); i++) {
+        const Event& event = events[i];
+        if (event.direction == 0) {
+            if (i == 0 || events[i - 1].direction == 0 || event.at != events[i - 1].at + hold) {
+                return false;
+            }
+        } else if (i > 0 && events[i - 1].at >= event.at) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void checkRotation() {
+    VirtualStepTimer timer;
+    RecordingOutput output(&timer);
+    StepEngine engine(&timer, &output);
+    engine.begin();
+    engine.setStepPeriod(MINUTE, 1, STEPS); // 29296.875 us
+    engine.setHoldTime(10000);
+    timer.advanceTo(1000);
+    engine.start();
+    timer.advanceTo(1000 + 2 * MINUTE);
+
+    std::vector<Event> steps;
+    for (const Event& event : output.events) {
+        if (event.direction != 0) {
+            steps.push_back(event);
+        }
+    }
+    bool onTime = steps.size() == 2 * STEPS + 1;
+    for (size_t n = 0; onTime && n < steps.size(); n++) {
+        onTime = steps[n].direction == 1 && steps[n].at == 1000 + n * MINUTE / STEPS;
+    }
+    check("rotation steps at n * period / steps", onTime);
+    check("rotation release after each step", releasesBetweenSteps(output.events, 10000) &&
+                                              output.events.size() == 2 * steps.size() - 1);
+    check("rotation position and phase error", engine.getPosition() == (int32_t)steps.size() &&
+                                               engine.getMaxPhaseError() == 0);
+
+    // A hold longer than the interval keeps the coils on between steps;
+    // stop() releases them at once. The release after the last step still
+    // comes at the old hold time.
+    engine.setHoldTime(50000);
+    timer.advanceBy(10000);
+    output.events.clear();
+    timer.advanceBy(MINUTE);
+    bool held = output.events.size() == STEPS;
+    for (const Event& event : output.events) {
+        held = held && event.direction == 1;
+    }
+    uint64_t stoppedAt = timer.nowMicros();
+    engine.stop();
+    timer.advanceBy(MINUTE);
+    held = held && output.events.back().direction == 0 && output.events.back().at == stoppedAt &&
+           !timer.isArmed();
+    check("long hold stays energized, stop releases", held);
+}
+
+static void checkMove() {
+    VirtualStepTimer timer;
+    RecordingOutput output(&timer);
+    StepEngine engine(&timer, &output);
+    MovePlanner planner;
+    planner.setLimits(500, 500);
+    engine.begin();
+    engine.setStepPeriod(MINUTE, 1, STEPS);
+    engine.setHoldTime(10000);
+    engine.start();
+    timer.advanceTo(MINUTE / 2);
+
+    output.events.clear();
+    int32_t before = engine.getPosition();
+    const int32_t MOVE = -600;
+    bool planned = planner.plan(MOVE) && engine.startMove(&planner);
+    uint64_t movedAt = timer.nowMicros();
+    while (engine.isMoving()) {
+        timer.advanceBy(1000);
+    }
+    bool completed = false;
+    bool finished = engine.takeMoveFinished(&completed);
+
+    std::vector<Event> moveSteps;
+    for (const Event& event : output.events) {
+        if (event.direction != 0) {
+            moveSteps.push_back(event);
+        }
+    }
+    bool moved = planned && finished && completed && moveSteps.size() == (size_t)-MOVE &&
+                 engine.getPosition() == before + MOVE && moveSteps.front().at == movedAt;
+    uint64_t shortest = UINT64_MAX;
+    for (size_t n = 0; n < moveSteps.size(); n++) {
+        moved = moved && moveSteps[n].direction == -1;
+        if (n > 0 && moveSteps[n].at - moveSteps[n - 1].at < shortest) {
+            shortest = moveSteps[n].at - moveSteps[n - 1].at;
+        }
+    }
+    check("move steps in its direction", moved);
+    check("move never faster than 2 ms a step", shortest >= MIN_INTERVAL);
+    // The virtual timer fires on time, so only the engine's rounding remains
+    uint64_t took = moveSteps.back().at - moveSteps.front().at;
+    uint64_t duration = planner.getDurationMicros();
+    check("move follows the planned duration", took + 2 * MIN_INTERVAL >= duration && took <= duration + 2 * MIN_INTERVAL);
+
+    // The rotation resumes one interval after the last move step, and
+    // releases never land on a step
+    uint64_t lastMoveStep = moveSteps.back().at;
+    output.events.clear();
+    timer.advanceBy(MINUTE);
+    bool resumed = !output.events.empty() && output.events.front().direction == 0 &&
+                   output.events.front().at == lastMoveStep + 10000 &&
+                   output.events[1].direction == 1 &&
+                   output.events[1].at == lastMoveStep + MINUTE / STEPS &&
+                   releasesBetweenSteps(std::vector<Event>(output.events.begin() + 1, output.events.end()), 10000);
+    check("rotation resumes after the move", resumed);
+
+    // Cancelled half way: stops, reports not completed
+    planner.plan(400);
+    engine.startMove(&planner);
+    timer.advanceBy(300000);
+    int32_t done = engine.getMoveStepsDone();
+    engine.cancelMove();
+    finished = engine.takeMoveFinished(&completed);
+    check("cancelled move reports incomplete", finished && !completed && done > 0 && done < 400 &&
+                                               !engine.isMoving());
+}
+
+int main() {
+    checkRotation();
+    checkMove();
+
+    printf("%s\n", failures ? "FAILED" : "all cases pass");
+    return failures ? 1 : 0;
+}